@@ -0,0 +1,21 @@
+/// @file version.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_VERSION_H
+#define TLAPACK_VERSION_H
+
+// the configured options and settings for <T>LAPACK
+// clang-format off
+#define TLAPACK_VERSION 0.1.2
+#define TLAPACK_VERSION_MAJOR 0
+#define TLAPACK_VERSION_MINOR 1
+#define TLAPACK_VERSION_PATCH 2
+// clang-format on
+
+#endif  // TLAPACK_VERSION_H
@@ -0,0 +1,470 @@
+/// @file example_autotune.cpp
+/// @brief Sweeps the block sizes and crossover points of the blocked routines
+/// and writes a tuning profile.
+///
+/// Usage: example_autotune [profile] [n1 n2 ...]
+///
+/// The profile is written to `profile` (default: tlapack_tuning.txt) and can
+/// be loaded at startup by setting the environment variable
+/// TLAPACK_TUNING_PROFILE to its path. The parameters are tuned for each
+/// scalar type at the matrix sizes n1, n2, ... (default: 100 300 600). The
+/// value found at n_k is used for sizes between (n_{k-1} + n_k) / 2 and
+/// (n_k + n_{k+1}) / 2. The routines look these entries up when they are
+/// called with the parameter left as 0 (see tuned_option()). The parameters
+/// that the options structs read once, without knowing the type and size,
+/// only get type-independent entries, taken from double.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Plugins for <T>LAPACK (must come before <T>LAPACK headers)
+#include <tlapack/plugins/legacyArray.hpp>
+
+// <T>LAPACK
+#include <tlapack/base/tuning.hpp>
+#include <tlapack/lapack/bdsdc.hpp>
+#include <tlapack/lapack/gbtrf.hpp>
+#include <tlapack/lapack/gebrd.hpp>
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/gghd3.hpp>
+#include <tlapack/lapack/gttrf.hpp>
+#include <tlapack/lapack/gttrs.hpp>
+#include <tlapack/lapack/hetrd.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/laset.hpp>
+#include <tlapack/lapack/lauum_recursive.hpp>
+#include <tlapack/lapack/multishift_qr.hpp>
+#include <tlapack/lapack/pbtrf.hpp>
+#include <tlapack/lapack/potrf.hpp>
+#include <tlapack/lapack/pttrf.hpp>
+#include <tlapack/lapack/pttrs.hpp>
+#include <tlapack/lapack/stedc.hpp>
+#include <tlapack/lapack/trmm_blocked_mixed.hpp>
+#include <tlapack/lapack/trtri_recursive.hpp>
+
+// C++ headers
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace tlapack;
+
+//------------------------------------------------------------------------------
+/// Best time, in seconds, of a few runs of f(). Each run is preceded by a call
+/// to reset(), which is not timed.
+double best_time(const std::function<void()>& reset,
+                 const std::function<void()>& f)
+{
+    double best = 0;
+    for (int run = 0; run < 3; ++run) {
+        reset();
+        const auto start = std::chrono::high_resolution_clock::now();
+        f();
+        const auto end = std::chrono::high_resolution_clock::now();
+        const double t = std::chrono::duration<double>(end - start).count();
+        if (run == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+/// Candidate with the smallest time
+size_t sweep(const std::vector<size_t>& candidates,
+             const std::function<double(size_t)>& time_of)
+{
+    size_t best = candidates[0];
+    double tbest = -1;
+    for (size_t c : candidates) {
+        const double t = time_of(c);
+        if (tbest < 0 || t < tbest) {
+            tbest = t;
+            best = c;
+        }
+    }
+    return best;
+}
+
+//------------------------------------------------------------------------------
+/// Tunes the parameters of the blocked routines for scalar type T and matrix
+/// size n. Calls record(routine, param, value) for each parameter.
+template <typename T>
+void tune(size_t n,
+          const std::function<void(const std::string&,
+                                   const std::string&,
+                                   size_t)>& record)
+{
+    using matrix_t = LegacyMatrix<T>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<LegacyMatrix<real_t>> new_rmatrix;
+
+    const std::vector<size_t> nbs = {8, 16, 32, 48, 64, 96, 128};
+    const std::vector<size_t> nxs = {32, 64, 128, 256};
+
+    // Random matrix and a copy that is overwritten by each run
+    std::mt19937 gen(n);
+    std::uniform_real_distribution<real_t> dist(-1, 1);
+    std::vector<T> A0_, A_, B0_, B_, Q_, Z_;
+    auto A0 = new_matrix(A0_, n, n);
+    auto A = new_matrix(A_, n, n);
+    auto B0 = new_matrix(B0_, n, n);
+    auto B = new_matrix(B_, n, n);
+    auto Q = new_matrix(Q_, n, n);
+    auto Z = new_matrix(Z_, n, n);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i) {
+            if constexpr (is_complex<T>)
+                A0(i, j) = T(dist(gen), dist(gen));
+            else
+                A0(i, j) = dist(gen);
+            B0(i, j) = (i <= j) ? A0(i, j) : T(0);
+        }
+    std::vector<T> tau(n), tauw(n);
+    const auto reset = [&]() { lacpy(GENERAL, A0, A); };
+
+    // geqrf
+    record("geqrf", "nb", sweep(nbs, [&](size_t nb) {
+               GeqrfOpts opts;
+               opts.nb = nb;
+               return best_time(reset, [&]() { geqrf(A, tau, opts); });
+           }));
+
+    // getrf with the blocked variant
+    {
+        std::vector<idx_t> piv(n);
+        record("getrf", "nb", sweep(nbs, [&](size_t nb) {
+                   GetrfOpts opts;
+                   opts.variant = GetrfVariant::Blocked;
+                   opts.nb = nb;
+                   return best_time(reset, [&]() { getrf(A, piv, opts); });
+               }));
+    }
+
+    // gebrd
+    record("gebrd", "nb", sweep(nbs, [&](size_t nb) {
+               GebrdOpts opts;
+               opts.nb = nb;
+               return best_time(reset,
+                                [&]() { gebrd(A, tau, tauw, opts); });
+           }));
+
+    // gehrd
+    GehrdOpts gehrdOpts;
+    gehrdOpts.nb = sweep(nbs, [&](size_t nb) {
+        gehrdOpts.nb = nb;
+        return best_time(reset, [&]() { gehrd(0, n, A, tau, gehrdOpts); });
+    });
+    gehrdOpts.nx_switch = sweep(nxs, [&](size_t nx) {
+        gehrdOpts.nx_switch = nx;
+        return best_time(reset, [&]() { gehrd(0, n, A, tau, gehrdOpts); });
+    });
+    record("gehrd", "nb", gehrdOpts.nb);
+    record("gehrd", "nx_switch", gehrdOpts.nx_switch);
+
+    // hetrd and stedc use the Hermitian part of A0
+    std::vector<T> H0_;
+    auto H0 = new_matrix(H0_, n, n);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            H0(i, j) = (i == j) ? T(real(A0(i, i)) + real_t(n))
+                                : (A0(i, j) + conj(A0(j, i)));
+    const auto resetH = [&]() { lacpy(GENERAL, H0, A); };
+
+    // potrf
+    record("potrf", "nb", sweep(nbs, [&](size_t nb) {
+               PotrfOpts opts;
+               opts.nb = nb;
+               return best_time(resetH,
+                                [&]() { potrf(LOWER_TRIANGLE, A, opts); });
+           }));
+
+    // pbtrf and gbtrf on n-by-n band matrices with kd = n/4 off-diagonals in
+    // compact storage. nx = 1 forces the blocked code
+    {
+        const idx_t kd = max(idx_t(1), n / 4);
+        std::vector<T> PB0_((kd + 1) * n), GB0_((3 * kd + 1) * n);
+        std::vector<T> PB_(PB0_.size()), GB_(GB0_.size());
+        LegacyBandedMatrix<T, idx_t> PB0(n, n, kd, 0, PB0_.data());
+        LegacyBandedMatrix<T, idx_t> GB0(n, n, kd, 2 * kd, GB0_.data());
+        LegacyBandedMatrix<T, idx_t> PB(n, n, kd, 0, PB_.data());
+        LegacyBandedMatrix<T, idx_t> GB(n, n, kd, 2 * kd, GB_.data());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = (j > kd) ? j - kd : 0; i < min(n, j + kd + 1); ++i) {
+                GB0(i, j) = A0(i, j);
+                if (i >= j)
+                    PB0(i, j) = (i == j) ? T(real_t(2 * kd + 1)) : A0(i, j);
+            }
+        std::vector<idx_t> piv(n);
+
+        record("pbtrf", "nb", sweep(nbs, [&](size_t nb) {
+                   PbtrfOpts opts;
+                   opts.nb = nb;
+                   opts.nx = 1;
+                   return best_time([&]() { PB_ = PB0_; },
+                                    [&]() { pbtrf(LOWER_TRIANGLE, PB, opts); });
+               }));
+        record("gbtrf", "nb", sweep(nbs, [&](size_t nb) {
+                   GbtrfOpts opts;
+                   opts.nb = nb;
+                   opts.nx = 1;
+                   return best_time([&]() { GB_ = GB0_; },
+                                    [&]() { gbtrf(GB, piv, opts); });
+               }));
+    }
+
+    // pttrs and gttrs with the n columns of A0 as right-hand sides. nb is the
+    // number of columns in each sweep of the recurrences
+    {
+        std::vector<T> D(n, T(real_t(4))), E(n - 1, T(1));
+        std::vector<T> DL(n - 1, T(1)), DG(n, T(real_t(4))), DU(n - 1, T(1));
+        std::vector<T> DU2(max(n, idx_t(2)) - 2);
+        std::vector<idx_t> piv(n);
+        pttrf(D, E);
+        gttrf(DL, DG, DU, DU2, piv);
+
+        record("pttrs", "nb", sweep(nbs, [&](size_t nb) {
+                   PttrsOpts opts;
+                   opts.nb = nb;
+                   return best_time(resetH, [&]() { pttrs(D, E, A, opts); });
+               }));
+        record("gttrs", "nb", sweep(nbs, [&](size_t nb) {
+                   GttrsOpts opts;
+                   opts.nb = nb;
+                   return best_time(resetH, [&]() {
+                       gttrs(NO_TRANS, DL, DG, DU, DU2, piv, A, opts);
+                   });
+               }));
+    }
+
+    // trtri and lauum on the upper triangle of A0, which is kept in B0. nx is
+    // the crossover between the recursion and the level-2 routines
+    const std::vector<size_t> nxs2 = {1, 16, 32, 64, 128, 256};
+    const auto resetB = [&]() { lacpy(GENERAL, B0, A); };
+    record("trtri", "nx", sweep(nxs2, [&](size_t nx) {
+               TrtriOpts opts;
+               opts.nx = nx;
+               return best_time(resetB, [&]() {
+                   trtri_recursive(UPPER_TRIANGLE, NON_UNIT_DIAG, A, opts);
+               });
+           }));
+    record("lauum", "nx", sweep(nxs2, [&](size_t nx) {
+               LauumOpts opts;
+               opts.nx = nx;
+               return best_time(resetB, [&]() {
+                   lauum_recursive(UPPER_TRIANGLE, A, opts);
+               });
+           }));
+
+    // hetrd
+    HetrdOpts hetrdOpts;
+    hetrdOpts.nb = sweep(nbs, [&](size_t nb) {
+        hetrdOpts.nb = nb;
+        return best_time(resetH,
+                         [&]() { hetrd(LOWER_TRIANGLE, A, tau, hetrdOpts); });
+    });
+    hetrdOpts.nx_switch = sweep(nxs, [&](size_t nx) {
+        hetrdOpts.nx_switch = nx;
+        return best_time(resetH,
+                         [&]() { hetrd(LOWER_TRIANGLE, A, tau, hetrdOpts); });
+    });
+    record("hetrd", "nb", hetrdOpts.nb);
+    record("hetrd", "nx_switch", hetrdOpts.nx_switch);
+
+    // stedc on the tridiagonal matrix of H0
+    {
+        std::vector<real_t> d0(n), e0(n), d(n), e(n);
+        std::vector<real_t> Zr_;
+        auto Zr = new_rmatrix(Zr_, n, n);
+        lacpy(GENERAL, H0, A);
+        hetrd(LOWER_TRIANGLE, A, tau, hetrdOpts);
+        for (idx_t i = 0; i < n; ++i)
+            d0[i] = real(A(i, i));
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e0[i] = real(A(i + 1, i));
+        const auto resetT = [&]() {
+            d = d0;
+            e = e0;
+            laset(GENERAL, real_t(0), real_t(1), Zr);
+        };
+        record("stedc", "nmin", sweep({16, 25, 50, 100}, [&](size_t nmin) {
+                   StedcOpts opts;
+                   opts.nmin = nmin;
+                   return best_time(resetT,
+                                    [&]() { stedc(true, d, e, Zr, opts); });
+               }));
+    }
+
+    // bdsdc on the bidiagonal matrix of A0
+    {
+        std::vector<real_t> d0(n), e0(n), d(n), e(n);
+        std::vector<real_t> Ur_, Vtr_;
+        auto Ur = new_rmatrix(Ur_, n, n);
+        auto Vtr = new_rmatrix(Vtr_, n, n);
+        reset();
+        gebrd(A, tau, tauw);
+        for (idx_t i = 0; i < n; ++i)
+            d0[i] = real(A(i, i));
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e0[i] = real(A(i, i + 1));
+        const auto resetBd = [&]() {
+            d = d0;
+            e = e0;
+            laset(GENERAL, real_t(0), real_t(1), Ur);
+            laset(GENERAL, real_t(0), real_t(1), Vtr);
+        };
+        record("bdsdc", "nmin", sweep({16, 25, 50, 100}, [&](size_t nmin) {
+                   BdsdcOpts opts;
+                   opts.nmin = nmin;
+                   return best_time(resetBd, [&]() {
+                       bdsdc(UPPER_TRIANGLE, true, true, d, e, Ur, Vtr, opts);
+                   });
+               }));
+    }
+
+    // trmm_blocked_mixed with an upper triangular matrix
+    record("trmm_blocked", "nb", sweep(nbs, [&](size_t nb) {
+               TrmmBlockedOpts opts;
+               opts.nb = nb;
+               std::vector<T> W_;
+               auto W = new_matrix(W_, std::min(nb, n), n);
+               return best_time(reset, [&]() {
+                   trmm_blocked_mixed(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS,
+                                      NON_UNIT_DIAG, T(1), B0, A, W, opts);
+               });
+           }));
+
+    // gghd3 with B0 upper triangular
+    const auto resetAB = [&]() {
+        lacpy(GENERAL, A0, A);
+        lacpy(GENERAL, B0, B);
+        laset(GENERAL, T(0), T(1), Q);
+        laset(GENERAL, T(0), T(1), Z);
+    };
+    record("gghd3", "nb", sweep(nbs, [&](size_t nb) {
+               Gghd3Opts opts;
+               opts.nb = nb;
+               return best_time(resetAB, [&]() {
+                   gghd3(true, true, 0, n, A, B, Q, Z, opts);
+               });
+           }));
+
+    // multishift_qr on the Hessenberg form of A0
+    {
+        std::vector<T> Hs_;
+        auto Hs = new_matrix(Hs_, n, n);
+        std::vector<std::complex<real_t>> w(n);
+        lacpy(GENERAL, A0, Hs);
+        gehrd(0, n, Hs, tau, gehrdOpts);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                Hs(i, j) = T(0);
+        const auto resetHs = [&]() {
+            lacpy(GENERAL, Hs, A);
+            laset(GENERAL, T(0), T(1), Q);
+        };
+        FrancisOpts francisOpts;
+        francisOpts.nmin = sweep({30, 50, 75, 100, 150}, [&](size_t nmin) {
+            francisOpts.nmin = nmin;
+            return best_time(resetHs, [&]() {
+                multishift_qr(true, true, 0, n, A, w, Q, francisOpts);
+            });
+        });
+        record("multishift_qr", "nmin", francisOpts.nmin);
+        francisOpts.nibble = sweep({7, 14, 25, 50}, [&](size_t nibble) {
+            francisOpts.nibble = nibble;
+            return best_time(resetHs, [&]() {
+                multishift_qr(true, true, 0, n, A, w, Q, francisOpts);
+            });
+        });
+        record("multishift_qr", "nibble", francisOpts.nibble);
+
+        const size_t ns0 = francisOpts.nshift_recommender(n, n);
+        std::vector<size_t> nss;
+        for (size_t ns : {ns0 / 2, ns0, 2 * ns0})
+            if (ns >= 2) nss.push_back(ns - ns % 2);
+        record("multishift_qr", "nshift", sweep(nss, [&](size_t ns) {
+                   francisOpts.nshift_recommender = [ns](size_t, size_t) {
+                       return ns;
+                   };
+                   return best_time(resetHs, [&]() {
+                       multishift_qr(true, true, 0, n, A, w, Q, francisOpts);
+                   });
+               }));
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Tunes all sizes for scalar type T and stores the results in profile
+template <typename T>
+void tune_all_sizes(const std::vector<size_t>& sizes, TuningProfile& profile)
+{
+    const std::string type = tuning_type<T>();
+    for (size_t k = 0; k < sizes.size(); ++k) {
+        const size_t nstart = (k == 0) ? 0 : (sizes[k - 1] + sizes[k]) / 2;
+        const bool isDefault = (type == "d") && (k + 1 == sizes.size());
+
+        std::cout << "Tuning type " << type << " with n = " << sizes[k]
+                  << std::endl;
+        tune<T>(sizes[k], [&](const std::string& routine,
+                              const std::string& param, size_t value) {
+            std::cout << "  " << routine << "." << param << " = " << value
+                      << std::endl;
+            // The number of shifts is looked up by size in the
+            // type-independent entries, which are taken from double
+            if (param == "nshift") {
+                if (type == "d")
+                    profile.set(routine, param, "*", nstart, value);
+                return;
+            }
+            // The block size of trmm_blocked_mixed() sizes the workspace of
+            // the caller, and the crossover point and the nibble threshold
+            // of multishift_qr() are read by the options struct, so only
+            // their defaults are used
+            if (routine != "trmm_blocked" && routine != "multishift_qr")
+                profile.set(routine, param, type, nstart, value);
+            if (isDefault) profile.set(routine, param, "*", 0, value);
+        });
+    }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    const std::string filename =
+        (argc > 1) ? std::string(argv[1]) : "tlapack_tuning.txt";
+    std::vector<size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {100, 300, 600};
+    std::sort(sizes.begin(), sizes.end());
+
+    // Do not let an existing profile change the options during the sweeps
+    tuning_profile().clear();
+
+    TuningProfile profile;
+    tune_all_sizes<float>(sizes, profile);
+    tune_all_sizes<double>(sizes, profile);
+    tune_all_sizes<std::complex<float>>(sizes, profile);
+    tune_all_sizes<std::complex<double>>(sizes, profile);
+
+    if (!profile.save(filename)) {
+        std::cerr << "Could not write " << filename << std::endl;
+        return 1;
+    }
+    std::cout << "Profile written to " << filename << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/// @file example_recursive_nx.cpp
+/// @brief Reports the time of trtri_recursive() and lauum_recursive() versus
+/// the crossover nx to the level-2 routines trti2() and lauu2().
+///
+/// Usage: example_recursive_nx [n1 n2 ...]
+///
+/// For each matrix size n1, n2, ... (default: 100 300 600), prints one line
+/// per value of nx with the best time of each routine in double precision.
+/// nx = 1 recurses down to 1-by-1 blocks and nx = n calls the level-2 routines
+/// on the whole matrix.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Plugins for <T>LAPACK (must come before <T>LAPACK headers)
+#include <tlapack/plugins/legacyArray.hpp>
+
+// <T>LAPACK
+#include <tlapack/base/utils.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lauum_recursive.hpp>
+#include <tlapack/lapack/trtri_recursive.hpp>
+
+// C++ headers
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace tlapack;
+
+//------------------------------------------------------------------------------
+/// Best time, in seconds, of a few runs of f(). Each run is preceded by a call
+/// to reset(), which is not timed.
+double best_time(const std::function<void()>& reset,
+                 const std::function<void()>& f)
+{
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        reset();
+        const auto start = std::chrono::high_resolution_clock::now();
+        f();
+        const auto end = std::chrono::high_resolution_clock::now();
+        const double t = std::chrono::duration<double>(end - start).count();
+        if (run == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void run(size_t n)
+{
+    using matrix_t = LegacyMatrix<T>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Upper triangular matrix with a dominant diagonal, so that its inverse
+    // is well conditioned, and a copy that is overwritten by each run
+    std::mt19937 gen(n);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    std::vector<T> A0_, A_;
+    auto A0 = new_matrix(A0_, n, n);
+    auto A = new_matrix(A_, n, n);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A0(i, j) = (i < j) ? dist(gen) : (i == j) ? T(n) : T(0);
+    const auto reset = [&]() { lacpy(GENERAL, A0, A); };
+
+    std::printf("n = %zu\n", n);
+    std::printf("%8s %14s %14s\n", "nx", "trtri (s)", "lauum (s)");
+    std::vector<size_t> nxs = {1, 8, 16, 32, 64, 128, 256, 512};
+    while (!nxs.empty() && nxs.back() >= n)
+        nxs.pop_back();
+    nxs.push_back(n);
+    for (size_t nx : nxs) {
+        TrtriOpts trtriOpts;
+        trtriOpts.nx = nx;
+        const double t1 = best_time(reset, [&]() {
+            trtri_recursive(UPPER_TRIANGLE, NON_UNIT_DIAG, A, trtriOpts);
+        });
+
+        LauumOpts lauumOpts;
+        lauumOpts.nx = nx;
+        const double t2 = best_time(
+            reset, [&]() { lauum_recursive(UPPER_TRIANGLE, A, lauumOpts); });
+
+        std::printf("%8zu %14.6e %14.6e\n", nx, t1, t2);
+    }
+    std::printf("\n");
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {100, 300, 600};
+
+    for (size_t n : sizes)
+        run<double>(n);
+
+    return 0;
+}
@@ -63,6 +63,7 @@
 // =============================================================================
 // Template LAPACK
 
+#include "tlapack/lapack/trti2.hpp"
 #include "tlapack/lapack/trtri_recursive.hpp"
 
 // Auxiliary routines
@@ -84,6 +85,7 @@
 #include "tlapack/lapack/lascl.hpp"
 #include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/lassq.hpp"
+#include "tlapack/lapack/lauu2.hpp"
 #include "tlapack/lapack/lauum_recursive.hpp"
 #include "tlapack/lapack/lu_mult.hpp"
 #include "tlapack/lapack/rscl.hpp"
@@ -112,9 +114,14 @@
 // Solution of positive definite systems
 // ----------------
 
+#include "tlapack/lapack/pbtrf.hpp"
+#include "tlapack/lapack/pbtrs.hpp"
 #include "tlapack/lapack/potrf.hpp"
 #include "tlapack/lapack/potrs.hpp"
+#include "tlapack/lapack/ptsv.hpp"
+#include "tlapack/lapack/ptsv_partitioned.hpp"
 #include "tlapack/lapack/pttrf.hpp"
+#include "tlapack/lapack/pttrs.hpp"
 
 // Solution of symmetric systems
 // ----------------
@@ -148,7 +155,11 @@
 // LU
 // ----------------
 
+#include "tlapack/lapack/gbtrf.hpp"
+#include "tlapack/lapack/gbtrs.hpp"
 #include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/gttrf.hpp"
+#include "tlapack/lapack/gttrs.hpp"
 
 // UL in place, where L and U are coming from the LU factorization of a matrix
 // ----------------
@@ -23,6 +23,9 @@ namespace tlapack {
  * This class does not perform such a check,
  * otherwise it would lack in performance.
  *
+ * The bands may be wider than the matrix. This is the case, e.g., of the
+ * kl extra superdiagonals that hold the fill-in of gbtrf().
+ *
  * @tparam T Floating-point type
  * @tparam idx_t Index type
  */
@@ -66,7 +69,8 @@ struct LegacyBandedMatrix {
     {
         tlapack_check(m >= 0);
         tlapack_check(n >= 0);
-        tlapack_check((kl + 1 <= m || m == 0) && (ku + 1 <= n || n == 0));
+        tlapack_check(kl >= 0);
+        tlapack_check(ku >= 0);
     }
 };
 
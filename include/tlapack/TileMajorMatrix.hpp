@@ -0,0 +1,263 @@
+/// @file TileMajorMatrix.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TILE_MAJOR_MATRIX_HH
+#define TLAPACK_TILE_MAJOR_MATRIX_HH
+
+#include <cassert>
+
+#include "tlapack/LegacyMatrix.hpp"
+#include "tlapack/base/exceptionHandling.hpp"
+#include "tlapack/base/types.hpp"
+
+namespace tlapack {
+
+/** Matrix stored in tile-major order.
+ *
+ * The matrix is partitioned into tiles of size mb-by-nb. Each tile is stored
+ * contiguously in column-major order, and the tiles are stored in
+ * column-major order, i.e., the tile (I,J) starts at ptr + I*mb*nb + J*ldt.
+ * The tiles in the last block row and block column are padded to the full
+ * size, so that a m-by-n matrix needs storage_size(m,n,mb,nb) entries.
+ *
+ * Every tile is a column-major matrix with leading dimension mb that does
+ * not alias any other tile. This avoids the cache and TLB conflicts of large
+ * power-of-two leading dimensions, and blocked algorithms may work directly on
+ * the tiles, see tile() and block().
+ *
+ * A view of a submatrix keeps the tiling of the original matrix. In this
+ * case, the entry (0,0) of the view is the entry (i0,j0) of the tile pointed
+ * by ptr.
+ *
+ * @tparam T Floating-point type
+ * @tparam idx_t Index type
+ */
+template <class T, class idx_t = std::size_t>
+struct TileMajorMatrix {
+    idx_t m, n;    ///< Sizes
+    T* ptr;        ///< Pointer to the tile that contains the entry (0,0)
+    idx_t mb, nb;  ///< Sizes of the tiles
+    idx_t ldt;     ///< Distance between two consecutive block columns
+    idx_t i0, j0;  ///< Position of the entry (0,0) inside its tile
+
+    static constexpr Layout layout = Layout::TileMajor;
+
+    /// Number of entries needed to store a m-by-n matrix with mb-by-nb tiles
+    static constexpr idx_t storage_size(idx_t m,
+                                        idx_t n,
+                                        idx_t mb,
+                                        idx_t nb) noexcept
+    {
+        return ((m + mb - 1) / mb) * ((n + nb - 1) / nb) * mb * nb;
+    }
+
+    constexpr const T& operator()(idx_t i, idx_t j) const noexcept
+    {
+        assert(i >= 0);
+        assert(i < m);
+        assert(j >= 0);
+        assert(j < n);
+        return ptr[offset(i, j)];
+    }
+
+    constexpr T& operator()(idx_t i, idx_t j) noexcept
+    {
+        assert(i >= 0);
+        assert(i < m);
+        assert(j >= 0);
+        assert(j < n);
+        return ptr[offset(i, j)];
+    }
+
+    /// Number of block rows
+    constexpr idx_t mt() const noexcept
+    {
+        return (m > 0) ? (i0 + m - 1) / mb + 1 : 0;
+    }
+
+    /// Number of block columns
+    constexpr idx_t nt() const noexcept
+    {
+        return (n > 0) ? (j0 + n - 1) / nb + 1 : 0;
+    }
+
+    /// End of the block row that contains the row i
+    constexpr idx_t tile_row_end(idx_t i) const noexcept
+    {
+        const idx_t r = ((i0 + i) / mb + 1) * mb - i0;
+        return (r < m) ? r : m;
+    }
+
+    /// End of the block column that contains the column j
+    constexpr idx_t tile_col_end(idx_t j) const noexcept
+    {
+        const idx_t c = ((j0 + j) / nb + 1) * nb - j0;
+        return (c < n) ? c : n;
+    }
+
+    /// Submatrix (ia:ib, ja:jb) with the same tiling
+    constexpr TileMajorMatrix<const T, idx_t> view(idx_t ia,
+                                                   idx_t ib,
+                                                   idx_t ja,
+                                                   idx_t jb) const noexcept
+    {
+        const idx_t i = i0 + ia;
+        const idx_t j = j0 + ja;
+        return TileMajorMatrix<const T, idx_t>(
+            ib - ia, jb - ja, ptr + (i / mb) * mb * nb + (j / nb) * ldt, mb,
+            nb, ldt, i % mb, j % nb);
+    }
+
+    /// @copydoc view()
+    constexpr TileMajorMatrix view(idx_t ia,
+                                   idx_t ib,
+                                   idx_t ja,
+                                   idx_t jb) noexcept
+    {
+        const idx_t i = i0 + ia;
+        const idx_t j = j0 + ja;
+        return TileMajorMatrix(ib - ia, jb - ja,
+                               ptr + (i / mb) * mb * nb + (j / nb) * ldt, mb,
+                               nb, ldt, i % mb, j % nb);
+    }
+
+    /// Submatrix (ia:ib, ja:jb) that lies inside a single tile, as a
+    /// column-major matrix
+    constexpr LegacyMatrix<const T, idx_t> block(idx_t ia,
+                                                 idx_t ib,
+                                                 idx_t ja,
+                                                 idx_t jb) const noexcept
+    {
+        assert(ia >= ib || tile_row_end(ia) >= ib);
+        assert(ja >= jb || tile_col_end(ja) >= jb);
+        return LegacyMatrix<const T, idx_t>(ib - ia, jb - ja,
+                                            ptr + offset(ia, ja), mb);
+    }
+
+    /// @copydoc block()
+    constexpr LegacyMatrix<T, idx_t> block(idx_t ia,
+                                           idx_t ib,
+                                           idx_t ja,
+                                           idx_t jb) noexcept
+    {
+        assert(ia >= ib || tile_row_end(ia) >= ib);
+        assert(ja >= jb || tile_col_end(ja) >= jb);
+        return LegacyMatrix<T, idx_t>(ib - ia, jb - ja, ptr + offset(ia, ja),
+                                      mb);
+    }
+
+    /// Part of the tile (I,J) that belongs to the matrix, as a column-major
+    /// matrix
+    constexpr LegacyMatrix<const T, idx_t> tile(idx_t I, idx_t J) const noexcept
+    {
+        assert(I >= 0 && I < mt());
+        assert(J >= 0 && J < nt());
+        const idx_t ia = (I > 0) ? I * mb - i0 : 0;
+        const idx_t ja = (J > 0) ? J * nb - j0 : 0;
+        return block(ia, tile_row_end(ia), ja, tile_col_end(ja));
+    }
+
+    /// @copydoc tile()
+    constexpr LegacyMatrix<T, idx_t> tile(idx_t I, idx_t J) noexcept
+    {
+        assert(I >= 0 && I < mt());
+        assert(J >= 0 && J < nt());
+        const idx_t ia = (I > 0) ? I * mb - i0 : 0;
+        const idx_t ja = (J > 0) ? J * nb - j0 : 0;
+        return block(ia, tile_row_end(ia), ja, tile_col_end(ja));
+    }
+
+    constexpr TileMajorMatrix(idx_t m,
+                              idx_t n,
+                              T* ptr,
+                              idx_t mb,
+                              idx_t nb,
+                              idx_t ldt,
+                              idx_t i0,
+                              idx_t j0)
+        : m(m), n(n), ptr(ptr), mb(mb), nb(nb), ldt(ldt), i0(i0), j0(j0)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(mb > 0);
+        tlapack_check(nb > 0);
+        tlapack_check(i0 >= 0 && i0 < mb);
+        tlapack_check(j0 >= 0 && j0 < nb);
+        tlapack_check(ldt >= ((i0 + m + mb - 1) / mb) * mb * nb);
+    }
+
+    constexpr TileMajorMatrix(idx_t m, idx_t n, T* ptr, idx_t mb, idx_t nb)
+        : m(m),
+          n(n),
+          ptr(ptr),
+          mb(mb),
+          nb(nb),
+          ldt(((m + mb - 1) / mb) * mb * nb),
+          i0(0),
+          j0(0)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(mb > 0);
+        tlapack_check(nb > 0);
+    }
+
+   private:
+    constexpr idx_t offset(idx_t i, idx_t j) const noexcept
+    {
+        const idx_t I = i0 + i;
+        const idx_t J = j0 + j;
+        return (I / mb) * mb * nb + (J / nb) * ldt + (I % mb) + (J % nb) * mb;
+    }
+};
+
+/** Vector view of a TileMajorMatrix.
+ *
+ * The i-th entry of the vector is the entry (i0 + i*di, j0 + i*dj) of the
+ * matrix A. Rows, columns and diagonals of a TileMajorMatrix are represented
+ * this way.
+ *
+ * @tparam T Floating-point type
+ * @tparam idx_t Index type
+ */
+template <class T, class idx_t = std::size_t>
+struct TileMajorVector {
+    TileMajorMatrix<T, idx_t> A;  ///< Matrix
+    idx_t n;                      ///< Size
+    idx_t i0, j0;                 ///< Position of the first entry in A
+    idx_t di, dj;                 ///< Increments in the rows and columns of A
+
+    constexpr const T& operator[](idx_t i) const noexcept
+    {
+        assert(i >= 0);
+        assert(i < n);
+        return A(i0 + i * di, j0 + i * dj);
+    }
+
+    constexpr T& operator[](idx_t i) noexcept
+    {
+        assert(i >= 0);
+        assert(i < n);
+        return A(i0 + i * di, j0 + i * dj);
+    }
+
+    constexpr TileMajorVector(const TileMajorMatrix<T, idx_t>& A,
+                              idx_t n,
+                              idx_t i0,
+                              idx_t j0,
+                              idx_t di,
+                              idx_t dj)
+        : A(A), n(n), i0(i0), j0(j0), di(di), dj(dj)
+    {
+        tlapack_check_false(n < 0);
+    }
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TILE_MAJOR_MATRIX_HH
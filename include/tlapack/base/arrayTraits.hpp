@@ -76,6 +76,24 @@ namespace traits {
         static constexpr Layout value = Layout::Unspecified;
     };
 
+    /**
+     * @brief Trait to determine the sizes of a given data structure that are
+     * known at compile time.
+     *
+     * The sizes are defined on @c static_size_trait<array_t,int>::nrows and
+     * @c static_size_trait<array_t,int>::ncols. A size of -1 means that it is
+     * only known at runtime. Use the tlapack::static_nrows and
+     * tlapack::static_ncols aliases instead.
+     *
+     * @tparam array_t Data structure.
+     * @tparam class If this is not an int, then the trait is not defined.
+     */
+    template <class array_t, class = int>
+    struct static_size_trait {
+        static constexpr int nrows = -1;
+        static constexpr int ncols = -1;
+    };
+
     /**
      * @brief Functor for data creation
      *
@@ -101,8 +119,10 @@ namespace traits {
          *
          * @return The new m-by-n matrix
          */
-        template <class T, class idx_t>
-        constexpr auto operator()(std::vector<T>& v, idx_t m, idx_t n = 1) const
+        template <class T, class idx_t, class Alloc>
+        constexpr auto operator()(std::vector<T, Alloc>& v,
+                                  idx_t m,
+                                  idx_t n = 1) const
         {
             return matrix_t();
         }
@@ -117,8 +137,8 @@ namespace traits {
          *
          * @return The new vector of size n
          */
-        template <class T, class idx_t>
-        constexpr auto operator()(std::vector<T>& v, idx_t n) const
+        template <class T, class idx_t, class Alloc>
+        constexpr auto operator()(std::vector<T, Alloc>& v, idx_t n) const
         {
             return matrix_t();
         }
@@ -231,6 +251,19 @@ using size_type = typename traits::size_type_trait<T, int>::type;
 template <class array_t>
 constexpr Layout layout = traits::layout_trait<array_t, int>::value;
 
+/// Number of rows of a matrix known at compile time, or -1.
+template <class array_t>
+constexpr int static_nrows = traits::static_size_trait<array_t, int>::nrows;
+
+/// Number of columns of a matrix known at compile time, or -1.
+template <class array_t>
+constexpr int static_ncols = traits::static_size_trait<array_t, int>::ncols;
+
+/// True if both sizes of a matrix are known at compile time.
+template <class array_t>
+constexpr bool has_static_size =
+    (static_nrows<array_t> >= 0) && (static_ncols<array_t> >= 0);
+
 /**
  * @brief Alias for @c traits::CreateFunctor<,int>.
  *
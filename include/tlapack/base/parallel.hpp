@@ -0,0 +1,268 @@
+/// @file parallel.hpp
+/// @brief Thread pool and execution policy used in the parallel regions of
+/// the blocked routines.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PARALLEL_HH
+#define TLAPACK_PARALLEL_HH
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tlapack {
+
+/**
+ * @brief Fixed-size pool of worker threads.
+ *
+ * The pool executes loops of independent tasks through parallel_for(). The
+ * calling thread always takes part in the loop, so that a pool with p workers
+ * runs up to p+1 tasks simultaneously. Loops may be nested: a task may call
+ * parallel_for() on the same pool without risk of deadlock.
+ */
+class ThreadPool {
+   public:
+    /**
+     * @brief Construct a pool of nworkers threads.
+     *
+     * @param[in] nworkers Number of worker threads. If nworkers = 0, use
+     *      std::thread::hardware_concurrency() - 1 workers.
+     */
+    explicit ThreadPool(std::size_t nworkers = 0)
+    {
+        if (nworkers == 0) {
+            const std::size_t hc = std::thread::hardware_concurrency();
+            nworkers = (hc > 1) ? hc - 1 : 0;
+        }
+        workers.reserve(nworkers);
+        for (std::size_t i = 0; i < nworkers; ++i)
+            workers.emplace_back([this]() { worker_loop(); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stop = true;
+        }
+        cv.notify_all();
+        for (auto& w : workers)
+            w.join();
+    }
+
+    /// Number of threads that may run tasks, including the caller
+    std::size_t size() const noexcept { return workers.size() + 1; }
+
+    /**
+     * @brief Calls f(i) for i = 0, ..., ntasks-1 and waits for all calls to
+     * finish.
+     *
+     * @param[in] ntasks Number of tasks.
+     * @param[in] f Callable object with signature void(std::size_t).
+     * @param[in] nthreads Maximum number of threads used, including the
+     *      caller. If nthreads = 0, use all threads in the pool.
+     *
+     * If one of the calls throws, the first exception caught is rethrown in
+     * the calling thread after all tasks finish.
+     */
+    template <class F>
+    void parallel_for(std::size_t ntasks, F&& f, std::size_t nthreads = 0)
+    {
+        if (ntasks == 0) return;
+        if (nthreads == 0 || nthreads > size()) nthreads = size();
+        if (nthreads > ntasks) nthreads = ntasks;
+
+        if (nthreads <= 1) {
+            for (std::size_t i = 0; i < ntasks; ++i)
+                f(i);
+            return;
+        }
+
+        auto loop = std::make_shared<Loop>(ntasks);
+        loop->body = [&f](std::size_t i) { f(i); };
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            for (std::size_t i = 1; i < nthreads; ++i)
+                queue.emplace_back([loop]() { loop->run(); });
+        }
+        if (nthreads == 2)
+            cv.notify_one();
+        else
+            cv.notify_all();
+
+        loop->run();
+        loop->wait();
+    }
+
+   private:
+    /// State shared by the threads that execute a loop
+    struct Loop {
+        std::function<void(std::size_t)> body;
+        const std::size_t ntasks;
+        std::atomic<std::size_t> next{0};
+        std::size_t remaining;
+        std::exception_ptr error;
+        std::mutex mtx;
+        std::condition_variable cv;
+
+        explicit Loop(std::size_t ntasks) : ntasks(ntasks), remaining(ntasks)
+        {}
+
+        void run()
+        {
+            for (std::size_t i = next++; i < ntasks; i = next++) {
+                std::exception_ptr e;
+                try {
+                    body(i);
+                }
+                catch (...) {
+                    e = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(mtx);
+                if (e && !error) error = e;
+                if (--remaining == 0) cv.notify_all();
+            }
+        }
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]() { return remaining == 0; });
+            if (error) std::rethrow_exception(error);
+        }
+    };
+
+    void worker_loop()
+    {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [this]() { return stop || !queue.empty(); });
+                if (stop && queue.empty()) return;
+                job = std::move(queue.front());
+                queue.pop_front();
+            }
+            job();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> queue;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stop = false;
+};
+
+/**
+ * @brief Thread pool used when no pool is given in the execution policy.
+ *
+ * The pool is created on the first call and has
+ * std::thread::hardware_concurrency() - 1 workers.
+ */
+inline ThreadPool& default_thread_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+/**
+ * @brief Execution policy of the parallel regions of a routine.
+ *
+ * The default policy is sequential. Use ExecutionPolicy::parallel() to run
+ * the parallel regions on a thread pool.
+ */
+struct ExecutionPolicy {
+    size_t nthreads = 1;  ///< Maximum number of threads, including the
+                          ///< caller. If nthreads = 0, use all threads in
+                          ///< the pool.
+    ThreadPool* pool = nullptr;  ///< Thread pool. If pool = nullptr, use
+                                 ///< default_thread_pool().
+
+    /// Sequential execution
+    static constexpr ExecutionPolicy sequential() noexcept { return {}; }
+
+    /// Parallel execution with up to nthreads threads from pool
+    static constexpr ExecutionPolicy parallel(
+        size_t nthreads = 0, ThreadPool* pool = nullptr) noexcept
+    {
+        return {nthreads, pool};
+    }
+
+    /// True if the policy may use more than one thread
+    constexpr bool is_parallel() const noexcept { return nthreads != 1; }
+};
+
+namespace internal {
+
+    /**
+     * @brief Splits the range [0, n) into contiguous blocks and calls
+     * f(j0, j1) for each block [j0, j1) according to the execution policy.
+     *
+     * The blocks have at least nmin entries, except possibly the last one. If
+     * the policy is sequential or n < 2*nmin, calls f(0, n) in the current
+     * thread.
+     *
+     * @param[in] exec Execution policy.
+     * @param[in] n Size of the range.
+     * @param[in] nmin Minimum size of a block.
+     * @param[in] f Callable object with signature void(idx_t, idx_t).
+     */
+    template <class idx_t, class F>
+    void parallel_for_blocks(const ExecutionPolicy& exec,
+                             idx_t n,
+                             idx_t nmin,
+                             F&& f)
+    {
+        if (n <= 0) return;
+        if (nmin <= 0) nmin = 1;
+
+        if (!exec.is_parallel() || n < 2 * nmin) {
+            f(idx_t(0), n);
+            return;
+        }
+
+        ThreadPool& pool = (exec.pool) ? *exec.pool : default_thread_pool();
+        std::size_t nthreads = exec.nthreads;
+        if (nthreads == 0 || nthreads > pool.size()) nthreads = pool.size();
+
+        // Block size: a multiple of nmin that gives at most one block per
+        // thread
+        const std::size_t nblocks_max = std::size_t(n / nmin);
+        if (nthreads > nblocks_max) nthreads = nblocks_max;
+        idx_t nb = (n + idx_t(nthreads) - 1) / idx_t(nthreads);
+        nb = ((nb + nmin - 1) / nmin) * nmin;
+        const std::size_t nblocks = std::size_t((n + nb - 1) / nb);
+
+        pool.parallel_for(
+            nblocks,
+            [&](std::size_t b) {
+                const idx_t j0 = idx_t(b) * nb;
+                const idx_t j1 = std::min<idx_t>(j0 + nb, n);
+                f(j0, j1);
+            },
+            nthreads);
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PARALLEL_HH
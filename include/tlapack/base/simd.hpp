@@ -0,0 +1,642 @@
+/// @file simd.hpp
+///
+/// @brief Explicit SIMD kernels for float, double, std::complex<float> and
+/// std::complex<double> with runtime selection of the instruction set.
+///
+/// The kernels are compiled for each instruction set the compiler knows about
+/// (AVX2+FMA and AVX-512F on x86-64, NEON on AArch64), independently of the
+/// flags used to compile the rest of the program. The instruction set is
+/// chosen at runtime, on first use, so that the same binary runs on machines
+/// with different capabilities. Define TLAPACK_USE_SIMD to enable them.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_SIMD_HH
+#define TLAPACK_SIMD_HH
+
+#include <atomic>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#include "tlapack/LegacyMatrix.hpp"
+#include "tlapack/LegacyVector.hpp"
+
+#if defined(TLAPACK_USE_SIMD) && (defined(__GNUC__) || defined(__clang__))
+    #if defined(__x86_64__)
+        #include <immintrin.h>
+        #define TLAPACK_SIMD_X86
+    #elif defined(__aarch64__) && defined(__ARM_NEON)
+        #include <arm_neon.h>
+        #define TLAPACK_SIMD_NEON
+    #endif
+#endif
+
+namespace tlapack {
+
+/// Instruction sets that may be used by the SIMD kernels
+enum class SimdIsa : char {
+    None = 0,       ///< Use the generic loops only
+    NEON = 'N',     ///< ARM Advanced SIMD
+    AVX2 = '2',     ///< AVX2 with FMA3
+    AVX512 = '5'    ///< AVX-512 Foundation
+};
+inline std::ostream& operator<<(std::ostream& out, const SimdIsa v)
+{
+    if (v == SimdIsa::None) return out << "None";
+    if (v == SimdIsa::NEON) return out << "NEON";
+    if (v == SimdIsa::AVX2) return out << "AVX2";
+    if (v == SimdIsa::AVX512) return out << "AVX512";
+    return out << "<Invalid>";
+}
+
+namespace internal {
+
+    /// Best instruction set supported by both the compiler and the CPU
+    inline SimdIsa simd_detect_isa() noexcept
+    {
+#if defined(TLAPACK_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            if (__builtin_cpu_supports("avx512f")) return SimdIsa::AVX512;
+            return SimdIsa::AVX2;
+        }
+        return SimdIsa::None;
+#elif defined(TLAPACK_SIMD_NEON)
+        return SimdIsa::NEON;
+#else
+        return SimdIsa::None;
+#endif
+    }
+
+    /// Instruction set in use. Initialized on first call. It is atomic
+    /// because the kernels read it from the workers of the thread pool.
+    inline std::atomic<SimdIsa>& simd_isa_ref() noexcept
+    {
+        static std::atomic<SimdIsa> isa(simd_detect_isa());
+        return isa;
+    }
+
+}  // namespace internal
+
+/// Instruction set currently used by the SIMD kernels
+inline SimdIsa simd_isa() noexcept
+{
+    return internal::simd_isa_ref().load(std::memory_order_relaxed);
+}
+
+/**
+ * Selects the instruction set used by the SIMD kernels.
+ *
+ * @param[in] isa Requested instruction set. If the CPU does not support it,
+ *      the best supported instruction set below isa is used instead.
+ *      SimdIsa::None disables the SIMD kernels.
+ *
+ * @return The instruction set in use after the call.
+ */
+inline SimdIsa set_simd_isa(SimdIsa isa) noexcept
+{
+    const SimdIsa best = internal::simd_detect_isa();
+    if (isa == SimdIsa::AVX512 && best != SimdIsa::AVX512) isa = SimdIsa::AVX2;
+    if (isa == SimdIsa::AVX2 && best != SimdIsa::AVX512 &&
+        best != SimdIsa::AVX2)
+        isa = SimdIsa::None;
+    if (isa == SimdIsa::NEON && best != SimdIsa::NEON) isa = SimdIsa::None;
+    internal::simd_isa_ref().store(isa, std::memory_order_relaxed);
+    return isa;
+}
+
+namespace internal {
+
+    /// True if T is one of the types with SIMD kernels
+    template <class T>
+    constexpr bool is_simd_type = std::is_same_v<T, float> ||
+                                  std::is_same_v<T, double> ||
+                                  std::is_same_v<T, std::complex<float>> ||
+                                  std::is_same_v<T, std::complex<double>>;
+
+    /// Trait for vectors whose data can be given to the SIMD kernels
+    template <class vector_t>
+    struct simd_vector_trait : std::false_type {};
+
+    template <class T, class idx_t, class int_t>
+    struct simd_vector_trait<
+        LegacyVector<T, idx_t, int_t, Direction::Forward, 0>>
+        : std::integral_constant<bool, is_simd_type<std::remove_const_t<T>>> {
+    };
+
+    /// Trait for matrices whose data can be given to the SIMD kernels
+    template <class matrix_t>
+    struct simd_matrix_trait : std::false_type {};
+
+    template <class T, class idx_t>
+    struct simd_matrix_trait<LegacyMatrix<T, idx_t, Layout::ColMajor, 0>>
+        : std::integral_constant<bool, is_simd_type<std::remove_const_t<T>>> {
+    };
+
+    /// True if vector_t is a forward LegacyVector with entries of a SIMD type
+    template <class vector_t>
+    constexpr bool is_simd_vector = simd_vector_trait<vector_t>::value;
+
+    /// True if matrix_t is a column-major LegacyMatrix with entries of a SIMD
+    /// type
+    template <class matrix_t>
+    constexpr bool is_simd_matrix = simd_matrix_trait<matrix_t>::value;
+
+    /// True if T has SIMD kernels and alpha_t is either T or real_type<T>
+    template <class T, class alpha_t>
+    constexpr bool is_simd_scalar =
+        is_simd_type<T> && (std::is_same_v<alpha_t, T> ||
+                            std::is_same_v<alpha_t, real_type<T>>);
+
+    namespace simd {
+
+        /// Ignores its arguments
+        template <class... Ts>
+        constexpr void ignore(const Ts&...) noexcept
+        {}
+
+#if defined(TLAPACK_SIMD_X86)
+
+    #if defined(__clang__)
+        #pragma clang attribute push(__attribute__((target("avx2,fma"))), \
+                                     apply_to = function)
+    #else
+        #pragma GCC push_options
+        #pragma GCC target("avx2,fma")
+    #endif
+
+        namespace avx2 {
+            template <class R>
+            struct Vec;
+
+            template <>
+            struct Vec<double> {
+                static constexpr std::size_t width = 4;
+                using type = __m256d;
+                static inline type zero() { return _mm256_setzero_pd(); }
+                static inline type set1(double a) { return _mm256_set1_pd(a); }
+                static inline type set2(double a, double b)
+                {
+                    return _mm256_setr_pd(a, b, a, b);
+                }
+                static inline type loadu(const double* p)
+                {
+                    return _mm256_loadu_pd(p);
+                }
+                static inline void storeu(double* p, type v)
+                {
+                    _mm256_storeu_pd(p, v);
+                }
+                static inline type add(type u, type v)
+                {
+                    return _mm256_add_pd(u, v);
+                }
+                static inline type mul(type u, type v)
+                {
+                    return _mm256_mul_pd(u, v);
+                }
+                static inline type fmadd(type u, type v, type w)
+                {
+                    return _mm256_fmadd_pd(u, v, w);
+                }
+                static inline type swap(type v)
+                {
+                    return _mm256_permute_pd(v, 0x5);
+                }
+            };
+
+            template <>
+            struct Vec<float> {
+                static constexpr std::size_t width = 8;
+                using type = __m256;
+                static inline type zero() { return _mm256_setzero_ps(); }
+                static inline type set1(float a) { return _mm256_set1_ps(a); }
+                static inline type set2(float a, float b)
+                {
+                    return _mm256_setr_ps(a, b, a, b, a, b, a, b);
+                }
+                static inline type loadu(const float* p)
+                {
+                    return _mm256_loadu_ps(p);
+                }
+                static inline void storeu(float* p, type v)
+                {
+                    _mm256_storeu_ps(p, v);
+                }
+                static inline type add(type u, type v)
+                {
+                    return _mm256_add_ps(u, v);
+                }
+                static inline type mul(type u, type v)
+                {
+                    return _mm256_mul_ps(u, v);
+                }
+                static inline type fmadd(type u, type v, type w)
+                {
+                    return _mm256_fmadd_ps(u, v, w);
+                }
+                static inline type swap(type v)
+                {
+                    return _mm256_permute_ps(v, 0xB1);
+                }
+            };
+
+    #include "tlapack/base/simd_kernels.hpp"
+        }  // namespace avx2
+
+    #if defined(__clang__)
+        #pragma clang attribute pop
+        #pragma clang attribute push(                     \
+            __attribute__((target("avx512f,avx2,fma"))), \
+            apply_to = function)
+    #else
+        #pragma GCC pop_options
+        #pragma GCC push_options
+        #pragma GCC target("avx512f,avx2,fma")
+    #endif
+
+        namespace avx512 {
+            template <class R>
+            struct Vec;
+
+            template <>
+            struct Vec<double> {
+                static constexpr std::size_t width = 8;
+                using type = __m512d;
+                static inline type zero() { return _mm512_setzero_pd(); }
+                static inline type set1(double a) { return _mm512_set1_pd(a); }
+                static inline type set2(double a, double b)
+                {
+                    return _mm512_mask_blend_pd(0xAA, _mm512_set1_pd(a),
+                                                _mm512_set1_pd(b));
+                }
+                static inline type loadu(const double* p)
+                {
+                    return _mm512_loadu_pd(p);
+                }
+                static inline void storeu(double* p, type v)
+                {
+                    _mm512_storeu_pd(p, v);
+                }
+                static inline type add(type u, type v)
+                {
+                    return _mm512_add_pd(u, v);
+                }
+                static inline type mul(type u, type v)
+                {
+                    return _mm512_mul_pd(u, v);
+                }
+                static inline type fmadd(type u, type v, type w)
+                {
+                    return _mm512_fmadd_pd(u, v, w);
+                }
+                static inline type swap(type v)
+                {
+                    return _mm512_mask_permute_pd(v, 0xFF, v, 0x55);
+                }
+            };
+
+            template <>
+            struct Vec<float> {
+                static constexpr std::size_t width = 16;
+                using type = __m512;
+                static inline type zero() { return _mm512_setzero_ps(); }
+                static inline type set1(float a) { return _mm512_set1_ps(a); }
+                static inline type set2(float a, float b)
+                {
+                    return _mm512_mask_blend_ps(0xAAAA, _mm512_set1_ps(a),
+                                                _mm512_set1_ps(b));
+                }
+                static inline type loadu(const float* p)
+                {
+                    return _mm512_loadu_ps(p);
+                }
+                static inline void storeu(float* p, type v)
+                {
+                    _mm512_storeu_ps(p, v);
+                }
+                static inline type add(type u, type v)
+                {
+                    return _mm512_add_ps(u, v);
+                }
+                static inline type mul(type u, type v)
+                {
+                    return _mm512_mul_ps(u, v);
+                }
+                static inline type fmadd(type u, type v, type w)
+                {
+                    return _mm512_fmadd_ps(u, v, w);
+                }
+                static inline type swap(type v)
+                {
+                    return _mm512_mask_permute_ps(v, 0xFFFF, v, 0xB1);
+                }
+            };
+
+    #include "tlapack/base/simd_kernels.hpp"
+        }  // namespace avx512
+
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #else
+        #pragma GCC pop_options
+    #endif
+
+#elif defined(TLAPACK_SIMD_NEON)
+
+        namespace neon {
+            template <class R>
+            struct Vec;
+
+            template <>
+            struct Vec<double> {
+                static constexpr std::size_t width = 2;
+                using type = float64x2_t;
+                static inline type zero() { return vdupq_n_f64(0.0); }
+                static inline type set1(double a) { return vdupq_n_f64(a); }
+                static inline type set2(double a, double b)
+                {
+                    const double tmp[2] = {a, b};
+                    return vld1q_f64(tmp);
+                }
+                static inline type loadu(const double* p)
+                {
+                    return vld1q_f64(p);
+                }
+                static inline void storeu(double* p, type v)
+                {
+                    vst1q_f64(p, v);
+                }
+                static inline type add(type u, type v)
+                {
+                    return vaddq_f64(u, v);
+                }
+                static inline type mul(type u, type v)
+                {
+                    return vmulq_f64(u, v);
+                }
+                static inline type fmadd(type u, type v, type w)
+                {
+                    return vfmaq_f64(w, u, v);
+                }
+                static inline type swap(type v) { return vextq_f64(v, v, 1); }
+            };
+
+            template <>
+            struct Vec<float> {
+                static constexpr std::size_t width = 4;
+                using type = float32x4_t;
+                static inline type zero() { return vdupq_n_f32(0.0f); }
+                static inline type set1(float a) { return vdupq_n_f32(a); }
+                static inline type set2(float a, float b)
+                {
+                    const float tmp[4] = {a, b, a, b};
+                    return vld1q_f32(tmp);
+                }
+                static inline type loadu(const float* p)
+                {
+                    return vld1q_f32(p);
+                }
+                static inline void storeu(float* p, type v)
+                {
+                    vst1q_f32(p, v);
+                }
+                static inline type add(type u, type v)
+                {
+                    return vaddq_f32(u, v);
+                }
+                static inline type mul(type u, type v)
+                {
+                    return vmulq_f32(u, v);
+                }
+                static inline type fmadd(type u, type v, type w)
+                {
+                    return vfmaq_f32(w, u, v);
+                }
+                static inline type swap(type v) { return vrev64q_f32(v); }
+            };
+
+    #include "tlapack/base/simd_kernels.hpp"
+        }  // namespace neon
+
+#endif
+
+/// Calls kernel<Vec<R>, R> for the instruction set in use and returns true, or
+/// returns false if no instruction set is available.
+#if defined(TLAPACK_SIMD_X86)
+    #define TLAPACK_SIMD_DISPATCH(R, kernel, ...)                        \
+        switch (simd_isa()) {                                            \
+            case SimdIsa::AVX512:                                        \
+                avx512::kernel<avx512::Vec<R>, R>(__VA_ARGS__);          \
+                return true;                                             \
+            case SimdIsa::AVX2:                                          \
+                avx2::kernel<avx2::Vec<R>, R>(__VA_ARGS__);              \
+                return true;                                             \
+            default:                                                     \
+                return false;                                            \
+        }
+#elif defined(TLAPACK_SIMD_NEON)
+    #define TLAPACK_SIMD_DISPATCH(R, kernel, ...)            \
+        if (simd_isa() == SimdIsa::NEON) {                   \
+            neon::kernel<neon::Vec<R>, R>(__VA_ARGS__);      \
+            return true;                                     \
+        }                                                    \
+        return false;
+#else
+    #define TLAPACK_SIMD_DISPATCH(R, kernel, ...) \
+        ignore(__VA_ARGS__);                      \
+        return false;
+#endif
+
+        /**
+         * y := alpha x + y, where x and y are contiguous arrays of size n.
+         *
+         * alpha may be either of type T or of type real_type<T>.
+         *
+         * @return true if a SIMD kernel was used, false otherwise.
+         */
+        template <class T, class alpha_t>
+        inline bool axpy(std::size_t n,
+                         const alpha_t& alpha,
+                         const T* x,
+                         T* y) noexcept
+        {
+            using R = real_type<T>;
+            const R* x_ = reinterpret_cast<const R*>(x);
+            R* y_ = reinterpret_cast<R*>(y);
+            if constexpr (std::is_same_v<alpha_t, R>) {
+                const std::size_t nr = n * (sizeof(T) / sizeof(R));
+                TLAPACK_SIMD_DISPATCH(R, axpy, nr, alpha, x_, y_)
+            }
+            else {
+                static_assert(std::is_same_v<alpha_t, T>);
+                const R ar = std::real(alpha);
+                const R ai = std::imag(alpha);
+                TLAPACK_SIMD_DISPATCH(R, caxpy, n, ar, ai, x_, y_)
+            }
+        }
+
+        /**
+         * x := alpha x, where x is a contiguous array of size n.
+         *
+         * alpha may be either of type T or of type real_type<T>.
+         *
+         * @return true if a SIMD kernel was used, false otherwise.
+         */
+        template <class T, class alpha_t>
+        inline bool scal(std::size_t n, const alpha_t& alpha, T* x) noexcept
+        {
+            using R = real_type<T>;
+            R* x_ = reinterpret_cast<R*>(x);
+            if constexpr (std::is_same_v<alpha_t, R>) {
+                const std::size_t nr = n * (sizeof(T) / sizeof(R));
+                TLAPACK_SIMD_DISPATCH(R, scal, nr, alpha, x_)
+            }
+            else {
+                static_assert(std::is_same_v<alpha_t, T>);
+                const R ar = std::real(alpha);
+                const R ai = std::imag(alpha);
+                TLAPACK_SIMD_DISPATCH(R, cscal, n, ar, ai, x_)
+            }
+        }
+
+        /**
+         * result := sum op(x_i) y_i, where x and y are contiguous arrays of
+         * size n, and op(x_i) = conj(x_i) if conjX is true or op(x_i) = x_i
+         * otherwise.
+         *
+         * @return true if a SIMD kernel was used, false otherwise.
+         */
+        template <class T>
+        inline bool dot(std::size_t n,
+                        bool conjX,
+                        const T* x,
+                        const T* y,
+                        T& result) noexcept
+        {
+            using R = real_type<T>;
+            const R* x_ = reinterpret_cast<const R*>(x);
+            const R* y_ = reinterpret_cast<const R*>(y);
+            if constexpr (std::is_same_v<T, R>) {
+                auto kernel = [&](auto f) {
+                    result = f(n, x_, y_);
+                    return true;
+                };
+#if defined(TLAPACK_SIMD_X86)
+                switch (simd_isa()) {
+                    case SimdIsa::AVX512:
+                        return kernel(avx512::dot<avx512::Vec<R>, R>);
+                    case SimdIsa::AVX2:
+                        return kernel(avx2::dot<avx2::Vec<R>, R>);
+                    default:
+                        return false;
+                }
+#elif defined(TLAPACK_SIMD_NEON)
+                if (simd_isa() == SimdIsa::NEON)
+                    return kernel(neon::dot<neon::Vec<R>, R>);
+                return false;
+#else
+                ignore(kernel);
+                return false;
+#endif
+            }
+            else {
+                R sr, si;
+                auto kernel = [&](auto f) {
+                    f(n, conjX, x_, y_, sr, si);
+                    result = T(sr, si);
+                    return true;
+                };
+#if defined(TLAPACK_SIMD_X86)
+                switch (simd_isa()) {
+                    case SimdIsa::AVX512:
+                        return kernel(avx512::cdot<avx512::Vec<R>, R>);
+                    case SimdIsa::AVX2:
+                        return kernel(avx2::cdot<avx2::Vec<R>, R>);
+                    default:
+                        return false;
+                }
+#elif defined(TLAPACK_SIMD_NEON)
+                if (simd_isa() == SimdIsa::NEON)
+                    return kernel(neon::cdot<neon::Vec<R>, R>);
+                return false;
+#else
+                ignore(kernel);
+                return false;
+#endif
+            }
+        }
+
+        /**
+         * Micro-kernel C := A B for gemm_blocked(), where A is a packed
+         * MR-by-kc sliver, B is a packed kc-by-NR sliver, and C is a MR-by-NR
+         * column-major tile.
+         *
+         * Uses the widest instruction set whose registers divide the columns
+         * of the tile.
+         *
+         * @return true if a SIMD kernel was used, false otherwise.
+         */
+        template <std::size_t MR, std::size_t NR, class T>
+        inline bool gemm(std::size_t kc,
+                         const T* A,
+                         const T* B,
+                         T* C) noexcept
+        {
+            using R = real_type<T>;
+            constexpr std::size_t mr = MR * (sizeof(T) / sizeof(R));
+            const R* A_ = reinterpret_cast<const R*>(A);
+            const R* B_ = reinterpret_cast<const R*>(B);
+            R* C_ = reinterpret_cast<R*>(C);
+
+#if defined(TLAPACK_SIMD_X86)
+            const SimdIsa isa = simd_isa();
+            if constexpr (mr % avx512::Vec<R>::width == 0) {
+                if (isa == SimdIsa::AVX512) {
+                    if constexpr (std::is_same_v<T, R>)
+                        avx512::gemm<MR, NR, avx512::Vec<R>>(kc, A_, B_, C_);
+                    else
+                        avx512::cgemm<MR, NR, avx512::Vec<R>>(kc, A_, B_, C_);
+                    return true;
+                }
+            }
+            if constexpr (mr % avx2::Vec<R>::width == 0) {
+                if (isa == SimdIsa::AVX512 || isa == SimdIsa::AVX2) {
+                    if constexpr (std::is_same_v<T, R>)
+                        avx2::gemm<MR, NR, avx2::Vec<R>>(kc, A_, B_, C_);
+                    else
+                        avx2::cgemm<MR, NR, avx2::Vec<R>>(kc, A_, B_, C_);
+                    return true;
+                }
+            }
+            return false;
+#elif defined(TLAPACK_SIMD_NEON)
+            if constexpr (mr % neon::Vec<R>::width == 0) {
+                if (simd_isa() == SimdIsa::NEON) {
+                    if constexpr (std::is_same_v<T, R>)
+                        neon::gemm<MR, NR, neon::Vec<R>>(kc, A_, B_, C_);
+                    else
+                        neon::cgemm<MR, NR, neon::Vec<R>>(kc, A_, B_, C_);
+                    return true;
+                }
+            }
+            return false;
+#else
+            ignore(kc, A_, B_, C_, mr);
+            return false;
+#endif
+        }
+
+#undef TLAPACK_SIMD_DISPATCH
+
+    }  // namespace simd
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_SIMD_HH
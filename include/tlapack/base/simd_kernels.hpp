@@ -0,0 +1,307 @@
+/// @file simd_kernels.hpp
+///
+/// @brief SIMD kernels written in terms of a vector-operations class V.
+///
+/// This file has no include guard on purpose. It is included by simd.hpp once
+/// per instruction set, inside a namespace and a region of code compiled for
+/// that instruction set. V must provide:
+///
+///     - width:         number of real entries in a vector register.
+///     - type:          the vector register type.
+///     - zero():        register with all entries zero.
+///     - set1(a):       register with all entries equal to a.
+///     - set2(a, b):    register with entries a, b, a, b, ...
+///     - loadu(p):      unaligned load.
+///     - storeu(p, v):  unaligned store.
+///     - add(u, v):     u + v.
+///     - mul(u, v):     u * v.
+///     - fmadd(u, v, w) u * v + w.
+///     - swap(v):       swaps each pair of entries, i.e., (a, b) -> (b, a).
+///
+/// Complex numbers are stored as pairs (real, imaginary) of real numbers, so
+/// that a complex array of size n is seen as a real array of size 2n.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+/// Sum of all entries of v
+template <class V, class R>
+inline R reduce(typename V::type v)
+{
+    R tmp[V::width];
+    V::storeu(tmp, v);
+    R s(0);
+    for (std::size_t i = 0; i < V::width; ++i)
+        s += tmp[i];
+    return s;
+}
+
+/// Sum of the even entries minus the sum of the odd entries of v
+template <class V, class R>
+inline R reduce_alt(typename V::type v)
+{
+    R tmp[V::width];
+    V::storeu(tmp, v);
+    R s(0);
+    for (std::size_t i = 0; i < V::width; i += 2)
+        s += tmp[i] - tmp[i + 1];
+    return s;
+}
+
+/// y := a x + y, where x and y are real arrays of size n
+template <class V, class R>
+void axpy(std::size_t n, R a, const R* x, R* y)
+{
+    constexpr std::size_t W = V::width;
+    const auto va = V::set1(a);
+
+    std::size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        auto y0 = V::fmadd(va, V::loadu(x + i), V::loadu(y + i));
+        auto y1 = V::fmadd(va, V::loadu(x + i + W), V::loadu(y + i + W));
+        auto y2 =
+            V::fmadd(va, V::loadu(x + i + 2 * W), V::loadu(y + i + 2 * W));
+        auto y3 =
+            V::fmadd(va, V::loadu(x + i + 3 * W), V::loadu(y + i + 3 * W));
+        V::storeu(y + i, y0);
+        V::storeu(y + i + W, y1);
+        V::storeu(y + i + 2 * W, y2);
+        V::storeu(y + i + 3 * W, y3);
+    }
+    for (; i + W <= n; i += W)
+        V::storeu(y + i, V::fmadd(va, V::loadu(x + i), V::loadu(y + i)));
+    for (; i < n; ++i)
+        y[i] += a * x[i];
+}
+
+/// y := (ar + i ai) x + y, where x and y are complex arrays of size n
+template <class V, class R>
+void caxpy(std::size_t n, R ar, R ai, const R* x, R* y)
+{
+    constexpr std::size_t W = V::width;
+    const auto var = V::set1(ar);
+    const auto vai = V::set2(-ai, ai);
+
+    n *= 2;
+    std::size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        const auto x0 = V::loadu(x + i);
+        const auto x1 = V::loadu(x + i + W);
+        auto y0 = V::fmadd(var, x0, V::loadu(y + i));
+        auto y1 = V::fmadd(var, x1, V::loadu(y + i + W));
+        y0 = V::fmadd(vai, V::swap(x0), y0);
+        y1 = V::fmadd(vai, V::swap(x1), y1);
+        V::storeu(y + i, y0);
+        V::storeu(y + i + W, y1);
+    }
+    for (; i + W <= n; i += W) {
+        const auto x0 = V::loadu(x + i);
+        V::storeu(y + i, V::fmadd(vai, V::swap(x0),
+                                  V::fmadd(var, x0, V::loadu(y + i))));
+    }
+    for (; i < n; i += 2) {
+        const R xr = x[i];
+        const R xi = x[i + 1];
+        y[i] += ar * xr - ai * xi;
+        y[i + 1] += ar * xi + ai * xr;
+    }
+}
+
+/// x := a x, where x is a real array of size n
+template <class V, class R>
+void scal(std::size_t n, R a, R* x)
+{
+    constexpr std::size_t W = V::width;
+    const auto va = V::set1(a);
+
+    std::size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        V::storeu(x + i, V::mul(va, V::loadu(x + i)));
+        V::storeu(x + i + W, V::mul(va, V::loadu(x + i + W)));
+    }
+    for (; i + W <= n; i += W)
+        V::storeu(x + i, V::mul(va, V::loadu(x + i)));
+    for (; i < n; ++i)
+        x[i] *= a;
+}
+
+/// x := (ar + i ai) x, where x is a complex array of size n
+template <class V, class R>
+void cscal(std::size_t n, R ar, R ai, R* x)
+{
+    constexpr std::size_t W = V::width;
+    const auto var = V::set1(ar);
+    const auto vai = V::set2(-ai, ai);
+
+    n *= 2;
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) {
+        const auto x0 = V::loadu(x + i);
+        V::storeu(x + i, V::fmadd(vai, V::swap(x0), V::mul(var, x0)));
+    }
+    for (; i < n; i += 2) {
+        const R xr = x[i];
+        const R xi = x[i + 1];
+        x[i] = ar * xr - ai * xi;
+        x[i + 1] = ar * xi + ai * xr;
+    }
+}
+
+/// Returns sum x_i y_i, where x and y are real arrays of size n
+template <class V, class R>
+R dot(std::size_t n, const R* x, const R* y)
+{
+    constexpr std::size_t W = V::width;
+    auto s0 = V::zero();
+    auto s1 = V::zero();
+    auto s2 = V::zero();
+    auto s3 = V::zero();
+
+    std::size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        s0 = V::fmadd(V::loadu(x + i), V::loadu(y + i), s0);
+        s1 = V::fmadd(V::loadu(x + i + W), V::loadu(y + i + W), s1);
+        s2 = V::fmadd(V::loadu(x + i + 2 * W), V::loadu(y + i + 2 * W), s2);
+        s3 = V::fmadd(V::loadu(x + i + 3 * W), V::loadu(y + i + 3 * W), s3);
+    }
+    for (; i + W <= n; i += W)
+        s0 = V::fmadd(V::loadu(x + i), V::loadu(y + i), s0);
+
+    R s = reduce<V, R>(V::add(V::add(s0, s1), V::add(s2, s3)));
+    for (; i < n; ++i)
+        s += x[i] * y[i];
+    return s;
+}
+
+/**
+ * Computes sum op(x_i) y_i, where x and y are complex arrays of size n and
+ * op(x_i) = conj(x_i) if conjX is true and op(x_i) = x_i otherwise.
+ * The real and imaginary parts of the result are stored in sr and si.
+ */
+template <class V, class R>
+void cdot(std::size_t n, bool conjX, const R* x, const R* y, R& sr, R& si)
+{
+    constexpr std::size_t W = V::width;
+
+    // p accumulates (xr yr, xi yi), q accumulates (xr yi, xi yr)
+    auto p0 = V::zero();
+    auto p1 = V::zero();
+    auto q0 = V::zero();
+    auto q1 = V::zero();
+
+    n *= 2;
+    std::size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        const auto x0 = V::loadu(x + i);
+        const auto x1 = V::loadu(x + i + W);
+        const auto y0 = V::loadu(y + i);
+        const auto y1 = V::loadu(y + i + W);
+        p0 = V::fmadd(x0, y0, p0);
+        p1 = V::fmadd(x1, y1, p1);
+        q0 = V::fmadd(x0, V::swap(y0), q0);
+        q1 = V::fmadd(x1, V::swap(y1), q1);
+    }
+    for (; i + W <= n; i += W) {
+        const auto x0 = V::loadu(x + i);
+        const auto y0 = V::loadu(y + i);
+        p0 = V::fmadd(x0, y0, p0);
+        q0 = V::fmadd(x0, V::swap(y0), q0);
+    }
+
+    const auto p = V::add(p0, p1);
+    const auto q = V::add(q0, q1);
+    if (conjX) {
+        sr = reduce<V, R>(p);
+        si = reduce_alt<V, R>(q);
+        for (; i < n; i += 2) {
+            sr += x[i] * y[i] + x[i + 1] * y[i + 1];
+            si += x[i] * y[i + 1] - x[i + 1] * y[i];
+        }
+    }
+    else {
+        sr = reduce_alt<V, R>(p);
+        si = reduce<V, R>(q);
+        for (; i < n; i += 2) {
+            sr += x[i] * y[i] - x[i + 1] * y[i + 1];
+            si += x[i] * y[i + 1] + x[i + 1] * y[i];
+        }
+    }
+}
+
+/**
+ * Micro-kernel for real gemm: C := A B, where A is a packed MR-by-kc sliver
+ * stored column by column, B is a packed kc-by-NR sliver stored row by row and
+ * C is a MR-by-NR column-major tile. MR must be a multiple of V::width.
+ */
+template <std::size_t MR, std::size_t NR, class V, class R>
+void gemm(std::size_t kc, const R* A, const R* B, R* C)
+{
+    constexpr std::size_t W = V::width;
+    constexpr std::size_t MV = MR / W;
+    static_assert(MV * W == MR);
+
+    typename V::type c[MV * NR];
+    for (std::size_t i = 0; i < MV * NR; ++i)
+        c[i] = V::zero();
+
+    for (std::size_t l = 0; l < kc; ++l) {
+        typename V::type a[MV];
+        for (std::size_t i = 0; i < MV; ++i)
+            a[i] = V::loadu(A + i * W);
+        for (std::size_t j = 0; j < NR; ++j) {
+            const auto b = V::set1(B[j]);
+            for (std::size_t i = 0; i < MV; ++i)
+                c[i + j * MV] = V::fmadd(a[i], b, c[i + j * MV]);
+        }
+        A += MR;
+        B += NR;
+    }
+
+    for (std::size_t j = 0; j < NR; ++j)
+        for (std::size_t i = 0; i < MV; ++i)
+            V::storeu(C + i * W + j * MR, c[i + j * MV]);
+}
+
+/**
+ * Micro-kernel for complex gemm: C := A B, where A is a packed MR-by-kc
+ * sliver stored column by column, B is a packed kc-by-NR sliver stored row by
+ * row and C is a MR-by-NR column-major tile. 2*MR must be a multiple of
+ * V::width.
+ */
+template <std::size_t MR, std::size_t NR, class V, class R>
+void cgemm(std::size_t kc, const R* A, const R* B, R* C)
+{
+    constexpr std::size_t W = V::width;
+    constexpr std::size_t MV = (2 * MR) / W;
+    static_assert(MV * W == 2 * MR);
+
+    typename V::type c[MV * NR];
+    for (std::size_t i = 0; i < MV * NR; ++i)
+        c[i] = V::zero();
+
+    for (std::size_t l = 0; l < kc; ++l) {
+        typename V::type a[MV];
+        typename V::type as[MV];
+        for (std::size_t i = 0; i < MV; ++i) {
+            a[i] = V::loadu(A + i * W);
+            as[i] = V::swap(a[i]);
+        }
+        for (std::size_t j = 0; j < NR; ++j) {
+            const auto br = V::set1(B[2 * j]);
+            const auto bi = V::set2(-B[2 * j + 1], B[2 * j + 1]);
+            for (std::size_t i = 0; i < MV; ++i) {
+                c[i + j * MV] = V::fmadd(a[i], br, c[i + j * MV]);
+                c[i + j * MV] = V::fmadd(as[i], bi, c[i + j * MV]);
+            }
+        }
+        A += 2 * MR;
+        B += 2 * NR;
+    }
+
+    for (std::size_t j = 0; j < NR; ++j)
+        for (std::size_t i = 0; i < MV; ++i)
+            V::storeu(C + i * W + 2 * j * MR, c[i + j * MV]);
+}
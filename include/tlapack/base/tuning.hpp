@@ -0,0 +1,287 @@
+/// @file tuning.hpp
+/// @brief Tuning profile with the block sizes and crossover points used as
+/// defaults in the options of the blocked routines.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TUNING_HH
+#define TLAPACK_TUNING_HH
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "tlapack/base/scalar_type_traits.hpp"
+
+namespace tlapack {
+
+/**
+ * @brief Tuned values of the parameters of the blocked routines.
+ *
+ * A parameter is identified by the name of the routine and the name of the
+ * parameter, e.g., ("geqrf", "nb"). For each parameter, the profile stores
+ * a list of entries (type, nstart, value), which means that value is used
+ * for matrices of scalar type `type` and size n >= nstart, up to the next
+ * entry. The scalar type is one of "s", "d", "c", "z" (see
+ * tuning_type<T>()), or "*" for entries that hold for any type.
+ *
+ * The profile is stored in a text file with one entry per line:
+ *
+ *      # routine param type nstart value
+ *      geqrf nb d 0 32
+ *      geqrf nb d 800 64
+ *      geqrf nb * 0 48
+ *
+ * Lines starting with '#' are ignored.
+ *
+ * The methods that modify the profile are not thread safe.
+ */
+class TuningProfile {
+   public:
+    /// Entry of the profile
+    struct Entry {
+        std::string type;   ///< Scalar type, or "*" for any type
+        size_t nstart = 0;  ///< Smallest matrix size of the entry
+        size_t value = 0;   ///< Value of the parameter
+    };
+
+    /// True if the profile has no entries
+    bool empty() const noexcept { return entries.empty(); }
+
+    /// Remove all entries
+    void clear() noexcept { entries.clear(); }
+
+    /**
+     * @brief Set the value of a parameter for matrices of size n >= nstart.
+     *
+     * Replaces the entry with the same type and nstart if it exists.
+     */
+    void set(const std::string& routine,
+             const std::string& param,
+             const std::string& type,
+             size_t nstart,
+             size_t value)
+    {
+        auto& list = entries[key(routine, param)];
+        auto it = list.begin();
+        for (; it != list.end(); ++it) {
+            if (it->type == type && it->nstart == nstart) {
+                it->value = value;
+                return;
+            }
+            if (it->type == type && it->nstart > nstart) break;
+        }
+        list.insert(it, Entry{type, nstart, value});
+    }
+
+    /**
+     * @brief Value of a parameter for matrices of scalar type `type` and
+     * size n.
+     *
+     * Uses the entry of the given type with the largest nstart <= n. If
+     * there is none, uses the entries of type "*" in the same way. Returns
+     * fallback if no entry matches.
+     */
+    size_t get(const std::string& routine,
+               const std::string& param,
+               const std::string& type,
+               size_t n,
+               size_t fallback) const
+    {
+        const auto it = entries.find(key(routine, param));
+        if (it == entries.end()) return fallback;
+
+        for (const std::string& t : {type, std::string("*")}) {
+            const Entry* best = nullptr;
+            for (const Entry& e : it->second)
+                if (e.type == t && e.nstart <= n &&
+                    (!best || e.nstart >= best->nstart))
+                    best = &e;
+            if (best) return best->value;
+        }
+
+        return fallback;
+    }
+
+    /**
+     * @brief Value of a parameter that holds for any scalar type and size.
+     *
+     * This is the entry of type "*" with nstart = 0, or fallback if there is
+     * none. The options structs use it as their default values.
+     */
+    size_t get(const std::string& routine,
+               const std::string& param,
+               size_t fallback) const
+    {
+        return get(routine, param, "*", 0, fallback);
+    }
+
+    /**
+     * @brief Add the entries stored in a stream.
+     *
+     * @return true if all lines were read successfully.
+     */
+    bool load(std::istream& is)
+    {
+        bool ok = true;
+        std::string line;
+        while (std::getline(is, line)) {
+            const size_t pos = line.find_first_not_of(" \t\r");
+            if (pos == std::string::npos || line[pos] == '#') continue;
+
+            std::istringstream ss(line);
+            std::string routine, param, type;
+            long long nstart, value;
+            if (ss >> routine >> param >> type >> nstart >> value &&
+                nstart >= 0 && value >= 0)
+                set(routine, param, type, size_t(nstart), size_t(value));
+            else
+                ok = false;
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Add the entries stored in a file.
+     *
+     * @return true if the file could be opened and all lines were read
+     *      successfully.
+     */
+    bool load(const std::string& filename)
+    {
+        std::ifstream is(filename);
+        if (!is) return false;
+        return load(is);
+    }
+
+    /// Write the entries to a stream in the format read by load()
+    void save(std::ostream& os) const
+    {
+        os << "# routine param type nstart value\n";
+        for (const auto& [k, list] : entries) {
+            const size_t pos = k.find(' ');
+            for (const Entry& e : list)
+                os << k.substr(0, pos) << ' ' << k.substr(pos + 1) << ' '
+                   << e.type << ' ' << e.nstart << ' ' << e.value << '\n';
+        }
+    }
+
+    /**
+     * @brief Write the entries to a file in the format read by load()
+     *
+     * @return true if the file was written successfully.
+     */
+    bool save(const std::string& filename) const
+    {
+        std::ofstream os(filename);
+        if (!os) return false;
+        save(os);
+        return bool(os);
+    }
+
+   private:
+    std::map<std::string, std::vector<Entry>> entries;
+
+    static std::string key(const std::string& routine,
+                           const std::string& param)
+    {
+        return routine + ' ' + param;
+    }
+};
+
+/**
+ * @brief Tuning profile used by the options of the blocked routines.
+ *
+ * On the first call, the profile is loaded from the file given by the
+ * environment variable TLAPACK_TUNING_PROFILE, if it is set. Otherwise, the
+ * profile starts empty and the routines use their built-in defaults.
+ */
+inline TuningProfile& tuning_profile()
+{
+    static TuningProfile profile = []() {
+        TuningProfile p;
+        if (const char* filename = std::getenv("TLAPACK_TUNING_PROFILE"))
+            p.load(std::string(filename));
+        return p;
+    }();
+    return profile;
+}
+
+/**
+ * @brief Name of the scalar type T in the tuning profile.
+ *
+ * @return "s", "d", "c" or "z" for float, double, complex<float> and
+ *      complex<double>, respectively. "*" for other types.
+ */
+template <class T>
+std::string tuning_type()
+{
+    using real_t = real_type<T>;
+    if constexpr (std::is_same_v<real_t, float>)
+        return is_complex<T> ? "c" : "s";
+    else if constexpr (std::is_same_v<real_t, double>)
+        return is_complex<T> ? "z" : "d";
+    else
+        return "*";
+}
+
+/**
+ * @brief Tuned value of a parameter for matrices of scalar type T and size n.
+ *
+ * @see TuningProfile::get()
+ */
+template <class T>
+size_t tuned_value(const std::string& routine,
+                   const std::string& param,
+                   size_t n,
+                   size_t fallback)
+{
+    return tuning_profile().get(routine, param, tuning_type<T>(), n,
+                                fallback);
+}
+
+/**
+ * @brief Value of an option of a routine for matrices of scalar type T and
+ * size n.
+ *
+ * The block sizes and crossover points that the tuning profile stores per
+ * type and size default to 0 (auto) in the options structs, and the
+ * routines resolve them with this function when they are called.
+ *
+ * @return value if value > 0, and tuned_value<T>(routine, param, n,
+ *      fallback) otherwise.
+ */
+template <class T>
+size_t tuned_option(size_t value,
+                    const std::string& routine,
+                    const std::string& param,
+                    size_t n,
+                    size_t fallback)
+{
+    return (value > 0) ? value : tuned_value<T>(routine, param, n, fallback);
+}
+
+/**
+ * @brief Default value of a parameter in the options of a routine.
+ *
+ * @see TuningProfile::get()
+ */
+inline size_t tuned_default(const std::string& routine,
+                            const std::string& param,
+                            size_t fallback)
+{
+    return tuning_profile().get(routine, param, fallback);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TUNING_HH
@@ -27,13 +27,15 @@ namespace tlapack {
 // Layouts
 
 enum class Layout : char {
-    Strided = 'S',   ///< Strided layout. Vectors whose i-th element is at
-                     ///< ptr + i*inc, inc is an integer.
-    ColMajor = 'C',  ///< Column-major layout. Matrices whose (i,j)-th element
-                     ///< is at ptr + i + j*ldim.
-    RowMajor = 'R',  ///< Row-major layout. Matrices whose (i,j)-th element
-                     ///< is at ptr + i*ldim + j.
-    Unspecified = 0  ///< Used on all other data structures.
+    Strided = 'S',    ///< Strided layout. Vectors whose i-th element is at
+                      ///< ptr + i*inc, inc is an integer.
+    ColMajor = 'C',   ///< Column-major layout. Matrices whose (i,j)-th element
+                      ///< is at ptr + i + j*ldim.
+    RowMajor = 'R',   ///< Row-major layout. Matrices whose (i,j)-th element
+                      ///< is at ptr + i*ldim + j.
+    TileMajor = 'T',  ///< Tile-major layout. Matrices stored as contiguous
+                      ///< column-major tiles, see TileMajorMatrix.
+    Unspecified = 0   ///< Used on all other data structures.
 };
 inline std::ostream& operator<<(std::ostream& out, const Layout v)
 {
@@ -41,6 +43,7 @@ inline std::ostream& operator<<(std::ostream& out, const Layout v)
     if (v == Layout::ColMajor) return out << "ColMajor";
     if (v == Layout::RowMajor) return out << "RowMajor";
     if (v == Layout::Strided) return out << "Strided";
+    if (v == Layout::TileMajor) return out << "TileMajor";
     return out << "<Invalid>";
 }
 
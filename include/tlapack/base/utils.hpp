@@ -302,6 +302,37 @@ template <class T1, class... Ts>
 using disable_if_allow_optblas_t =
     enable_if_t<(!allow_optblas<T1, Ts...>), int>;
 
+// -----------------------------------------------------------------------------
+// Kernels for matrices with sizes known at compile time
+
+namespace internal {
+    /// Largest number of rows or columns for which matrices with sizes known
+    /// at compile time are processed by fully unrolled kernels.
+    constexpr int max_unrolled_size = 8;
+
+    /// True if matrix_t is small and has sizes known at compile time.
+    template <class matrix_t>
+    constexpr bool use_unrolled_kernel =
+        has_static_size<matrix_t> && (static_nrows<matrix_t> >= 1) &&
+        (static_nrows<matrix_t> <= max_unrolled_size) &&
+        (static_ncols<matrix_t> >= 1) &&
+        (static_ncols<matrix_t> <= max_unrolled_size);
+
+    /** Calls f(std::integral_constant<int, i>()) for i = first, ..., last-1.
+     *
+     * The loop is unrolled at compile time, and i can be used in constant
+     * expressions inside f, e.g., as the bound of another static_for().
+     */
+    template <int first, int last, class F>
+    constexpr void static_for(F&& f)
+    {
+        if constexpr (first < last) {
+            f(std::integral_constant<int, first>());
+            static_for<first + 1, last>(f);
+        }
+    }
+}  // namespace internal
+
 #ifdef TLAPACK_USE_LAPACKPP
 namespace traits {
     template <>
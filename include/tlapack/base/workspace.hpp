@@ -10,6 +10,11 @@
 #ifndef TLAPACK_WORKSPACE_HH
 #define TLAPACK_WORKSPACE_HH
 
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
 namespace tlapack {
 
 /// @brief Output information in the workspace query
@@ -169,6 +174,224 @@ struct WorkInfo {
     bool isVector;  ///< True if the Workspace is a vector at compile time
 };
 
+/**
+ * @brief Thread-local stack of memory used by the workspaces of <T>LAPACK.
+ *
+ * The arena hands out memory from large chunks by bumping an offset. Memory
+ * released in reverse order of allocation is reused immediately, and all
+ * memory is reused once every allocation has been released. Chunks are only
+ * requested from the heap when the arena runs out of space, and they are
+ * merged into a single chunk as soon as the arena is empty. Therefore, after
+ * the first call (or after reserve()), repeated calls to a routine perform no
+ * heap allocations for their workspaces.
+ *
+ * The allocations are aligned to alignment bytes. Each thread has its own
+ * arena, see workspace_arena(). Memory must be released by the thread that
+ * allocated it.
+ */
+class WorkspaceArena {
+   public:
+    static constexpr std::size_t alignment = 64;  ///< Alignment in bytes
+    static constexpr std::size_t min_chunk_size =
+        std::size_t(1) << 16;  ///< Minimum size of a chunk in bytes
+
+    WorkspaceArena() = default;
+    WorkspaceArena(const WorkspaceArena&) = delete;
+    WorkspaceArena& operator=(const WorkspaceArena&) = delete;
+    ~WorkspaceArena()
+    {
+        for (auto& c : chunks)
+            free_chunk(c);
+    }
+
+    /**
+     * @brief Ensures that nbytes can be allocated without heap allocations.
+     *
+     * Does nothing if the arena is in use.
+     *
+     * @param[in] nbytes Number of bytes.
+     */
+    void reserve(std::size_t nbytes)
+    {
+        if (nlive > 0 || capacity() >= nbytes) return;
+        for (auto& c : chunks)
+            free_chunk(c);
+        chunks.clear();
+        new_chunk(round_up(nbytes));
+    }
+
+    /**
+     * @brief Ensures that a workspace of type T and size workinfo can be
+     * allocated without heap allocations.
+     *
+     * @param[in] workinfo Workspace sizes, e.g., from a *_worksize routine.
+     */
+    template <class T>
+    void reserve(const WorkInfo& workinfo)
+    {
+        reserve(workinfo.size() * sizeof(T));
+    }
+
+    /// Allocates nbytes aligned to alignment bytes
+    void* allocate(std::size_t nbytes)
+    {
+        const std::size_t s = round_up(nbytes);
+        if (chunks.empty() || offset + s > chunks.back().size)
+            new_chunk(std::max({s, 2 * capacity(), min_chunk_size}));
+
+        void* p = chunks.back().data + offset;
+        offset += s;
+        ++nlive;
+        served += nbytes;
+        return p;
+    }
+
+    /// Releases nbytes allocated at p
+    void deallocate(void* p, std::size_t nbytes) noexcept
+    {
+        const std::size_t s = round_up(nbytes);
+        if (offset >= s &&
+            static_cast<char*>(p) + s == chunks.back().data + offset)
+            offset -= s;
+        if (--nlive == 0) {
+            offset = 0;
+            if (chunks.size() > 1) {
+                const std::size_t total = capacity();
+                for (auto& c : chunks)
+                    free_chunk(c);
+                chunks.clear();
+                new_chunk(total);
+            }
+        }
+    }
+
+    /// Frees all memory of the arena. Does nothing if the arena is in use.
+    void release() noexcept
+    {
+        if (nlive > 0) return;
+        for (auto& c : chunks)
+            free_chunk(c);
+        chunks.clear();
+        offset = 0;
+    }
+
+    /// Total number of bytes allocated from the arena
+    std::size_t bytes_served() const noexcept { return served; }
+
+    /// Number of chunks requested from the heap
+    std::size_t heap_allocations() const noexcept { return nheap; }
+
+    /// Number of bytes owned by the arena
+    std::size_t capacity() const noexcept
+    {
+        std::size_t total = 0;
+        for (const auto& c : chunks)
+            total += c.size;
+        return total;
+    }
+
+    /// Resets bytes_served() and heap_allocations() to zero
+    void reset_counters() noexcept
+    {
+        served = 0;
+        nheap = 0;
+    }
+
+   private:
+    struct Chunk {
+        char* data;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t round_up(std::size_t nbytes) noexcept
+    {
+        return ((nbytes + alignment - 1) / alignment) * alignment;
+    }
+
+    void new_chunk(std::size_t size)
+    {
+        char* data = static_cast<char*>(
+            ::operator new(size, std::align_val_t(alignment)));
+        chunks.push_back({data, size});
+        offset = 0;
+        ++nheap;
+    }
+
+    static void free_chunk(Chunk& c) noexcept
+    {
+        ::operator delete(c.data, std::align_val_t(alignment));
+    }
+
+    std::vector<Chunk> chunks;  ///< The last chunk is the one in use
+    std::size_t offset = 0;     ///< Offset of the free space in the last chunk
+    std::size_t nlive = 0;      ///< Number of allocations not yet released
+    std::size_t served = 0;
+    std::size_t nheap = 0;
+};
+
+/// Workspace arena of the calling thread
+inline WorkspaceArena& workspace_arena() noexcept
+{
+    static thread_local WorkspaceArena arena;
+    return arena;
+}
+
+/**
+ * @brief Allocator that takes memory from the workspace arena of the thread
+ * that constructs it.
+ *
+ * @tparam T Type of the elements.
+ */
+template <class T>
+struct WorkspaceAllocator {
+    using value_type = T;
+
+    WorkspaceArena* arena;  ///< Arena that provides the memory
+
+    WorkspaceAllocator() noexcept : arena(&workspace_arena()) {}
+
+    template <class U>
+    WorkspaceAllocator(const WorkspaceAllocator<U>& other) noexcept
+        : arena(other.arena)
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(arena->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        arena->deallocate(p, n * sizeof(T));
+    }
+
+    template <class U>
+    bool operator==(const WorkspaceAllocator<U>& other) const noexcept
+    {
+        return arena == other.arena;
+    }
+
+    template <class U>
+    bool operator!=(const WorkspaceAllocator<U>& other) const noexcept
+    {
+        return arena != other.arena;
+    }
+};
+
+/**
+ * @brief Container for the memory of workspaces allocated with tlapack::Create.
+ *
+ * If TLAPACK_USE_WORKSPACE_ARENA is defined, the memory comes from the
+ * workspace arena of the calling thread. Otherwise, this is std::vector<T>.
+ */
+#ifdef TLAPACK_USE_WORKSPACE_ARENA
+template <class T>
+using workspace_vector = std::vector<T, WorkspaceAllocator<T>>;
+#else
+template <class T>
+using workspace_vector = std::vector<T>;
+#endif
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_WORKSPACE_HH
@@ -0,0 +1,126 @@
+/// @file batched/Batch.hpp
+/// @brief Batches of small matrices and the interleaved layout used by the
+/// batched routines.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BATCHED_BATCH_HH
+#define TLAPACK_BATCHED_BATCH_HH
+
+#include <type_traits>
+
+#include "tlapack/LegacyMatrix.hpp"
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// Options for the batched routines
+struct BatchOpts {
+    ExecutionPolicy exec = {};  ///< Execution policy used to split the batch
+};
+
+/**
+ * @brief Batch of matrices with the same sizes stored at a constant distance
+ * from each other in memory.
+ *
+ * The matrix i of the batch is the LegacyMatrix of size m-by-n that starts at
+ * ptr + i * stride and has leading dimension ldim.
+ *
+ * A batch can also be any container of matrices, e.g.,
+ * std::vector<LegacyMatrix<T>>, that provides size() and operator[].
+ *
+ * @tparam T Floating-point type
+ * @tparam idx_t Index type
+ * @tparam L Either Layout::ColMajor or Layout::RowMajor
+ */
+template <class T, class idx_t = std::size_t, Layout L = Layout::ColMajor>
+struct LegacyStridedBatch {
+    idx_t m, n;     ///< Sizes of each matrix
+    T* ptr;         ///< Pointer to the first matrix
+    idx_t ldim;     ///< Leading dimension of each matrix
+    idx_t stride;   ///< Distance between two consecutive matrices
+    idx_t count;    ///< Number of matrices
+
+    /// Number of matrices
+    constexpr idx_t size() const noexcept { return count; }
+
+    /// Matrix i of the batch
+    constexpr LegacyMatrix<T, idx_t, L> operator[](idx_t i) const
+    {
+        assert(i < count);
+        return LegacyMatrix<T, idx_t, L>(m, n, ptr + i * stride, ldim);
+    }
+};
+
+namespace internal {
+
+    /// Number of matrices of a batch in one interleaved group
+    template <class T>
+    constexpr std::size_t batch_lanes = (64 / sizeof(T) > 0) ? 64 / sizeof(T)
+                                                             : 1;
+
+    /// True if the batched routines use interleaved kernels for T
+    template <class T>
+    constexpr bool has_interleaved_kernels = std::is_floating_point_v<T>;
+
+    /**
+     * @brief Matrix of a group of L matrices stored with the batch index
+     * innermost.
+     *
+     * Entry (i,j) of the matrix l is stored at data[(i + j*m)*L + l], so that
+     * the same entry of all matrices is contiguous in memory and loops over
+     * the group run in SIMD lanes.
+     */
+    template <class T, std::size_t L>
+    struct InterleavedMatrix {
+        std::size_t m, n;
+        workspace_vector<T> data;
+
+        InterleavedMatrix(std::size_t m, std::size_t n)
+            : m(m), n(n), data(m * n * L)
+        {}
+
+        /// Pointer to the L entries (i,j)
+        T* operator()(std::size_t i, std::size_t j) noexcept
+        {
+            return data.data() + (i + j * m) * L;
+        }
+    };
+
+    /**
+     * @brief Calls f(b0, b1) for groups [b0, b1) of at most L consecutive
+     * matrices of a batch of size nbatch, splitting the groups among the
+     * threads of the execution policy.
+     */
+    template <std::size_t L, class F>
+    void for_each_group(const ExecutionPolicy& exec,
+                        std::size_t nbatch,
+                        F&& f)
+    {
+        const std::size_t ngroups = (nbatch + L - 1) / L;
+        parallel_for_blocks(exec, ngroups, std::size_t(1),
+                            [&](std::size_t g0, std::size_t g1) {
+                                for (std::size_t g = g0; g < g1; ++g)
+                                    f(g * L, std::min((g + 1) * L, nbatch));
+                            });
+    }
+
+    /// Returns the index plus one of the first nonzero info, or 0
+    template <class info_t>
+    int first_batch_info(const info_t& info, std::size_t nbatch)
+    {
+        for (std::size_t b = 0; b < nbatch; ++b)
+            if (info[b] != 0) return int(b + 1);
+        return 0;
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BATCHED_BATCH_HH
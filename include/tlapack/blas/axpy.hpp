@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_AXPY_HH
 #define TLAPACK_BLAS_AXPY_HH
 
+#include "tlapack/base/simd.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -41,6 +42,16 @@ void axpy(const alpha_t& alpha, const vectorX_t& x, vectorY_t& y)
     // check arguments
     tlapack_check_false((idx_t)size(y) < n);
 
+    // SIMD kernels for contiguous data
+    if constexpr (internal::is_simd_vector<vectorX_t> &&
+                  internal::is_simd_vector<vectorY_t> &&
+                  is_same_v<type_t<vectorX_t>, T> &&
+                  internal::is_simd_scalar<T, alpha_t>) {
+        if (x.inc == 1 && y.inc == 1 &&
+            internal::simd::axpy(n, alpha, x.ptr, y.ptr))
+            return;
+    }
+
     for (idx_t i = 0; i < n; ++i)
         y[i] += alpha * x[i];
 }
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_DOTU_HH
 #define TLAPACK_BLAS_DOTU_HH
 
+#include "tlapack/base/simd.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -41,6 +42,16 @@ auto dotu(const vectorX_t& x, const vectorY_t& y)
     tlapack_check_false(size(y) != n);
 
     return_t result(0);
+
+    // SIMD kernels for contiguous data
+    if constexpr (internal::is_simd_vector<vectorX_t> &&
+                  internal::is_simd_vector<vectorY_t> &&
+                  is_same_v<type_t<vectorX_t>, T>) {
+        if (x.inc == 1 && y.inc == 1 &&
+            internal::simd::dot(n, false, x.ptr, y.ptr, result))
+            return result;
+    }
+
     for (idx_t i = 0; i < n; ++i)
         result += x[i] * y[i];
 
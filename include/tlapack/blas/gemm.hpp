@@ -12,9 +12,102 @@
 #define TLAPACK_BLAS_GEMM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm_blocked.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// End of the block row of op(X) that contains the row i. Only matrices
+    /// with tile-major layout are split in block rows.
+    template <class matrix_t, class idx_t>
+    constexpr idx_t gemm_row_end(Op trans, const matrix_t& X, idx_t i)
+    {
+        if constexpr (layout<matrix_t> == Layout::TileMajor)
+            return (trans == Op::NoTrans) ? X.tile_row_end(i)
+                                          : X.tile_col_end(i);
+        else
+            return (trans == Op::NoTrans) ? nrows(X) : ncols(X);
+    }
+
+    /// End of the block column of op(X) that contains the column j
+    template <class matrix_t, class idx_t>
+    constexpr idx_t gemm_col_end(Op trans, const matrix_t& X, idx_t j)
+    {
+        return gemm_row_end((trans == Op::NoTrans) ? Op::Trans : Op::NoTrans,
+                            X, j);
+    }
+
+    /// Block of X such that op(X) is op(X)(i0:i1, j0:j1). If X has
+    /// tile-major layout, the block lies in a single tile and is returned as
+    /// a column-major matrix.
+    template <class matrix_t, class idx_t>
+    constexpr auto gemm_block(
+        Op trans, matrix_t& X, idx_t i0, idx_t i1, idx_t j0, idx_t j1)
+    {
+        using range = pair<idx_t, idx_t>;
+        if (trans != Op::NoTrans) {
+            std::swap(i0, j0);
+            std::swap(i1, j1);
+        }
+        if constexpr (layout<std::remove_const_t<matrix_t>> ==
+                      Layout::TileMajor)
+            return X.block(i0, i1, j0, j1);
+        else
+            return slice(X, range(i0, i1), range(j0, j1));
+    }
+
+    /** General matrix-matrix multiply on tile-major matrices.
+     *
+     * The product is split in blocks such that each block of A, B and C lies
+     * in a single tile. Each block product is computed with gemm() on
+     * contiguous column-major matrices.
+     *
+     * @see gemm()
+     */
+    template <class matrixA_t,
+              class matrixB_t,
+              class matrixC_t,
+              class alpha_t,
+              class beta_t>
+    void gemm_tile_major(Op transA,
+                         Op transB,
+                         const alpha_t& alpha,
+                         const matrixA_t& A,
+                         const matrixB_t& B,
+                         const beta_t& beta,
+                         matrixC_t& C)
+    {
+        using idx_t = size_type<matrixC_t>;
+        using real_t = real_type<type_t<matrixC_t>>;
+
+        const idx_t m = nrows(C);
+        const idx_t n = ncols(C);
+        const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+
+        for (idx_t j0 = 0, j1; j0 < n; j0 = j1) {
+            j1 = min(gemm_col_end(Op::NoTrans, C, j0),
+                     gemm_col_end(transB, B, j0));
+            for (idx_t i0 = 0, i1; i0 < m; i0 = i1) {
+                i1 = min(gemm_row_end(Op::NoTrans, C, i0),
+                         gemm_row_end(transA, A, i0));
+                auto Cij = gemm_block(Op::NoTrans, C, i0, i1, j0, j1);
+                for (idx_t l0 = 0, l1; l0 < k; l0 = l1) {
+                    l1 = min(gemm_col_end(transA, A, l0),
+                             gemm_row_end(transB, B, l0));
+                    const auto Ail = gemm_block(transA, A, i0, i1, l0, l1);
+                    const auto Blj = gemm_block(transB, B, l0, l1, j0, j1);
+                    if (l0 == 0)
+                        gemm(transA, transB, alpha, Ail, Blj, beta, Cij);
+                    else
+                        gemm(transA, transB, alpha, Ail, Blj, real_t(1), Cij);
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * General matrix-matrix multiply:
  * \[
@@ -86,6 +179,23 @@ void gemm(Op transA,
     tlapack_check_false(
         (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
 
+    // Work on contiguous tiles if any matrix has tile-major layout
+    if constexpr (layout<matrixA_t> == Layout::TileMajor ||
+                  layout<matrixB_t> == Layout::TileMajor ||
+                  layout<matrixC_t> == Layout::TileMajor) {
+        if (k > 0)
+            return internal::gemm_tile_major(transA, transB, alpha, A, B, beta,
+                                             C);
+    }
+
+    // Use the cache-blocked algorithm for large matrices
+    {
+        constexpr idx_t nx =
+            GemmBlockedOpts::defaults<scalar_type<TA, TB>>().nx;
+        if (m >= nx && n >= nx && k >= nx)
+            return gemm_blocked(transA, transB, alpha, A, B, beta, C);
+    }
+
     if (transA == Op::NoTrans) {
         using scalar_t = scalar_type<alpha_t, TB>;
 
@@ -0,0 +1,361 @@
+/// @file gemm_blocked.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMM_BLOCKED_HH
+#define TLAPACK_BLAS_GEMM_BLOCKED_HH
+
+#include "tlapack/base/simd.hpp"
+#include "tlapack/base/utils.hpp"
+
+/// Size in bytes of the L1 data cache assumed by gemm_blocked()
+#ifndef TLAPACK_L1_CACHE_SIZE
+    #define TLAPACK_L1_CACHE_SIZE 32768
+#endif
+
+/// Size in bytes of the L2 cache assumed by gemm_blocked()
+#ifndef TLAPACK_L2_CACHE_SIZE
+    #define TLAPACK_L2_CACHE_SIZE 262144
+#endif
+
+/// Size in bytes of the L3 cache slice assumed by gemm_blocked()
+#ifndef TLAPACK_L3_CACHE_SIZE
+    #define TLAPACK_L3_CACHE_SIZE 2097152
+#endif
+
+namespace tlapack {
+
+/**
+ * Options struct for gemm_blocked()
+ *
+ * The default values are chosen from the entry type T so that:
+ *  - a kc-by-NR sliver of op(B) fits in half of the L1 cache,
+ *  - a mc-by-kc block of op(A) fits in half of the L2 cache,
+ *  - a kc-by-nc panel of op(B) fits in half of the L3 cache.
+ *
+ * MR-by-NR is the size of the register tile used by the micro-kernel.
+ */
+struct GemmBlockedOpts {
+    size_t mc = 0;  ///< Number of rows of op(A) packed at a time
+    size_t kc = 0;  ///< Number of columns of op(A) packed at a time
+    size_t nc = 0;  ///< Number of columns of op(B) packed at a time
+    size_t nx = 0;  ///< Use the blocked code if m, n and k are all >= nx
+
+    /// Default options for the entry type T
+    template <class T>
+    static constexpr GemmBlockedOpts defaults() noexcept;
+};
+
+namespace internal {
+
+    /// Number of rows of the register tile used by gemm_blocked()
+    template <class T>
+    constexpr size_t gemm_mr = std::is_arithmetic_v<T> ? 8 : 4;
+
+    /// Number of columns of the register tile used by gemm_blocked()
+    template <class T>
+    constexpr size_t gemm_nr = 4;
+
+    /// Rounds x down to a positive multiple of r
+    constexpr size_t gemm_round(size_t x, size_t r) noexcept
+    {
+        return (x < r) ? r : (x / r) * r;
+    }
+
+    /**
+     * Packs the mc-by-kc block op(A)(i0:i0+mc, l0:l0+kc) into Ap.
+     *
+     * The block is stored as a sequence of MR-by-kc slivers, each sliver
+     * stored column by column. The last sliver is padded with zeros.
+     */
+    template <size_t MR, class TA, class matrixA_t, class idx_t>
+    void gemm_pack_A(Op transA,
+                     const matrixA_t& A,
+                     idx_t i0,
+                     idx_t mc,
+                     idx_t l0,
+                     idx_t kc,
+                     TA* Ap)
+    {
+        for (idx_t ir = 0; ir < mc; ir += MR) {
+            const idx_t mr = min<idx_t>(MR, mc - ir);
+            if (transA == Op::NoTrans) {
+                for (idx_t l = 0; l < kc; ++l) {
+                    for (idx_t i = 0; i < mr; ++i)
+                        Ap[i] = A(i0 + ir + i, l0 + l);
+                    for (idx_t i = mr; i < MR; ++i)
+                        Ap[i] = TA(0);
+                    Ap += MR;
+                }
+            }
+            else if (transA == Op::Trans) {
+                for (idx_t l = 0; l < kc; ++l) {
+                    for (idx_t i = 0; i < mr; ++i)
+                        Ap[i] = A(l0 + l, i0 + ir + i);
+                    for (idx_t i = mr; i < MR; ++i)
+                        Ap[i] = TA(0);
+                    Ap += MR;
+                }
+            }
+            else {
+                for (idx_t l = 0; l < kc; ++l) {
+                    for (idx_t i = 0; i < mr; ++i)
+                        Ap[i] = conj(A(l0 + l, i0 + ir + i));
+                    for (idx_t i = mr; i < MR; ++i)
+                        Ap[i] = TA(0);
+                    Ap += MR;
+                }
+            }
+        }
+    }
+
+    /**
+     * Packs the kc-by-nc panel op(B)(l0:l0+kc, j0:j0+nc) into Bp.
+     *
+     * The panel is stored as a sequence of kc-by-NR slivers, each sliver
+     * stored row by row. The last sliver is padded with zeros.
+     */
+    template <size_t NR, class TB, class matrixB_t, class idx_t>
+    void gemm_pack_B(Op transB,
+                     const matrixB_t& B,
+                     idx_t l0,
+                     idx_t kc,
+                     idx_t j0,
+                     idx_t nc,
+                     TB* Bp)
+    {
+        for (idx_t jr = 0; jr < nc; jr += NR) {
+            const idx_t nr = min<idx_t>(NR, nc - jr);
+            if (transB == Op::NoTrans) {
+                for (idx_t l = 0; l < kc; ++l) {
+                    for (idx_t j = 0; j < nr; ++j)
+                        Bp[j] = B(l0 + l, j0 + jr + j);
+                    for (idx_t j = nr; j < NR; ++j)
+                        Bp[j] = TB(0);
+                    Bp += NR;
+                }
+            }
+            else if (transB == Op::Trans) {
+                for (idx_t l = 0; l < kc; ++l) {
+                    for (idx_t j = 0; j < nr; ++j)
+                        Bp[j] = B(j0 + jr + j, l0 + l);
+                    for (idx_t j = nr; j < NR; ++j)
+                        Bp[j] = TB(0);
+                    Bp += NR;
+                }
+            }
+            else {
+                for (idx_t l = 0; l < kc; ++l) {
+                    for (idx_t j = 0; j < nr; ++j)
+                        Bp[j] = conj(B(j0 + jr + j, l0 + l));
+                    for (idx_t j = nr; j < NR; ++j)
+                        Bp[j] = TB(0);
+                    Bp += NR;
+                }
+            }
+        }
+    }
+
+    /**
+     * Micro-kernel of gemm_blocked(): computes the MR-by-NR product
+     * $acc := Ap \times Bp$, where Ap is a packed MR-by-kc sliver of op(A)
+     * and Bp is a packed kc-by-NR sliver of op(B).
+     *
+     * acc is stored in column-major order. All loop bounds are compile-time
+     * constants, so the compiler can keep acc in registers. For float, double
+     * and complex entries, the SIMD kernels in simd.hpp are used when
+     * available.
+     */
+    template <size_t MR, size_t NR, class TA, class TB, class scalar_t>
+    inline void gemm_microkernel(size_t kc,
+                                 const TA* Ap,
+                                 const TB* Bp,
+                                 scalar_t* acc)
+    {
+        // SIMD kernels for float, double and complex
+        if constexpr (is_same_v<TA, scalar_t> && is_same_v<TB, scalar_t> &&
+                      is_simd_type<scalar_t>) {
+            if (simd::gemm<MR, NR>(kc, Ap, Bp, acc)) return;
+        }
+
+        for (size_t i = 0; i < MR * NR; ++i)
+            acc[i] = scalar_t(0);
+        for (size_t l = 0; l < kc; ++l) {
+            for (size_t j = 0; j < NR; ++j) {
+                const TB blj = Bp[j];
+                for (size_t i = 0; i < MR; ++i)
+                    acc[i + j * MR] += Ap[i] * blj;
+            }
+            Ap += MR;
+            Bp += NR;
+        }
+    }
+
+}  // namespace internal
+
+template <class T>
+constexpr GemmBlockedOpts GemmBlockedOpts::defaults() noexcept
+{
+    constexpr size_t MR = internal::gemm_mr<T>;
+    constexpr size_t NR = internal::gemm_nr<T>;
+    constexpr size_t s = sizeof(T);
+
+    GemmBlockedOpts opts;
+    opts.kc = internal::gemm_round(
+        min<size_t>(TLAPACK_L1_CACHE_SIZE / (2 * NR * s), 256), 8);
+    opts.mc = internal::gemm_round(
+        min<size_t>(TLAPACK_L2_CACHE_SIZE / (2 * opts.kc * s), 256), MR);
+    opts.nc = internal::gemm_round(
+        min<size_t>(TLAPACK_L3_CACHE_SIZE / (2 * opts.kc * s), 4096), NR);
+    opts.nx = 2 * MR;
+    return opts;
+}
+
+/**
+ * General matrix-matrix multiply using a cache-blocked algorithm:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * where $op(X)$ is one of
+ *     $op(X) = X$,
+ *     $op(X) = X^T$, or
+ *     $op(X) = X^H$,
+ * alpha and beta are scalars, and A, B, and C are matrices, with
+ * $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
+ *
+ * The algorithm follows the GotoBLAS/BLIS scheme. op(B) is packed in
+ * kc-by-nc panels and op(A) in mc-by-kc blocks, both into contiguous buffers
+ * of entries of type type_t<matrixB_t> and type_t<matrixA_t>. The
+ * micro-kernel then updates each MR-by-NR tile of C from the packed data.
+ * Transposition and conjugation are applied during packing, so the
+ * micro-kernel is the same for all combinations of transA and transB.
+ *
+ * @param[in] transA
+ *     The operation $op(A)$ to be used:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] transB
+ *     The operation $op(B)$ to be used:
+ *     - Op::NoTrans:   $op(B) = B$.
+ *     - Op::Trans:     $op(B) = B^T$.
+ *     - Op::ConjTrans: $op(B) = B^H$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix.
+ * @param[in] opts Options. Zero-valued block sizes are replaced by
+ *      GemmBlockedOpts::defaults<scalar_type<TA,TB>>().
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemm_blocked(Op transA,
+                  Op transB,
+                  const alpha_t& alpha,
+                  const matrixA_t& A,
+                  const matrixB_t& B,
+                  const beta_t& beta,
+                  matrixC_t& C,
+                  const GemmBlockedOpts& opts = {})
+{
+    // data traits
+    using TA = type_t<matrixA_t>;
+    using TB = type_t<matrixB_t>;
+    using idx_t = size_type<matrixA_t>;
+    using scalar_t = scalar_type<TA, TB>;
+
+    // register tile
+    constexpr idx_t MR = internal::gemm_mr<scalar_t>;
+    constexpr idx_t NR = internal::gemm_nr<scalar_t>;
+
+    // constants
+    const idx_t m = (transA == Op::NoTrans) ? nrows(A) : ncols(A);
+    const idx_t n = (transB == Op::NoTrans) ? ncols(B) : nrows(B);
+    const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+
+    // block sizes
+    constexpr GemmBlockedOpts defaults =
+        GemmBlockedOpts::defaults<scalar_t>();
+    const idx_t mc = internal::gemm_round(
+        (opts.mc > 0) ? opts.mc : defaults.mc, MR);
+    const idx_t kc = (opts.kc > 0) ? opts.kc : defaults.kc;
+    const idx_t nc = internal::gemm_round(
+        (opts.nc > 0) ? opts.nc : defaults.nc, NR);
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false((idx_t)nrows(C) != m);
+    tlapack_check_false((idx_t)ncols(C) != n);
+    tlapack_check_false(
+        (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
+
+    // C := beta C
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            C(i, j) *= beta;
+
+    // Quick return
+    if (m == 0 || n == 0 || k == 0) return;
+
+    // Packing buffers
+    const idx_t mcMax = min(mc, ((m + MR - 1) / MR) * MR);
+    const idx_t kcMax = min(kc, k);
+    const idx_t ncMax = min(nc, ((n + NR - 1) / NR) * NR);
+    workspace_vector<TA> Ap_(mcMax * kcMax);
+    workspace_vector<TB> Bp_(kcMax * ncMax);
+    scalar_t acc[MR * NR];
+
+    for (idx_t jc = 0; jc < n; jc += nc) {
+        const idx_t nb = min(nc, n - jc);
+        for (idx_t pc = 0; pc < k; pc += kc) {
+            const idx_t kb = min(kc, k - pc);
+
+            // Pack op(B)(pc:pc+kb, jc:jc+nb)
+            internal::gemm_pack_B<NR>(transB, B, pc, kb, jc, nb, Bp_.data());
+
+            for (idx_t ic = 0; ic < m; ic += mc) {
+                const idx_t mb = min(mc, m - ic);
+
+                // Pack op(A)(ic:ic+mb, pc:pc+kb)
+                internal::gemm_pack_A<MR>(transA, A, ic, mb, pc, kb,
+                                          Ap_.data());
+
+                // Macro-kernel
+                for (idx_t jr = 0; jr < nb; jr += NR) {
+                    const idx_t nr = min(NR, nb - jr);
+                    const TB* Bp = Bp_.data() + jr * kb;
+                    for (idx_t ir = 0; ir < mb; ir += MR) {
+                        const idx_t mr = min(MR, mb - ir);
+                        const TA* Ap = Ap_.data() + ir * kb;
+
+                        internal::gemm_microkernel<MR, NR>(kb, Ap, Bp, acc);
+
+                        for (idx_t j = 0; j < nr; ++j)
+                            for (idx_t i = 0; i < mr; ++i)
+                                C(ic + ir + i, jc + jr + j) +=
+                                    alpha * acc[i + j * MR];
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  //  #ifndef TLAPACK_BLAS_GEMM_BLOCKED_HH
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_GEMV_HH
 #define TLAPACK_BLAS_GEMV_HH
 
+#include "tlapack/base/simd.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/conjugate.hpp"
 
@@ -85,6 +86,36 @@ void gemv(Op trans,
     for (idx_t i = 0; i < m; ++i)
         y[i] *= beta;
 
+    // SIMD kernels for column-major A and contiguous vectors
+    if constexpr (internal::is_simd_matrix<matrixA_t> &&
+                  internal::is_simd_vector<vectorY_t> && is_same_v<TA, T> &&
+                  is_same_v<TX, T> && internal::is_simd_scalar<T, alpha_t>) {
+        if (trans == Op::NoTrans && y.inc == 1 &&
+            simd_isa() != SimdIsa::None) {
+            // form y += alpha * A * x
+            for (idx_t j = 0; j < n; ++j) {
+                const T tmp = alpha * x[j];
+                internal::simd::axpy(m, tmp, &A.ptr[j * A.ldim], y.ptr);
+            }
+            return;
+        }
+    }
+    if constexpr (internal::is_simd_matrix<matrixA_t> &&
+                  internal::is_simd_vector<vectorX_t> && is_same_v<TA, T> &&
+                  is_same_v<TX, T>) {
+        if ((trans == Op::Trans || trans == Op::ConjTrans) && x.inc == 1 &&
+            simd_isa() != SimdIsa::None) {
+            // form y += alpha * op(A) * x
+            for (idx_t i = 0; i < m; ++i) {
+                T tmp(0);
+                internal::simd::dot(n, trans == Op::ConjTrans,
+                                    &A.ptr[i * A.ldim], x.ptr, tmp);
+                y[i] += alpha * tmp;
+            }
+            return;
+        }
+    }
+
     if (trans == Op::NoTrans) {
         // form y += alpha * A * x
         for (idx_t j = 0; j < n; ++j) {
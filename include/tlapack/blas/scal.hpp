@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_SCAL_HH
 #define TLAPACK_BLAS_SCAL_HH
 
+#include "tlapack/base/simd.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -34,6 +35,12 @@ void scal(const alpha_t& alpha, vector_t& x)
     // constants
     const idx_t n = size(x);
 
+    // SIMD kernels for contiguous data
+    if constexpr (internal::is_simd_vector<vector_t> &&
+                  internal::is_simd_scalar<T, alpha_t>) {
+        if (x.inc == 1 && internal::simd::scal(n, alpha, x.ptr)) return;
+    }
+
     for (idx_t i = 0; i < n; ++i)
         x[i] *= alpha;
 }
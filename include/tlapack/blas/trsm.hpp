@@ -12,9 +12,313 @@
 #define TLAPACK_BLAS_TRSM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /// Unblocked algorithm of trsm(), taken from the reference BLAS
+    template <TLAPACK_MATRIX matrixA_t,
+              TLAPACK_MATRIX matrixB_t,
+              TLAPACK_SCALAR alpha_t>
+    void trsm_level2(Side side,
+                     Uplo uplo,
+                     Op trans,
+                     Diag diag,
+                     const alpha_t& alpha,
+                     const matrixA_t& A,
+                     matrixB_t& B)
+    {
+        // data traits
+        using idx_t = size_type<matrixA_t>;
+        using TB = type_t<matrixB_t>;
+
+        // constants
+        const idx_t m = nrows(B);
+        const idx_t n = ncols(B);
+
+        if (side == Side::Left) {
+            using scalar_t = scalar_type<alpha_t, TB>;
+            if (trans == Op::NoTrans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, j) *= alpha;
+                        for (idx_t k = m - 1; k != idx_t(-1); --k) {
+                            if (diag == Diag::NonUnit) B(k, j) /= A(k, k);
+                            for (idx_t i = 0; i < k; ++i)
+                                B(i, j) -= A(i, k) * B(k, j);
+                        }
+                    }
+                }
+                else {  // uplo == Uplo::Lower
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, j) *= alpha;
+                        for (idx_t k = 0; k < m; ++k) {
+                            if (diag == Diag::NonUnit) B(k, j) /= A(k, k);
+                            for (idx_t i = k + 1; i < m; ++i)
+                                B(i, j) -= A(i, k) * B(k, j);
+                        }
+                    }
+                }
+            }
+            else if (trans == Op::Trans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = 0; i < m; ++i) {
+                            scalar_t sum = alpha * B(i, j);
+                            for (idx_t k = 0; k < i; ++k)
+                                sum -= A(k, i) * B(k, j);
+                            B(i, j) =
+                                (diag == Diag::NonUnit) ? sum / A(i, i) : sum;
+                        }
+                    }
+                }
+                else {  // uplo == Uplo::Lower
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = m - 1; i != idx_t(-1); --i) {
+                            scalar_t sum = alpha * B(i, j);
+                            for (idx_t k = i + 1; k < m; ++k)
+                                sum -= A(k, i) * B(k, j);
+                            B(i, j) =
+                                (diag == Diag::NonUnit) ? sum / A(i, i) : sum;
+                        }
+                    }
+                }
+            }
+            else {  // trans == Op::ConjTrans
+                if (uplo == Uplo::Upper) {
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = 0; i < m; ++i) {
+                            scalar_t sum = alpha * B(i, j);
+                            for (idx_t k = 0; k < i; ++k)
+                                sum -= conj(A(k, i)) * B(k, j);
+                            B(i, j) = (diag == Diag::NonUnit)
+                                          ? sum / conj(A(i, i))
+                                          : sum;
+                        }
+                    }
+                }
+                else {  // uplo == Uplo::Lower
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = m - 1; i != idx_t(-1); --i) {
+                            scalar_t sum = alpha * B(i, j);
+                            for (idx_t k = i + 1; k < m; ++k)
+                                sum -= conj(A(k, i)) * B(k, j);
+                            B(i, j) = (diag == Diag::NonUnit)
+                                          ? sum / conj(A(i, i))
+                                          : sum;
+                        }
+                    }
+                }
+            }
+        }
+        else {  // side == Side::Right
+            if (trans == Op::NoTrans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, j) *= alpha;
+                        for (idx_t k = 0; k < j; ++k) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) -= B(i, k) * A(k, j);
+                        }
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) /= A(j, j);
+                        }
+                    }
+                }
+                else {  // uplo == Uplo::Lower
+                    for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, j) *= alpha;
+                        for (idx_t k = j + 1; k < n; ++k) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) -= B(i, k) * A(k, j);
+                        }
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) /= A(j, j);
+                        }
+                    }
+                }
+            }
+            else if (trans == Op::Trans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t k = n - 1; k != idx_t(-1); --k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, k) /= A(k, k);
+                        }
+                        for (idx_t j = 0; j < k; ++j) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) -= B(i, k) * A(j, k);
+                        }
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, k) *= alpha;
+                    }
+                }
+                else {  // uplo == Uplo::Lower
+                    for (idx_t k = 0; k < n; ++k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, k) /= A(k, k);
+                        }
+                        for (idx_t j = k + 1; j < n; ++j) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) -= B(i, k) * A(j, k);
+                        }
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, k) *= alpha;
+                    }
+                }
+            }
+            else {  // trans == Op::ConjTrans
+                if (uplo == Uplo::Upper) {
+                    for (idx_t k = n - 1; k != idx_t(-1); --k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, k) /= conj(A(k, k));
+                        }
+                        for (idx_t j = 0; j < k; ++j) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) -= B(i, k) * conj(A(j, k));
+                        }
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, k) *= alpha;
+                    }
+                }
+                else {  // uplo == Uplo::Lower
+                    for (idx_t k = 0; k < n; ++k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, k) /= conj(A(k, k));
+                        }
+                        for (idx_t j = k + 1; j < n; ++j) {
+                            for (idx_t i = 0; i < m; ++i)
+                                B(i, j) -= B(i, k) * conj(A(j, k));
+                        }
+                        for (idx_t i = 0; i < m; ++i)
+                            B(i, k) *= alpha;
+                    }
+                }
+            }
+        }
+    }
+
+    /// Order of the triangular matrices solved by trsm_level2() in trsm()
+    template <class T>
+    constexpr size_t trsm_nb = 64;
+
+    /// True if trsm_recursive() can split matrices of type matrix_t, see
+    /// concepts::SliceableMatrix
+    template <class matrix_t, class = void>
+    constexpr bool trsm_sliceable = false;
+
+    template <class matrix_t>
+    constexpr bool trsm_sliceable<
+        matrix_t,
+        std::void_t<decltype(slice(std::declval<const matrix_t&>(),
+                                   pair<int, int>{0, 1},
+                                   pair<int, int>{0, 1}))>> = true;
+
+    /**
+     * Recursive algorithm of trsm().
+     *
+     * The triangular matrix is split in two halves, and the off-diagonal
+     * block is applied with gemm(). The recursion stops when the order of
+     * the triangular matrix is at most trsm_nb. Most of the flops are then
+     * done by gemm().
+     */
+    template <TLAPACK_SMATRIX matrixA_t,
+              TLAPACK_SMATRIX matrixB_t,
+              TLAPACK_SCALAR alpha_t>
+    void trsm_recursive(Side side,
+                        Uplo uplo,
+                        Op trans,
+                        Diag diag,
+                        const alpha_t& alpha,
+                        const matrixA_t& A,
+                        matrixB_t& B)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using TB = type_t<matrixB_t>;
+        using real_t = real_type<scalar_type<alpha_t, TB>>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t one(1);
+        const idx_t k = nrows(A);
+        const idx_t nb = trsm_nb<scalar_type<type_t<matrixA_t>, TB>>;
+
+        if (k <= nb) return trsm_level2(side, uplo, trans, diag, alpha, A, B);
+
+        // Split A in blocks whose order is a multiple of nb when possible
+        const idx_t k1 = (k / 2 > nb) ? ((k / 2) / nb) * nb : k / 2;
+
+        const auto A11 = slice(A, range{0, k1}, range{0, k1});
+        const auto A12 = slice(A, range{0, k1}, range{k1, k});
+        const auto A21 = slice(A, range{k1, k}, range{0, k1});
+        const auto A22 = slice(A, range{k1, k}, range{k1, k});
+
+        // upper is true if op(A) is upper triangular
+        const bool upper = (uplo == Uplo::Upper) == (trans == Op::NoTrans);
+
+        if (side == Side::Left) {
+            auto B1 = rows(B, range{0, k1});
+            auto B2 = rows(B, range{k1, k});
+            if (upper) {
+                // Solve op(A22) X2 = alpha B2, then op(A11) X1 = alpha B1 -
+                // op(A12) X2, where A12 is stored in A21 when trans != NoTrans
+                trsm_recursive(side, uplo, trans, diag, alpha, A22, B2);
+                if (trans == Op::NoTrans)
+                    gemm(NO_TRANS, NO_TRANS, -one, A12, B2, alpha, B1);
+                else
+                    gemm(trans, NO_TRANS, -one, A21, B2, alpha, B1);
+                trsm_recursive(side, uplo, trans, diag, one, A11, B1);
+            }
+            else {
+                // Solve op(A11) X1 = alpha B1, then op(A22) X2 = alpha B2 -
+                // op(A21) X1, where A21 is stored in A12 when trans != NoTrans
+                trsm_recursive(side, uplo, trans, diag, alpha, A11, B1);
+                if (trans == Op::NoTrans)
+                    gemm(NO_TRANS, NO_TRANS, -one, A21, B1, alpha, B2);
+                else
+                    gemm(trans, NO_TRANS, -one, A12, B1, alpha, B2);
+                trsm_recursive(side, uplo, trans, diag, one, A22, B2);
+            }
+        }
+        else {  // side == Side::Right
+            auto B1 = cols(B, range{0, k1});
+            auto B2 = cols(B, range{k1, k});
+            if (upper) {
+                // Solve X1 op(A11) = alpha B1, then X2 op(A22) = alpha B2 -
+                // X1 op(A12), where A12 is stored in A21 when trans != NoTrans
+                trsm_recursive(side, uplo, trans, diag, alpha, A11, B1);
+                if (trans == Op::NoTrans)
+                    gemm(NO_TRANS, NO_TRANS, -one, B1, A12, alpha, B2);
+                else
+                    gemm(NO_TRANS, trans, -one, B1, A21, alpha, B2);
+                trsm_recursive(side, uplo, trans, diag, one, A22, B2);
+            }
+            else {
+                // Solve X2 op(A22) = alpha B2, then X1 op(A11) = alpha B1 -
+                // X2 op(A21), where A21 is stored in A12 when trans != NoTrans
+                trsm_recursive(side, uplo, trans, diag, alpha, A22, B2);
+                if (trans == Op::NoTrans)
+                    gemm(NO_TRANS, NO_TRANS, -one, B2, A21, alpha, B1);
+                else
+                    gemm(NO_TRANS, trans, -one, B2, A12, alpha, B1);
+                trsm_recursive(side, uplo, trans, diag, one, A11, B1);
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * Solve the triangular matrix-vector equation
  * \[
@@ -34,6 +338,10 @@ namespace tlapack {
  * No test for singularity or near-singularity is included in this
  * routine. Such tests must be performed before calling this routine.
  *
+ * @note If the order of A is larger than internal::trsm_nb and A and B can be
+ *      sliced, the triangular matrix is split recursively and most of the
+ *      work is done by gemm().
+ *
  * @param[in] side
  *     Whether $op(A)$ is on the left or right of X:
  *     - Side::Left:  $op(A) X = B$.
@@ -98,171 +406,15 @@ void trsm(Side side,
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
 
-    if (side == Side::Left) {
-        using scalar_t = scalar_type<alpha_t, TB>;
-        if (trans == Op::NoTrans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, j) *= alpha;
-                    for (idx_t k = m - 1; k != idx_t(-1); --k) {
-                        if (diag == Diag::NonUnit) B(k, j) /= A(k, k);
-                        for (idx_t i = 0; i < k; ++i)
-                            B(i, j) -= A(i, k) * B(k, j);
-                    }
-                }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, j) *= alpha;
-                    for (idx_t k = 0; k < m; ++k) {
-                        if (diag == Diag::NonUnit) B(k, j) /= A(k, k);
-                        for (idx_t i = k + 1; i < m; ++i)
-                            B(i, j) -= A(i, k) * B(k, j);
-                    }
-                }
-            }
-        }
-        else if (trans == Op::Trans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = 0; i < m; ++i) {
-                        scalar_t sum = alpha * B(i, j);
-                        for (idx_t k = 0; k < i; ++k)
-                            sum -= A(k, i) * B(k, j);
-                        B(i, j) = (diag == Diag::NonUnit) ? sum / A(i, i) : sum;
-                    }
-                }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = m - 1; i != idx_t(-1); --i) {
-                        scalar_t sum = alpha * B(i, j);
-                        for (idx_t k = i + 1; k < m; ++k)
-                            sum -= A(k, i) * B(k, j);
-                        B(i, j) = (diag == Diag::NonUnit) ? sum / A(i, i) : sum;
-                    }
-                }
-            }
-        }
-        else {  // trans == Op::ConjTrans
-            if (uplo == Uplo::Upper) {
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = 0; i < m; ++i) {
-                        scalar_t sum = alpha * B(i, j);
-                        for (idx_t k = 0; k < i; ++k)
-                            sum -= conj(A(k, i)) * B(k, j);
-                        B(i, j) =
-                            (diag == Diag::NonUnit) ? sum / conj(A(i, i)) : sum;
-                    }
-                }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = m - 1; i != idx_t(-1); --i) {
-                        scalar_t sum = alpha * B(i, j);
-                        for (idx_t k = i + 1; k < m; ++k)
-                            sum -= conj(A(k, i)) * B(k, j);
-                        B(i, j) =
-                            (diag == Diag::NonUnit) ? sum / conj(A(i, i)) : sum;
-                    }
-                }
-            }
-        }
-    }
-    else {  // side == Side::Right
-        if (trans == Op::NoTrans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, j) *= alpha;
-                    for (idx_t k = 0; k < j; ++k) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(k, j);
-                    }
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) /= A(j, j);
-                    }
-                }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, j) *= alpha;
-                    for (idx_t k = j + 1; k < n; ++k) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(k, j);
-                    }
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) /= A(j, j);
-                    }
-                }
-            }
-        }
-        else if (trans == Op::Trans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t k = n - 1; k != idx_t(-1); --k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= A(k, k);
-                    }
-                    for (idx_t j = 0; j < k; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(j, k);
-                    }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
-                }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t k = 0; k < n; ++k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= A(k, k);
-                    }
-                    for (idx_t j = k + 1; j < n; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(j, k);
-                    }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
-                }
-            }
-        }
-        else {  // trans == Op::ConjTrans
-            if (uplo == Uplo::Upper) {
-                for (idx_t k = n - 1; k != idx_t(-1); --k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= conj(A(k, k));
-                    }
-                    for (idx_t j = 0; j < k; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * conj(A(j, k));
-                    }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
-                }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t k = 0; k < n; ++k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= conj(A(k, k));
-                    }
-                    for (idx_t j = k + 1; j < n; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * conj(A(j, k));
-                    }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
-                }
-            }
-        }
+    // Recursive algorithm for large triangular matrices that can be sliced
+    if constexpr (internal::trsm_sliceable<matrixA_t> &&
+                  internal::trsm_sliceable<matrixB_t>) {
+        const idx_t k = (side == Side::Left) ? m : n;
+        if (k > internal::trsm_nb<scalar_type<type_t<matrixA_t>, TB>>)
+            return internal::trsm_recursive(side, uplo, trans, diag, alpha, A,
+                                            B);
     }
+    internal::trsm_level2(side, uplo, trans, diag, alpha, A, B);
 }
 
 #ifdef TLAPACK_USE_LAPACKPP
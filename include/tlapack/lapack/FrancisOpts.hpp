@@ -13,6 +13,7 @@
 #include <cmath>
 #include <functional>
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -22,9 +23,13 @@ namespace tlapack {
  */
 struct FrancisOpts {
     /// Function that returns the number of shifts to use
-    /// for a given matrix size
+    /// for a given matrix size. The entries ("multishift_qr", "nshift") of
+    /// the tuning profile take precedence over the built-in values.
     std::function<size_t(size_t, size_t)> nshift_recommender =
         [](size_t n, size_t nh) -> size_t {
+        const size_t ns = tuning_profile().get("multishift_qr", "nshift", "*",
+                                               n, 0);
+        if (ns > 0) return ns;
         if (n < 30) return 2;
         if (n < 60) return 4;
         if (n < 150) return 10;
@@ -34,10 +39,14 @@ struct FrancisOpts {
         return 256;
     };
 
-    /// Function that returns the number of shifts to use
-    /// for a given matrix size
+    /// Function that returns the size of the deflation window to use
+    /// for a given matrix size. The entries ("multishift_qr", "nw") of the
+    /// tuning profile take precedence over the built-in values.
     std::function<size_t(size_t, size_t)> deflation_window_recommender =
         [](size_t n, size_t nh) -> size_t {
+        const size_t nw =
+            tuning_profile().get("multishift_qr", "nw", "*", n, 0);
+        if (nw > 0) return nw;
         if (n < 30) return 2;
         if (n < 60) return 4;
         if (n < 150) return 10;
@@ -54,9 +63,9 @@ struct FrancisOpts {
     int n_shifts_total = 0;  ///< total number of shifts used
 
     /// Threshold to switch between blocked and unblocked code
-    size_t nmin = 75;
+    size_t nmin = tuned_default("multishift_qr", "nmin", 75);
     /// Threshold of percent of AED window that must converge to skip a sweep
-    size_t nibble = 14;
+    size_t nibble = tuned_default("multishift_qr", "nibble", 14);
 };
 
 // Forward declarations:
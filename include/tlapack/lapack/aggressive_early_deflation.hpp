@@ -649,7 +649,7 @@ void aggressive_early_deflation(bool want_t,
     // Allocates workspace
     WorkInfo workinfo = aggressive_early_deflation_worksize<T>(
         want_t, want_z, ilo, ihi, nw, A, s, Z, ns, nd, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     aggressive_early_deflation_work(want_t, want_z, ilo, ihi, nw, A, s, Z, ns,
@@ -0,0 +1,704 @@
+/// @file bdsdc.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dbdsdc.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd1.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd2.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BDSDC_HH
+#define TLAPACK_BDSDC_HH
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/lartg.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laed4.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/svd_qr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for bdsdc
+ */
+struct BdsdcOpts {
+    /// Subproblems of size at most nmin are solved by svd_qr(). 0: tuned
+    /// value, see tuned_option()
+    size_t nmin = 0;
+    ExecutionPolicy exec = {};  ///< Execution policy of the independent
+                                ///< subproblems and of the singular vector
+                                ///< updates
+};
+
+namespace internal {
+
+    /**
+     * Merges the SVDs of two adjacent subproblems.
+     *
+     * The n-by-(n+sqre) upper bidiagonal matrix B, where sqre = ncols(Vt) -
+     * n is 0 or 1, is split as
+     *
+     *      B = [ B1       0          ]
+     *          [ alpha e^T  beta f^T ]
+     *          [ 0        B2         ],
+     *
+     * where B1 is nl-by-(nl+1), B2 is (n-nl-1)-by-(n-nl-1+sqre), and e and f
+     * are the last and the first canonical vectors. On entry,
+     * U = diag(U1, 1, U2) and Vt = diag(Vt1, Vt2) contain the singular
+     * vectors of B1 and B2, and d[0:nl] and d[nl+1:n] their singular values.
+     * The last row of Vt1, and the last row of Vt2 if sqre = 1, span the null
+     * spaces of B1 and B2. On exit, U, Vt and d contain the SVD of B. If
+     * sqre = 1, the last row of Vt spans the null space of B.
+     *
+     * In the basis of the singular vectors of B1 and B2, B is diagonal
+     * except for the row nl. The two null vectors are first combined by a
+     * rotation. The squares of the singular values of the resulting matrix
+     * are the eigenvalues of a rank-one modification of a diagonal matrix,
+     * computed by laed4(). Singular values are deflated when the
+     * corresponding entry of z is small or when two of them are close. The
+     * singular vectors are computed as in Gu and Eisenstat, and are
+     * multiplied by U and Vt with gemm() calls that skip the zero blocks.
+     *
+     * @param[in,out] d Real vector of length n.
+     * @param[in,out] U n-by-n real matrix.
+     * @param[in,out] Vt (n+sqre)-by-(n+sqre) real matrix.
+     * @param[in] nl Number of rows of B1. 0 < nl < n-1.
+     * @param[in] alpha Diagonal element of the row nl of B.
+     * @param[in] beta Off-diagonal element of the row nl of B.
+     * @param[in] opts Options.
+     *
+     * @return 0 if success.
+     * @return 1 if laed4() failed to converge.
+     */
+    template <class d_t, class matrix_t>
+    int bdsdc_merge(d_t& d,
+                    matrix_t& U,
+                    matrix_t& Vt,
+                    size_type<matrix_t> nl,
+                    type_t<matrix_t> alpha,
+                    type_t<matrix_t> beta,
+                    const BdsdcOpts& opts)
+    {
+        using idx_t = size_type<matrix_t>;
+        using real_t = type_t<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // Functor
+        Create<matrix_t> new_matrix;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+        const idx_t m = ncols(Vt);
+        const bool sqre = (m > n);
+        const idx_t nb = max<idx_t>(opts.nmin, 1);
+        const real_t eps = uroundoff<real_t>();
+
+        // Local workspaces
+        workspace_vector<real_t> z(n), dsigma(n), D(n), w(n), dnew(n);
+        workspace_vector<idx_t> indx(n), indxp(n), coltyp(n), g(n), perm(n);
+
+        // Row nl of B in the basis of the right singular vectors of B1 and B2
+        for (idx_t j = 0; j < n; ++j)
+            z[j] = alpha * Vt(j, nl) + beta * Vt(j, nl + 1);
+
+        // Combine the null vectors of B1 and B2. The row nl of Vt is now
+        // the only one with a pole at zero
+        if (sqre) {
+            real_t c, s, r;
+            lartg(z[nl], beta * Vt(n, nl + 1), c, s, r);
+            z[nl] = r;
+            auto vt1 = row(Vt, nl);
+            auto vt2 = row(Vt, n);
+            rot(vt1, vt2, c, s);
+        }
+        d[nl] = zero;
+
+        // Permutation that sorts the poles in ascending order, with the pole
+        // at zero first
+        std::iota(indx.begin(), indx.end(), idx_t(0));
+        std::stable_sort(indx.begin(), indx.end(), [&](idx_t a, idx_t b) {
+            return (a == nl) ? (b != nl) : (b != nl && d[a] < d[b]);
+        });
+
+        // Column types of U and row types of Vt: 1 if the nonzeros are in the
+        // first block, 3 if they are in the second block, 2 if they are in
+        // both blocks and 4 if the singular value is deflated. The row nl of
+        // U has a single nonzero, in the column nl
+        for (idx_t i = 0; i < n; ++i)
+            coltyp[i] = (i < nl) ? 1 : 3;
+        coltyp[nl] = 2;
+
+        // Deflation tolerance
+        real_t dmax = max(abs(alpha), abs(beta));
+        for (idx_t i = 0; i < n; ++i)
+            dmax = max(dmax, abs(d[i]));
+        const real_t tol = real_t(8) * eps * dmax;
+
+        // The pole at zero is never deflated
+        if (abs(z[nl]) <= tol) z[nl] = tol;
+
+        // Deflation. The k singular values that are not deflated are listed
+        // in indxp[0:k] in ascending order
+        idx_t k = 0;
+        indxp[k++] = nl;
+        idx_t pj = n;
+        for (idx_t jj = 1; jj < n; ++jj) {
+            const idx_t nj = indx[jj];
+
+            // Deflate due to a small entry of z
+            if (abs(z[nj]) <= tol) {
+                coltyp[nj] = 4;
+                continue;
+            }
+
+            if (pj == n) {
+                pj = nj;
+                continue;
+            }
+
+            // Check if the singular values are close enough to deflate
+            if (abs(d[nj] - d[pj]) <= tol) {
+                // Deflate d[pj] with a rotation of the singular vectors
+                real_t s = z[pj];
+                real_t c = z[nj];
+                const real_t tau = lapy2(c, s);
+                c /= tau;
+                s = -s / tau;
+                z[nj] = tau;
+                z[pj] = zero;
+                if (coltyp[nj] != coltyp[pj]) coltyp[nj] = 2;
+                coltyp[pj] = 4;
+
+                auto up = col(U, pj);
+                auto un = col(U, nj);
+                rot(up, un, c, s);
+                auto vtp = row(Vt, pj);
+                auto vtn = row(Vt, nj);
+                rot(vtp, vtn, c, s);
+            }
+            else
+                indxp[k++] = pj;
+            pj = nj;
+        }
+        if (pj != n) indxp[k++] = pj;
+
+        // Poles of the secular equation. The smallest nonzero pole is kept
+        // away from zero
+        for (idx_t i = 0; i < k; ++i) {
+            dsigma[i] = d[indxp[i]];
+            w[i] = z[indxp[i]];
+        }
+        if (k > 1 && dsigma[1] < tol) dsigma[1] = tol;
+        real_t rho(0);
+        for (idx_t i = 0; i < k; ++i) {
+            D[i] = dsigma[i] * dsigma[i];
+            rho += w[i] * w[i];
+        }
+        const real_t rnorm = sqrt(rho);
+        for (idx_t i = 0; i < k; ++i)
+            w[i] /= rnorm;
+
+        // Group the singular values that are not deflated by type. The
+        // column indxp[i] of U and row indxp[i] of Vt go to the position g[i]
+        idx_t ctot[3] = {0, 0, 0};
+        for (idx_t i = 0; i < k; ++i)
+            ++ctot[coltyp[indxp[i]] - 1];
+        idx_t pos[3] = {0, ctot[0], ctot[0] + ctot[1]};
+        for (idx_t i = 0; i < k; ++i)
+            g[i] = pos[coltyp[indxp[i]] - 1]++;
+        const idx_t n12 = ctot[0] + ctot[1];
+        const idx_t n23 = ctot[1] + ctot[2];
+
+        // Nonzero blocks of the grouped columns of U and rows of Vt
+        workspace_vector<real_t> Wu_, Wvt_, Unew_, Vtnew_, Uk_, Vk_, Delta_;
+        auto Wu = new_matrix(Wu_, n, n);
+        auto Wvt = new_matrix(Wvt_, m, m);
+        auto Utop = slice(Wu, range{0, nl}, range{0, n12});
+        auto Ubot = slice(Wu, range{nl + 1, n}, range{0, n23});
+        auto Vttop = slice(Wvt, range{0, n12}, range{0, nl + 1});
+        auto Vtbot = slice(Wvt, range{0, n23}, range{nl + 1, m});
+        for (idx_t i = 0; i < k; ++i) {
+            const idx_t p = indxp[i];
+            if (coltyp[p] <= 2) {
+                for (idx_t r = 0; r < nl; ++r)
+                    Utop(r, g[i]) = U(r, p);
+                for (idx_t c = 0; c <= nl; ++c)
+                    Vttop(g[i], c) = Vt(p, c);
+            }
+            if (coltyp[p] >= 2) {
+                for (idx_t r = nl + 1; r < n; ++r)
+                    Ubot(r - nl - 1, g[i] - ctot[0]) = U(r, p);
+                for (idx_t c = nl + 1; c < m; ++c)
+                    Vtbot(g[i] - ctot[0], c - nl - 1) = Vt(p, c);
+            }
+        }
+
+        auto Unew = new_matrix(Unew_, n, n);
+        auto Vtnew = new_matrix(Vtnew_, m, m);
+
+        // Solve the secular equation. Delta(:,j) stores D - dnew[j]^2
+        auto Delta = new_matrix(Delta_, k, k);
+        std::atomic<int> info(0);
+        parallel_for_blocks(opts.exec, k, nb, [&](idx_t j0, idx_t j1) {
+            for (idx_t j = j0; j < j1; ++j) {
+                auto delta = col(Delta, j);
+                real_t lambda;
+                if (laed4(k, j, D, w, delta, rho, lambda) != 0) info = 1;
+                dnew[j] = sqrt(lambda);
+                if (k <= 2)
+                    for (idx_t i = 0; i < k; ++i)
+                        delta[i] = D[i] - lambda;
+            }
+        });
+        if (info != 0) return info;
+
+        // Recompute z so that the singular vectors are numerically
+        // orthogonal (Gu and Eisenstat)
+        if (k > 2) {
+            parallel_for_blocks(opts.exec, k, nb, [&](idx_t i0, idx_t i1) {
+                for (idx_t i = i0; i < i1; ++i) {
+                    real_t wi = Delta(i, i);
+                    for (idx_t j = 0; j < k; ++j)
+                        if (j != i) wi *= Delta(i, j) / (D[i] - D[j]);
+                    w[i] = (w[i] < zero) ? -sqrt(-wi) : sqrt(-wi);
+                }
+            });
+        }
+        else {
+            for (idx_t i = 0; i < k; ++i)
+                w[i] *= rnorm;
+        }
+
+        // Singular vectors of the rank-one modification, in the grouped order
+        auto Uk = new_matrix(Uk_, k, k);
+        auto Vk = new_matrix(Vk_, k, k);
+        parallel_for_blocks(opts.exec, k, nb, [&](idx_t j0, idx_t j1) {
+            for (idx_t j = j0; j < j1; ++j) {
+                auto u = col(Uk, j);
+                auto v = col(Vk, j);
+                for (idx_t i = 0; i < k; ++i) {
+                    v[g[i]] = w[i] / Delta(i, j);
+                    u[g[i]] = dsigma[i] * v[g[i]];
+                }
+                u[g[0]] = -one;
+                scal(one / nrm2(u), u);
+                scal(one / nrm2(v), v);
+            }
+        });
+
+        // Update the singular vectors:
+        // Unew = [Utop 0; 0 1 0; 0 Ubot] Uk and Vtnew = Vk^T [Vttop 0; 0 Vtbot]
+        parallel_for_blocks(opts.exec, k, nb, [&](idx_t j0, idx_t j1) {
+            auto Unew1 = slice(Unew, range{0, nl}, range{j0, j1});
+            auto Unew2 = slice(Unew, range{nl + 1, n}, range{j0, j1});
+            auto Vtnew1 = slice(Vtnew, range{j0, j1}, range{0, nl + 1});
+            auto Vtnew2 = slice(Vtnew, range{j0, j1}, range{nl + 1, m});
+            const auto Uk1 = slice(Uk, range{0, n12}, range{j0, j1});
+            const auto Uk2 = slice(Uk, range{ctot[0], k}, range{j0, j1});
+            const auto Vk1 = slice(Vk, range{0, n12}, range{j0, j1});
+            const auto Vk2 = slice(Vk, range{ctot[0], k}, range{j0, j1});
+            gemm(NO_TRANS, NO_TRANS, one, Utop, Uk1, zero, Unew1);
+            gemm(NO_TRANS, NO_TRANS, one, Ubot, Uk2, zero, Unew2);
+            gemm(TRANSPOSE, NO_TRANS, one, Vk1, Vttop, zero, Vtnew1);
+            gemm(TRANSPOSE, NO_TRANS, one, Vk2, Vtbot, zero, Vtnew2);
+            for (idx_t j = j0; j < j1; ++j)
+                Unew(nl, j) = Uk(g[0], j);
+        });
+
+        // Copy the deflated singular triplets
+        for (idx_t i = 0, j = k; i < n; ++i) {
+            if (coltyp[i] == 4) {
+                for (idx_t r = 0; r < n; ++r)
+                    Unew(r, j) = U(r, i);
+                for (idx_t c = 0; c < m; ++c)
+                    Vtnew(j, c) = Vt(i, c);
+                dnew[j++] = d[i];
+            }
+        }
+
+        // Sort the singular values in descending order. The null vector of
+        // B stays in the last row of Vt
+        std::iota(perm.begin(), perm.end(), idx_t(0));
+        std::stable_sort(perm.begin(), perm.end(), [&](idx_t a, idx_t b) {
+            return dnew[a] > dnew[b];
+        });
+        for (idx_t j = 0; j < n; ++j) {
+            d[j] = dnew[perm[j]];
+            for (idx_t r = 0; r < n; ++r)
+                U(r, j) = Unew(r, perm[j]);
+            for (idx_t c = 0; c < m; ++c)
+                Vt(j, c) = Vtnew(perm[j], c);
+        }
+
+        return 0;
+    }
+
+    /**
+     * Computes the SVD of an n-by-(n+sqre) upper bidiagonal matrix using
+     * divide and conquer, where sqre = ncols(Vt) - n is 0 or 1.
+     *
+     * @param[in,out] d Real vector of length n.
+     *      On exit, the singular values in descending order.
+     * @param[in,out] e Real vector of length n-1+sqre. Destroyed on exit.
+     * @param[out] U n-by-n real matrix. The left singular vectors.
+     * @param[out] Vt (n+sqre)-by-(n+sqre) real matrix. The right singular
+     *      vectors. If sqre = 1, the last row spans the null space.
+     * @param[in] opts Options.
+     *
+     * @return 0 if success.
+     * @return nonzero if svd_qr() or laed4() failed.
+     */
+    template <class d_t, class e_t, class matrix_t>
+    int bdsdc_recursive(
+        d_t& d, e_t& e, matrix_t& U, matrix_t& Vt, const BdsdcOpts& opts)
+    {
+        using idx_t = size_type<matrix_t>;
+        using real_t = type_t<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+        const idx_t m = ncols(Vt);
+
+        if (n <= max<idx_t>(opts.nmin, 2)) {
+            laset(GENERAL, zero, one, U);
+            laset(GENERAL, zero, one, Vt);
+
+            // Rotate the last column of B into the diagonal, so that B
+            // becomes [B' 0] with B' square
+            if (m > n) {
+                real_t c, s, r;
+                real_t f = e[n - 1];
+                e[n - 1] = zero;
+                for (idx_t i = n; i-- > 0;) {
+                    lartg(d[i], f, c, s, r);
+                    d[i] = r;
+                    if (i > 0) {
+                        f = -s * e[i - 1];
+                        e[i - 1] *= c;
+                    }
+                    auto vt1 = row(Vt, i);
+                    auto vt2 = row(Vt, n);
+                    rot(vt1, vt2, c, s);
+                }
+            }
+
+            auto e0 = slice(e, range{0, n - 1});
+            auto U0 = slice(U, range{0, n}, range{0, n});
+            auto Vt0 = slice(Vt, range{0, n}, range{0, m});
+            return svd_qr(Uplo::Upper, true, true, d, e0, U0, Vt0);
+        }
+
+        // Divide: B = [B1 0; alpha beta; 0 B2]
+        const idx_t nl = n / 2;
+        const real_t alpha = d[nl];
+        const real_t beta = e[nl];
+
+        auto d1 = slice(d, range{0, nl});
+        auto d2 = slice(d, range{nl + 1, n});
+        auto e1 = slice(e, range{0, nl});
+        auto e2 = slice(e, range{nl + 1, m - 1});
+        auto U1 = slice(U, range{0, nl}, range{0, nl});
+        auto U2 = slice(U, range{nl + 1, n}, range{nl + 1, n});
+        auto Vt1 = slice(Vt, range{0, nl + 1}, range{0, nl + 1});
+        auto Vt2 = slice(Vt, range{nl + 1, m}, range{nl + 1, m});
+
+        // Conquer: the subproblems are independent and use disjoint blocks
+        // of U and Vt
+        int info1 = 0, info2 = 0;
+        auto solve = [&](std::size_t i) {
+            if (i == 0)
+                info1 = bdsdc_recursive(d1, e1, U1, Vt1, opts);
+            else
+                info2 = bdsdc_recursive(d2, e2, U2, Vt2, opts);
+        };
+        if (opts.exec.is_parallel()) {
+            ThreadPool& pool =
+                (opts.exec.pool) ? *opts.exec.pool : default_thread_pool();
+            pool.parallel_for(2, solve, opts.exec.nthreads);
+        }
+        else {
+            solve(0);
+            solve(1);
+        }
+        if (info1 != 0) return info1;
+        if (info2 != 0) return info2;
+
+        // U = diag(U1, 1, U2) and Vt = diag(Vt1, Vt2)
+        auto U12 = slice(U, range{0, nl + 1}, range{nl, n});
+        auto U21 = slice(U, range{nl, n}, range{0, nl});
+        auto U22 = slice(U, range{nl, nl + 1}, range{nl + 1, n});
+        auto U23 = slice(U, range{nl + 1, n}, range{nl, nl + 1});
+        laset(GENERAL, zero, zero, U12);
+        laset(GENERAL, zero, zero, U21);
+        laset(GENERAL, zero, zero, U22);
+        laset(GENERAL, zero, zero, U23);
+        U(nl, nl) = one;
+        auto Vt12 = slice(Vt, range{0, nl + 1}, range{nl + 1, m});
+        auto Vt21 = slice(Vt, range{nl + 1, m}, range{0, nl + 1});
+        laset(GENERAL, zero, zero, Vt12);
+        laset(GENERAL, zero, zero, Vt21);
+
+        // Merge
+        return bdsdc_merge(d, U, Vt, nl, alpha, beta, opts);
+    }
+
+}  // namespace internal
+
+/**
+ * BDSDC computes the singular values and, optionally, the left and/or right
+ * singular vectors of a real n-by-n (upper or lower) bidiagonal matrix B
+ * using the divide and conquer method. The SVD of B has the form
+ *      B = Q * S * P**T.
+ * If left singular vectors are requested, this subroutine returns U*Q
+ * instead of Q, and, if right singular vectors are requested, it returns
+ * P**T*VT instead of P**T, for given input matrices U and VT, as svd_qr().
+ *
+ * The matrix is first split into unreduced blocks. Each block of size larger
+ * than opts.nmin is split in two, and the SVDs of the two parts are merged by
+ * solving a secular equation with laed4(). Blocks of size at most opts.nmin
+ * are solved by svd_qr(). The singular vectors of each block are then
+ * applied to U and Vt with gemm().
+ *
+ * See "A Divide-and-Conquer Algorithm for the Bidiagonal SVD," by M. Gu and
+ * S. Eisenstat, SIAM J. Matrix Anal. Appl. vol. 16, no. 1, pp. 79-92, 1995.
+ *
+ * @return 0 if success.
+ * @return nonzero if the algorithm failed to compute a singular value.
+ *
+ * @param[in] uplo
+ *      Uplo::Upper, B is upper bidiagonal
+ *      Uplo::Lower, B is lower bidiagonal
+ *
+ * @param[in] want_u bool
+ *
+ * @param[in] want_vt bool
+ *      If both want_u and want_vt are false, only the singular values are
+ *      computed, by svd_qr().
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, diagonal elements of the bidiagonal matrix B.
+ *      On exit, the singular values of B in decreasing order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, off-diagonal elements of the bidiagonal matrix B.
+ *      On exit, e is destroyed.
+ *
+ * @param[in,out] U nu-by-n matrix.
+ *      On entry, an nu-by-n unitary matrix.
+ *      On exit, U is overwritten by U * Q.
+ *      Only the first n columns are referenced, and none if want_u is false.
+ *
+ * @param[in,out] Vt n-by-nvt matrix.
+ *      On entry, an n-by-nvt unitary matrix.
+ *      On exit, Vt is overwritten by P^H * Vt.
+ *      Only the first n rows are referenced, and none if want_vt is false.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nmin: Size of the subproblems solved by svd_qr().
+ *      - @c opts.exec: Execution policy. If parallel, independent
+ *        subproblems are solved concurrently, and the secular equations and
+ *        the singular vector updates are split by columns.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int bdsdc(Uplo uplo,
+          bool want_u,
+          bool want_vt,
+          d_t& d,
+          e_t& e,
+          matrix_t& U,
+          matrix_t& Vt,
+          const BdsdcOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using r_matrix_t = real_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<r_matrix_t> new_real_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t nmin =
+        max<idx_t>(tuned_option<T>(opts.nmin, "bdsdc", "nmin", n, 25), 1);
+    const real_t eps = uroundoff<real_t>();
+
+    // Options of the recursion, with the size of the subproblems resolved
+    BdsdcOpts optsRec = opts;
+    optsRec.nmin = nmin;
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(n <= 1 || (idx_t)size(e) >= n - 1);
+    if (want_u) tlapack_check(ncols(U) >= n);
+    if (want_vt) tlapack_check(nrows(Vt) >= n);
+
+    // Quick return if possible
+    if (n == 0) return 0;
+
+    // Divide and conquer is only used for the singular vectors
+    if ((!want_u && !want_vt) || n <= nmin)
+        return svd_qr(uplo, want_u, want_vt, d, e, U, Vt);
+
+    const idx_t nu = (want_u) ? nrows(U) : 0;
+    const idx_t nvt = (want_vt) ? ncols(Vt) : 0;
+
+    // If the matrix is lower bidiagonal, apply a sequence of rotations
+    // to make it upper bidiagonal.
+    if (uplo == Uplo::Lower) {
+        real_t c, s, r;
+        for (idx_t i = 0; i < n - 1; ++i) {
+            lartg(d[i], e[i], c, s, r);
+            d[i] = r;
+            e[i] = s * d[i + 1];
+            d[i + 1] = c * d[i + 1];
+
+            // Update singular vectors if desired
+            if (want_u) {
+                auto u1 = col(U, i);
+                auto u2 = col(U, i + 1);
+                rot(u1, u2, c, s);
+            }
+        }
+    }
+
+    // Scale the matrix to avoid overflow and underflow
+    real_t orgnrm(0);
+    for (idx_t i = 0; i < n; ++i)
+        orgnrm = max(orgnrm, abs(d[i]));
+    for (idx_t i = 0; i + 1 < n; ++i)
+        orgnrm = max(orgnrm, abs(e[i]));
+    if (orgnrm == zero) {
+        for (idx_t i = 0; i < n; ++i)
+            d[i] = zero;
+        return 0;
+    }
+    for (idx_t i = 0; i < n; ++i)
+        d[i] /= orgnrm;
+    for (idx_t i = 0; i + 1 < n; ++i)
+        e[i] /= orgnrm;
+
+    // Allocate workspaces
+    workspace_vector<real_t> Q_, Pt_;
+    auto Q = new_real_matrix(Q_, n, n);
+    auto Pt = new_real_matrix(Pt_, n, n);
+    workspace_vector<T> Ut_, Vtt_;
+    auto Ut = new_matrix(Ut_, nu, n);
+    auto Vtt = new_matrix(Vtt_, n, nvt);
+
+    for (idx_t start = 0; start < n;) {
+        // Find the unreduced block d[start:end]
+        idx_t end = start;
+        for (; end + 1 < n; ++end) {
+            if (abs(e[end]) <= eps) {
+                e[end] = zero;
+                break;
+            }
+        }
+        ++end;
+
+        const idx_t nb = end - start;
+        auto db = slice(d, range{start, end});
+        auto eb = slice(e, range{start, end - 1});
+        auto Qb = slice(Q, range{0, nb}, range{0, nb});
+        auto Ptb = slice(Pt, range{0, nb}, range{0, nb});
+        const int info =
+            internal::bdsdc_recursive(db, eb, Qb, Ptb, optsRec);
+        if (info != 0) return info;
+
+        // U(:,start:end) = U(:,start:end) * Qb
+        if (want_u) {
+            auto Ub = slice(U, range{0, nu}, range{start, end});
+            auto Utb = slice(Ut, range{0, nu}, range{0, nb});
+            internal::parallel_for_blocks(
+                opts.exec, nb, nmin, [&](idx_t j0, idx_t j1) {
+                    const auto Qj = cols(Qb, range{j0, j1});
+                    auto Utj = cols(Utb, range{j0, j1});
+                    gemm(NO_TRANS, NO_TRANS, one, Ub, Qj, zero, Utj);
+                });
+            lacpy(GENERAL, Utb, Ub);
+        }
+
+        // Vt(start:end,:) = Ptb * Vt(start:end,:)
+        if (want_vt) {
+            auto Vtb = slice(Vt, range{start, end}, range{0, nvt});
+            auto Vttb = slice(Vtt, range{0, nb}, range{0, nvt});
+            internal::parallel_for_blocks(
+                opts.exec, nvt, nmin, [&](idx_t j0, idx_t j1) {
+                    const auto Vtj = cols(Vtb, range{j0, j1});
+                    auto Vttj = cols(Vttb, range{j0, j1});
+                    gemm(NO_TRANS, NO_TRANS, one, Ptb, Vtj, zero, Vttj);
+                });
+            lacpy(GENERAL, Vttb, Vtb);
+        }
+
+        start = end;
+    }
+
+    for (idx_t i = 0; i < n; ++i)
+        d[i] *= orgnrm;
+
+    // Use selection sort to minize swaps of singular vectors
+    for (idx_t i = 0; i < n - 1; ++i) {
+        idx_t k = i;
+        real_t p = d[i];
+        for (idx_t j = i + 1; j < n; ++j) {
+            if (d[j] > p) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if (k != i) {
+            d[k] = d[i];
+            d[i] = p;
+            if (want_u) {
+                auto u1 = col(U, i);
+                auto u2 = col(U, k);
+                tlapack::swap(u1, u2);
+            }
+            if (want_vt) {
+                auto vt1 = row(Vt, i);
+                auto vt2 = row(Vt, k);
+                tlapack::swap(vt1, vt2);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BDSDC_HH
@@ -0,0 +1,374 @@
+/// @file gbtrf.hpp Computes the LU factorization of a band matrix stored in
+/// compact band format using partial pivoting.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GBTRF_HH
+#define TLAPACK_GBTRF_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for gbtrf()
+struct GbtrfOpts : public EcOpts {
+    GbtrfOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+
+    size_t nb = 0;  ///< Block size. 0: tuned value, see tuned_option()
+    size_t nx = 0;  ///< Level-2 if kl < nx. 0: tuned value, see
+                    ///< tuned_option()
+};
+
+namespace internal {
+
+    /// Sets to zero the kl superdiagonals above the ku superdiagonals of A,
+    /// which receive the fill-in of gbtrf().
+    template <typename T, class idx_t>
+    void gbtrf_zero_fill(LegacyBandedMatrix<T, idx_t>& A, idx_t kl)
+    {
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t kv = upperband(A);
+        const idx_t ku = kv - kl;
+
+        for (idx_t j = ku + 1; j < n; ++j) {
+            const idx_t i0 = (j > kv) ? j - kv : idx_t(0);
+            const idx_t i1 = min(j - ku, m);
+            for (idx_t i = i0; i < i1; ++i)
+                A(i, j) = T(0);
+        }
+    }
+
+    /** Level-2 LU factorization of a band matrix in compact band storage.
+     *
+     * @see gbtrf()
+     *
+     * @ingroup computational
+     */
+    template <typename T, class idx_t, TLAPACK_VECTOR piv_t>
+    int gbtf2(LegacyBandedMatrix<T, idx_t>& A, piv_t& piv)
+    {
+        using real_t = real_type<T>;
+
+        // Constants
+        const real_t one(1);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t kl = lowerband(A);
+        const idx_t ku = upperband(A) - kl;
+        const idx_t k = min(m, n);
+
+        gbtrf_zero_fill(A, kl);
+
+        int info = 0;
+        // ju is the last column affected by the row interchanges so far
+        idx_t ju = 0;
+        for (idx_t j = 0; j < k; ++j) {
+            const idx_t km = min(kl, m - 1 - j);
+
+            // Find the pivot
+            idx_t jp = 0;
+            real_t amax = abs1(A(j, j));
+            for (idx_t i = 1; i <= km; ++i) {
+                if (abs1(A(j + i, j)) > amax) {
+                    jp = i;
+                    amax = abs1(A(j + i, j));
+                }
+            }
+            piv[j] = j + jp;
+
+            if (A(j + jp, j) != T(0)) {
+                ju = max(ju, min(j + ku + jp, n - 1));
+
+                // Swap rows j and j+jp in columns j:ju
+                if (jp != 0) {
+                    for (idx_t c = j; c <= ju; ++c) {
+                        const T aux = A(j, c);
+                        A(j, c) = A(j + jp, c);
+                        A(j + jp, c) = aux;
+                    }
+                }
+
+                // Compute the multipliers and update the trailing band
+                const T rjj = one / A(j, j);
+                for (idx_t i = 1; i <= km; ++i)
+                    A(j + i, j) *= rjj;
+                for (idx_t c = j + 1; c <= ju; ++c) {
+                    const T ajc = A(j, c);
+                    for (idx_t i = 1; i <= km; ++i)
+                        A(j + i, c) -= A(j + i, j) * ajc;
+                }
+            }
+            else if (info == 0)
+                info = j + 1;
+        }
+
+        return info;
+    }
+
+}  // namespace internal
+
+/** Computes the LU factorization of an m-by-n band matrix A with kl
+ * subdiagonals and ku superdiagonals using partial pivoting with row
+ * interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *      A = P L U
+ * \]
+ * where P is a permutation matrix constructed from the piv vector, L is lower
+ * triangular with unit diagonal and at most kl nonzeros below the diagonal in
+ * each column, and U is upper triangular with kl+ku superdiagonals.
+ *
+ * A is stored in compact band format with lowerband(A) = kl and
+ * upperband(A) = kl+ku, i.e., with kl extra superdiagonals that receive the
+ * fill-in of U and do not need to be set on entry. Only O((2 kl + ku) n)
+ * memory is used.
+ *
+ * The matrix is processed in panels of nb columns. Each panel is factored with
+ * level-2 operations, and the updates of the columns to its right are done by
+ * trsm() and gemm() on dense views of the compact storage (see band_block()).
+ * The parts of the off-diagonal blocks that cross the edges of the band are
+ * copied to two nb-by-nb workspaces. If kl < nx or nb > kl, the level-2
+ * algorithm is used instead. With the reference BLAS, the blocks are too small
+ * to pay off for narrower bands.
+ *
+ * @param[in,out] A m-by-n banded matrix in compact storage.
+ *      On entry, the matrix A in the lower kl and the upper ku bands.
+ *      On exit, the factors L and U. The unit diagonal elements of L are
+ *      not stored. The multipliers of column j of L are stored as computed in
+ *      step j, i.e., before the row interchanges of the later steps.
+ *
+ * @param[out] piv Vector of size min(m,n).
+ *      The pivot indices: row i was interchanged with row piv[i].
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size.
+ *      - nx: Smallest number of subdiagonals kl for which the blocked code is
+ *      used.
+ *
+ * @return 0 if success.
+ * @return j+1 if U(j,j) is exactly zero. The factorization has been
+ *      completed, but U is singular.
+ *
+ * @ingroup computational
+ */
+template <typename T, class idx_t, TLAPACK_VECTOR piv_t>
+int gbtrf(LegacyBandedMatrix<T, idx_t>& A,
+          piv_t& piv,
+          const GbtrfOpts& opts = {})
+{
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t kl = lowerband(A);
+    const idx_t kv = upperband(A);
+    const idx_t ku = kv - kl;
+    const idx_t k = min(m, n);
+    const idx_t nb = tuned_option<T>(opts.nb, "gbtrf", "nb", n, 32);
+
+    // Check arguments
+    tlapack_check(kv >= kl);
+    tlapack_check((idx_t)size(piv) >= k);
+
+    // Quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    // Unblocked code
+    if (nb <= 1 || nb > kl ||
+        kl < (idx_t)tuned_option<T>(opts.nx, "gbtrf", "nx", n, 256))
+        return internal::gbtf2(A, piv);
+
+    internal::gbtrf_zero_fill(A, kl);
+
+    // work13 holds the lower triangle of the block A13 that crosses the upper
+    // edge of the band, and work31 holds the block A31 below the band. Their
+    // opposite triangles must stay zero.
+    Create<LegacyMatrix<T, idx_t>> new_matrix;
+    workspace_vector<T> work13_;
+    auto work13 = new_matrix(work13_, nb, nb);
+    workspace_vector<T> work31_;
+    auto work31 = new_matrix(work31_, nb, nb);
+    laset(GENERAL, real_t(0), real_t(0), work13);
+    laset(GENERAL, real_t(0), real_t(0), work31);
+
+    auto swap_entries = [](T& a, T& b) {
+        const T aux = a;
+        a = b;
+        b = aux;
+    };
+
+    int info = 0;
+    // ju is the last column affected by the row interchanges so far
+    idx_t ju = 0;
+    for (idx_t j = 0; j < k; j += nb) {
+        const idx_t jb = min(nb, k - j);
+
+        // The rows of the block column j:j+jb below the diagonal block are
+        // split into A21, which lies entirely in the band, and A31, whose
+        // lower triangle is outside the band
+        const idx_t i2 = min(kl - jb, m - j - jb);
+        const idx_t i3 = (m > j + kl) ? min(jb, m - j - kl) : idx_t(0);
+
+        // Factor the panel
+        for (idx_t jj = j; jj < j + jb; ++jj) {
+            const idx_t km = min(kl, m - 1 - jj);
+
+            // Find the pivot
+            idx_t jp = 0;
+            real_t amax = abs1(A(jj, jj));
+            for (idx_t i = 1; i <= km; ++i) {
+                if (abs1(A(jj + i, jj)) > amax) {
+                    jp = i;
+                    amax = abs1(A(jj + i, jj));
+                }
+            }
+            piv[jj] = jj + jp;
+
+            if (A(jj + jp, jj) != T(0)) {
+                ju = max(ju, min(jj + ku + jp, n - 1));
+
+                // Swap rows jj and jj+jp in the panel. The columns to the left
+                // of jj in rows of A31 are kept in work31
+                if (jp != 0) {
+                    if (jj + jp < j + kl) {
+                        for (idx_t c = j; c < j + jb; ++c)
+                            swap_entries(A(jj, c), A(jj + jp, c));
+                    }
+                    else {
+                        for (idx_t c = j; c < jj; ++c)
+                            swap_entries(A(jj, c),
+                                         work31(jj + jp - j - kl, c - j));
+                        for (idx_t c = jj; c < j + jb; ++c)
+                            swap_entries(A(jj, c), A(jj + jp, c));
+                    }
+                }
+
+                // Compute the multipliers and update the rest of the panel
+                const T rjj = one / A(jj, jj);
+                for (idx_t i = 1; i <= km; ++i)
+                    A(jj + i, jj) *= rjj;
+                const idx_t jm = min(ju, j + jb - 1);
+                for (idx_t c = jj + 1; c <= jm; ++c) {
+                    const T ajc = A(jj, c);
+                    for (idx_t i = 1; i <= km; ++i)
+                        A(jj + i, c) -= A(jj + i, jj) * ajc;
+                }
+            }
+            else if (info == 0)
+                info = jj + 1;
+
+            // Copy the current column of A31 into work31
+            const idx_t nw = min(jj - j + 1, i3);
+            for (idx_t i = 0; i < nw; ++i)
+                work31(i, jj - j) = A(j + kl + i, jj);
+        }
+
+        if (j + jb < n) {
+            // Columns j+jb:j+jb+j2 lie in the band for all rows of the block
+            // column. Columns j+kv:j+kv+j3 cross the upper edge of the band
+            const idx_t j2 =
+                (ju + 1 > j + jb) ? min(ju + 1 - j, kv) - jb : idx_t(0);
+            const idx_t j3 = (ju + 1 > j + kv) ? ju + 1 - j - kv : idx_t(0);
+
+            // Apply the row interchanges to A12, A22 and A32
+            for (idx_t ii = j; ii < j + jb; ++ii) {
+                const idx_t ip = piv[ii];
+                if (ip != ii)
+                    for (idx_t c = j + jb; c < j + jb + j2; ++c)
+                        swap_entries(A(ii, c), A(ip, c));
+            }
+
+            // Apply the row interchanges to A13, A23 and A33
+            for (idx_t t = 0; t < j3; ++t) {
+                const idx_t c = j + kv + t;
+                for (idx_t ii = j + t; ii < j + jb; ++ii) {
+                    const idx_t ip = piv[ii];
+                    if (ip != ii) swap_entries(A(ii, c), A(ip, c));
+                }
+            }
+
+            auto L11 = band_block(A, j, j, jb, jb);
+            auto A21 = band_block(A, j + jb, j, i2, jb);
+            auto W31 = slice(work31, range{0, i3}, range{0, jb});
+
+            // Update A12, A22 and A32
+            if (j2 > 0) {
+                auto A12 = band_block(A, j, j + jb, jb, j2);
+                trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, L11,
+                     A12);
+                if (i2 > 0) {
+                    auto A22 = band_block(A, j + jb, j + jb, i2, j2);
+                    gemm(NO_TRANS, NO_TRANS, -one, A21, A12, one, A22);
+                }
+                if (i3 > 0) {
+                    auto A32 = band_block(A, j + kl, j + jb, i3, j2);
+                    gemm(NO_TRANS, NO_TRANS, -one, W31, A12, one, A32);
+                }
+            }
+
+            // Update A13, A23 and A33
+            if (j3 > 0) {
+                auto W13 = slice(work13, range{0, jb}, range{0, j3});
+                for (idx_t jc = 0; jc < j3; ++jc)
+                    for (idx_t ii = jc; ii < jb; ++ii)
+                        W13(ii, jc) = A(j + ii, j + kv + jc);
+
+                trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, L11,
+                     W13);
+                if (i2 > 0) {
+                    auto A23 = band_block(A, j + jb, j + kv, i2, j3);
+                    gemm(NO_TRANS, NO_TRANS, -one, A21, W13, one, A23);
+                }
+                if (i3 > 0) {
+                    auto A33 = band_block(A, j + kl, j + kv, i3, j3);
+                    gemm(NO_TRANS, NO_TRANS, -one, W31, W13, one, A33);
+                }
+
+                for (idx_t jc = 0; jc < j3; ++jc)
+                    for (idx_t ii = jc; ii < jb; ++ii)
+                        A(j + ii, j + kv + jc) = W13(ii, jc);
+            }
+        }
+
+        // Undo the row interchanges of the panel in the columns to the left of
+        // each pivot, so that L is stored as in the level-2 algorithm, and
+        // copy A31 back into the band
+        for (idx_t jj = j + jb; jj-- > j;) {
+            const idx_t jp = piv[jj] - jj;
+            if (jp != 0) {
+                if (jj + jp < j + kl) {
+                    for (idx_t c = j; c < jj; ++c)
+                        swap_entries(A(jj, c), A(jj + jp, c));
+                }
+                else {
+                    for (idx_t c = j; c < jj; ++c)
+                        swap_entries(A(jj, c),
+                                     work31(jj + jp - j - kl, c - j));
+                }
+            }
+            const idx_t nw = min(i3, jj - j + 1);
+            for (idx_t i = 0; i < nw; ++i)
+                A(j + kl + i, jj) = work31(i, jj - j);
+        }
+    }
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GBTRF_HH
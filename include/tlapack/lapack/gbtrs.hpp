@@ -0,0 +1,152 @@
+/// @file gbtrs.hpp Solves a linear system with a band matrix using the LU
+/// factorization computed by gbtrf().
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GBTRS_HH
+#define TLAPACK_GBTRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/** Solves the system of equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * where A is an n-by-n band matrix factored as $A = P L U$ by gbtrf(), and
+ * $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$.
+ *
+ * The row interchanges are applied one at a time together with the columns
+ * of L, as stored by gbtrf(), and U is solved as a band matrix with kl+ku
+ * superdiagonals.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] A n-by-n banded matrix in compact storage.
+ *      The factors L and U from gbtrf(), with lowerband(A) = kl and
+ *      upperband(A) = kl+ku.
+ *
+ * @param[in] piv Vector of size n.
+ *      The pivot indices from gbtrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          typename T,
+          class idx_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_MATRIX matrixB_t>
+int gbtrs(op_t trans,
+          const LegacyBandedMatrix<T, idx_t>& A,
+          const piv_t& piv,
+          matrixB_t& B)
+{
+    using TB = type_t<matrixB_t>;
+
+    // Constants
+    const idx_t n = ncols(A);
+    const idx_t nrhs = ncols(B);
+    const idx_t kl = lowerband(A);
+    const idx_t kv = upperband(A);
+
+    // Check arguments
+    tlapack_check(trans == Op::NoTrans || trans == Op::Trans ||
+                  trans == Op::ConjTrans);
+    tlapack_check(nrows(A) == n);
+    tlapack_check(kv >= kl);
+    tlapack_check((idx_t)size(piv) >= n);
+    tlapack_check((idx_t)nrows(B) == n);
+
+    // Quick return
+    if (n == 0 || nrhs == 0) return 0;
+
+    auto swap_rows = [&](idx_t i, idx_t ip) {
+        for (idx_t k = 0; k < nrhs; ++k) {
+            const TB aux = B(i, k);
+            B(i, k) = B(ip, k);
+            B(ip, k) = aux;
+        }
+    };
+
+    if (trans == Op::NoTrans) {
+        // Solve L Y = P^T B
+        if (kl > 0) {
+            for (idx_t j = 0; j + 1 < n; ++j) {
+                const idx_t lm = min(kl, n - 1 - j);
+                const idx_t ip = piv[j];
+                if (ip != j) swap_rows(j, ip);
+                for (idx_t k = 0; k < nrhs; ++k) {
+                    const TB bjk = B(j, k);
+                    for (idx_t i = 1; i <= lm; ++i)
+                        B(j + i, k) -= A(j + i, j) * bjk;
+                }
+            }
+        }
+        // Solve U X = Y
+        for (idx_t j = n; j-- > 0;) {
+            const idx_t i0 = (j > kv) ? j - kv : idx_t(0);
+            for (idx_t k = 0; k < nrhs; ++k) {
+                const TB bjk = B(j, k) / A(j, j);
+                B(j, k) = bjk;
+                for (idx_t i = i0; i < j; ++i)
+                    B(i, k) -= A(i, j) * bjk;
+            }
+        }
+    }
+    else {
+        const bool conjA = (trans == Op::ConjTrans);
+        auto opA = [&](idx_t i, idx_t j) {
+            return conjA ? conj(A(i, j)) : A(i, j);
+        };
+
+        // Solve op(U) Y = B
+        for (idx_t j = 0; j < n; ++j) {
+            const idx_t i0 = (j > kv) ? j - kv : idx_t(0);
+            for (idx_t k = 0; k < nrhs; ++k) {
+                TB s = B(j, k);
+                for (idx_t i = i0; i < j; ++i)
+                    s -= opA(i, j) * B(i, k);
+                B(j, k) = s / opA(j, j);
+            }
+        }
+        // Solve op(L) X = Y and apply P
+        if (kl > 0) {
+            for (idx_t j = n - 1; j-- > 0;) {
+                const idx_t lm = min(kl, n - 1 - j);
+                for (idx_t k = 0; k < nrhs; ++k) {
+                    TB s = B(j, k);
+                    for (idx_t i = 1; i <= lm; ++i)
+                        s -= opA(j + i, j) * B(j + i, k);
+                    B(j, k) = s;
+                }
+                const idx_t ip = piv[j];
+                if (ip != j) swap_rows(j, ip);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GBTRS_HH
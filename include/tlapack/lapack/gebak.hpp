@@ -0,0 +1,102 @@
+/// @file gebak.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebak.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEBAK_HH
+#define TLAPACK_GEBAK_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/gebal.hpp"
+
+namespace tlapack {
+
+/**
+ * Forms the right or left eigenvectors of a general matrix by backward
+ * transformation on the computed eigenvectors of the balanced matrix output
+ * by gebal().
+ *
+ * @param[in] job Specifies the type of backward transformation required.
+ *      Must be the same value used in gebal().
+ *
+ * @param[in] side
+ *      - Side::Right: V contains right eigenvectors;
+ *      - Side::Left:  V contains left eigenvectors.
+ *
+ * @param[in] ilo integer
+ * @param[in] ihi integer
+ *      The integers ilo and ihi determined by gebal().
+ *
+ * @param[in] scale Vector of length n.
+ *      Details of the permutation and scaling factors, as returned by gebal().
+ *
+ * @param[in,out] V n-by-m matrix.
+ *      On entry, the matrix of right or left eigenvectors to be transformed.
+ *      On exit, V is overwritten by the transformed eigenvectors.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SIDE side_t,
+          TLAPACK_VECTOR vector_t,
+          TLAPACK_SMATRIX matrix_t>
+void gebak(Balance job,
+           side_t side,
+           size_type<matrix_t> ilo,
+           size_type<matrix_t> ihi,
+           const vector_t& scale,
+           matrix_t& V)
+{
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<type_t<matrix_t>>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(V);
+
+    // check arguments
+    tlapack_check_false(job != Balance::None && job != Balance::Permute &&
+                        job != Balance::Scale && job != Balance::Both);
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(ilo > ihi || ihi > n);
+    tlapack_check_false((idx_t)size(scale) < n);
+
+    // Quick return if possible
+    if (n == 0 || ncols(V) == 0 || job == Balance::None) return;
+
+    // Backward balance
+    if (ilo + 1 < ihi && (job == Balance::Scale || job == Balance::Both)) {
+        for (idx_t i = ilo; i < ihi; ++i) {
+            const real_t s = real(scale[i]);
+            auto vi = row(V, i);
+            scal((side == Side::Right) ? s : one / s, vi);
+        }
+    }
+
+    // Backward permutation
+    //
+    // For i = ilo-1 step -1 until 0,
+    //         ihi step 1 until n-1 do
+    if (job == Balance::Permute || job == Balance::Both) {
+        for (idx_t ii = 0; ii < n; ++ii) {
+            idx_t i = ii;
+            if (i >= ilo && i < ihi) continue;
+            if (i < ilo) i = ilo - 1 - ii;
+            const idx_t k = idx_t(real(scale[i]));
+            if (k == i) continue;
+            auto vi = row(V, i);
+            auto vk = row(V, k);
+            tlapack::swap(vi, vk);
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEBAK_HH
@@ -0,0 +1,255 @@
+/// @file gebal.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebal.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEBAL_HH
+#define TLAPACK_GEBAL_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+
+namespace tlapack {
+
+/// @brief Operations performed by gebal() to balance a matrix.
+enum class Balance : char {
+    None = 'N',     ///< Do nothing
+    Permute = 'P',  ///< Permute only
+    Scale = 'S',    ///< Scale only
+    Both = 'B'      ///< Permute and scale
+};
+
+/**
+ * Balances a general matrix A.
+ *
+ * This involves, first, permuting A by a similarity transformation to
+ * isolate eigenvalues in the first ilo and the last n-ihi elements on the
+ * diagonal of A:
+ *
+ *      P^T A P = [ T1   X   Y  ]
+ *                [ 0    B   Z  ]
+ *                [ 0    0   T2 ]
+ *
+ * where T1 and T2 are upper triangular. Then, the rows and columns ilo to
+ * ihi-1 are scaled by a diagonal similarity transformation D to make their
+ * norms as close as possible:
+ *
+ *      A := D^{-1} P^T A P D.
+ *
+ * Balancing may reduce the 1-norm of the matrix, and improve the accuracy of
+ * the computed eigenvalues and eigenvectors.
+ *
+ * @return 0 if success.
+ * @return -1 if a NaN was found while scaling A.
+ *
+ * @param[in] job Specifies the operations to be performed on A.
+ *      - Balance::None:    A is not balanced. ilo = 0, ihi = n, and
+ *                          scale(i) = 1;
+ *      - Balance::Permute: A is permuted only;
+ *      - Balance::Scale:   A is scaled only;
+ *      - Balance::Both:    A is permuted and scaled.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On exit, A is overwritten by the balanced matrix.
+ *
+ * @param[out] ilo integer
+ * @param[out] ihi integer
+ *      On exit, A(i,j) = 0 if i > j and j = 0,...,ilo-1 or
+ *      i = ihi,...,n-1. ilo = 0 and ihi = n if job = Balance::None or
+ *      Balance::Scale.
+ *
+ * @param[out] scale Vector of length n.
+ *      Details of the permutations and scaling factors applied to A. If p(j)
+ *      is the index of the row and column interchanged with row and
+ *      column j, and d(j) is the scaling factor applied to row and column j,
+ *      then
+ *      - scale(j) = p(j) for j = 0,...,ilo-1 and j = ihi,...,n-1;
+ *      - scale(j) = d(j) for j = ilo,...,ihi-1.
+ *      The order in which the interchanges are made is n-1 to ihi, then 0 to
+ *      ilo-1. The values stored in scale are real.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR vector_t>
+int gebal(Balance job,
+          matrix_t& A,
+          size_type<matrix_t>& ilo,
+          size_type<matrix_t>& ihi,
+          vector_t& scale)
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t sclfac(2);
+    const real_t factor(0.95);
+    const idx_t n = ncols(A);
+
+    // check arguments
+    tlapack_check_false(job != Balance::None && job != Balance::Permute &&
+                        job != Balance::Scale && job != Balance::Both);
+    tlapack_check_false(nrows(A) != n);
+    tlapack_check_false((idx_t)size(scale) < n);
+
+    ilo = 0;
+    ihi = n;
+
+    // Quick return if possible
+    if (n == 0) return 0;
+
+    if (job == Balance::None) {
+        for (idx_t i = 0; i < n; ++i)
+            scale[i] = one;
+        return 0;
+    }
+
+    // Permutation to isolate eigenvalues if possible
+    if (job == Balance::Permute || job == Balance::Both) {
+        // Row and column exchange
+        auto exchange = [&](idx_t j, idx_t m) {
+            scale[m] = real_t(j);
+            if (j != m) {
+                auto c1 = slice(A, range{0, ihi}, j);
+                auto c2 = slice(A, range{0, ihi}, m);
+                tlapack::swap(c1, c2);
+                auto r1 = slice(A, j, range{ilo, n});
+                auto r2 = slice(A, m, range{ilo, n});
+                tlapack::swap(r1, r2);
+            }
+        };
+
+        // Search for rows isolating an eigenvalue and push them down
+        bool noconv = true;
+        while (noconv) {
+            noconv = false;
+            for (idx_t i = ihi; i-- > 0;) {
+                bool canswap = true;
+                for (idx_t j = 0; j < ihi; ++j) {
+                    if (i != j && A(i, j) != T(zero)) {
+                        canswap = false;
+                        break;
+                    }
+                }
+                if (canswap) {
+                    exchange(i, ihi - 1);
+                    noconv = true;
+                    if (ihi == 1) {
+                        ilo = 0;
+                        ihi = 1;
+                        return 0;
+                    }
+                    --ihi;
+                }
+            }
+        }
+
+        // Search for columns isolating an eigenvalue and push them left
+        noconv = true;
+        while (noconv) {
+            noconv = false;
+            for (idx_t j = ilo; j < ihi; ++j) {
+                bool canswap = true;
+                for (idx_t i = ilo; i < ihi; ++i) {
+                    if (i != j && A(i, j) != T(zero)) {
+                        canswap = false;
+                        break;
+                    }
+                }
+                if (canswap) {
+                    exchange(j, ilo);
+                    noconv = true;
+                    ++ilo;
+                }
+            }
+        }
+    }
+
+    // Initialize scale for non-permuted submatrix
+    for (idx_t i = ilo; i < ihi; ++i)
+        scale[i] = one;
+
+    if (job == Balance::Permute) return 0;
+
+    // Balance the submatrix in rows ilo to ihi-1
+
+    const real_t sfmin1 = safe_min<real_t>() / ulp<real_t>();
+    const real_t sfmax1 = one / sfmin1;
+    const real_t sfmin2 = sfmin1 * sclfac;
+    const real_t sfmax2 = one / sfmin2;
+
+    // Iterative loop for norm reduction
+    bool noconv = true;
+    while (noconv) {
+        noconv = false;
+        for (idx_t i = ilo; i < ihi; ++i) {
+            real_t c = nrm2(slice(A, range{ilo, ihi}, i));
+            real_t r = nrm2(slice(A, i, range{ilo, ihi}));
+            const idx_t ica = iamax(slice(A, range{0, ihi}, i));
+            real_t ca = abs(A(ica, i));
+            const idx_t ira = iamax(slice(A, i, range{ilo, n}));
+            real_t ra = abs(A(i, ira + ilo));
+
+            // Guard against zero c or r due to underflow
+            if (c == zero || r == zero) continue;
+
+            // Exit if NaN to avoid infinite loop
+            if (isnan(c + ca + r + ra)) return -1;
+
+            real_t g = r / sclfac;
+            real_t f = one;
+            const real_t s = c + r;
+            while (c < g && max(f, max(c, ca)) < sfmax2 &&
+                   min(r, min(g, ra)) > sfmin2) {
+                f *= sclfac;
+                c *= sclfac;
+                ca *= sclfac;
+                r /= sclfac;
+                g /= sclfac;
+                ra /= sclfac;
+            }
+
+            g = c / sclfac;
+            while (g >= r && max(r, ra) < sfmax2 &&
+                   min(min(f, c), min(g, ca)) > sfmin2) {
+                f /= sclfac;
+                c /= sclfac;
+                g /= sclfac;
+                ca /= sclfac;
+                r *= sclfac;
+                ra *= sclfac;
+            }
+
+            // Now balance
+            const real_t scalei = real(scale[i]);
+            if (c + r >= factor * s) continue;
+            if (f < one && scalei < one && f * scalei <= sfmin1) continue;
+            if (f > one && scalei > one && scalei >= sfmax1 / f) continue;
+
+            scale[i] = scalei * f;
+            noconv = true;
+
+            auto ri = slice(A, i, range{ilo, n});
+            scal(one / f, ri);
+            auto ci = slice(A, range{0, ihi}, i);
+            scal(f, ci);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEBAL_HH
@@ -12,6 +12,8 @@
 #ifndef TLAPACK_GEBRD_HH
 #define TLAPACK_GEBRD_HH
 
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/lapack/labrd.hpp"
@@ -22,7 +24,10 @@ namespace tlapack {
  * Options struct for gebrd()
  */
 struct GebrdOpts {
-    size_t nb = 32;  ///< Block size used in the blocked reduction
+    /// Block size used in the blocked reduction. 0: tuned value, see
+    /// tuned_option()
+    size_t nb = 0;
+    ExecutionPolicy exec = {};  ///< Execution policy of the trailing updates
 };
 
 /** Worspace query of gebrd()
@@ -54,7 +59,9 @@ constexpr WorkInfo gebrd_worksize(const matrix_t& A,
 
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
-    const idx_t nb = min((idx_t)opts.nb, min(m, n));
+    const idx_t nb = min(
+        (idx_t)tuned_option<type_t<matrix_t>>(opts.nb, "gebrd", "nb", n, 32),
+        min(m, n));
 
     if constexpr (is_same_v<T, type_t<work_t>>)
         return WorkInfo(m + n, nb);
@@ -90,7 +97,8 @@ int gebrd_work(matrix_t& A,
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
     const idx_t k = min(m, n);
-    const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t nb =
+        min((idx_t)tuned_option<TA>(opts.nb, "gebrd", "nb", n, 32), k);
 
     // Matrices X and Y
     auto [X, work2] = reshape(work, m, nb);
@@ -129,10 +137,16 @@ int gebrd_work(matrix_t& A,
 
             auto V = slice(A, range{i + ib, m}, range{i, i + ib});
             auto Y3 = slice(Y, range{i + ib, n}, range{0, ib});
-            gemm(NO_TRANS, CONJ_TRANS, -one, V, Y3, one, A3);
             auto U = slice(A, range{i, i + ib}, range{i + ib, n});
             auto X3 = slice(X, range{i + ib, m}, range{0, ib});
-            gemm(NO_TRANS, NO_TRANS, -one, X3, U, one, A3);
+            internal::parallel_for_blocks(
+                opts.exec, n - i - ib, nb, [&](idx_t k0, idx_t k1) {
+                    auto A3k = cols(A3, range{k0, k1});
+                    auto Y3k = rows(Y3, range{k0, k1});
+                    auto Uk = cols(U, range{k0, k1});
+                    gemm(NO_TRANS, CONJ_TRANS, -one, V, Y3k, one, A3k);
+                    gemm(NO_TRANS, NO_TRANS, -one, X3, Uk, one, A3k);
+                });
 
             if (m >= n)
                 A(i + ib - 1, i + ib) = e;
@@ -212,7 +226,7 @@ int gebrd(matrix_t& A,
 
     // Allocates workspace
     WorkInfo workinfo = gebrd_worksize<T>(A, tauv, tauw, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gebrd_work(A, tauv, tauw, work, opts);
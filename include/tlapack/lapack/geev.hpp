@@ -0,0 +1,372 @@
+/// @file geev.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dgeev.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEEV_HH
+#define TLAPACK_GEEV_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/lartg.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/gebak.hpp"
+#include "tlapack/lapack/gebal.hpp"
+#include "tlapack/lapack/gehrd.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lange.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+#include "tlapack/lapack/lascl.hpp"
+#include "tlapack/lapack/multishift_qr.hpp"
+#include "tlapack/lapack/trevc3.hpp"
+#include "tlapack/lapack/unghr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for geev
+ */
+struct GeevOpts : public FrancisOpts {
+    /// Operations used to balance the matrix
+    Balance balance = Balance::Both;
+    /// Block size used in the Hessenberg reduction. 0: tuned value, see
+    /// tuned_option()
+    size_t nb = 0;
+    /// If only nx_switch columns are left, the Hessenberg reduction uses
+    /// unblocked code. 0: tuned value, see tuned_option()
+    size_t nx_switch = 0;
+    /// Number of eigenvectors back-transformed at once by trevc3(). 0: tuned
+    /// value, see tuned_option()
+    size_t nb_trevc = 0;
+};
+
+/** Workspace query of geev()
+ *
+ * @param[in] want_vl bool
+ * @param[in] want_vr bool
+ * @param[in] A n-by-n matrix.
+ * @param[in] w Complex vector of length n.
+ * @param[in] VL n-by-n matrix.
+ * @param[in] VR n-by-n matrix.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          enable_if_t<is_complex<type_t<vector_t>>, int> = 0>
+WorkInfo geev_worksize(bool want_vl,
+                       bool want_vr,
+                       const matrix_t& A,
+                       const vector_t& w,
+                       const matrix_t& VL,
+                       const matrix_t& VR,
+                       const GeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = ncols(A);
+    const bool want_v = want_vl || want_vr;
+    const matrix_t& V = (want_vr) ? VR : VL;
+
+    if (n == 0) return WorkInfo(0);
+
+    GehrdOpts gehrdOpts;
+    gehrdOpts.nb = opts.nb;
+    gehrdOpts.nx_switch = opts.nx_switch;
+
+    Trevc3Opts trevcOpts;
+    trevcOpts.nb = opts.nb_trevc;
+
+    auto&& tau = col(A, 0);
+    WorkInfo workinfo = gehrd_worksize<T>(0, n, A, tau, gehrdOpts);
+    if (want_v) workinfo.minMax(unghr_worksize<T>(0, n, V, tau));
+    workinfo.minMax(
+        multishift_qr_worksize<T>(want_v, want_v, 0, n, A, w, V, opts));
+    if (want_v)
+        workinfo.minMax(
+            trevc3_worksize<T>(want_vl, want_vr, true, A, VL, VR, trevcOpts));
+
+    // tau and scale
+    workinfo += WorkInfo(n, 2);
+
+    return workinfo;
+}
+
+/** @copybrief geev()
+ * Workspace is provided as an argument.
+ * @copydetails geev()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_WORKSPACE work_t,
+          enable_if_t<is_complex<type_t<vector_t>>, int> = 0>
+int geev_work(bool want_vl,
+              bool want_vr,
+              matrix_t& A,
+              vector_t& w,
+              matrix_t& VL,
+              matrix_t& VR,
+              work_t& work,
+              const GeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const bool want_v = want_vl || want_vr;
+
+    // check arguments
+    tlapack_check(nrows(A) == n);
+    tlapack_check((idx_t)size(w) == n);
+    if (want_vl) {
+        tlapack_check(nrows(VL) == n);
+        tlapack_check(ncols(VL) == n);
+    }
+    if (want_vr) {
+        tlapack_check(nrows(VR) == n);
+        tlapack_check(ncols(VR) == n);
+    }
+
+    // Quick return
+    if (n == 0) return 0;
+
+    // Schur vectors are computed in VR, or in VL if only the left
+    // eigenvectors are wanted
+    matrix_t& V = (want_vr) ? VR : VL;
+
+    // Householder scalars and balancing factors
+    auto [TS, work2] = reshape(work, n, 2);
+    auto tau = col(TS, 0);
+    auto scale = col(TS, 1);
+
+    // Scale A if its largest entry is outside the range [smlnum, bignum]
+    const real_t smlnum = sqrt(safe_min<real_t>()) / ulp<real_t>();
+    const real_t bignum = one / smlnum;
+    const real_t anrm = lange(MAX_NORM, A);
+    real_t cscale = one;
+    if (anrm > zero && anrm < smlnum)
+        cscale = smlnum;
+    else if (anrm > bignum)
+        cscale = bignum;
+    if (cscale != one) lascl(GENERAL, anrm, cscale, A);
+
+    // Balance the matrix
+    idx_t ilo, ihi;
+    if (gebal(opts.balance, A, ilo, ihi, scale) != 0) return -1;
+
+    // Reduce to upper Hessenberg form
+    GehrdOpts gehrdOpts;
+    gehrdOpts.nb = opts.nb;
+    gehrdOpts.nx_switch = opts.nx_switch;
+    gehrd_work(ilo, ihi, A, tau, work2, gehrdOpts);
+
+    // Generate the unitary matrix used in the reduction
+    if (want_v) {
+        lacpy(GENERAL, A, V);
+        unghr_work(ilo, ihi, V, tau, work2);
+    }
+
+    // Remove the Householder vectors from A
+    for (idx_t j = 0; j + 2 < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            A(i, j) = zero;
+
+    // Compute the Schur factorization. The eigenvalues isolated by gebal()
+    // are in the diagonal of A.
+    FrancisOpts francisOpts = opts;
+    const int info = multishift_qr_work(want_v, want_v, ilo, ihi, A, w, V,
+                                        work2, francisOpts);
+    for (idx_t i = 0; i < ilo; ++i)
+        w[i] = A(i, i);
+    for (idx_t i = ihi; i < n; ++i)
+        w[i] = A(i, i);
+
+    // Undo the scaling of the eigenvalues. The eigenvectors do not depend on
+    // it.
+    if (cscale != one) {
+        const real_t r = anrm / cscale;
+        for (idx_t i = 0; i < n; ++i)
+            w[i] *= r;
+    }
+    if (info != 0 || !want_v) return info;
+
+    // Compute the eigenvectors of the Schur form and back-transform them
+    if (want_vl && want_vr) lacpy(GENERAL, VR, VL);
+    Trevc3Opts trevcOpts;
+    trevcOpts.nb = opts.nb_trevc;
+    trevc3_work(want_vl, want_vr, true, A, VL, VR, work2, trevcOpts);
+
+    // Normalizes the eigenvectors in V to have Euclidean norm 1 and the
+    // largest component real
+    auto normalize = [&](matrix_t& X) {
+        for (idx_t j = 0; j < n; ++j) {
+            auto vj = col(X, j);
+            if (is_real<T> && j + 1 < n && A(j + 1, j) != T(zero)) {
+                // Complex conjugate pair stored in the columns j and j+1
+                auto vj1 = col(X, j + 1);
+                const real_t scl = one / lapy2(nrm2(vj), nrm2(vj1));
+                scal(scl, vj);
+                scal(scl, vj1);
+
+                idx_t k = 0;
+                real_t vmax = zero;
+                for (idx_t i = 0; i < n; ++i) {
+                    const real_t vi =
+                        square(real(vj[i])) + square(real(vj1[i]));
+                    if (vi > vmax) {
+                        vmax = vi;
+                        k = i;
+                    }
+                }
+                real_t c, s, r;
+                lartg(real(vj[k]), real(vj1[k]), c, s, r);
+                rot(vj, vj1, c, s);
+                vj1[k] = zero;
+                ++j;
+            }
+            else {
+                scal(one / nrm2(vj), vj);
+                if constexpr (is_complex<T>) {
+                    idx_t k = 0;
+                    real_t vmax = zero;
+                    for (idx_t i = 0; i < n; ++i) {
+                        const real_t vi = square(real(vj[i])) +
+                                          square(imag(vj[i]));
+                        if (vi > vmax) {
+                            vmax = vi;
+                            k = i;
+                        }
+                    }
+                    scal(conj(vj[k]) / sqrt(vmax), vj);
+                    vj[k] = real(vj[k]);
+                }
+            }
+        }
+    };
+
+    // Undo balancing and normalize
+    if (want_vr) {
+        gebak(opts.balance, RIGHT_SIDE, ilo, ihi, scale, VR);
+        normalize(VR);
+    }
+    if (want_vl) {
+        gebak(opts.balance, LEFT_SIDE, ilo, ihi, scale, VL);
+        normalize(VL);
+    }
+
+    return 0;
+}
+
+/**
+ * Computes the eigenvalues and, optionally, the left and/or right
+ * eigenvectors of a general n-by-n matrix A.
+ *
+ * The right eigenvector v(j) of A satisfies
+ *
+ *      A v(j) = w(j) v(j),
+ *
+ * and the left eigenvector u(j) of A satisfies
+ *
+ *      u(j)^H A = w(j) u(j)^H.
+ *
+ * If the entries of A are very small or very large, A is first scaled to
+ * avoid underflow and overflow, as in LAPACK's xGEEV.
+ * The matrix is then balanced by gebal() and reduced to upper Hessenberg
+ * form by gehrd(). The Schur form is computed by multishift_qr(), and the
+ * eigenvectors are obtained by trevc3(), which back-transforms them with
+ * matrix-matrix products. Finally, the balancing is undone by gebak().
+ *
+ * The computed eigenvectors are normalized to have Euclidean norm equal to 1
+ * and largest component real.
+ *
+ * @return 0 if success.
+ * @return i > 0 if multishift_qr() failed to compute all the eigenvalues.
+ *      The elements i:ihi of w contain the eigenvalues which have converged.
+ *      No eigenvectors are computed.
+ * @return -1 if a NaN was found while balancing A.
+ *
+ * @param[in] want_vl bool
+ *      If true, compute the left eigenvectors of A.
+ *
+ * @param[in] want_vr bool
+ *      If true, compute the right eigenvectors of A.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On exit, A has been overwritten.
+ *
+ * @param[out] w Complex vector of length n.
+ *      The computed eigenvalues. Complex conjugate pairs of eigenvalues of a
+ *      real matrix appear consecutively with the eigenvalue having the
+ *      positive imaginary part first.
+ *
+ * @param[out] VL n-by-n matrix.
+ *      If want_vl is true, the left eigenvectors u(j) are stored one after
+ *      another in the columns of VL, in the same order as their eigenvalues.
+ *      If A is real and the j-th and (j+1)-st eigenvalues form a complex
+ *      conjugate pair, then u(j) = VL(:,j) + i*VL(:,j+1) and
+ *      u(j+1) = VL(:,j) - i*VL(:,j+1).
+ *      If want_vl is false, VL is not referenced.
+ *
+ * @param[out] VR n-by-n matrix.
+ *      If want_vr is true, the right eigenvectors v(j) are stored one after
+ *      another in the columns of VR, in the same order as their eigenvalues.
+ *      If A is real and the j-th and (j+1)-st eigenvalues form a complex
+ *      conjugate pair, then v(j) = VR(:,j) + i*VR(:,j+1) and
+ *      v(j+1) = VR(:,j) - i*VR(:,j+1).
+ *      If want_vr is false, VR is not referenced.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.balance: Operations used to balance A. @see gebal().
+ *      - @c opts.nb and @c opts.nx_switch: @see GehrdOpts.
+ *      - @c opts.nb_trevc: Number of eigenvectors back-transformed at once.
+ *      - The remaining options are passed to multishift_qr().
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          enable_if_t<is_complex<type_t<vector_t>>, int> = 0>
+int geev(bool want_vl,
+         bool want_vr,
+         matrix_t& A,
+         vector_t& w,
+         matrix_t& VL,
+         matrix_t& VR,
+         const GeevOpts& opts = {})
+{
+    using work_t = matrix_type<matrix_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo =
+        geev_worksize<T>(want_vl, want_vr, A, w, VL, VR, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return geev_work(want_vl, want_vr, A, w, VL, VR, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEEV_HH
@@ -12,6 +12,8 @@
 #ifndef TLAPACK_GEHRD_HH
 #define TLAPACK_GEHRD_HH
 
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/lapack/gehd2.hpp"
@@ -25,9 +27,13 @@ namespace tlapack {
  * Options struct for gehrd
  */
 struct GehrdOpts {
-    size_t nb = 32;          ///< Block size used in the blocked reduction
-    size_t nx_switch = 128;  ///< If only nx_switch columns are left, the
-                             ///< algorithm will use unblocked code
+    /// Block size used in the blocked reduction. 0: tuned value, see
+    /// tuned_option()
+    size_t nb = 0;
+    /// If only nx_switch columns are left, the algorithm will use unblocked
+    /// code. 0: tuned value, see tuned_option()
+    size_t nx_switch = 0;
+    ExecutionPolicy exec = {};  ///< Execution policy of the trailing updates
 };
 
 /** Worspace query of gehrd()
@@ -59,9 +65,16 @@ constexpr WorkInfo gehrd_worksize(size_type<matrix_t> ilo,
     using work_t = matrix_type<matrix_t, vector_t>;
     using range = pair<idx_t, idx_t>;
 
+    using TA = type_t<matrix_t>;
+
     const idx_t n = ncols(A);
-    const idx_t nb = (ilo < ihi) ? min<idx_t>(opts.nb, ihi - ilo - 1) : 0;
-    const idx_t nx = max<idx_t>(nb, opts.nx_switch);
+    const idx_t nb =
+        (ilo < ihi)
+            ? min<idx_t>(tuned_option<TA>(opts.nb, "gehrd", "nb", n, 32),
+                         ihi - ilo - 1)
+            : 0;
+    const idx_t nx = max<idx_t>(
+        nb, tuned_option<TA>(opts.nx_switch, "gehrd", "nx_switch", n, 128));
 
     WorkInfo workinfo;
     if constexpr (is_same_v<T, type_t<work_t>>) {
@@ -115,9 +128,14 @@ int gehrd_work(size_type<matrix_t> ilo,
     const idx_t n = ncols(A);
 
     // Blocksize
-    const idx_t nb = (ilo < ihi) ? min<idx_t>(opts.nb, ihi - ilo - 1) : 0;
+    const idx_t nb =
+        (ilo < ihi)
+            ? min<idx_t>(tuned_option<TA>(opts.nb, "gehrd", "nb", n, 32),
+                         ihi - ilo - 1)
+            : 0;
     // Size of the last block which be handled with unblocked code
-    const idx_t nx = max(nb, (idx_t)opts.nx_switch);
+    const idx_t nx = max<idx_t>(
+        nb, tuned_option<TA>(opts.nx_switch, "gehrd", "nx_switch", n, 128));
 
     // check arguments
     tlapack_check_false((ilo < 0) or (ilo >= n));
@@ -159,7 +177,12 @@ int gehrd_work(size_type<matrix_t> ilo,
             V(nb2 - 1, nb2 - 1) = one;
             auto A3 = slice(A, range{0, ihi}, range{i + nb2, ihi});
             auto Y_2 = slice(Y, range{0, ihi}, range{0, nb2});
-            gemm(NO_TRANS, CONJ_TRANS, -one, Y_2, V2, one, A3);
+            internal::parallel_for_blocks(
+                opts.exec, ihi - i - nb2, nb, [&](idx_t k0, idx_t k1) {
+                    auto A3k = cols(A3, range{k0, k1});
+                    auto V2k = rows(V2, range{k0, k1});
+                    gemm(NO_TRANS, CONJ_TRANS, -one, Y_2, V2k, one, A3k);
+                });
             V(nb2 - 1, nb2 - 1) = ei;
         }
         // Apply the block reflector H to A(0:i+1,i+1:i+ib) from the right
@@ -170,10 +193,17 @@ int gehrd_work(size_type<matrix_t> ilo,
             axpy(-one, slice(Y, range{0, i + 1}, j), A4);
         }
 
-        // Apply the block reflector H to A(i+1:ihi,i+nb:n) from the left
+        // Apply the block reflector H to A(i+1:ihi,i+nb:n) from the left.
+        // Each block of columns of A5 uses the corresponding block of columns
+        // of Yt as workspace.
         auto A5 = slice(A, range{i + 1, ihi}, range{i + nb2, n});
-        larfb_work(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE, V, T_s,
-                   A5, Yt);
+        internal::parallel_for_blocks(
+            opts.exec, n - i - nb2, nb, [&](idx_t k0, idx_t k1) {
+                auto A5k = cols(A5, range{k0, k1});
+                auto Wk = slice(Yt, range{0, nb2}, range{k0, k1});
+                larfb_work(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE,
+                           V, T_s, A5k, Wk);
+            });
     }
 
     return gehd2_work(i, ihi, A, tau, work);
@@ -240,7 +270,7 @@ int gehrd(size_type<matrix_t> ilo,
 
     // Allocates workspace
     WorkInfo workinfo = gehrd_worksize<T>(ilo, ihi, A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gehrd_work(ilo, ihi, A, tau, work, opts);
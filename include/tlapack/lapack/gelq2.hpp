@@ -132,7 +132,7 @@ int gelq2(matrix_t& A, vector_t& tauw)
 
     // Allocates workspace
     WorkInfo workinfo = gelq2_worksize<T>(A, tauw);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gelq2_work(A, tauw, work);
@@ -162,7 +162,7 @@ int gelqf(A_t& A, tau_t& tau, const GelqfOpts& opts = {})
 
     // Allocate or get workspace
     WorkInfo workinfo = gelqf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gelqf_work(A, tau, work, opts);
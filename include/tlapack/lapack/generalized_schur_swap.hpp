@@ -177,7 +177,7 @@ int generalized_schur_swap(bool want_q,
         // Swap 1-by-1 block with 2-by-2 block
         //
 
-        std::vector<T> H_;
+        workspace_vector<T> H_;
         auto H = new_matrix(H_, 2, 3);
         std::vector<T> v(3);
 
@@ -264,7 +264,7 @@ int generalized_schur_swap(bool want_q,
         //
         // Swap 2-by-2 block with 1-by-1 block
         //
-        std::vector<T> H_;
+        workspace_vector<T> H_;
         auto H = new_matrix(H_, 2, 3);
         std::vector<T> v(3);
 
@@ -350,7 +350,7 @@ int generalized_schur_swap(bool want_q,
         //
         // Swap 2-by-2 block with 2-by-2 block
         //
-        std::vector<T> M_;
+        workspace_vector<T> M_;
         auto M = new_matrix(M_, 8, 8);
         std::vector<T> x(8);
         std::vector<idx_t> piv(8);
@@ -474,9 +474,9 @@ int generalized_schur_swap(bool want_q,
         rotg(ssy2, temp, cy2, sy2);
 
         // Perform the swap on a local matrix and check the error
-        std::vector<T> AA_;
+        workspace_vector<T> AA_;
         auto AA = new_matrix(AA_, 4, 4);
-        std::vector<T> BB_;
+        workspace_vector<T> BB_;
         auto BB = new_matrix(BB_, 4, 4);
 
         lacpy(GENERAL, slice(A, range(j0, j3 + 1), range(j0, j3 + 1)), AA);
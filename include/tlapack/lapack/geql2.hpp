@@ -143,7 +143,7 @@ int geql2(matrix_t& A, vector_t& tau)
 
     // Allocates workspace
     WorkInfo workinfo = geql2_worksize<T>(A, tau);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return geql2_work(A, tau, work);
@@ -18,6 +18,92 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /** QR factorization of an m-by-n matrix whose sizes are known at compile
+     * time.
+     *
+     * The matrix is copied to a local array and all loops are unrolled, so
+     * that the entries are kept in registers. The Householder reflectors are
+     * computed without the rescaling of larfg(). If a column is so small or
+     * so large that the rescaling is needed, A and tau are not modified and
+     * false is returned. Otherwise, the result is the same as the one of
+     * geqr2().
+     *
+     * @return true if the factorization was computed.
+     *
+     * @ingroup computational
+     */
+    template <int m, int n, TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR vector_t>
+    bool geqr2_unrolled(matrix_t& A, vector_t& tau)
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+        using real_t = real_type<T>;
+        constexpr int k = (m < n) ? m : n;
+
+        // Range of squared norms in which no rescaling is needed
+        const real_t small = safe_min<real_t>() / ulp<real_t>();
+        const real_t big = safe_max<real_t>();
+
+        T a[m][n], t[k];
+        static_for<0, m>([&](auto i) {
+            static_for<0, n>(
+                [&](auto j) { a[i][j] = A(idx_t(i), idx_t(j)); });
+        });
+
+        bool ok = true;
+        static_for<0, k>([&](auto j) {
+            if (!ok) return;
+
+            // Generate the elementary reflector H(j)
+            const T alpha = a[j][j];
+            real_t beta2 =
+                real(alpha) * real(alpha) + imag(alpha) * imag(alpha);
+            bool identity = (imag(alpha) == real_t(0));
+            static_for<j + 1, m>([&](auto i) {
+                beta2 += real(a[i][j]) * real(a[i][j]) +
+                         imag(a[i][j]) * imag(a[i][j]);
+                identity = identity && (a[i][j] == T(0));
+            });
+            if (identity) {
+                t[j] = T(0);
+                return;
+            }
+            if (!(beta2 >= small && beta2 < big)) {
+                ok = false;
+                return;
+            }
+            const real_t beta =
+                (real(alpha) < real_t(0)) ? sqrt(beta2) : -sqrt(beta2);
+            t[j] = (beta - alpha) / beta;
+            const T scal = T(1) / (alpha - beta);
+            static_for<j + 1, m>([&](auto i) { a[i][j] *= scal; });
+            a[j][j] = T(beta);
+
+            // Apply H(j)^H = I - conj(tau) v v^H to A(j:m,j+1:n) from the left
+            static_for<j + 1, n>([&](auto c) {
+                T w = a[j][c];
+                static_for<j + 1, m>(
+                    [&](auto i) { w += conj(a[i][j]) * a[i][c]; });
+                w *= conj(t[j]);
+                a[j][c] -= w;
+                static_for<j + 1, m>([&](auto i) { a[i][c] -= a[i][j] * w; });
+            });
+        });
+        if (!ok) return false;
+
+        static_for<0, m>([&](auto i) {
+            static_for<0, n>(
+                [&](auto j) { A(idx_t(i), idx_t(j)) = a[i][j]; });
+        });
+        static_for<0, k>([&](auto j) { tau[idx_t(j)] = t[j]; });
+
+        return true;
+    }
+
+}  // namespace internal
+
 /** Worspace query of geqr2()
  *
  * @param[in] A m-by-n matrix.
@@ -73,6 +159,13 @@ int geqr2_work(matrix_t& A, vector_t& tau, work_t& work)
     // quick return
     if (n <= 0 || m <= 0) return 0;
 
+    // Small matrices with sizes known at compile time
+    if constexpr (internal::use_unrolled_kernel<matrix_t>) {
+        if (internal::geqr2_unrolled<static_nrows<matrix_t>,
+                                     static_ncols<matrix_t>>(A, tau))
+            return 0;
+    }
+
     for (idx_t i = 0; i < k; ++i) {
         // Define v := A[i:m,i]
         auto v = slice(A, range{i, m}, i);
@@ -126,6 +219,11 @@ int geqr2_work(matrix_t& A, vector_t& tau, work_t& work)
  * @param[out] tau Real vector of length min(m,n).
  *      The scalar factors of the elementary reflectors.
  *
+ * @note If the sizes of A are known at compile time, e.g., for mdspan with
+ *     static extents or fixed-size Eigen matrices, and are at most
+ *     internal::max_unrolled_size, the loops are fully unrolled and no
+ *     workspace is allocated.
+ *
  * @ingroup alloc_workspace
  */
 template <TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR vector_t>
@@ -144,9 +242,17 @@ int geqr2(matrix_t& A, vector_t& tau)
     // quick return
     if (n <= 0 || m <= 0) return 0;
 
+    // Small matrices with sizes known at compile time need no workspace
+    if constexpr (internal::use_unrolled_kernel<matrix_t>) {
+        tlapack_check_false((idx_t)size(tau) < min(m, n));
+        if (internal::geqr2_unrolled<static_nrows<matrix_t>,
+                                     static_ncols<matrix_t>>(A, tau))
+            return 0;
+    }
+
     // Allocates workspace
     WorkInfo workinfo = geqr2_worksize<T>(A, tau);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return geqr2_work(A, tau, work);
@@ -0,0 +1,183 @@
+/// @file geqr2_batched.hpp Computes the QR factorization of a batch of small
+/// matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQR2_BATCHED_HH
+#define TLAPACK_GEQR2_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/batched/Batch.hpp"
+#include "tlapack/lapack/geqr2.hpp"
+
+namespace tlapack {
+
+/** Computes the QR factorization of each matrix A[b] of a batch of m-by-n
+ * matrices.
+ *
+ * Each factorization has the same semantics as geqr2(A[b], tau[b]).
+ *
+ * For real types, groups of matrices are copied to an interleaved layout
+ * (batch index innermost) and factored together, so that the loops over the
+ * matrices of a group run in SIMD lanes. The Householder reflectors are
+ * computed without the rescaling of larfg(). A matrix whose columns are so
+ * small or so large that the rescaling is needed is factored again by
+ * geqr2(). For complex types, geqr2() is called on each matrix.
+ *
+ * @param[in,out] A Batch of m-by-n matrices, e.g., a LegacyStridedBatch or
+ *      a std::vector of matrices. All matrices must have the same size.
+ *      On exit, the factors R and the Householder vectors of each matrix, in
+ *      the format of geqr2().
+ *
+ * @param[out] tau Batch of vectors of size min(m,n), e.g., a
+ *      std::vector<std::vector<T>>. tau[b] are the scalar factors of the
+ *      elementary reflectors of A[b].
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy used to split the batch among threads.
+ *
+ * @return 0
+ *
+ * @ingroup computational
+ */
+template <class batch_t, class tau_batch_t>
+int geqr2_batched(batch_t& A, tau_batch_t& tau, const BatchOpts& opts = {})
+{
+    using matrix_t = std::decay_t<decltype(A[0])>;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr std::size_t L = internal::batch_lanes<T>;
+
+    const std::size_t nbatch = A.size();
+
+    // check arguments
+    tlapack_check((std::size_t)size(tau) >= nbatch);
+
+    // quick return
+    if (nbatch == 0) return 0;
+
+    const idx_t m = nrows(A[0]);
+    const idx_t n = ncols(A[0]);
+    const idx_t k = min(m, n);
+    for (std::size_t b = 0; b < nbatch; ++b) {
+        tlapack_check(nrows(A[b]) == m && ncols(A[b]) == n);
+        tlapack_check((idx_t)size(tau[b]) >= k);
+    }
+
+    if constexpr (!internal::has_interleaved_kernels<T>) {
+        internal::for_each_group<1>(
+            opts.exec, nbatch, [&](std::size_t b, std::size_t) {
+                auto&& Ab = A[b];
+                auto&& taub = tau[b];
+                geqr2(Ab, taub);
+            });
+    }
+    else {
+        // Range of squared norms in which no rescaling is needed
+        const T small = safe_min<T>() / ulp<T>();
+        const T big = safe_max<T>();
+
+        internal::for_each_group<L>(opts.exec, nbatch, [&](std::size_t b0,
+                                                           std::size_t b1) {
+            const std::size_t nb = b1 - b0;
+            internal::InterleavedMatrix<T, L> P(m, n);
+            workspace_vector<T> tauP(k * L);
+
+            // Unused lanes hold zeros
+            for (std::size_t l = 0; l < L; ++l) {
+                if (l < nb) {
+                    auto&& Ab = A[b0 + l];
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            P(i, j)[l] = Ab(i, j);
+                }
+                else {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            P(i, j)[l] = T(0);
+                }
+            }
+
+            bool fallback[L] = {};
+            T xnorm2[L], beta[L], scal[L], w[L];
+            for (idx_t j = 0; j < k; ++j) {
+                // Generate the elementary reflector H(j)
+                for (std::size_t l = 0; l < L; ++l)
+                    xnorm2[l] = T(0);
+                for (idx_t i = j + 1; i < m; ++i) {
+                    const T* pij = P(i, j);
+                    for (std::size_t l = 0; l < L; ++l)
+                        xnorm2[l] += pij[l] * pij[l];
+                }
+                T* pjj = P(j, j);
+                T* tauj = &tauP[j * L];
+                for (std::size_t l = 0; l < L; ++l) {
+                    const T alpha = pjj[l];
+                    const T beta2 = alpha * alpha + xnorm2[l];
+                    const bool identity = (xnorm2[l] == T(0));
+                    if (!identity && !(beta2 >= small && beta2 < big))
+                        fallback[l] = true;
+                    const T b = std::sqrt(beta2);
+                    beta[l] = identity ? alpha : ((alpha >= T(0)) ? -b : b);
+                    tauj[l] = identity ? T(0) : (beta[l] - alpha) / beta[l];
+                    scal[l] = identity ? T(1) : T(1) / (alpha - beta[l]);
+                }
+                for (idx_t i = j + 1; i < m; ++i) {
+                    T* pij = P(i, j);
+                    for (std::size_t l = 0; l < L; ++l)
+                        pij[l] *= scal[l];
+                }
+
+                // Apply H(j) to the trailing columns from the left
+                for (idx_t c = j + 1; c < n; ++c) {
+                    T* pjc = P(j, c);
+                    for (std::size_t l = 0; l < L; ++l)
+                        w[l] = pjc[l];
+                    for (idx_t i = j + 1; i < m; ++i) {
+                        const T* pij = P(i, j);
+                        const T* pic = P(i, c);
+                        for (std::size_t l = 0; l < L; ++l)
+                            w[l] += pij[l] * pic[l];
+                    }
+                    for (std::size_t l = 0; l < L; ++l) {
+                        w[l] *= tauj[l];
+                        pjc[l] -= w[l];
+                    }
+                    for (idx_t i = j + 1; i < m; ++i) {
+                        const T* pij = P(i, j);
+                        T* pic = P(i, c);
+                        for (std::size_t l = 0; l < L; ++l)
+                            pic[l] -= w[l] * pij[l];
+                    }
+                }
+
+                for (std::size_t l = 0; l < L; ++l)
+                    pjj[l] = beta[l];
+            }
+
+            for (std::size_t l = 0; l < nb; ++l) {
+                auto&& Ab = A[b0 + l];
+                auto&& taub = tau[b0 + l];
+                if (fallback[l]) {
+                    geqr2(Ab, taub);
+                    continue;
+                }
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        Ab(i, j) = P(i, j)[l];
+                for (idx_t j = 0; j < k; ++j)
+                    taub[j] = tauP[j * L + l];
+            }
+        });
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQR2_BATCHED_HH
@@ -12,19 +12,59 @@
 #ifndef TLAPACK_GEQRF_HH
 #define TLAPACK_GEQRF_HH
 
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/geqr2.hpp"
+#include "tlapack/lapack/geqrt3.hpp"
+#include "tlapack/lapack/lacpy.hpp"
 #include "tlapack/lapack/larfb.hpp"
 #include "tlapack/lapack/larft.hpp"
 
 namespace tlapack {
+
+/// @brief Algorithms for the panel factorization in geqrf()
+enum class GeqrfPanel : char {
+    Level2 = '2',    ///< geqr2() followed by larft()
+    Recursive = 'R'  ///< geqrt3()
+};
+
 /**
  * Options struct for geqrf
  */
 struct GeqrfOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 0;  ///< Block size. 0: tuned value, see tuned_option()
+    GeqrfPanel panel = GeqrfPanel::Level2;  ///< Panel factorization
+    size_t nx_panel = 0;  ///< Recursion cutoff of the panel factorization.
+                          ///< 0: tuned value, see tuned_option()
+    ExecutionPolicy exec = {};  ///< Execution policy of the trailing updates
 };
 
+namespace internal {
+
+    /// Block size of geqrf(). The panels of a tile-major matrix are its block
+    /// columns, so that the trailing updates work on whole tiles.
+    template <TLAPACK_SMATRIX A_t>
+    constexpr size_type<A_t> geqrf_nb(const A_t& A, const GeqrfOpts& opts)
+    {
+        using idx_t = size_type<A_t>;
+        if constexpr (layout<A_t> == Layout::TileMajor) {
+            if (A.j0 == 0) return A.nb;
+        }
+        return (idx_t)tuned_option<type_t<A_t>>(opts.nb, "geqrf", "nb",
+                                                ncols(A), 32);
+    }
+
+    /// Options of geqrt3() for the recursive panels of geqrf()
+    template <TLAPACK_SMATRIX A_t>
+    Geqrt3Opts geqrf_panel_opts(const A_t& A, const GeqrfOpts& opts)
+    {
+        return Geqrt3Opts{tuned_option<type_t<A_t>>(
+            opts.nx_panel, "geqrf", "nx_panel", ncols(A), 16)};
+    }
+
+}  // namespace internal
+
 /** Worspace query of geqrf()
  *
  * @param[in] A m-by-n matrix.
@@ -50,20 +90,30 @@ constexpr WorkInfo geqrf_worksize(const A_t& A,
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
     const idx_t k = min(m, n);
-    const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t nb = min(internal::geqrf_nb(A, opts), k);
 
     auto&& A11 = cols(A, range(0, nb));
     auto&& tauw1 = slice(tau, range(0, nb));
-    WorkInfo workinfo = geqr2_worksize<T>(A11, tauw1);
+    const bool recursive = (opts.panel == GeqrfPanel::Recursive);
+    WorkInfo workinfo =
+        recursive ? geqrt3_worksize<T>(A11, tauw1,
+                                       internal::geqrf_panel_opts(A, opts))
+                  : geqr2_worksize<T>(A11, tauw1);
 
     if (n > nb) {
         auto&& TT1 = slice(A, range(0, nb), range(0, nb));
         auto&& A12 = slice(A, range(0, m), range(nb, n));
         workinfo.minMax(larfb_worksize<T>(LEFT_SIDE, CONJ_TRANS, FORWARD,
                                           COLUMNWISE_STORAGE, A11, TT1, A12));
+    }
+    if (n > nb || recursive) {
         if constexpr (is_same_v<T, type_t<work_t>>)
             workinfo += WorkInfo(nb, nb);
     }
+    if constexpr (layout<A_t> == Layout::TileMajor) {
+        if constexpr (is_same_v<T, type_t<work_t>>)
+            workinfo += WorkInfo(m, nb);
+    }
 
     return workinfo;
 }
@@ -86,35 +136,70 @@ int geqrf_work(A_t& A, tau_t& tau, work_t& work, const GeqrfOpts& opts = {})
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
     const idx_t k = min(m, n);
-    const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t nb = min(internal::geqrf_nb(A, opts), k);
+
+    const bool recursive = (opts.panel == GeqrfPanel::Recursive);
+    const Geqrt3Opts geqrt3Opts = internal::geqrf_panel_opts(A, opts);
 
     // check arguments
     tlapack_check((idx_t)size(tau) >= k);
 
     // Matrix TT
-    auto [TT, work2] = (n > nb) ? reshape(work, nb, nb) : reshape(work, 0, 0);
+    auto [TT, work2] = (n > nb || recursive) ? reshape(work, nb, nb)
+                                             : reshape(work, 0, 0);
 
-    // Main computational loop
-    for (idx_t j = 0; j < k; j += nb) {
-        const idx_t ib = min(nb, k - j);
-
-        // Compute the QR factorization of the current block A(j:m,j:j+ib)
-        auto A11 = slice(A, range(j, m), range(j, j + ib));
+    // Factors the block V = A(j:m,j:j+ib) and applies its block reflector to
+    // A(j:m,j+ib:n)
+    auto factor_and_update = [&](idx_t j, auto& V, auto& panelWork,
+                                 auto& updateWork) {
+        const idx_t ib = ncols(V);
         auto tauw1 = slice(tau, range(j, j + ib));
 
-        geqr2_work(A11, tauw1, work);
+        // The recursive panel also forms the triangular factor of the block
+        // reflector H = H(j) H(j+1) . . . H(j+ib-1)
+        if (recursive) {
+            auto TT1 = slice(TT, range(0, ib), range(0, ib));
+            geqrt3_work(V, tauw1, TT1, updateWork, geqrt3Opts);
+        }
+        else
+            geqr2_work(V, tauw1, panelWork);
 
         if (j + ib < n) {
-            // Form the triangular factor of the block reflector H = H(j)
-            // H(j+1) . . . H(j+ib-1)
+            // Form the triangular factor of the block reflector
             auto TT1 = slice(TT, range(0, ib), range(0, ib));
-            larft(FORWARD, COLUMNWISE_STORAGE, A11, tauw1, TT1);
+            if (!recursive) larft(FORWARD, COLUMNWISE_STORAGE, V, tauw1, TT1);
 
-            // Apply H to A(j:m,j+ib:n) from the left
+            // Apply H to A(j:m,j+ib:n) from the left. Each block of columns
+            // of A12 uses the corresponding block of columns of W.
             auto A12 = slice(A, range(j, m), range(j + ib, n));
-            larfb_work(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE, A11,
-                       TT1, A12, work2);
+            auto W = reshape(updateWork, ib, n - j - ib).first;
+            internal::parallel_for_blocks(
+                opts.exec, n - j - ib, nb, [&](idx_t k0, idx_t k1) {
+                    auto A12k = cols(A12, range(k0, k1));
+                    auto Wk = cols(W, range(k0, k1));
+                    larfb_work(LEFT_SIDE, CONJ_TRANS, FORWARD,
+                               COLUMNWISE_STORAGE, V, TT1, A12k, Wk);
+                });
+        }
+    };
+
+    // Main computational loop
+    for (idx_t j = 0; j < k; j += nb) {
+        const idx_t ib = min(nb, k - j);
+
+        // Compute the QR factorization of the current block A(j:m,j:j+ib)
+        auto A11 = slice(A, range(j, m), range(j, j + ib));
+
+        // The panel of a tile-major matrix is factored in a contiguous copy
+        if constexpr (layout<A_t> == Layout::TileMajor) {
+            auto [P, work3] = reshape(work2, m, nb);
+            auto V = slice(P, range(0, m - j), range(0, ib));
+            lacpy(GENERAL, A11, V);
+            factor_and_update(j, V, work3, work3);
+            lacpy(GENERAL, V, A11);
         }
+        else
+            factor_and_update(j, A11, work, work2);
     }
 
     return 0;
@@ -151,6 +236,15 @@ int geqrf_work(A_t& A, tau_t& tau, work_t& work, const GeqrfOpts& opts = {})
  *      The scalar factors of the elementary reflectors.
  *
  * @param[in] opts Options.
+ *      - nb: Block size. If A is a TileMajorMatrix whose first column starts
+ *        a block column, the block size is the width of the tiles. The
+ *        panels of a TileMajorMatrix are factored in a contiguous copy.
+ *      - panel: Factorization of the panels of nb columns. GeqrfPanel::Level2
+ *        uses geqr2() and then larft(). GeqrfPanel::Recursive uses geqrt3(),
+ *        which forms the triangular factor of the block reflector with gemm()
+ *        and trmm() while it factors the panel.
+ *      - nx_panel: Recursion cutoff of geqrt3().
+ *      - exec: Execution policy of the trailing updates.
  *
  * @ingroup alloc_workspace
  */
@@ -163,7 +257,7 @@ int geqrf(A_t& A, tau_t& tau, const GeqrfOpts& opts = {})
 
     // Allocate or get workspace
     WorkInfo workinfo = geqrf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return geqrf_work(A, tau, work, opts);
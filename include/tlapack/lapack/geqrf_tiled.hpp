@@ -0,0 +1,142 @@
+/// @file geqrf_tiled.hpp Computes the QR factorization of a general matrix
+/// using a tiled algorithm.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQRF_TILED_HH
+#define TLAPACK_GEQRF_TILED_HH
+
+#include <deque>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/larfb.hpp"
+#include "tlapack/lapack/larft.hpp"
+#include "tlapack/tiled/TiledMatrix.hpp"
+
+namespace tlapack {
+
+/** Computes a QR factorization of an m-by-n matrix A using a tiled
+ * algorithm.
+ *
+ * The output has the same format as geqrf(). The matrix is partitioned into
+ * nb-by-nb tiles. For each block column p, one task factors the block column
+ * from the diagonal tile down (geqrf) and forms the triangular factor of the
+ * block reflector (larft). One task per block column j > p then applies the
+ * block reflector to the block column j (larfb). Each task starts as soon as
+ * its dependencies are satisfied, so that the factorization of the block
+ * column p+1 overlaps with the updates of the block columns j > p+1.
+ *
+ * @note The tasks work on whole block columns, not on tiles. The reflectors
+ *      of a block column span all its tiles below the diagonal, as in
+ *      geqrf(), so the panel is a single task and the tiles of a column are
+ *      not pipelined. Tile kernels (geqrt, tsqrt, tsmqr) would let the panel
+ *      tiles pipeline, but they represent Q as a tree of small reflectors in
+ *      a format different from geqrf(). Parallelism comes only from the
+ *      nt - p - 1 updates of each step, so tall and skinny matrices gain
+ *      little. Use tsqr() for those.
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the elements on and above the diagonal of the array
+ *      contain the min(m,n)-by-n upper trapezoidal matrix R
+ *      (R is upper triangular if m >= n); the elements below the diagonal,
+ *      with the array tau, represent the unitary matrix Q as a
+ *      product of elementary reflectors.
+ *
+ * @param[out] tau Real vector of length min(m,n).
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *      - nb: Tile size.
+ *      - exec: Execution policy used to run the tasks.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t>
+int geqrf_tiled(A_t& A, tau_t& tau, const TiledOpts& opts = {})
+{
+    using work_t = matrix_type<A_t, tau_t>;
+    using T = type_t<work_t>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+    using tiled::Access;
+    using tiled::Dependency;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = opts.nb;
+
+    // check arguments
+    tlapack_check((idx_t)size(tau) >= k);
+    tlapack_check(nb > 0);
+
+    // quick return
+    if (k <= 0) return 0;
+
+    tiled::TiledMatrix<A_t> tA(A, nb, nb);
+    const idx_t mt = tA.mt();
+    const idx_t nt = tA.nt();
+    const idx_t kt = (k + nb - 1) / nb;
+
+    // Triangular factors of the block reflectors
+    std::deque<std::vector<T>> Ts(kt);
+
+    tiled::TaskGraph g;
+    for (idx_t p = 0; p < kt; ++p) {
+        const idx_t r0 = tA.rows(p).first;
+        const idx_t c0 = tA.cols(p).first;
+        const idx_t kp = min(tA.tile_ncols(p), m - r0);
+        std::vector<T>* Tp = &Ts[p];
+
+        // Factor the block column
+        std::vector<Dependency> deps = tA.column(p, mt, p, Access::ReadWrite);
+        deps.push_back({&tau[r0], Access::Write});
+        deps.push_back({Tp, Access::Write});
+        g.insert_task(
+            [&, p, r0, c0, kp, Tp]() {
+                Create<work_t> new_matrix;
+                auto Ap = slice(A, range(r0, m), tA.cols(p));
+                auto taup = slice(tau, range(r0, r0 + kp));
+                geqrf(Ap, taup);
+
+                auto V = slice(A, range(r0, m), range(c0, c0 + kp));
+                auto TT = new_matrix(*Tp, kp, kp);
+                larft(FORWARD, COLUMNWISE_STORAGE, V, taup, TT);
+            },
+            deps, 2);
+
+        // Apply the block reflector to the trailing block columns
+        for (idx_t j = p + 1; j < nt; ++j) {
+            std::vector<Dependency> deps = tA.column(p, mt, p, Access::Read);
+            std::vector<Dependency> depsj =
+                tA.column(p, mt, j, Access::ReadWrite);
+            deps.insert(deps.end(), depsj.begin(), depsj.end());
+            deps.push_back({Tp, Access::Read});
+            g.insert_task(
+                [&, j, r0, c0, kp, Tp]() {
+                    Create<work_t> new_matrix;
+                    auto V = slice(A, range(r0, m), range(c0, c0 + kp));
+                    auto TT = new_matrix(*Tp, kp, kp);
+                    auto Aj = slice(A, range(r0, m), tA.cols(j));
+                    larfb(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE,
+                          V, TT, Aj);
+                },
+                deps, (j == p + 1) ? 1 : 0);
+        }
+    }
+    g.execute(opts.exec);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQRF_TILED_HH
@@ -0,0 +1,198 @@
+/// @file geqrt3.hpp Computes the QR factorization of a general matrix and the
+/// triangular factor of its block reflector using a recursive algorithm.
+/// @note Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/zgeqrt3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQRT3_HH
+#define TLAPACK_GEQRT3_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trmm.hpp"
+#include "tlapack/lapack/geqr2.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/larft.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for geqrt3
+ */
+struct Geqrt3Opts {
+    size_t nx = 16;  ///< Panels with at most nx columns are factored with
+                     ///< geqr2() and larft()
+};
+
+/** Worspace query of geqrt3()
+ *
+ * @param[in] A m-by-n matrix, m >= n.
+ *
+ * @param tau Vector of length n.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t>
+constexpr WorkInfo geqrt3_worksize(const A_t& A,
+                                   const tau_t& tau,
+                                   const Geqrt3Opts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    const idx_t n = ncols(A);
+    const idx_t nx = min(max((idx_t)opts.nx, idx_t(1)), n);
+
+    // The leaves of the recursion are the only calls that need workspace
+    auto&& A1 = cols(A, range(0, nx));
+    auto&& tau1 = slice(tau, range(0, nx));
+    return geqr2_worksize<T>(A1, tau1);
+}
+
+/** @copybrief geqrt3()
+ * Workspace is provided as an argument.
+ * @copydetails geqrt3()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_SVECTOR tau_t,
+          TLAPACK_SMATRIX TT_t,
+          TLAPACK_WORKSPACE work_t>
+int geqrt3_work(
+    A_t& A, tau_t& tau, TT_t& TT, work_t& work, const Geqrt3Opts& opts = {})
+{
+    using T = type_t<A_t>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t nx = max((idx_t)opts.nx, idx_t(1));
+
+    // check arguments
+    tlapack_check(m >= n);
+    tlapack_check((idx_t)size(tau) >= n);
+    tlapack_check(nrows(TT) >= n && ncols(TT) >= n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if (n <= nx) {
+        geqr2_work(A, tau, work);
+        larft(FORWARD, COLUMNWISE_STORAGE, A, slice(tau, range(0, n)), TT);
+        return 0;
+    }
+
+    const idx_t n1 = n / 2;
+    const idx_t n2 = n - n1;
+
+    // Factor the first half of the columns
+    auto A1 = cols(A, range(0, n1));
+    auto tau1 = slice(tau, range(0, n1));
+    auto T1 = slice(TT, range(0, n1), range(0, n1));
+    geqrt3_work(A1, tau1, T1, work, opts);
+
+    // Apply Q1^H = I - V1 T1^H V1^H to A(0:m,n1:n), using T12 as workspace
+    auto V11 = slice(A, range(0, n1), range(0, n1));
+    auto V21 = slice(A, range(n1, m), range(0, n1));
+    auto A12 = slice(A, range(0, n1), range(n1, n));
+    auto A22 = slice(A, range(n1, m), range(n1, n));
+    auto T12 = slice(TT, range(0, n1), range(n1, n));
+
+    lacpy(GENERAL, A12, T12);
+    trmm(LEFT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, T(1), V11, T12);
+    gemm(CONJ_TRANS, NO_TRANS, T(1), V21, A22, T(1), T12);
+    trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, T(1), T1, T12);
+    gemm(NO_TRANS, NO_TRANS, T(-1), V21, T12, T(1), A22);
+    trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), V11, T12);
+    for (idx_t j = 0; j < n2; ++j)
+        for (idx_t i = 0; i < n1; ++i)
+            A12(i, j) -= T12(i, j);
+
+    // Factor the second half of the columns
+    auto tau2 = slice(tau, range(n1, n));
+    auto T2 = slice(TT, range(n1, n), range(n1, n));
+    geqrt3_work(A22, tau2, T2, work, opts);
+
+    // T12 = -T1 V1^H V2 T2, where V2 is unit lower triangular in the rows
+    // n1:n and is zero above them
+    auto V2 = slice(A, range(n1, n), range(n1, n));
+    for (idx_t j = 0; j < n2; ++j)
+        for (idx_t i = 0; i < n1; ++i)
+            T12(i, j) = conj(A(n1 + j, i));
+    trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), V2, T12);
+    if (m > n)
+        gemm(CONJ_TRANS, NO_TRANS, T(1), slice(A, range(n, m), range(0, n1)),
+             slice(A, range(n, m), range(n1, n)), T(1), T12);
+    trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, T(-1), T1, T12);
+    trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, T(1), T2, T12);
+
+    return 0;
+}
+
+/** Computes a QR factorization of an m-by-n matrix A, m >= n, and the
+ * triangular factor of the block reflector of Q using the recursive algorithm
+ * of Elmroth and Gustavson.
+ *
+ * The matrix Q is represented as in geqrf(), and also as the block reflector
+ * \[
+ *          Q = H_1 H_2 ... H_n = I - V T V^H,
+ * \]
+ * where V is the unit lower trapezoidal matrix stored below the diagonal of
+ * A and T is upper triangular. The columns are split in two halves, and the
+ * routine calls itself to factor each half. The update of the second half
+ * and the off-diagonal block of T are computed with gemm() and trmm(), so
+ * that the factorization is rich in level-3 operations. Matrices with at most
+ * opts.nx columns are factored with geqr2() and larft().
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the elements on and above the diagonal of the array
+ *      contain the n-by-n upper triangular matrix R; the elements below the
+ *      diagonal, with the array tau, represent the unitary matrix Q as a
+ *      product of elementary reflectors.
+ *
+ * @param[out] tau Vector of length n.
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[out] TT n-by-n matrix.
+ *      The upper triangular factor T of the block reflector. The strictly
+ *      lower triangle is not referenced.
+ *
+ * @param[in] opts Options.
+ *      - nx: Largest number of columns factored with the level-2 algorithm.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t, TLAPACK_SMATRIX TT_t>
+int geqrt3(A_t& A, tau_t& tau, TT_t& TT, const Geqrt3Opts& opts = {})
+{
+    using work_t = matrix_type<A_t, tau_t>;
+    using T = type_t<work_t>;
+    Create<work_t> new_matrix;
+
+    // Allocate or get workspace
+    WorkInfo workinfo = geqrt3_worksize<T>(A, tau, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return geqrt3_work(A, tau, TT, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQRT3_HH
@@ -143,7 +143,7 @@ int gerq2(matrix_t& A, vector_t& tau)
 
     // Allocates workspace
     WorkInfo workinfo = gerq2_worksize<T>(A, tau);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gerq2_work(A, tau, work);
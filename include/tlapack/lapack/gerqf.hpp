@@ -165,7 +165,7 @@ int gerqf(A_t& A, tau_t& tau, const GerqfOpts& opts = {})
 
     // Allocate or get workspace
     WorkInfo workinfo = gerqf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gerqf_work(A, tau, work, opts);
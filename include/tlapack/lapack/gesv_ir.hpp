@@ -0,0 +1,280 @@
+/// @file gesv_ir.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zcgesv.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GESV_IR_HH
+#define TLAPACK_GESV_IR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/getrs.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lange.hpp"
+#include "tlapack/lapack/laset.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for gesv_ir()
+struct GesvIrOpts : public GetrfOpts {
+    int itermax = 30;  ///< Maximum number of refinement steps
+};
+
+namespace internal {
+
+    /// Returns true if every column of R satisfies the stopping criterion of
+    /// the iterative refinement, |R(:,j)| <= cte |X(:,j)| in the max norm
+    template <TLAPACK_SMATRIX matrixR_t, TLAPACK_SMATRIX matrixX_t>
+    bool ir_converged(const matrixR_t& R,
+                      const matrixX_t& X,
+                      const real_type<type_t<matrixX_t>>& cte)
+    {
+        using idx_t = size_type<matrixX_t>;
+
+        for (idx_t j = 0; j < ncols(X); ++j) {
+            const auto xj = col(X, j);
+            const auto rj = col(R, j);
+            if (abs1(rj[iamax(rj)]) > abs1(xj[iamax(xj)]) * cte) return false;
+        }
+        return true;
+    }
+
+}  // namespace internal
+
+/** Worspace query of gesv_ir()
+ *
+ * @param[in] A n-by-n matrix.
+ * @param[in] B n-by-nrhs matrix.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount of workspace required in the working
+ *      precision. The low precision workspace is n-by-(n+nrhs).
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrixA_t, TLAPACK_SMATRIX matrixB_t>
+constexpr WorkInfo gesv_ir_worksize(const matrixA_t& A,
+                                    const matrixB_t& B,
+                                    const GesvIrOpts& opts = {})
+{
+    return WorkInfo(nrows(B), ncols(B));
+}
+
+/** @copybrief gesv_ir()
+ * Workspace is provided as an argument.
+ * @copydetails gesv_ir()
+ *
+ * @param[out] Wlow n-by-(n+nrhs) workspace.
+ *      Its entry type is the precision used in the factorization of A.
+ *
+ * @param work Workspace in the working precision. Use the workspace query
+ *      gesv_ir_worksize() to determine its size.
+ *
+ * @ingroup workspace
+ */
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SVECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t,
+          TLAPACK_SMATRIX matrixLow_t,
+          TLAPACK_WORKSPACE work_t>
+int gesv_ir_work(matrixA_t& A,
+                 piv_t& piv,
+                 const matrixB_t& B,
+                 matrixX_t& X,
+                 int& iter,
+                 matrixLow_t& Wlow,
+                 work_t& work,
+                 const GesvIrOpts& opts = {})
+{
+    using idx_t = size_type<matrixA_t>;
+    using T = type_t<matrixX_t>;
+    using real_t = real_type<T>;
+    using TL = type_t<matrixLow_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+    const real_t rmax(std::numeric_limits<real_type<TL>>::max());
+
+    // check arguments
+    tlapack_check_false(ncols(A) != n);
+    tlapack_check_false((idx_t)size(piv) < n);
+    tlapack_check_false(nrows(B) != n);
+    tlapack_check_false(nrows(X) != n || ncols(X) != nrhs);
+    tlapack_check_false(nrows(Wlow) < n || ncols(Wlow) < n + nrhs);
+    tlapack_check_false(opts.itermax < 0);
+
+    iter = 0;
+
+    // Quick return if possible
+    if (n == 0 || nrhs == 0) return 0;
+
+    // Matrices in low precision
+    auto Alow = slice(Wlow, range{0, n}, range{0, n});
+    auto Rlow = slice(Wlow, range{0, n}, range{n, n + nrhs});
+
+    // Residual in the working precision
+    auto [R, work1] = reshape(work, n, nrhs);
+
+    // Stopping criterion
+    const real_t anrm = lange(INF_NORM, A);
+    const real_t cte = anrm * ulp<real_t>() * sqrt(real_t(n));
+
+    // Computes R = B - A X
+    auto residual = [&]() {
+        lacpy(GENERAL, B, R);
+        gemm(NO_TRANS, NO_TRANS, -one, A, X, one, R);
+    };
+
+    // Pivot indices of the factorization of A
+    const auto ipiv = slice(piv, range{0, n});
+
+    // Solves A D = R in low precision and updates X += D
+    auto refine = [&]() {
+        lacpy(GENERAL, R, Rlow);
+        getrs(NO_TRANS, Alow, ipiv, Rlow);
+        for (idx_t j = 0; j < nrhs; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                X(i, j) += T(Rlow(i, j));
+    };
+
+    if (lange(MAX_NORM, B) > rmax || lange(MAX_NORM, A) > rmax) {
+        // A or B do not fit in the low precision
+        iter = -2;
+    }
+    else {
+        // Factor A in low precision
+        lacpy(GENERAL, A, Alow);
+        if (getrf(Alow, piv, opts) != 0) {
+            iter = -3;
+        }
+        else {
+            // First solution, computed entirely in low precision
+            lacpy(GENERAL, B, R);
+            laset(GENERAL, real_t(0), real_t(0), X);
+            refine();
+            residual();
+            if (internal::ir_converged(R, X, cte)) return 0;
+
+            for (int it = 1; it <= opts.itermax; ++it) {
+                if (lange(MAX_NORM, R) > rmax) {
+                    iter = -2;
+                    break;
+                }
+                refine();
+                residual();
+                if (internal::ir_converged(R, X, cte)) {
+                    iter = it;
+                    return 0;
+                }
+            }
+            if (iter == 0) iter = -opts.itermax - 1;
+        }
+    }
+
+    // The refinement did not converge. Factor A in the working precision
+    int info = getrf(A, piv, opts);
+    if (info != 0) return info;
+    lacpy(GENERAL, B, X);
+    getrs(NO_TRANS, A, ipiv, X);
+
+    return 0;
+}
+
+/** Solves a general linear system A X = B using a mixed precision
+ * iterative refinement.
+ *
+ * The LU factorization of A is computed in a lower precision, which is given
+ * by the template parameter @c real_low_t. This factorization is used to
+ * compute a first solution and to refine it. The residuals are computed in
+ * the working precision of X. Each refinement step solves A D = R in the low
+ * precision and updates X := X + D. The refinement stops when
+ * \[
+ *      \|R(:,j)\|_{\max} \leq \|X(:,j)\|_{\max} \|A\|_\infty \epsilon \sqrt{n}
+ * \]
+ * for every column j, where $\epsilon$ is the machine epsilon, ulp(), of the
+ * working precision.
+ *
+ * If the refinement does not converge, the matrix A does not fit in the low
+ * precision or the low precision factorization fails, the routine falls back
+ * to the LU factorization of A in the working precision. This is the same
+ * strategy as in LAPACK's DSGESV and ZCGESV.
+ *
+ * @return  0 if success.
+ * @return  i+1 if the working precision LU failed on iteration i. In this
+ *      case, the solution X could not be computed.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the matrix A.
+ *      On exit, A is unchanged if the iterative refinement succeeds
+ *      (iter >= 0). Otherwise, A is overwritten by the factors L and U of
+ *      A = P L U computed in the working precision.
+ *
+ * @param[out] piv Vector of length n.
+ *      The pivot indices from the LU factorization, in the format of
+ *      getrf(). If iter >= 0, they correspond to the low precision
+ *      factorization.
+ *
+ * @param[in] B n-by-nrhs matrix.
+ *
+ * @param[out] X n-by-nrhs matrix.
+ *      The solution X.
+ *
+ * @param[out] iter integer
+ *      - iter >= 0: number of refinement steps;
+ *      - iter = -2: A, B or a residual overflowed in the low precision;
+ *      - iter = -3: the low precision LU factorization failed;
+ *      - iter = -itermax-1: the refinement did not converge.
+ *      If iter < 0, the solution was computed in the working precision.
+ *
+ * @param[in] opts Options.
+ *      - itermax: Maximum number of refinement steps.
+ *      - The options of getrf(), used in both precisions.
+ *
+ * @ingroup alloc_workspace
+ */
+template <class real_low_t = float,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SVECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int gesv_ir(matrixA_t& A,
+            piv_t& piv,
+            const matrixB_t& B,
+            matrixX_t& X,
+            int& iter,
+            const GesvIrOpts& opts = {})
+{
+    using idx_t = size_type<matrixA_t>;
+    using work_t = matrix_type<matrixA_t, matrixX_t>;
+    using T = type_t<work_t>;
+    using TL = std::conditional_t<is_complex<T>, std::complex<real_low_t>,
+                                  real_low_t>;
+    Create<work_t> new_matrix;
+
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+
+    // Allocate or get workspace
+    WorkInfo workinfo = gesv_ir_worksize<T>(A, B, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    workspace_vector<TL> Wlow_;
+    auto Wlow = new_matrix(Wlow_, n, n + nrhs);
+
+    return gesv_ir_work(A, piv, B, X, iter, Wlow, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GESV_IR_HH
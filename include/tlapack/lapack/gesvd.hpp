@@ -13,19 +13,35 @@
 #define TLAPACK_GESVD_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/bdsdc.hpp"
 #include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/gelqf.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/svd_qr.hpp"
 #include "tlapack/lapack/ungbr.hpp"
+#include "tlapack/lapack/unglq.hpp"
+#include "tlapack/lapack/ungqr.hpp"
 
 namespace tlapack {
 
+enum class GesvdVariant : char { QR = 'Q', DivideAndConquer = 'D' };
+
 /**
  * Options struct for gesvd
  */
 struct GesvdOpts {
-    /// @todo If either max(m,n)/min(m,n) is larger than shapethresh, a QR
-    /// factorization is used before
+    /// Method used on the bidiagonal matrix
+    GesvdVariant variant = GesvdVariant::QR;
+    /// If max(m,n) > shapethresh * min(m,n), A is first reduced to a
+    /// triangular matrix by a QR (m > n) or LQ (m < n) factorization, and only
+    /// the triangular factor is reduced to bidiagonal form
     float shapethresh = 1.6;
+    /// If true and want_u is true, the first min(m,n) left singular vectors
+    /// overwrite the first min(m,n) columns of A, and U is not referenced
+    bool u_in_a = false;
 };
 
 /**
@@ -38,7 +54,12 @@ struct GesvdOpts {
  * right singular vectors. Depending on the dimensions of U and Vt,
  * either the reduced or full unitary factors are determined.
  *
- * @note There is no option to return U or Vt in A. This functionality is
+ * If max(m,n) > opts.shapethresh * min(m,n), A is first factored as A = Q*R
+ * (m > n) or A = L*Q (m < n), and the SVD of the min(m,n)-by-min(m,n)
+ * triangular factor is computed instead. The singular vectors of A are then
+ * obtained by multiplying the ones of the triangular factor by Q.
+ *
+ * @note There is no option to return Vt in A. This functionality is
  * present in zgesvd in Reference LAPACK.
  *
  * @return  0 if success
@@ -48,17 +69,27 @@ struct GesvdOpts {
  * @param[in] want_vt bool
  *
  * @param[in,out] A m-by-n matrix.
+ *      On exit, if want_u and opts.u_in_a are true, the first min(m,n)
+ *      columns of A contain the left singular vectors. Otherwise, the contents
+ *      of A are destroyed.
  *
  * @param[out] s vector of length min(m,n).
  *      The singular values of A, sorted so that S(i) >= S(i+1).
  *
- * @param[in,out] U m-by-m matrix.
+ * @param[in,out] U m-by-m or m-by-min(m,n) matrix.
+ *      Not referenced if want_u is false or opts.u_in_a is true.
  *
- * @param[in,out] Vt n-by-n matrix.
+ * @param[in,out] Vt n-by-n or min(m,n)-by-n matrix.
+ *      Not referenced if want_vt is false.
  *
  * @param[in] opts Options.
- *      - @c opts.work is used if whenever it has sufficient size.
- *        The sufficient size can be obtained through a workspace query.
+ *      - @c opts.variant: Method used to compute the SVD of the bidiagonal
+ *        matrix:
+ *          - QR = 'Q': implicit zero-shift QR, svd_qr(),
+ *          - DivideAndConquer = 'D': divide and conquer, bdsdc().
+ *      - @c opts.shapethresh: Aspect ratio above which the QR or LQ
+ *        factorization is computed first.
+ *      - @c opts.u_in_a: Whether the left singular vectors overwrite A.
  *
  * @ingroup computational
  */
@@ -71,26 +102,127 @@ int gesvd(bool want_u,
           matrix_t& Vt,
           const GesvdOpts& opts = {})
 {
+    using T = type_t<matrix_t>;
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
+    using real_t = real_type<T>;
 
     // Functors
+    Create<matrix_t> new_matrix;
     Create<vector_type<matrix_t>> new_vector;
     Create<vector_type<r_vector_t>> new_rvector;
 
     // constants
+    const real_t zero(0);
+    const real_t one(1);
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
     const idx_t k = min(m, n);
     const Uplo uplo = (m >= n) ? Uplo::Upper : Uplo::Lower;
+    const bool u_in_a = want_u && opts.u_in_a;
+
+    if (k > 0 && m != n && float(max(m, n)) > opts.shapethresh * float(k)) {
+        // The SVD of the k-by-k triangular factor is computed in W. It is
+        // square, so that gesvd is not called again on a QR or LQ
+        // factorization
+        workspace_vector<T> tau_, W_, Wu_, Wvt_;
+        auto tau = new_vector(tau_, k);
+        auto W = new_matrix(W_, k, k);
+        auto Wu = new_matrix(Wu_, want_u ? k : 0, want_u ? k : 0);
+        auto Wvt = new_matrix(Wvt_, want_vt ? k : 0, want_vt ? k : 0);
+        GesvdOpts optsW = opts;
+        optsW.u_in_a = false;
+        int info;
+
+        if (m > n) {
+            // A = Q * R
+            geqrf(A, tau);
+            laset(GENERAL, zero, zero, W);
+            lacpy(UPPER_TRIANGLE, slice(A, range{0, n}, range{0, n}), W);
+
+            // R = Wu * S * Wvt
+            info = gesvd(want_u, want_vt, W, s, Wu, Wvt, optsW);
+            if (info != 0) return info;
+
+            if (want_vt) lacpy(GENERAL, Wvt, Vt);
+
+            if (u_in_a) {
+                // A := Q * Wu, n rows at a time, using W as workspace
+                ungqr(A, tau);
+                for (idx_t i = 0; i < m; i += n) {
+                    const idx_t ib = min(n, m - i);
+                    auto Ai = slice(A, range{i, i + ib}, range{0, n});
+                    auto Wi = slice(W, range{0, ib}, range{0, n});
+                    lacpy(GENERAL, Ai, Wi);
+                    gemm(NO_TRANS, NO_TRANS, one, Wi, Wu, zero, Ai);
+                }
+            }
+            else if (want_u && ncols(U) == n) {
+                // U := Q * Wu
+                ungqr(A, tau);
+                gemm(NO_TRANS, NO_TRANS, one, A, Wu, zero, U);
+            }
+            else if (want_u) {
+                // Form the m-by-m matrix Q in U, and U(:,0:n) := Q(:,0:n) * Wu
+                // using A as workspace
+                auto U0 = slice(U, range{0, m}, range{0, n});
+                lacpy(LOWER_TRIANGLE, A, U0);
+                ungqr(U, tau);
+                gemm(NO_TRANS, NO_TRANS, one, U0, Wu, zero, A);
+                lacpy(GENERAL, A, U0);
+            }
+        }
+        else {
+            // A = L * Q
+            gelqf(A, tau);
+            laset(GENERAL, zero, zero, W);
+            lacpy(LOWER_TRIANGLE, slice(A, range{0, m}, range{0, m}), W);
+
+            // L = Wu * S * Wvt
+            info = gesvd(want_u, want_vt, W, s, Wu, Wvt, optsW);
+            if (info != 0) return info;
+
+            if (want_vt && nrows(Vt) == m) {
+                // Vt := Wvt * Q
+                unglq(A, tau);
+                gemm(NO_TRANS, NO_TRANS, one, Wvt, A, zero, Vt);
+            }
+            else if (want_vt) {
+                // Form the n-by-n matrix Q in Vt, and Vt(0:m,:) := Wvt *
+                // Q(0:m,:) using A as workspace
+                auto Vt0 = slice(Vt, range{0, m}, range{0, n});
+                lacpy(UPPER_TRIANGLE, A, Vt0);
+                unglq(Vt, tau);
+                gemm(NO_TRANS, NO_TRANS, one, Wvt, Vt0, zero, A);
+                lacpy(GENERAL, A, Vt0);
+            }
+
+            if (u_in_a) {
+                auto Ua = slice(A, range{0, m}, range{0, m});
+                lacpy(GENERAL, Wu, Ua);
+            }
+            else if (want_u)
+                lacpy(GENERAL, Wu, U);
+        }
+
+        return info;
+    }
 
     // Allocate vectors
-    std::vector<type_t<matrix_t>> tauv_, tauw_;
+    workspace_vector<T> tauv_, tauw_;
     auto tauv = new_vector(tauv_, k);
     auto tauw = new_vector(tauw_, k);
-    std::vector<type_t<r_vector_t>> e_;
+    workspace_vector<type_t<r_vector_t>> e_;
     auto e = new_rvector(e_, k);
 
+    // SVD of the bidiagonal matrix
+    const auto bidiag_svd = [&](bool wu, bool wvt, auto& U_, auto& Vt_) {
+        if (opts.variant == GesvdVariant::DivideAndConquer)
+            return bdsdc(uplo, wu, wvt, s, e, U_, Vt_);
+        else
+            return svd_qr(uplo, wu, wvt, s, e, U_, Vt_);
+    };
+
     // Reduce A to bidiagonal form
     gebrd(A, tauv, tauw);
 
@@ -109,19 +241,31 @@ int gesvd(bool want_u,
         }
     }
 
-    if (want_u) {
-        auto Ui = slice(U, range{0, m}, range{0, k});
-        lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, k}), Ui);
-        ungbr_q(n, U, tauv);
-    }
-
     if (want_vt) {
         auto Vti = slice(Vt, range{0, k}, range{0, n});
         lacpy(Uplo::Upper, slice(A, range{0, k}, range{0, n}), Vti);
         ungbr_p(m, Vt, tauw);
     }
 
-    return svd_qr(uplo, want_u, want_vt, s, e, U, Vt);
+    if (u_in_a) {
+        // Q is formed in place, after the reflectors of P were copied to Vt
+        auto Ua = slice(A, range{0, m}, range{0, k});
+        ungbr_q(n, Ua, tauv);
+        if (want_vt) {
+            auto Vti = slice(Vt, range{0, k}, range{0, n});
+            return bidiag_svd(true, true, Ua, Vti);
+        }
+        else
+            return bidiag_svd(true, false, Ua, Ua);
+    }
+
+    if (want_u) {
+        auto Ui = slice(U, range{0, m}, range{0, k});
+        lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, k}), Ui);
+        ungbr_q(n, U, tauv);
+    }
+
+    return bidiag_svd(want_u, want_vt, U, Vt);
 }
 
 }  // namespace tlapack
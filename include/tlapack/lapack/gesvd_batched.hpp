@@ -0,0 +1,319 @@
+/// @file gesvd_batched.hpp Computes the singular value decomposition of a
+/// batch of small matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GESVD_BATCHED_HH
+#define TLAPACK_GESVD_BATCHED_HH
+
+#include <algorithm>
+#include <numeric>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/batched/Batch.hpp"
+#include "tlapack/lapack/gesvd.hpp"
+
+namespace tlapack {
+
+/** Computes the singular value decomposition of each matrix A[b] of a batch
+ * of m-by-n matrices.
+ *
+ * Each decomposition has the same output format as
+ * gesvd(want_u, want_vt, A[b], s[b], U[b], Vt[b]). The singular values agree
+ * with the ones of gesvd() up to rounding, and the singular vectors agree up
+ * to the usual sign (or subspace) ambiguity.
+ *
+ * For real types, groups of matrices are copied to an interleaved layout
+ * (batch index innermost) and decomposed together with the one-sided Jacobi
+ * method, so that the loops over the matrices of a group run in SIMD lanes.
+ * The Jacobi method computes the reduced factors, i.e., U is m-by-n if
+ * m >= n, and Vt is m-by-n if m < n. If full factors are requested, or if
+ * the type is complex, gesvd() is called on each matrix. A matrix is also
+ * decomposed again by gesvd() if the Jacobi method does not converge, or if
+ * the requested singular vectors of a tiny singular value are not well
+ * determined.
+ *
+ * @param[in] want_u bool
+ *
+ * @param[in] want_vt bool
+ *
+ * @param[in,out] A Batch of m-by-n matrices, e.g., a LegacyStridedBatch or
+ *      a std::vector of matrices. All matrices must have the same size.
+ *      On exit, the contents of A[b] are destroyed.
+ *
+ * @param[out] s Batch of vectors of size min(m,n), e.g., a
+ *      std::vector<std::vector<real_t>>. s[b] are the singular values of A[b],
+ *      sorted so that S(i) >= S(i+1).
+ *
+ * @param[out] U Batch of m-by-min(m,n) or m-by-m matrices.
+ *      Not referenced if want_u is false.
+ *
+ * @param[out] Vt Batch of min(m,n)-by-n or n-by-n matrices.
+ *      Not referenced if want_vt is false.
+ *
+ * @param[out] info Vector of size A.size().
+ *      info[b] is 0 if the decomposition of A[b] succeeds, or the return value
+ *      of gesvd() for A[b].
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy used to split the batch among threads.
+ *
+ * @return 0 if all decompositions succeed, or b+1 where b is the first
+ *      matrix such that info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <class batch_t, class s_batch_t, class info_t>
+int gesvd_batched(bool want_u,
+                  bool want_vt,
+                  batch_t& A,
+                  s_batch_t& s,
+                  batch_t& U,
+                  batch_t& Vt,
+                  info_t& info,
+                  const BatchOpts& opts = {})
+{
+    using matrix_t = std::decay_t<decltype(A[0])>;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr std::size_t L = internal::batch_lanes<T>;
+
+    const std::size_t nbatch = A.size();
+
+    // check arguments
+    tlapack_check((std::size_t)size(s) >= nbatch);
+    tlapack_check((std::size_t)size(info) >= nbatch);
+    tlapack_check(!want_u || (std::size_t)U.size() >= nbatch);
+    tlapack_check(!want_vt || (std::size_t)Vt.size() >= nbatch);
+
+    // quick return
+    if (nbatch == 0) return 0;
+
+    const idx_t m = nrows(A[0]);
+    const idx_t n = ncols(A[0]);
+    const idx_t k = min(m, n);
+    for (std::size_t b = 0; b < nbatch; ++b) {
+        tlapack_check(nrows(A[b]) == m && ncols(A[b]) == n);
+        tlapack_check((idx_t)size(s[b]) >= k);
+        if (want_u) tlapack_check(nrows(U[b]) == m);
+        if (want_vt) tlapack_check(ncols(Vt[b]) == n);
+    }
+
+    // The Jacobi method works on W = A if m >= n, or W = A^T otherwise. The
+    // normalized columns of W give U or V, and the rotations give V or U.
+    const idx_t mm = max(m, n);
+    const idx_t nn = k;
+    const bool want_w = (m >= n) ? want_u : want_vt;
+    const bool want_v = (m >= n) ? want_vt : want_u;
+    const bool reduced = (m >= n) ? (!want_u || ncols(U[0]) == n)
+                                  : (!want_vt || nrows(Vt[0]) == m);
+
+    auto gesvd_b = [&](std::size_t b) {
+        auto&& Ab = A[b];
+        auto&& sb = s[b];
+        if (want_u && want_vt) {
+            auto&& Ub = U[b];
+            auto&& Vtb = Vt[b];
+            info[b] = gesvd(true, true, Ab, sb, Ub, Vtb);
+        }
+        else if (want_u) {
+            auto&& Ub = U[b];
+            info[b] = gesvd(true, false, Ab, sb, Ub, Ub);
+        }
+        else if (want_vt) {
+            auto&& Vtb = Vt[b];
+            info[b] = gesvd(false, true, Ab, sb, Vtb, Vtb);
+        }
+        else {
+            info[b] = gesvd(false, false, Ab, sb, Ab, Ab);
+        }
+    };
+
+    if constexpr (!internal::has_interleaved_kernels<T>) {
+        internal::for_each_group<1>(
+            opts.exec, nbatch,
+            [&](std::size_t b, std::size_t) { gesvd_b(b); });
+    }
+    else {
+        if (!reduced) {
+            internal::for_each_group<1>(
+                opts.exec, nbatch,
+                [&](std::size_t b, std::size_t) { gesvd_b(b); });
+            return internal::first_batch_info(info, nbatch);
+        }
+
+        const T eps = ulp<T>();
+        const int maxsweeps = 30;
+
+        internal::for_each_group<L>(opts.exec, nbatch, [&](std::size_t b0,
+                                                           std::size_t b1) {
+            const std::size_t nb = b1 - b0;
+            internal::InterleavedMatrix<T, L> W(mm, nn);
+            internal::InterleavedMatrix<T, L> V(want_v ? nn : 0, nn);
+
+            // Unused lanes hold zeros
+            for (std::size_t l = 0; l < L; ++l) {
+                if (l < nb) {
+                    auto&& Ab = A[b0 + l];
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < m; ++i) {
+                            if (m >= n)
+                                W(i, j)[l] = Ab(i, j);
+                            else
+                                W(j, i)[l] = Ab(i, j);
+                        }
+                }
+                else {
+                    for (idx_t j = 0; j < nn; ++j)
+                        for (idx_t i = 0; i < mm; ++i)
+                            W(i, j)[l] = T(0);
+                }
+                if (want_v) {
+                    for (idx_t j = 0; j < nn; ++j)
+                        for (idx_t i = 0; i < nn; ++i)
+                            V(i, j)[l] = (i == j) ? T(1) : T(0);
+                }
+            }
+
+            // One-sided Jacobi sweeps
+            bool rotated[L];
+            T a[L], bq[L], g[L], c[L], sn[L];
+            int sweep = 0;
+            for (; sweep < maxsweeps; ++sweep) {
+                for (std::size_t l = 0; l < L; ++l)
+                    rotated[l] = false;
+
+                for (idx_t p = 0; p + 1 < nn; ++p) {
+                    for (idx_t q = p + 1; q < nn; ++q) {
+                        for (std::size_t l = 0; l < L; ++l)
+                            a[l] = bq[l] = g[l] = T(0);
+                        for (idx_t i = 0; i < mm; ++i) {
+                            const T* wp = W(i, p);
+                            const T* wq = W(i, q);
+                            for (std::size_t l = 0; l < L; ++l) {
+                                a[l] += wp[l] * wp[l];
+                                bq[l] += wq[l] * wq[l];
+                                g[l] += wp[l] * wq[l];
+                            }
+                        }
+
+                        for (std::size_t l = 0; l < L; ++l) {
+                            const bool rot =
+                                abs(g[l]) > eps * std::sqrt(a[l] * bq[l]);
+                            const T gl = rot ? g[l] : T(1);
+                            const T zeta = (bq[l] - a[l]) / (T(2) * gl);
+                            const T t =
+                                ((zeta >= T(0)) ? T(1) : T(-1)) /
+                                (abs(zeta) + std::sqrt(T(1) + zeta * zeta));
+                            const T cl = T(1) / std::sqrt(T(1) + t * t);
+                            c[l] = rot ? cl : T(1);
+                            sn[l] = rot ? cl * t : T(0);
+                            rotated[l] = rotated[l] || rot;
+                        }
+
+                        for (idx_t i = 0; i < mm; ++i) {
+                            T* wp = W(i, p);
+                            T* wq = W(i, q);
+                            for (std::size_t l = 0; l < L; ++l) {
+                                const T tmp = wp[l];
+                                wp[l] = c[l] * tmp - sn[l] * wq[l];
+                                wq[l] = sn[l] * tmp + c[l] * wq[l];
+                            }
+                        }
+                        if (want_v) {
+                            for (idx_t i = 0; i < nn; ++i) {
+                                T* vp = V(i, p);
+                                T* vq = V(i, q);
+                                for (std::size_t l = 0; l < L; ++l) {
+                                    const T tmp = vp[l];
+                                    vp[l] = c[l] * tmp - sn[l] * vq[l];
+                                    vq[l] = sn[l] * tmp + c[l] * vq[l];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                bool converged = true;
+                for (std::size_t l = 0; l < L; ++l)
+                    converged = converged && !rotated[l];
+                if (converged) break;
+            }
+
+            // Singular values are the norms of the columns of W
+            workspace_vector<T> sigma(nn * L);
+            for (idx_t j = 0; j < nn; ++j) {
+                T* sj = &sigma[j * L];
+                for (std::size_t l = 0; l < L; ++l)
+                    sj[l] = T(0);
+                for (idx_t i = 0; i < mm; ++i) {
+                    const T* wj = W(i, j);
+                    for (std::size_t l = 0; l < L; ++l)
+                        sj[l] += wj[l] * wj[l];
+                }
+                for (std::size_t l = 0; l < L; ++l)
+                    sj[l] = std::sqrt(sj[l]);
+            }
+
+            std::vector<idx_t> perm(nn);
+            for (std::size_t l = 0; l < nb; ++l) {
+                const std::size_t b = b0 + l;
+
+                // Sort the singular values in decreasing order
+                std::iota(perm.begin(), perm.end(), idx_t(0));
+                std::stable_sort(perm.begin(), perm.end(),
+                                 [&](idx_t i, idx_t j) {
+                                     return sigma[i * L + l] >
+                                            sigma[j * L + l];
+                                 });
+                const T smax = (nn > 0) ? sigma[perm[0] * L + l] : T(0);
+                const T smin = (nn > 0) ? sigma[perm[nn - 1] * L + l] : T(0);
+
+                if ((rotated[l] && sweep == maxsweeps) ||
+                    (want_w && nn > 0 && !(smin > T(nn) * eps * smax))) {
+                    gesvd_b(b);
+                    continue;
+                }
+
+                auto&& sb = s[b];
+                for (idx_t j = 0; j < nn; ++j)
+                    sb[j] = sigma[perm[j] * L + l];
+
+                if (want_w) {
+                    auto&& Wb = (m >= n) ? U[b] : Vt[b];
+                    for (idx_t j = 0; j < nn; ++j) {
+                        const T r = T(1) / sigma[perm[j] * L + l];
+                        for (idx_t i = 0; i < mm; ++i) {
+                            if (m >= n)
+                                Wb(i, j) = W(i, perm[j])[l] * r;
+                            else
+                                Wb(j, i) = W(i, perm[j])[l] * r;
+                        }
+                    }
+                }
+                if (want_v) {
+                    auto&& Vb = (m >= n) ? Vt[b] : U[b];
+                    for (idx_t j = 0; j < nn; ++j) {
+                        for (idx_t i = 0; i < nn; ++i) {
+                            if (m >= n)
+                                Vb(j, i) = V(i, perm[j])[l];
+                            else
+                                Vb(i, j) = V(i, perm[j])[l];
+                        }
+                    }
+                }
+                info[b] = 0;
+            }
+        });
+    }
+
+    return internal::first_batch_info(info, nbatch);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GESVD_BATCHED_HH
@@ -12,17 +12,27 @@
 #define TLAPACK_GETRF_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/getrf_blocked.hpp"
 #include "tlapack/lapack/getrf_level0.hpp"
 #include "tlapack/lapack/getrf_recursive.hpp"
 
 namespace tlapack {
 
 /// @brief Variants of the algorithm to compute the LU factorization.
-enum class GetrfVariant : char { Level0 = '0', Recursive = 'R' };
+enum class GetrfVariant : char {
+    Level0 = '0',
+    Recursive = 'R',
+    Blocked = 'B',
+    Lookahead = 'L'
+};
 
 /// @brief Options struct for getrf()
 struct GetrfOpts {
     GetrfVariant variant = GetrfVariant::Recursive;
+    ExecutionPolicy exec = {};  ///< Execution policy of the Recursive, Blocked
+                                ///< and Lookahead variants
+    size_t nb = 0;  ///< Block size of the Blocked and Lookahead variants.
+                    ///< 0: tuned value, see tuned_option()
 };
 
 /** getrf computes an LU factorization of a general m-by-n matrix A.
@@ -49,7 +59,15 @@ struct GetrfOpts {
  * @param[in] opts Options.
  *      - variant:
  *          - Recursive = 'R',
- *          - Level0 = '0'
+ *          - Level0 = '0',
+ *          - Blocked = 'B': right-looking blocked algorithm,
+ *          - Lookahead = 'L': Blocked with lookahead of one panel.
+ *      - exec: Execution policy of the updates in the Recursive, Blocked and
+ *      Lookahead variants.
+ *      - nb: Block size of the Blocked and Lookahead variants.
+ *      If the sizes of A are known at compile time and are at most
+ *      internal::max_unrolled_size, the unrolled kernel of getrf_level0()
+ *      is used for any variant.
  *
  * @note To construct L and U, one proceeds as in the following steps
  *      1. Set matrices L m-by-k, and U k-by-n be to matrices with all zeros,
@@ -63,9 +81,21 @@ struct GetrfOpts {
 template <TLAPACK_MATRIX matrix_t, TLAPACK_VECTOR piv_t>
 int getrf(matrix_t& A, piv_t& piv, const GetrfOpts& opts = {})
 {
+    // Small matrices with sizes known at compile time
+    if constexpr (internal::use_unrolled_kernel<matrix_t>)
+        return getrf_level0(A, piv);
+
     // Call variant
     if (opts.variant == GetrfVariant::Recursive)
-        return getrf_recursive(A, piv);
+        return getrf_recursive(A, piv, opts.exec);
+    else if (opts.variant == GetrfVariant::Blocked ||
+             opts.variant == GetrfVariant::Lookahead) {
+        GetrfBlockedOpts blockedOpts;
+        blockedOpts.nb = opts.nb;
+        blockedOpts.lookahead = (opts.variant == GetrfVariant::Lookahead);
+        blockedOpts.exec = opts.exec;
+        return getrf_blocked(A, piv, blockedOpts);
+    }
     else
         return getrf_level0(A, piv);
 }
@@ -0,0 +1,181 @@
+/// @file getrf_batched.hpp Computes the LU factorization of a batch of small
+/// general matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_BATCHED_HH
+#define TLAPACK_GETRF_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/batched/Batch.hpp"
+#include "tlapack/lapack/getrf.hpp"
+
+namespace tlapack {
+
+/** Computes the LU factorization with partial pivoting of each matrix A[b]
+ * of a batch of general matrices.
+ *
+ * For nonsingular matrices, each factorization has the same semantics as
+ * getrf(A[b], piv[b]). If an exact zero pivot is found, the factorization is
+ * completed as in LAPACK's getf2, and the index of the first zero pivot is
+ * reported in info[b].
+ *
+ * For real types, groups of matrices are copied to an interleaved layout
+ * (batch index innermost) and factored together by a right-looking
+ * level-2 algorithm, so that the loops over the matrices of a group run in
+ * SIMD lanes. For complex types, getrf() is called on each matrix.
+ *
+ * @param[in,out] A Batch of m-by-n matrices, e.g., a LegacyStridedBatch or
+ *      a std::vector of matrices. All matrices must have the same size.
+ *      On exit, the factors L and U of each matrix.
+ *
+ * @param[out] piv Batch of integer vectors of size min(m,n), e.g., a
+ *      std::vector<std::vector<idx_t>>. piv[b] are the pivots of A[b] in the
+ *      format of getrf().
+ *
+ * @param[out] info Vector of size A.size().
+ *      info[b] is the return value of getrf for A[b].
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy used to split the batch among threads.
+ *
+ * @return 0 if all matrices are nonsingular, or b+1 where b is the first
+ *      matrix such that info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <class batch_t, class piv_batch_t, class info_t>
+int getrf_batched(batch_t& A,
+                  piv_batch_t& piv,
+                  info_t& info,
+                  const BatchOpts& opts = {})
+{
+    using matrix_t = std::decay_t<decltype(A[0])>;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr std::size_t L = internal::batch_lanes<T>;
+
+    const std::size_t nbatch = A.size();
+
+    // check arguments
+    tlapack_check((std::size_t)size(piv) >= nbatch);
+    tlapack_check((std::size_t)size(info) >= nbatch);
+
+    // quick return
+    if (nbatch == 0) return 0;
+
+    const idx_t m = nrows(A[0]);
+    const idx_t n = ncols(A[0]);
+    const idx_t k = min(m, n);
+    for (std::size_t b = 0; b < nbatch; ++b) {
+        tlapack_check(nrows(A[b]) == m && ncols(A[b]) == n);
+        tlapack_check((idx_t)size(piv[b]) >= k);
+    }
+
+    if constexpr (!internal::has_interleaved_kernels<T>) {
+        internal::for_each_group<1>(
+            opts.exec, nbatch, [&](std::size_t b, std::size_t) {
+                auto&& Ab = A[b];
+                auto&& pivb = piv[b];
+                info[b] = getrf(Ab, pivb);
+            });
+    }
+    else {
+        internal::for_each_group<L>(opts.exec, nbatch, [&](std::size_t b0,
+                                                           std::size_t b1) {
+            const std::size_t nb = b1 - b0;
+            internal::InterleavedMatrix<T, L> P(m, n);
+
+            // Unused lanes hold zeros
+            for (std::size_t l = 0; l < L; ++l) {
+                if (l < nb) {
+                    auto&& Ab = A[b0 + l];
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            P(i, j)[l] = Ab(i, j);
+                }
+                else {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < m; ++i)
+                            P(i, j)[l] = T(0);
+                }
+            }
+
+            int infoP[L] = {};
+            idx_t p[L];
+            T amax[L], r[L];
+            for (idx_t j = 0; j < k; ++j) {
+                // Find the pivots
+                {
+                    const T* pjj = P(j, j);
+                    for (std::size_t l = 0; l < L; ++l) {
+                        p[l] = j;
+                        amax[l] = abs1(pjj[l]);
+                    }
+                }
+                for (idx_t i = j + 1; i < m; ++i) {
+                    const T* pij = P(i, j);
+                    for (std::size_t l = 0; l < L; ++l) {
+                        const T a = abs1(pij[l]);
+                        const bool larger = (a > amax[l]);
+                        p[l] = larger ? i : p[l];
+                        amax[l] = larger ? a : amax[l];
+                    }
+                }
+
+                // Swap the rows of each matrix
+                for (std::size_t l = 0; l < nb; ++l) {
+                    piv[b0 + l][j] = p[l];
+                    if (p[l] != j) {
+                        for (idx_t c = 0; c < n; ++c)
+                            std::swap(P(j, c)[l], P(p[l], c)[l]);
+                    }
+                }
+
+                // Compute the multipliers. A zero pivot leaves a zero column.
+                {
+                    const T* pjj = P(j, j);
+                    for (std::size_t l = 0; l < L; ++l) {
+                        const bool zero = (pjj[l] == T(0));
+                        if (zero && infoP[l] == 0) infoP[l] = int(j + 1);
+                        r[l] = zero ? T(0) : T(1) / pjj[l];
+                    }
+                }
+                for (idx_t i = j + 1; i < m; ++i) {
+                    T* pij = P(i, j);
+                    for (std::size_t l = 0; l < L; ++l)
+                        pij[l] *= r[l];
+                }
+
+                // Update the trailing matrix
+                for (idx_t c = j + 1; c < n; ++c) {
+                    const T* pjc = P(j, c);
+                    for (idx_t i = j + 1; i < m; ++i) {
+                        T* pic = P(i, c);
+                        const T* pij = P(i, j);
+                        for (std::size_t l = 0; l < L; ++l)
+                            pic[l] -= pij[l] * pjc[l];
+                    }
+                }
+            }
+
+            for (std::size_t l = 0; l < nb; ++l) {
+                auto&& Ab = A[b0 + l];
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        Ab(i, j) = P(i, j)[l];
+                info[b0 + l] = infoP[l];
+            }
+        });
+    }
+
+    return internal::first_batch_info(info, nbatch);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_BATCHED_HH
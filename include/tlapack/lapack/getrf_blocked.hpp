@@ -0,0 +1,236 @@
+/// @file getrf_blocked.hpp Computes the LU factorization of a general matrix
+/// using a right-looking blocked algorithm.
+/// @note Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/zgetrf.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_BLOCKED_HH
+#define TLAPACK_GETRF_BLOCKED_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/getrf_recursive.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for getrf_blocked()
+ */
+struct GetrfBlockedOpts {
+    size_t nb = 0;  ///< Block size. 0: tuned value, see tuned_option()
+    bool lookahead = false;     ///< Factor the next panel while the rest of
+                                ///< the trailing matrix is updated
+    ExecutionPolicy exec = {};  ///< Execution policy of the trailing updates
+};
+
+namespace internal {
+
+    /** Applies the row interchanges and the updates of the panel j:j+jb of
+     * the LU factorization to the columns c0:c1 of A.
+     */
+    template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR piv_t>
+    void getrf_blocked_update(matrix_t& A,
+                              const piv_t& piv,
+                              size_type<matrix_t> j,
+                              size_type<matrix_t> jb,
+                              size_type<matrix_t> c0,
+                              size_type<matrix_t> c1)
+    {
+        using idx_t = size_type<matrix_t>;
+        using T = type_t<matrix_t>;
+        using real_t = real_type<T>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t j2 = j + jb;
+        if (c0 >= c1) return;
+
+        auto Ac = cols(A, range(c0, c1));
+        for (idx_t i = j; i < j2; ++i) {
+            if ((idx_t)piv[i] != i) {
+                auto r1 = row(Ac, i);
+                auto r2 = row(Ac, piv[i]);
+                tlapack::swap(r1, r2);
+            }
+        }
+
+        const auto A11 = slice(A, range(j, j2), range(j, j2));
+        auto A12 = rows(Ac, range(j, j2));
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), A11, A12);
+
+        if (j2 < m) {
+            const auto A21 = slice(A, range(j2, m), range(j, j2));
+            auto A22 = rows(Ac, range(j2, m));
+            gemm(NO_TRANS, NO_TRANS, real_t(-1), A21, A12, real_t(1), A22);
+        }
+    }
+
+}  // namespace internal
+
+/** getrf_blocked computes an LU factorization of a general m-by-n matrix A
+ *  using partial pivoting with row interchanges.
+ *
+ *  The factorization has the form
+ * \[
+ *   P A = L U
+ * \]
+ *  where P is a permutation matrix constructed from our piv vector, L is lower
+ * triangular with unit diagonal elements (lower trapezoidal if m > n), and U is
+ * upper triangular (upper trapezoidal if m < n).
+ *
+ *  This is the right-looking blocked version of the algorithm. Each panel of
+ * nb columns is factored with getrf_recursive(), and then the row
+ * interchanges, a triangular solve and a gemm() update the trailing matrix.
+ * The trailing update is split into blocks of columns that are processed in
+ * parallel according to opts.exec.
+ *
+ *  With opts.lookahead = true, the columns of the next panel are updated
+ * first, and the next panel is factored while the other columns of the
+ * trailing matrix are updated. This takes the panel factorization out of the
+ * critical path when more than one thread is available.
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the factors L and U from the factorization A=PLU;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[in,out] piv is a k-by-1 integer vector where k=min(m,n)
+ * and piv[i]=j where i<=j<=k-1, which means in the i-th iteration of the
+ * algorithm, the j-th row needs to be swapped with i
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size.
+ *      - lookahead: Overlap the factorization of the next panel with the
+ *        trailing update.
+ *      - exec: Execution policy.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR piv_t>
+int getrf_blocked(matrix_t& A, piv_t& piv, const GetrfBlockedOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = max(
+        idx_t(1),
+        (idx_t)tuned_option<type_t<matrix_t>>(opts.nb, "getrf", "nb", k, 256));
+
+    // check arguments
+    tlapack_check((idx_t)size(piv) >= k);
+
+    // quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    // Factors the panel j:j+jb and makes its pivots global
+    auto factor_panel = [&](idx_t j, idx_t jb) -> int {
+        auto Ap = slice(A, range(j, m), range(j, j + jb));
+        auto pivp = slice(piv, range(j, j + jb));
+        const int info = getrf_recursive(Ap, pivp);
+        for (idx_t i = 0; i < jb; ++i)
+            pivp[i] += j;
+        return (info != 0) ? info + j : 0;
+    };
+
+    // Threads available for the trailing updates
+    ThreadPool* pool = nullptr;
+    std::size_t nthreads = 1;
+    if (opts.exec.is_parallel()) {
+        pool = (opts.exec.pool) ? opts.exec.pool : &default_thread_pool();
+        nthreads = opts.exec.nthreads;
+        if (nthreads == 0 || nthreads > pool->size()) nthreads = pool->size();
+    }
+
+    int info = 0;
+    idx_t jnext = 0;  // First panel that is not factored yet
+    for (idx_t j = 0; j < k; j += nb) {
+        const idx_t jb = min(nb, k - j);
+        const idx_t j2 = j + jb;
+
+        if (jnext == j) {
+            info = factor_panel(j, jb);
+            jnext = j2;
+            if (info != 0) break;
+        }
+        if (j2 >= n) break;
+
+        // The lookahead task updates and factors the next panel, and the
+        // other tasks update the blocks of columns c0:n
+        const idx_t jbn = (j2 < k) ? min(nb, k - j2) : 0;
+        const bool ahead = opts.lookahead && jbn > 0;
+        const idx_t c0 = ahead ? j2 + jbn : j2;
+        const idx_t nrest = n - c0;
+
+        std::size_t nblocks = 0;
+        idx_t wb = 0;
+        if (nrest > 0) {
+            const std::size_t nt =
+                ahead ? std::max<std::size_t>(nthreads - 1, 1) : nthreads;
+            nblocks = std::min<std::size_t>(nt, (nrest + nb - 1) / nb);
+            wb = (nrest + idx_t(nblocks) - 1) / idx_t(nblocks);
+            wb = ((wb + nb - 1) / nb) * nb;
+            nblocks = std::size_t((nrest + wb - 1) / wb);
+        }
+
+        int infoAhead = 0;
+        auto task = [&](std::size_t t) {
+            if (ahead && t == 0) {
+                internal::getrf_blocked_update(A, piv, j, jb, j2, j2 + jbn);
+                infoAhead = factor_panel(j2, jbn);
+            }
+            else {
+                const idx_t b = idx_t(ahead ? t - 1 : t);
+                const idx_t b0 = c0 + b * wb;
+                const idx_t b1 = min(b0 + wb, n);
+                internal::getrf_blocked_update(A, piv, j, jb, b0, b1);
+            }
+        };
+        const std::size_t ntasks = nblocks + (ahead ? 1 : 0);
+        if (nthreads > 1)
+            pool->parallel_for(ntasks, task, nthreads);
+        else
+            for (std::size_t t = 0; t < ntasks; ++t)
+                task(t);
+
+        if (ahead) {
+            jnext = j2 + jbn;
+            info = infoAhead;
+            if (info != 0) break;
+        }
+    }
+    if (info != 0) return info;
+
+    // Apply the interchanges of each panel to the columns on its left
+    for (idx_t j = nb; j < k; j += nb) {
+        const idx_t jb = min(nb, k - j);
+        auto Al = cols(A, range(0, j));
+        for (idx_t i = j; i < j + jb; ++i) {
+            if ((idx_t)piv[i] != i) {
+                auto r1 = row(Al, i);
+                auto r2 = row(Al, piv[i]);
+                tlapack::swap(r1, r2);
+            }
+        }
+    }
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_BLOCKED_HH
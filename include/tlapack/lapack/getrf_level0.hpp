@@ -13,6 +13,82 @@
 #include "tlapack/base/utils.hpp"
 namespace tlapack {
 
+namespace internal {
+
+    /** LU factorization of an m-by-n matrix whose sizes are known at compile
+     * time.
+     *
+     * The matrix is copied to a local array and all loops are unrolled, so
+     * that the entries are kept in registers. Row interchanges are done with
+     * compile-time indices. The result is the same as the one of
+     * getrf_level0().
+     *
+     * @ingroup computational
+     */
+    template <int m, int n, TLAPACK_MATRIX matrix_t, TLAPACK_VECTOR piv_t>
+    int getrf_level0_unrolled(matrix_t& A, piv_t& piv)
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+        using real_t = real_type<T>;
+        constexpr int k = (m < n) ? m : n;
+
+        T a[m][n];
+        static_for<0, m>([&](auto i) {
+            static_for<0, n>(
+                [&](auto j) { a[i][j] = A(idx_t(i), idx_t(j)); });
+        });
+
+        int info = 0;
+        static_for<0, k>([&](auto j) {
+            if (info != 0) return;
+
+            // find pivot
+            int p = j;
+            real_t amax = abs1(a[j][j]);
+            static_for<j + 1, m>([&](auto i) {
+                const real_t aij = abs1(a[i][j]);
+                if (aij > amax) {
+                    p = i;
+                    amax = aij;
+                }
+            });
+            piv[idx_t(j)] = p;
+
+            // if nonzero pivot does not exist, return
+            if (amax == real_t(0)) {
+                info = j + 1;
+                return;
+            }
+
+            // swap j-th row and p-th row
+            static_for<j + 1, m>([&](auto i) {
+                if (i == p) {
+                    static_for<0, n>(
+                        [&](auto c) { std::swap(a[j][c], a[i][c]); });
+                }
+            });
+
+            // compute the multipliers
+            static_for<j + 1, m>([&](auto i) { a[i][j] /= a[j][j]; });
+
+            // update the submatrix a(j+1:m-1,j+1:n-1)
+            static_for<j + 1, m>([&](auto i) {
+                static_for<j + 1, n>(
+                    [&](auto c) { a[i][c] -= a[i][j] * a[j][c]; });
+            });
+        });
+
+        static_for<0, m>([&](auto i) {
+            static_for<0, n>(
+                [&](auto j) { A(idx_t(i), idx_t(j)) = a[i][j]; });
+        });
+
+        return info;
+    }
+
+}  // namespace internal
+
 /** getrf computes an LU factorization of a general m-by-n matrix A
  *  using partial pivoting with row interchanges.
  *
@@ -44,6 +120,10 @@ namespace tlapack {
  *      3. below the diagonal of A will be copied to L
  *      4. On and above the diagonal of A will be copied to U
  *
+ * @note If the sizes of A are known at compile time, e.g., for mdspan with
+ *     static extents or fixed-size Eigen matrices, and are at most
+ *     internal::max_unrolled_size, the loops are fully unrolled.
+ *
  * @ingroup computational
  */
 template <TLAPACK_MATRIX matrix_t, TLAPACK_VECTOR piv_t>
@@ -64,6 +144,12 @@ int getrf_level0(matrix_t& A, piv_t& piv)
     // quick return
     if (m <= 0 || n <= 0) return 0;
 
+    // Small matrices with sizes known at compile time
+    if constexpr (internal::use_unrolled_kernel<matrix_t>) {
+        return internal::getrf_level0_unrolled<static_nrows<matrix_t>,
+                                               static_ncols<matrix_t>>(A, piv);
+    }
+
     for (idx_t j = 0; j < end; j++) {
         // find pivot and swap the row with pivot row
         piv[j] = j;
@@ -10,6 +10,7 @@
 #ifndef TLAPACK_GETRF_RECURSIVE_HH
 #define TLAPACK_GETRF_RECURSIVE_HH
 
+#include "tlapack/base/parallel.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/iamax.hpp"
@@ -43,6 +44,10 @@ namespace tlapack {
  * and piv[i]=j where i<=j<=k-1, which means in the i-th iteration of the
  * algorithm, the j-th row needs to be swapped with i
  *
+ * @param[in] exec Execution policy. The row interchanges, triangular solves
+ * and matrix products that update the right part of A are split into blocks
+ * of columns that are processed in parallel.
+ *
  * @note To construct L and U, one proceeds as in the following steps
  *      1. Set matrices L m-by-k, and U k-by-n be to matrices with all zeros,
  * where k=min(m,n)
@@ -53,7 +58,9 @@ namespace tlapack {
  * @ingroup computational
  */
 template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR piv_t>
-int getrf_recursive(matrix_t& A, piv_t& piv)
+int getrf_recursive(matrix_t& A,
+                    piv_t& piv,
+                    const ExecutionPolicy& exec = {})
 {
     using idx_t = size_type<matrix_t>;
     using T = type_t<matrix_t>;
@@ -67,6 +74,7 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
     const idx_t k = min(m, n);
+    const idx_t nmin = 32;  // Minimum number of columns in a parallel block
 
     // check arguments
     tlapack_check((idx_t)size(piv) >= k);
@@ -118,20 +126,26 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
         auto A0 = tlapack::cols(A, range(0, m));
         auto A1 = tlapack::cols(A, range(m, n));
 
-        int info = getrf_recursive(A0, piv);
+        int info = getrf_recursive(A0, piv, exec);
         if (info != 0) return info;
 
-        // swap the rows of A1 according to piv
-        for (idx_t j = 0; j < k; j++) {
-            if ((idx_t)piv[j] != j) {
-                auto vect1 = tlapack::row(A1, j);
-                auto vect2 = tlapack::row(A1, piv[j]);
-                tlapack::swap(vect1, vect2);
-            }
-        }
+        internal::parallel_for_blocks(
+            exec, n - m, nmin, [&](idx_t j0, idx_t j1) {
+                auto A1j = tlapack::cols(A1, range(j0, j1));
+
+                // swap the rows of A1 according to piv
+                for (idx_t j = 0; j < k; j++) {
+                    if ((idx_t)piv[j] != j) {
+                        auto vect1 = tlapack::row(A1j, j);
+                        auto vect2 = tlapack::row(A1j, piv[j]);
+                        tlapack::swap(vect1, vect2);
+                    }
+                }
 
-        // Solve triangular system A0 X = A1 and update A1
-        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), A0, A1);
+                // Solve triangular system A0 X = A1 and update A1
+                trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), A0,
+                     A1j);
+            });
 
         return 0;
     }
@@ -147,18 +161,9 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
         auto piv0 = tlapack::slice(piv, range(0, k0));
 
         // Apply getrf on the left of half of the matrix
-        int info = getrf_recursive(A0, piv0);
+        int info = getrf_recursive(A0, piv0, exec);
         if (info != 0) return info;
 
-        // swap the rows of A1
-        for (idx_t j = 0; j < k0; j++) {
-            if ((idx_t)piv0[j] != j) {
-                auto vect1 = tlapack::row(A1, j);
-                auto vect2 = tlapack::row(A1, piv0[j]);
-                tlapack::swap(vect1, vect2);
-            }
-        }
-
         // partition A into the following four blocks:
         auto A00 = tlapack::slice(A, range(0, k0), range(0, k0));
         auto A01 = tlapack::slice(A, range(0, k0), range(k0, n));
@@ -168,14 +173,33 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
         // Take piv1 to be the second slice of of piv, meaning piv= [piv0, piv1]
         auto piv1 = tlapack::slice(piv, range(k0, k));
 
-        // Solve the triangular system of equations given by A00 X = A01
-        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), A00, A01);
-
-        // A11 <---- A11 - (A10 * A01)
-        gemm(NO_TRANS, NO_TRANS, real_t(-1), A10, A01, real_t(1), A11);
+        internal::parallel_for_blocks(
+            exec, n - k0, nmin, [&](idx_t j0, idx_t j1) {
+                auto A1j = tlapack::cols(A1, range(j0, j1));
+                auto A01j = tlapack::cols(A01, range(j0, j1));
+                auto A11j = tlapack::cols(A11, range(j0, j1));
+
+                // swap the rows of A1
+                for (idx_t j = 0; j < k0; j++) {
+                    if ((idx_t)piv0[j] != j) {
+                        auto vect1 = tlapack::row(A1j, j);
+                        auto vect2 = tlapack::row(A1j, piv0[j]);
+                        tlapack::swap(vect1, vect2);
+                    }
+                }
+
+                // Solve the triangular system of equations given by
+                // A00 X = A01
+                trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), A00,
+                     A01j);
+
+                // A11 <---- A11 - (A10 * A01)
+                gemm(NO_TRANS, NO_TRANS, real_t(-1), A10, A01j, real_t(1),
+                     A11j);
+            });
 
         // Finding LU factorization of A11 in place
-        info = getrf_recursive(A11, piv1);
+        info = getrf_recursive(A11, piv1, exec);
         if (info != 0) return info + k0;
 
         // swap the rows of A10 according to the swapped rows of A11 by refering
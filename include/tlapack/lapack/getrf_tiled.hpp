@@ -0,0 +1,443 @@
+/// @file getrf_tiled.hpp Computes the LU factorization of a general matrix
+/// using a tiled algorithm with tournament pivoting.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_TILED_HH
+#define TLAPACK_GETRF_TILED_HH
+
+#include <atomic>
+#include <deque>
+#include <numeric>
+#include <unordered_map>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/getrf_recursive.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/tiled/TiledMatrix.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /// Node of the reduction tree of tournament pivoting
+    template <class T, class idx_t>
+    struct TournamentNode {
+        std::vector<T> rows;      ///< Candidate rows, stored as a matrix
+        std::vector<idx_t> idx;   ///< Row indices of the candidates in A
+        std::vector<T> lu;        ///< LU factors of the winners (root only)
+    };
+
+    /**
+     * LU factorization with partial pivoting that does not stop at zero
+     * pivots. Columns without a nonzero pivot are skipped.
+     *
+     * @return 0 if all pivots are nonzero, or the index plus one of the first
+     *      zero pivot.
+     */
+    template <TLAPACK_SMATRIX matrix_t, class piv_t>
+    int getrf_nostop(matrix_t& A, piv_t& piv)
+    {
+        using idx_t = size_type<matrix_t>;
+        using T = type_t<matrix_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t k = min(m, n);
+
+        int info = 0;
+        for (idx_t j = 0; j < k; ++j) {
+            idx_t p = j;
+            for (idx_t i = j + 1; i < m; ++i)
+                if (abs1(A(i, j)) > abs1(A(p, j))) p = i;
+            piv[j] = p;
+
+            if (p != j) {
+                for (idx_t l = 0; l < n; ++l) {
+                    const T tmp = A(j, l);
+                    A(j, l) = A(p, l);
+                    A(p, l) = tmp;
+                }
+            }
+
+            if (A(j, j) == T(0)) {
+                if (info == 0) info = j + 1;
+                continue;
+            }
+
+            for (idx_t i = j + 1; i < m; ++i) {
+                A(i, j) /= A(j, j);
+                for (idx_t l = j + 1; l < n; ++l)
+                    A(i, l) -= A(i, j) * A(j, l);
+            }
+        }
+        return info;
+    }
+
+    /**
+     * Selects up to w pivot rows of the r-by-w matrix S using LU with partial
+     * pivoting, and stores the selected rows and their indices in node.
+     *
+     * @param[in] S r-by-w matrix with the candidate rows.
+     * @param[in] idx Row indices in A of the rows of S.
+     * @param[in] w Number of rows to select.
+     * @param[out] node Node of the tournament.
+     * @param[in] root If true, also stores the w-by-w LU factors of the
+     *      selected rows in node.lu.
+     */
+    template <class work_t, TLAPACK_MATRIX S_t, class T, class idx_t>
+    void tournament_select(const S_t& S,
+                           const std::vector<idx_t>& idx,
+                           idx_t w,
+                           TournamentNode<T, idx_t>& node,
+                           bool root)
+    {
+        using range = pair<idx_t, idx_t>;
+        Create<work_t> new_matrix;
+
+        const idx_t r = nrows(S);
+        const idx_t nsel = min(r, w);
+
+        workspace_vector<T> B_;
+        auto B = new_matrix(B_, r, w);
+        std::vector<idx_t> piv(nsel);
+        lacpy(GENERAL, S, B);
+        if (getrf_recursive(B, piv) != 0) {
+            lacpy(GENERAL, S, B);
+            getrf_nostop(B, piv);
+        }
+
+        // Rows of S in the pivoted order
+        std::vector<idx_t> perm(r);
+        std::iota(perm.begin(), perm.end(), idx_t(0));
+        for (idx_t j = 0; j < nsel; ++j)
+            std::swap(perm[j], perm[piv[j]]);
+
+        std::vector<T> rows_;
+        auto R = new_matrix(rows_, nsel, w);
+        std::vector<idx_t> idx_(nsel);
+        for (idx_t i = 0; i < nsel; ++i) {
+            for (idx_t j = 0; j < w; ++j)
+                R(i, j) = S(perm[i], j);
+            idx_[i] = idx[perm[i]];
+        }
+
+        if (root) {
+            auto LU = new_matrix(node.lu, w, w);
+            lacpy(GENERAL, slice(B, range(0, w), range(0, w)), LU);
+        }
+        node.rows = std::move(rows_);
+        node.idx = std::move(idx_);
+    }
+
+}  // namespace internal
+
+/** Computes the LU factorization of a general m-by-n matrix A using a tiled
+ * algorithm with tournament pivoting.
+ *
+ * The factorization has the form
+ * \[
+ *   P A = L U
+ * \]
+ * where P is a permutation matrix, L is lower triangular with unit diagonal
+ * elements (lower trapezoidal if m > n), and U is upper triangular (upper
+ * trapezoidal if m < n). The output has the same format as getrf().
+ *
+ * The matrix is partitioned into nb-by-nb tiles. The pivot rows of each block
+ * column are chosen by tournament pivoting (CALU): every tile of the block
+ * column proposes nb candidate rows using LU with partial pivoting, and the
+ * candidates are reduced pairwise in a binary tree. The winners are moved to
+ * the diagonal tile, and the remaining rows are computed with triangular
+ * solves. The pivots may differ from the ones of partial pivoting, but the
+ * method is stable in practice.
+ *
+ * Each selection of candidates (getrf_recursive), row interchange (swap),
+ * triangular solve (trsm) and matrix product (gemm) on tiles is a task of a
+ * tiled::TaskGraph. The tasks are executed by the threads of the execution
+ * policy as soon as their dependencies are satisfied.
+ *
+ * @return  0 if success
+ * @return  i+1 if U(i,i) is exactly zero. The factorization is completed in
+ *      this case.
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the factors L and U from the factorization P A = L U;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[out] piv k-by-1 integer vector where k=min(m,n).
+ *      piv[i] = j, where i <= j < m, means that the row i was interchanged
+ *      with row j in the i-th step of the factorization.
+ *
+ * @param[in] opts Options.
+ *      - nb: Tile size.
+ *      - exec: Execution policy used to run the tasks.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR piv_t>
+int getrf_tiled(matrix_t& A, piv_t& piv, const TiledOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using work_t = matrix_type<matrix_t>;
+    using node_t = internal::TournamentNode<T, idx_t>;
+    using tiled::Access;
+    using tiled::Dependency;
+
+    // constants
+    const T one(1);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = opts.nb;
+
+    // check arguments
+    tlapack_check((idx_t)size(piv) >= k);
+    tlapack_check(nb > 0);
+
+    // quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    tiled::TiledMatrix<matrix_t> tA(A, nb, nb);
+    const idx_t mt = tA.mt();
+    const idx_t nt = tA.nt();
+    const idx_t kt = (k + nb - 1) / nb;
+
+    // Smallest index of a zero pivot
+    std::atomic<idx_t> info{0};
+    auto set_info = [&info](idx_t i) {
+        idx_t current = info;
+        while ((current == 0 || i < current) &&
+               !info.compare_exchange_weak(current, i)) {
+        }
+    };
+
+    // Nodes of the tournaments. A deque keeps the addresses stable.
+    std::deque<node_t> nodes;
+
+    tiled::TaskGraph g;
+    for (idx_t p = 0; p < kt; ++p) {
+        const idx_t r0 = tA.rows(p).first;
+        const idx_t c0 = tA.cols(p).first;
+        const idx_t w = min(tA.tile_ncols(p), m - r0);
+        const tiled::handle_t hpiv = &piv[r0];
+
+        if (m - r0 < tA.tile_ncols(p)) {
+            // The last block row has fewer rows than the block column. Factor
+            // the whole block row at once.
+            std::vector<Dependency> deps = tA.row(p, p, nt, Access::ReadWrite);
+            deps.push_back({hpiv, Access::Write});
+            g.insert_task(
+                [&, r0, c0, w]() {
+                    auto Ap = slice(A, range(r0, m), range(c0, n));
+                    auto pivp = slice(piv, range(r0, r0 + w));
+                    const int infop = getrf_recursive(Ap, pivp);
+                    if (infop != 0) set_info(r0 + infop);
+                    for (idx_t i = 0; i < w; ++i)
+                        pivp[i] += r0;
+                },
+                deps, 3);
+        }
+        else {
+            // Tournament: leaves
+            std::vector<node_t*> level;
+            for (idx_t i = p; i < mt; ++i) {
+                nodes.emplace_back();
+                node_t* leaf = &nodes.back();
+                const bool root = (mt - p == 1);
+                g.insert_task(
+                    [&, leaf, i, c0, w, root]() {
+                        auto S = slice(A, tA.rows(i), range(c0, c0 + w));
+                        std::vector<idx_t> idx(nrows(S));
+                        std::iota(idx.begin(), idx.end(), tA.rows(i).first);
+                        internal::tournament_select<work_t>(S, idx, w, *leaf,
+                                                            root);
+                    },
+                    {{tA.handle(i, p), Access::Read}, {leaf, Access::Write}},
+                    2);
+                level.push_back(leaf);
+            }
+
+            // Tournament: binary reduction tree
+            while (level.size() > 1) {
+                std::vector<node_t*> next;
+                const bool root = (level.size() == 2);
+                for (std::size_t l = 0; l + 1 < level.size(); l += 2) {
+                    node_t* a = level[l];
+                    node_t* b = level[l + 1];
+                    nodes.emplace_back();
+                    node_t* c = &nodes.back();
+                    g.insert_task(
+                        [a, b, c, w, root]() {
+                            Create<work_t> new_matrix;
+                            const idx_t ra = a->idx.size();
+                            const idx_t rb = b->idx.size();
+                            auto Ra = new_matrix(a->rows, ra, w);
+                            auto Rb = new_matrix(b->rows, rb, w);
+
+                            workspace_vector<T> S_;
+                            auto S = new_matrix(S_, ra + rb, w);
+                            auto Sa = rows(S, range(0, ra));
+                            auto Sb = rows(S, range(ra, ra + rb));
+                            lacpy(GENERAL, Ra, Sa);
+                            lacpy(GENERAL, Rb, Sb);
+                            std::vector<idx_t> idx(a->idx);
+                            idx.insert(idx.end(), b->idx.begin(),
+                                       b->idx.end());
+
+                            internal::tournament_select<work_t>(S, idx, w, *c,
+                                                                root);
+                            *a = node_t();
+                            *b = node_t();
+                        },
+                        {{a, Access::ReadWrite},
+                         {b, Access::ReadWrite},
+                         {c, Access::Write}},
+                        2);
+                    next.push_back(c);
+                }
+                if (level.size() % 2 == 1) next.push_back(level.back());
+                level = std::move(next);
+            }
+            node_t* root = level[0];
+
+            // Move the winners to the diagonal tile, copy their LU factors
+            // and compute the part of L in the diagonal tile
+            std::vector<Dependency> deps =
+                tA.column(p, mt, p, Access::ReadWrite);
+            deps.push_back({root, Access::ReadWrite});
+            deps.push_back({hpiv, Access::Write});
+            g.insert_task(
+                [&, root, p, r0, c0, w]() {
+                    // Convert the list of winners into row interchanges
+                    std::unordered_map<idx_t, idx_t> where, at;
+                    auto find = [](std::unordered_map<idx_t, idx_t>& map,
+                                   idx_t i) {
+                        auto it = map.find(i);
+                        return (it == map.end()) ? i : it->second;
+                    };
+                    for (idx_t i = 0; i < w; ++i) {
+                        const idx_t row = root->idx[i];
+                        const idx_t pos = find(where, row);
+                        const idx_t other = find(at, r0 + i);
+                        piv[r0 + i] = pos;
+                        at[pos] = other;
+                        where[other] = pos;
+                        at[r0 + i] = row;
+                        where[row] = r0 + i;
+                    }
+
+                    auto Ap = slice(A, range(r0, m), range(c0, c0 + w));
+                    for (idx_t i = 0; i < w; ++i) {
+                        if (piv[r0 + i] != r0 + i) {
+                            auto vect1 = row(Ap, i);
+                            auto vect2 = row(Ap, piv[r0 + i] - r0);
+                            tlapack::swap(vect1, vect2);
+                        }
+                    }
+
+                    Create<work_t> new_matrix;
+                    auto LU = new_matrix(root->lu, w, w);
+                    auto A11 = slice(Ap, range(0, w), range(0, w));
+                    lacpy(GENERAL, LU, A11);
+                    for (idx_t i = 0; i < w; ++i) {
+                        if (A11(i, i) == T(0)) {
+                            set_info(r0 + i + 1);
+                            break;
+                        }
+                    }
+
+                    const idx_t mp = tA.tile_nrows(p);
+                    if (mp > w) {
+                        auto A21 = slice(Ap, range(w, mp), range(0, w));
+                        trsm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS,
+                             NON_UNIT_DIAG, one, A11, A21);
+                    }
+                    *root = node_t();
+                },
+                deps, 3);
+
+            // Compute the rest of L
+            for (idx_t i = p + 1; i < mt; ++i) {
+                g.insert_task(
+                    [&, p, i, w]() {
+                        auto A11 =
+                            slice(tA.tile(p, p), range(0, w), range(0, w));
+                        auto Aip = tA.tile(i, p);
+                        trsm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS,
+                             NON_UNIT_DIAG, one, A11, Aip);
+                    },
+                    {{tA.handle(p, p), Access::Read},
+                     {tA.handle(i, p), Access::ReadWrite}},
+                    2);
+            }
+        }
+
+        // Apply the row interchanges to the other block columns
+        const idx_t jend = (m - r0 < tA.tile_ncols(p)) ? p : nt;
+        for (idx_t j = 0; j < jend; ++j) {
+            if (j == p) continue;
+            std::vector<Dependency> deps =
+                tA.column(p, mt, j, Access::ReadWrite);
+            deps.push_back({hpiv, Access::Read});
+            g.insert_task(
+                [&, j, r0, w]() {
+                    auto Aj = slice(A, range(r0, m), tA.cols(j));
+                    for (idx_t i = 0; i < w; ++i) {
+                        if ((idx_t)piv[r0 + i] != r0 + i) {
+                            auto vect1 = row(Aj, i);
+                            auto vect2 = row(Aj, piv[r0 + i] - r0);
+                            tlapack::swap(vect1, vect2);
+                        }
+                    }
+                },
+                deps, (j == p + 1) ? 2 : 0);
+        }
+
+        // Update the trailing matrix
+        if (m - r0 >= tA.tile_ncols(p)) {
+            for (idx_t j = p + 1; j < nt; ++j) {
+                g.insert_task(
+                    [&, p, j, w]() {
+                        auto A11 =
+                            slice(tA.tile(p, p), range(0, w), range(0, w));
+                        auto Apj = tA.tile(p, j);
+                        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG,
+                             one, A11, Apj);
+                    },
+                    {{tA.handle(p, p), Access::Read},
+                     {tA.handle(p, j), Access::ReadWrite}},
+                    (j == p + 1) ? 2 : 0);
+                for (idx_t i = p + 1; i < mt; ++i) {
+                    g.insert_task(
+                        [&, p, i, j]() {
+                            auto Aip = tA.tile(i, p);
+                            auto Apj = tA.tile(p, j);
+                            auto Aij = tA.tile(i, j);
+                            gemm(NO_TRANS, NO_TRANS, -one, Aip, Apj, one,
+                                 Aij);
+                        },
+                        {{tA.handle(i, p), Access::Read},
+                         {tA.handle(p, j), Access::Read},
+                         {tA.handle(i, j), Access::ReadWrite}},
+                        (j == p + 1) ? 1 : 0);
+                }
+            }
+        }
+    }
+    g.execute(opts.exec);
+
+    return (int)info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_TILED_HH
@@ -121,7 +121,7 @@ int getri_uxli(matrix_t& A)
 
     // Allocates workspace
     WorkInfo workinfo = getri_uxli_worksize<T>(A);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return getri_uxli_work(A, work);
@@ -0,0 +1,100 @@
+/// @file getrs.hpp Apply the LU factorization to solve a linear system.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRS_HH
+#define TLAPACK_GETRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/laswp.hpp"
+
+namespace tlapack {
+
+/** Apply the LU factorization to solve a linear system.
+ * \[
+ *      op(A) X = B,
+ * \]
+ * where $A = P L U$ was computed by getrf(), and $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$.
+ *
+ * The row interchanges are applied to B in blocks of columns by laswp(),
+ * and the triangular solves are done by trsm(). For many right-hand sides,
+ * most of the work is done by gemm().
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] A n-by-n matrix.
+ *      The factors L and U from the factorization $A = P L U$ computed by
+ *      getrf(). The unit diagonal elements of L are not stored.
+ *
+ * @param[in] piv Vector of size n.
+ *      The pivot indices from getrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @param[in] opts Options.
+ *      - nb: Number of columns of B in each block of row interchanges.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_MATRIX matrixB_t>
+int getrs(op_t trans,
+          const matrixA_t& A,
+          const piv_t& piv,
+          matrixB_t& B,
+          const LaswpOpts& opts = {})
+{
+    using T = type_t<matrixB_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+
+    // Check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(ncols(A) != n);
+    tlapack_check_false((idx_t)size(piv) != n);
+    tlapack_check_false((idx_t)nrows(B) != n);
+
+    // Quick return
+    if (n == 0 || ncols(B) == 0) return 0;
+
+    if (trans == Op::NoTrans) {
+        // Solve A X = B where A = P L U
+        laswp(FORWARD, B, piv, opts);
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, A, B);
+        trsm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, A, B);
+    }
+    else {
+        // Solve op(A) X = B where op(A) = op(U) op(L) P^T
+        trsm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one, A, B);
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, trans, UNIT_DIAG, one, A, B);
+        laswp(BACKWARD, B, piv, opts);
+    }
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRS_HH
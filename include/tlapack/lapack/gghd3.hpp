@@ -12,6 +12,7 @@
 #ifndef TLAPACK_GGHD3_HH
 #define TLAPACK_GGHD3_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/rot.hpp"
 #include "tlapack/blas/rotg.hpp"
@@ -24,7 +25,7 @@ namespace tlapack {
  * Options struct for gghd3
  */
 struct Gghd3Opts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = 0;  ///< Block size. 0: tuned value, see tuned_option()
 };
 
 /** Reduces a pair of real square matrices (A, B) to generalized upper
@@ -70,7 +71,7 @@ int gghd3(bool wantq,
 
     // constants
     const idx_t n = ncols(A);
-    const idx_t nb = opts.nb;
+    const idx_t nb = tuned_option<T>(opts.nb, "gghd3", "nb", n, 32);
     const idx_t nh = ihi - ilo - 1;
 
     // check arguments
@@ -93,18 +94,18 @@ int gghd3(bool wantq,
     if (nh <= 1) return 0;
 
     // Locally allocate workspace for now
-    std::vector<real_t> Cl_;
+    workspace_vector<real_t> Cl_;
     auto Cl = new_real_matrix(Cl_, nh - 1, nb);
-    std::vector<T> Sl_;
+    workspace_vector<T> Sl_;
     auto Sl = new_matrix(Sl_, nh - 1, nb);
-    std::vector<real_t> Cr_;
+    workspace_vector<real_t> Cr_;
     auto Cr = new_real_matrix(Cr_, nh - 1, nb);
-    std::vector<T> Sr_;
+    workspace_vector<T> Sr_;
     auto Sr = new_matrix(Sr_, nh - 1, nb);
 
-    std::vector<T> Qt_;
+    workspace_vector<T> Qt_;
     auto Qt = new_matrix(Qt_, 2 * nb, 2 * nb);
-    std::vector<T> C_;
+    workspace_vector<T> C_;
     auto C = new_matrix(C_, 2 * nb, n);
     auto D = new_matrix(C_, n, 2 * nb);
 
@@ -0,0 +1,187 @@
+/// @file gttrs.hpp Solves a linear system with a general tridiagonal matrix
+/// using the LU factorization computed by gttrf().
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GTTRS_HH
+#define TLAPACK_GTTRS_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for gttrs()
+struct GttrsOpts {
+    size_t nb = 0;  ///< Columns of B per sweep. 0: tuned value, see
+                    ///< tuned_option()
+    ExecutionPolicy exec = {};  ///< Execution policy over the columns of B
+};
+
+/** Solves the system of equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * where A is an n-by-n tridiagonal matrix factored as $A = L U$ by gttrf(),
+ * and $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$.
+ *
+ * As in pttrs(), the columns of B are processed in blocks of nb, with the
+ * innermost loop over the columns of a block, and the blocks are split among
+ * the threads of the execution policy.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] DL Vector of size n-1. The multipliers of L from gttrf().
+ * @param[in] D Vector of size n. The diagonal of U from gttrf().
+ * @param[in] DU Vector of size n-1. The first superdiagonal of U.
+ * @param[in] DU2 Vector of size n-2. The second superdiagonal of U.
+ * @param[in] piv Vector of size n. The pivot indices from gttrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @param[in] opts Options.
+ *      - nb: Number of columns of B in each sweep.
+ *      - exec: Execution policy over the blocks of columns of B.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          TLAPACK_VECTOR dl_t,
+          TLAPACK_VECTOR d_t,
+          TLAPACK_VECTOR du_t,
+          TLAPACK_VECTOR du2_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_MATRIX matrixB_t>
+int gttrs(op_t trans,
+          const dl_t& DL,
+          const d_t& D,
+          const du_t& DU,
+          const du2_t& DU2,
+          const piv_t& piv,
+          matrixB_t& B,
+          const GttrsOpts& opts = {})
+{
+    using T = type_t<d_t>;
+    using TB = type_t<matrixB_t>;
+    using idx_t = size_type<matrixB_t>;
+
+    // Constants
+    const idx_t n = size(D);
+    const idx_t nrhs = ncols(B);
+    const idx_t nb =
+        max(idx_t(1), (idx_t)tuned_option<TB>(opts.nb, "gttrs", "nb", n, 32));
+
+    // Check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(n > 0 && (idx_t)size(DL) + 1 != n);
+    tlapack_check_false(n > 0 && (idx_t)size(DU) + 1 != n);
+    tlapack_check_false(n > 1 && (idx_t)size(DU2) + 2 != n);
+    tlapack_check_false((idx_t)size(piv) < n);
+    tlapack_check_false((idx_t)nrows(B) != n);
+
+    // Quick return
+    if (n == 0 || nrhs == 0) return 0;
+
+    const bool conjA = (trans == Op::ConjTrans);
+    auto op = [conjA](const T& x) { return conjA ? conj(x) : x; };
+
+    internal::parallel_for_blocks(opts.exec, nrhs, nb, [&](idx_t k0,
+                                                           idx_t k1) {
+        for (idx_t j0 = k0; j0 < k1; j0 += nb) {
+            const idx_t j1 = min(j0 + nb, k1);
+
+            if (trans == Op::NoTrans) {
+                // Solve L Y = B, applying the row interchanges
+                for (idx_t i = 0; i + 1 < n; ++i) {
+                    const T li = DL[i];
+                    if ((idx_t)piv[i] == i) {
+                        for (idx_t k = j0; k < j1; ++k)
+                            B(i + 1, k) -= li * B(i, k);
+                    }
+                    else {
+                        for (idx_t k = j0; k < j1; ++k) {
+                            const TB bi = B(i, k);
+                            B(i, k) = B(i + 1, k);
+                            B(i + 1, k) = bi - li * B(i, k);
+                        }
+                    }
+                }
+
+                // Solve U X = Y
+                for (idx_t k = j0; k < j1; ++k)
+                    B(n - 1, k) /= D[n - 1];
+                if (n > 1) {
+                    for (idx_t k = j0; k < j1; ++k)
+                        B(n - 2, k) =
+                            (B(n - 2, k) - DU[n - 2] * B(n - 1, k)) / D[n - 2];
+                }
+                for (idx_t i = n; i-- > 2;) {
+                    const T ui = DU[i - 2];
+                    const T u2i = DU2[i - 2];
+                    const T di = D[i - 2];
+                    for (idx_t k = j0; k < j1; ++k)
+                        B(i - 2, k) = (B(i - 2, k) - ui * B(i - 1, k) -
+                                       u2i * B(i, k)) /
+                                      di;
+                }
+            }
+            else {
+                // Solve op(U) Y = B
+                for (idx_t k = j0; k < j1; ++k)
+                    B(0, k) /= op(D[0]);
+                if (n > 1) {
+                    for (idx_t k = j0; k < j1; ++k)
+                        B(1, k) = (B(1, k) - op(DU[0]) * B(0, k)) / op(D[1]);
+                }
+                for (idx_t i = 2; i < n; ++i) {
+                    const T ui = op(DU[i - 1]);
+                    const T u2i = op(DU2[i - 2]);
+                    const T di = op(D[i]);
+                    for (idx_t k = j0; k < j1; ++k)
+                        B(i, k) = (B(i, k) - ui * B(i - 1, k) -
+                                   u2i * B(i - 2, k)) /
+                                  di;
+                }
+
+                // Solve op(L) X = Y, applying the row interchanges
+                for (idx_t i = n - 1; i-- > 0;) {
+                    const T li = op(DL[i]);
+                    if ((idx_t)piv[i] == i) {
+                        for (idx_t k = j0; k < j1; ++k)
+                            B(i, k) -= li * B(i + 1, k);
+                    }
+                    else {
+                        for (idx_t k = j0; k < j1; ++k) {
+                            const TB bi1 = B(i + 1, k);
+                            B(i + 1, k) = B(i, k) - li * bi1;
+                            B(i, k) = bi1;
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GTTRS_HH
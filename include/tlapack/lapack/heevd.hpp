@@ -0,0 +1,118 @@
+/// @file heevd.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zheevd.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HEEVD_HH
+#define TLAPACK_HEEVD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/hetrd.hpp"
+#include "tlapack/lapack/stedc.hpp"
+#include "tlapack/lapack/ungtr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for heevd
+ */
+struct HeevdOpts : public StedcOpts {
+    /// Block size used in the tridiagonal reduction. 0: tuned value, see
+    /// tuned_option()
+    size_t nb = 0;
+    /// If only nx_switch columns are left, the tridiagonal reduction uses
+    /// unblocked code. 0: tuned value, see tuned_option()
+    size_t nx_switch = 0;
+};
+
+/**
+ * Computes all eigenvalues and, optionally, eigenvectors of a Hermitian
+ * matrix A using the divide and conquer method. A is reduced to real
+ * symmetric tridiagonal form by hetrd(), and the eigendecomposition of the
+ * tridiagonal matrix is computed by stedc().
+ *
+ * @return 0 if success.
+ * @return nonzero if stedc() failed to compute an eigenvalue.
+ *
+ * @param[in] want_z bool
+ *      If true, compute the eigenvectors.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, if want_z is true, the orthonormal eigenvectors of A.
+ *      Otherwise, the triangle referenced by uplo is destroyed.
+ *
+ * @param[out] w Real vector of length n.
+ *      The eigenvalues of A in ascending order.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb and @c opts.nx_switch: @see HetrdOpts.
+ *      - @c opts.nmin: @see StedcOpts.
+ *      - @c opts.exec: Execution policy of the tridiagonal reduction and of
+ *        stedc().
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR r_vector_t,
+          TLAPACK_UPLO uplo_t>
+int heevd(bool want_z,
+          uplo_t uplo,
+          matrix_t& A,
+          r_vector_t& w,
+          const HeevdOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<vector_type<matrix_t>> new_vector;
+    Create<vector_type<r_vector_t>> new_rvector;
+
+    // constants
+    const idx_t n = nrows(A);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check((idx_t)size(w) >= n);
+
+    // Quick return if possible
+    if (n == 0) return 0;
+
+    // Allocate vectors
+    workspace_vector<type_t<matrix_t>> tau_;
+    auto tau = new_vector(tau_, n - 1);
+    workspace_vector<type_t<r_vector_t>> e_;
+    auto e = new_rvector(e_, n - 1);
+
+    // Reduce A to real symmetric tridiagonal form
+    HetrdOpts hetrdOpts;
+    hetrdOpts.nb = opts.nb;
+    hetrdOpts.nx_switch = opts.nx_switch;
+    hetrdOpts.exec = opts.exec;
+    hetrd(uplo, A, tau, hetrdOpts);
+
+    for (idx_t i = 0; i < n; ++i)
+        w[i] = real(A(i, i));
+    for (idx_t i = 0; i + 1 < n; ++i)
+        e[i] = (uplo == Uplo::Lower) ? real(A(i + 1, i)) : real(A(i, i + 1));
+
+    // Generate the unitary matrix used in the reduction
+    if (want_z) ungtr(uplo, A, tau);
+
+    auto wn = slice(w, range{0, n});
+    return stedc(want_z, wn, e, A, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HEEVD_HH
@@ -0,0 +1,276 @@
+/// @file hetrd.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrd.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRD_HH
+#define TLAPACK_HETRD_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/her2k.hpp"
+#include "tlapack/lapack/hetd2.hpp"
+#include "tlapack/lapack/latrd.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for hetrd
+ */
+struct HetrdOpts {
+    /// Block size used in the blocked reduction. 0: tuned value, see
+    /// tuned_option()
+    size_t nb = 0;
+    /// If only nx_switch columns are left, the algorithm will use unblocked
+    /// code. 0: tuned value, see tuned_option()
+    size_t nx_switch = 0;
+    ExecutionPolicy exec = {};  ///< Execution policy of the panel products
+                                ///< and of the trailing updates
+};
+
+/** Worspace query of hetrd()
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced.
+ * @param[in] A n-by-n Hermitian matrix.
+ * @param tau Vector of length n-1.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          class uplo_t>
+constexpr WorkInfo hetrd_worksize(uplo_t uplo,
+                                  const matrix_t& A,
+                                  const vector_t& tau,
+                                  const HetrdOpts& opts = {})
+{
+    using TA = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = ncols(A);
+    const idx_t nb = tuned_option<TA>(opts.nb, "hetrd", "nb", n, 32);
+    const idx_t nx = max<idx_t>(
+        nb, tuned_option<TA>(opts.nx_switch, "hetrd", "nx_switch", n, 128));
+
+    // W and the off-diagonal elements of the panel
+    if (nb >= 1 && nx < n) return WorkInfo(n, nb + 1);
+
+    return WorkInfo(0);
+}
+
+/** @copybrief hetrd()
+ * Workspace is provided as an argument.
+ * @copydetails hetrd()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_WORKSPACE work_t,
+          class uplo_t>
+int hetrd_work(uplo_t uplo,
+               matrix_t& A,
+               vector_t& tau,
+               work_t& work,
+               const HetrdOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const idx_t nb = tuned_option<T>(opts.nb, "hetrd", "nb", n, 32);
+    const idx_t nx = max<idx_t>(
+        nb, tuned_option<T>(opts.nx_switch, "hetrd", "nx_switch", n, 128));
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check((idx_t)size(tau) >= n - 1);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Use unblocked code for small matrices
+    if (nb < 1 || nx >= n) return hetd2(uplo, A, tau);
+
+    // Matrix W and vector e
+    auto [W, work2] = reshape(work, n, nb);
+    auto [e, work3] = reshape(work2, n);
+
+    if (uplo == Uplo::Upper) {
+        // Columns 0:kk are reduced by unblocked code. The other columns are
+        // reduced in blocks of nb from the last to the first
+        const idx_t kk = n - ((n - nx + nb - 1) / nb) * nb;
+
+        for (idx_t i = n; i > kk;) {
+            i -= nb;
+
+            // Reduce columns i:i+nb to tridiagonal form and form the matrix W
+            // which is needed to update the unreduced part of the matrix
+            auto A11 = slice(A, range{0, i + nb}, range{0, i + nb});
+            auto W11 = slice(W, range{0, i + nb}, range{0, nb});
+            latrd(uplo, A11, e, tau, W11, opts.exec);
+
+            // Update the unreduced submatrix A(0:i,0:i), using an update of
+            // the form: A := A - V*W**H - W*V**H. The update is done by blocks
+            // of nb columns, so that most of the work is done by gemm(), and
+            // the blocks of columns are updated independently.
+            auto V = slice(A, range{0, i}, range{i, i + nb});
+            auto W1 = slice(W, range{0, i}, range{0, nb});
+            internal::parallel_for_blocks(
+                opts.exec, i, nb, [&](idx_t j0, idx_t j1) {
+                    for (idx_t k0 = j0; k0 < j1; k0 += nb) {
+                        const idx_t k1 = min(k0 + nb, j1);
+                        auto Ckk = slice(A, range{k0, k1}, range{k0, k1});
+                        her2k(UPPER_TRIANGLE, NO_TRANS, -one,
+                              rows(V, range{k0, k1}), rows(W1, range{k0, k1}),
+                              one, Ckk);
+                        if (k0 > 0) {
+                            auto C = slice(A, range{0, k0}, range{k0, k1});
+                            gemm(NO_TRANS, CONJ_TRANS, -one,
+                                 rows(V, range{0, k0}),
+                                 rows(W1, range{k0, k1}), one, C);
+                            gemm(NO_TRANS, CONJ_TRANS, -one,
+                                 rows(W1, range{0, k0}),
+                                 rows(V, range{k0, k1}), one, C);
+                        }
+                    }
+                });
+
+            // Copy superdiagonal elements back into A, and only keep the
+            // real part of the main diagonal
+            for (idx_t j = i; j < i + nb; ++j) {
+                A(j - 1, j) = e[j - 1];
+                A(j, j) = real(A(j, j));
+            }
+        }
+
+        // Use unblocked code to reduce the last or only block
+        auto A00 = slice(A, range{0, kk}, range{0, kk});
+        return hetd2(uplo, A00, tau);
+    }
+    else {
+        idx_t i = 0;
+        for (; i + nx < n; i += nb) {
+            // Reduce columns i:i+nb to tridiagonal form and form the matrix W
+            // which is needed to update the unreduced part of the matrix
+            auto A11 = slice(A, range{i, n}, range{i, n});
+            auto W11 = slice(W, range{0, n - i}, range{0, nb});
+            auto e1 = slice(e, range{i, n});
+            auto tau1 = slice(tau, range{i, n - 1});
+            latrd(uplo, A11, e1, tau1, W11, opts.exec);
+
+            // Update the unreduced submatrix A(i+nb:n,i+nb:n), using an update
+            // of the form: A := A - V*W**H - W*V**H. The update is done by
+            // blocks of nb columns, so that most of the work is done by
+            // gemm(), and the blocks of columns are updated independently.
+            const idx_t m = n - i - nb;
+            auto V = slice(A, range{i + nb, n}, range{i, i + nb});
+            auto W1 = slice(W, range{nb, n - i}, range{0, nb});
+            auto A22 = slice(A, range{i + nb, n}, range{i + nb, n});
+            internal::parallel_for_blocks(
+                opts.exec, m, nb, [&](idx_t j0, idx_t j1) {
+                    for (idx_t k0 = j0; k0 < j1; k0 += nb) {
+                        const idx_t k1 = min(k0 + nb, j1);
+                        auto Ckk = slice(A22, range{k0, k1}, range{k0, k1});
+                        her2k(LOWER_TRIANGLE, NO_TRANS, -one,
+                              rows(V, range{k0, k1}), rows(W1, range{k0, k1}),
+                              one, Ckk);
+                        if (k1 < m) {
+                            auto C = slice(A22, range{k1, m}, range{k0, k1});
+                            gemm(NO_TRANS, CONJ_TRANS, -one,
+                                 rows(V, range{k1, m}),
+                                 rows(W1, range{k0, k1}), one, C);
+                            gemm(NO_TRANS, CONJ_TRANS, -one,
+                                 rows(W1, range{k1, m}),
+                                 rows(V, range{k0, k1}), one, C);
+                        }
+                    }
+                });
+
+            // Copy subdiagonal elements back into A
+            for (idx_t j = i; j < i + nb; ++j)
+                A(j + 1, j) = e[j];
+        }
+
+        // Use unblocked code to reduce the last or only block
+        auto A22 = slice(A, range{i, n}, range{i, n});
+        auto tau2 = slice(tau, range{i, n - 1});
+        return hetd2(uplo, A22, tau2);
+    }
+}
+
+/** Reduces a Hermitian matrix to real symmetric tridiagonal form by a unitary
+ * similarity transformation:
+ * Q**H * A * Q = T.
+ *
+ * This is the blocked version of hetd2(). Blocks of nb columns are reduced by
+ * latrd(), and the remaining part of the matrix is updated with her2k().
+ *
+ * @return  0 if success
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the main diagonal and offdiagonal contain the elements of the
+ * symmetric tridiagonal matrix B. The other positions are used to store
+ * elementary Householder reflectors.
+ *
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Block size.
+ *      - @c opts.nx_switch: Size of the trailing matrix reduced by hetd2().
+ *      - @c opts.exec: Execution policy of the trailing updates and of the
+ *        products by the Hermitian matrix in latrd().
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR vector_t, class uplo_t>
+int hetrd(uplo_t uplo,
+          matrix_t& A,
+          vector_t& tau,
+          const HetrdOpts& opts = {})
+{
+    using work_t = matrix_type<matrix_t, vector_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetrd_worksize<T>(uplo, A, tau, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetrd_work(uplo, A, tau, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRD_HH
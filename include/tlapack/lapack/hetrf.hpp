@@ -12,13 +12,17 @@
 #define TLAPACK_HETRF_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/hetrf_aa.hpp"
 #include "tlapack/lapack/hetrf_blocked.hpp"
+#include "tlapack/lapack/hetrf_rook.hpp"
 
 namespace tlapack {
 
 /// @brief Variants of the algorithm to compute the Bunch-Kaufman factorization.
 enum class HetrfVariant : char {
-    Blocked = 'B'  // blocked Bunch-Kaufman with diagonal pivoting
+    Blocked = 'B',  ///< blocked Bunch-Kaufman with diagonal pivoting
+    Rook = 'R',     ///< bounded Bunch-Kaufman (rook) diagonal pivoting
+    Aasen = 'A'     ///< Aasen's L T L^op with a tridiagonal T
 };
 
 /// @brief Options struct for hetrf()
@@ -28,6 +32,30 @@ struct HetrfOpts : public BlockedLDLOpts {
     HetrfVariant variant = HetrfVariant::Blocked;
 };
 
+/** Worspace query of hetrf()
+ *
+ * @param[in] A n-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t>
+constexpr WorkInfo hetrf_worksize(const matrix_t& A,
+                                  const HetrfOpts& opts = {})
+{
+    if (opts.variant == HetrfVariant::Blocked)
+        return hetrf_blocked_worksize<T>(A, opts);
+    else if (opts.variant == HetrfVariant::Aasen)
+        return hetrf_aa_worksize<T>(A, opts);
+    else if (opts.variant == HetrfVariant::Rook)
+        return hetrf_rook_worksize<T>(A, opts);
+    else
+        return WorkInfo(0);
+}
+
 /** @copybrief hetrf()
  * Workspace is provided as an argument.
  * @copydetails hetrf()
@@ -52,10 +80,16 @@ int hetrf_work(uplo_t uplo,
     tlapack_check(nrows(A) == ncols(A));
     tlapack_check(opts.invariant == Op::Trans ||
                   opts.invariant == Op::ConjTrans);
-    tlapack_check(opts.variant == HetrfVariant::Blocked);
+    tlapack_check(opts.variant == HetrfVariant::Blocked ||
+                  opts.variant == HetrfVariant::Rook ||
+                  opts.variant == HetrfVariant::Aasen);
     // Call variant
     if (opts.variant == HetrfVariant::Blocked)
         return hetrf_blocked_work(uplo, A, ipiv, work, opts);
+    else if (opts.variant == HetrfVariant::Rook)
+        return hetrf_rook_work(uplo, A, ipiv, work, opts);
+    else if (opts.variant == HetrfVariant::Aasen)
+        return hetrf_aa_work(uplo, A, ipiv, work, opts);
     else
         return 0;
 }
@@ -118,6 +152,11 @@ int hetrf_work(uplo_t uplo,
  *      Define the behavior of checks for NaNs, and nb for hetrf_blocked.
  *      - variant:
  *          - Blocked = 'B'
+ *          - Rook = 'R': see hetrf_rook(). The factors have the same form,
+ *            but 2-by-2 pivots may use two interchanges.
+ *          - Aasen = 'A': see hetrf_aa(). Computes $P A P^T = L T L^{op}$
+ *            with T tridiagonal, mostly with gemm.
+ *      Use hetrs() with the same options to solve a linear system.
  *
  * @return 0: successful exit.
  * @return i, 0 < i <= n, if $D(i-1,i-1)$ is exactly zero;
@@ -135,10 +174,16 @@ int hetrf(uplo_t uplo, matrix_t& A, ipiv_t& ipiv, const HetrfOpts& opts = {})
     tlapack_check(nrows(A) == ncols(A));
     tlapack_check(opts.invariant == Op::Trans ||
                   opts.invariant == Op::ConjTrans);
-    tlapack_check(opts.variant == HetrfVariant::Blocked);
+    tlapack_check(opts.variant == HetrfVariant::Blocked ||
+                  opts.variant == HetrfVariant::Rook ||
+                  opts.variant == HetrfVariant::Aasen);
     // Call variant
     if (opts.variant == HetrfVariant::Blocked)
         return hetrf_blocked(uplo, A, ipiv, opts);
+    else if (opts.variant == HetrfVariant::Rook)
+        return hetrf_rook(uplo, A, ipiv, opts);
+    else if (opts.variant == HetrfVariant::Aasen)
+        return hetrf_aa(uplo, A, ipiv, opts);
     else
         return 0;
 }
@@ -0,0 +1,271 @@
+/// @file hetrf_aa.hpp Computes the factorization of a symmetric or Hermitian
+/// matrix A using Aasen's algorithm.
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrf_aa.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRF_AA_HH
+#define TLAPACK_HETRF_AA_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/copy.hpp"
+#include "tlapack/blas/dotu.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/hetrf_rook.hpp"
+#include "tlapack/lapack/rscl.hpp"
+
+namespace tlapack {
+
+/** Worspace query of hetrf_aa()
+ *
+ * @param[in] A n-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t>
+constexpr WorkInfo hetrf_aa_worksize(const matrix_t& A,
+                                     const BlockedLDLOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, n);
+
+    if constexpr (is_same_v<T, type_t<matrix_t>>)
+        return (n > nb) ? WorkInfo(nb + 1 + n * (nb + 1))
+                        : WorkInfo(nb + 1);
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief hetrf_aa()
+ * Workspace is provided as an argument.
+ * @copydetails hetrf_aa()
+ *
+ * @param work Workspace. Use the workspace query to determine the size
+ * needed.
+ *
+ * @ingroup workspace
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR ipiv_t,
+          TLAPACK_WORKSPACE work_t>
+int hetrf_aa_work(uplo_t uplo,
+                  matrix_t& A,
+                  ipiv_t& ipiv,
+                  work_t& work,
+                  const BlockedLDLOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, n);
+    const bool upper = (uplo == Uplo::Upper);
+    const bool herm = (opts.invariant == Op::ConjTrans);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check((idx_t)size(ipiv) >= n);
+    tlapack_check(nb >= 1 || n == 0);
+    tlapack_check(opts.invariant == Op::Trans ||
+                  opts.invariant == Op::ConjTrans);
+
+    // Quick return
+    if (n == 0) return 0;
+
+    // The upper triangle is factored as the lower triangle of the matrix
+    // whose rows and columns are in reverse order. The entries of h are
+    // reversed as well, so that slices of A and h are consistent operands for
+    // the BLAS.
+    auto mi = [&](idx_t i) { return upper ? n - 1 - i : i; };
+    auto mr = [&](idx_t i0, idx_t i1) {
+        return upper ? range{n - i1, n - i0} : range{i0, i1};
+    };
+    auto hi = [&](idx_t k) { return upper ? nb - k : k; };
+    auto hr = [&](idx_t k0, idx_t k1) {
+        return upper ? range{nb + 1 - k1, nb + 1 - k0} : range{k0, k1};
+    };
+    auto a = [&](idx_t i, idx_t j) -> T& { return A(mi(i), mi(j)); };
+    auto cj = [herm](const T& x) { return herm ? conj(x) : x; };
+
+    // L(i,k), i >= k. The first column of L is e_0, and L(i,k) is stored in
+    // a(i,k-1) for i > k > 0
+    auto l = [&](idx_t i, idx_t k) -> T {
+        return (i == k) ? T(1) : ((k == 0) ? T(0) : a(i, k - 1));
+    };
+
+    // Column of H = T L^op in the current panel
+    auto [h, work1] = reshape(work, nb + 1);
+
+    ipiv[upper ? n - 1 : 0] = (int)(upper ? n - 1 : 0);
+    for (idx_t j0 = 0; j0 < n; j0 += nb) {
+        const idx_t j1 = min(j0 + nb, n);
+
+        // The columns c0:j1 of L that contribute below their diagonal. The
+        // first column of L is e_0, and it never does.
+        const idx_t c0 = max(j0, idx_t(2)) - 1;
+
+        // Left-looking factorization of the panel j0:j1. On entry, the
+        // columns j0:n of a hold the trailing matrix
+        //      S = A - L(:,0:j0) T(0:j0,0:j0) L(:,0:j0)^op,
+        // which is symmetric. Column j of the panel also needs the term
+        // T(j0-1,j0) that couples the previous columns with column j0.
+        // h[k] stores the contribution of column i = j0-1+k of L.
+        for (idx_t j = j0; j < j1; ++j) {
+            // h = H(j0-1:j+1,j) without the terms already in S
+            if (j0 > 0) h[hi(0)] = cj(a(j0, j0 - 1)) * cj(l(j, j0));
+            for (idx_t i = j0; i < j; ++i) {
+                T hk = a(i, i) * cj(l(j, i)) +
+                       cj(a(i + 1, i)) * cj(l(j, i + 1));
+                if (i > 0) hk += a(i, i - 1) * cj(l(j, i - 1));
+                h[hi(i - j0 + 1)] = hk;
+            }
+
+            // H(j,j) = S(j,j) - L(j,c0:j) h
+            T hjj = a(j, j);
+            if (c0 < j) {
+                hjj -= dotu(slice(A, mi(j), mr(c0 - 1, j - 1)),
+                            slice(h, hr(c0 - j0 + 1, j - j0 + 1)));
+            }
+            h[hi(j - j0 + 1)] = hjj;
+
+            // Diagonal of T
+            T tjj = (j > 0) ? hjj - a(j, j - 1) * cj(l(j, j - 1)) : hjj;
+            a(j, j) = herm ? T(real(tjj)) : tjj;
+
+            if (j + 1 == n) break;
+
+            // v = S(j+1:n,j) - L(j+1:n,c0:j+1) h
+            auto v = slice(A, mr(j + 1, n), mi(j));
+            if (c0 <= j) {
+                gemv(NO_TRANS, T(-1), slice(A, mr(j + 1, n), mr(c0 - 1, j)),
+                     slice(h, hr(c0 - j0 + 1, j - j0 + 2)), T(1), v);
+            }
+
+            // Pivot on the largest entry of v
+            const idx_t iv = iamax(v);
+            const idx_t p = upper ? n - 1 - iv : j + 1 + iv;
+            ipiv[mi(j + 1)] = (int)mi(p);
+            if (p != j + 1) internal::heswapr(a, idx_t(0), j + 1, p, n, herm);
+
+            // Subdiagonal of T and column j+1 of L
+            const T t = a(j + 1, j);
+            if (t != T(0) && j + 2 < n) {
+                auto lj = slice(A, mr(j + 2, n), mi(j));
+                rscl(t, lj);
+            }
+        }
+        if (j1 >= n) break;
+
+        // Update the trailing matrix,
+        //      S(j1:n,j1:n) -= X T(c0:j1,c0:j1) X^op,  X = L(j1:n,c0:j1),
+        // restricted to the entries of T that are not yet in S, i.e., all but
+        // T(j0-1,j0-1). With Y = X T, the diagonal blocks are updated with
+        // her2k resp. syr2k and the other blocks with gemm.
+        const idx_t m2 = n - j1;
+        const auto X = slice(A, mr(j1, n), mr(c0 - 1, j1 - 1));
+        auto [Y, work2] = reshape(work1, m2, j1 - c0);
+
+        // Column of X and Y that holds column c of L
+        auto pos = [&](idx_t c) { return upper ? j1 - 1 - c : c - c0; };
+        for (idx_t c = c0; c < j1; ++c) {
+            auto y = col(Y, pos(c));
+            copy(col(X, pos(c)), y);
+            scal((c + 1 == j0) ? T(0) : a(c, c), y);
+            if (c > c0) axpy(cj(a(c, c - 1)), col(X, pos(c - 1)), y);
+            if (c + 1 < j1) axpy(a(c + 1, c), col(X, pos(c + 1)), y);
+        }
+
+        auto S = slice(A, mr(j1, n), mr(j1, n));
+        internal::hetrf_update(uplo, herm, X, Y, S, nb);
+    }
+
+    return 0;
+}
+
+/** Computes the factorization of a symmetric or Hermitian matrix A using
+ * Aasen's algorithm.
+ *
+ * The factorization has the form
+ *      $P A P^T = U T U^{op},$ if uplo = Upper, or
+ *      $P A P^T = L T L^{op},$ if uplo = Lower,
+ * where L resp. U is unit lower resp. upper triangular, T is a symmetric or
+ * Hermitian tridiagonal matrix and P is a permutation matrix.
+ * If opts.invariant = Op::Trans then op=T,
+ * and if opts.invariant = Op::ConjTrans then op=H.
+ *
+ * The factorization is computed in panels of nb columns. Each panel is
+ * factored with a left-looking algorithm that needs the previous columns of
+ * the panel only, and updates each column with gemv. The trailing matrix is
+ * then updated with gemm, and its diagonal blocks with her2k resp. syr2k.
+ * This is where most of the work is done.
+ *
+ * If uplo = Lower, the first column of L is $e_0$. The diagonal and the
+ * subdiagonal of T overwrite the diagonal and the subdiagonal of A, and
+ * $L(i,k)$, $i > k > 0$, overwrites $A(i,k-1)$. P is the sequence of
+ * interchanges of rows and columns $i$ and $ipiv[i]$, applied for
+ * $i = 0, \dots, n-1$. If uplo = Upper, the factorization is computed on the
+ * matrix with rows and columns in reverse order. The last column of U is
+ * $e_{n-1}$, the superdiagonal of T overwrites the superdiagonal of A,
+ * $U(i,k)$, $i < k < n-1$, overwrites $A(i,k+1)$ and the interchanges are
+ * applied for $i = n-1, \dots, 0$.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the symmetric matrix A of size n-by-n.
+ *      On exit, the factors T and L or U, as described above.
+ *
+ * @param[out] ipiv Vector of size n. The interchanges described above.
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size.
+ *      - invariant: Op::Trans (symmetric) or Op::ConjTrans (Hermitian).
+ *
+ * @return 0: successful exit. The matrix T may be singular, which is reported
+ *      by the solver.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR ipiv_t>
+int hetrf_aa(uplo_t uplo,
+             matrix_t& A,
+             ipiv_t& ipiv,
+             const BlockedLDLOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetrf_aa_worksize<T>(A, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetrf_aa_work(uplo, A, ipiv, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRF_AA_HH
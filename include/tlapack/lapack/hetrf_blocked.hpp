@@ -133,7 +133,7 @@ int hetrf_blocked(uplo_t uplo,
 
     // Allocates workspace
     WorkInfo workinfo = hetrf_blocked_worksize<T>(A, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return hetrf_blocked_work(uplo, A, ipiv, work, opts);
@@ -0,0 +1,497 @@
+/// @file hetrf_rook.hpp Computes the factorization of a symmetric or Hermitian
+/// matrix A using the bounded Bunch-Kaufman (rook) diagonal pivoting method.
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrf_rook.f
+/// and @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlahef_rook.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRF_ROOK_HH
+#define TLAPACK_HETRF_ROOK_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/copy.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/her2k.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/blas/syr2k.hpp"
+#include "tlapack/lapack/hetrf_blocked.hpp"
+#include "tlapack/lapack/rscl.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Interchanges rows and columns r and s, r < s, of the trailing
+     * submatrix A(f:n,f:n) of a symmetric or Hermitian matrix.
+     *
+     * The matrix is accessed through a(i,j), i >= j, which returns a
+     * reference to the entry (i,j) of its lower triangle. The rows r and s of
+     * the columns f:r-1 are swapped as well.
+     */
+    template <class access_t, class idx_t>
+    void heswapr(access_t& a, idx_t f, idx_t r, idx_t s, idx_t n, bool herm)
+    {
+        using std::swap;
+        using T = std::decay_t<decltype(a(0, 0))>;
+
+        for (idx_t j = f; j < r; ++j)
+            swap(a(r, j), a(s, j));
+        for (idx_t i = r + 1; i < s; ++i) {
+            const T t = a(i, r);
+            a(i, r) = herm ? conj(a(s, i)) : a(s, i);
+            a(s, i) = herm ? conj(t) : t;
+        }
+        if (herm) a(s, r) = conj(a(s, r));
+        for (idx_t i = s + 1; i < n; ++i)
+            swap(a(i, r), a(i, s));
+        swap(a(r, r), a(s, s));
+    }
+
+    /** Updates the triangle uplo of the m-by-m symmetric or Hermitian matrix
+     *      C := C - X Y^{op},
+     * where $X Y^{op}$ is symmetric or Hermitian, e.g., $Y = X D$ for a
+     * symmetric or Hermitian D.
+     *
+     * The blocks of nb columns off the diagonal are updated with gemm, and the
+     * nb-by-nb diagonal blocks with her2k resp. syr2k, so that the other
+     * triangle of C is not computed.
+     */
+    template <TLAPACK_SMATRIX matrixX_t,
+              TLAPACK_SMATRIX matrixY_t,
+              TLAPACK_SMATRIX matrixC_t>
+    void hetrf_update(Uplo uplo,
+                      bool herm,
+                      const matrixX_t& X,
+                      const matrixY_t& Y,
+                      matrixC_t& C,
+                      size_type<matrixC_t> nb)
+    {
+        using T = type_t<matrixC_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrixC_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(C);
+        const idx_t k = ncols(X);
+        const Op op = herm ? Op::ConjTrans : Op::Trans;
+
+        for (idx_t c0 = 0; c0 < m; c0 += nb) {
+            const idx_t c1 = min(c0 + nb, m);
+            const auto Xd = slice(X, range{c0, c1}, range{0, k});
+            const auto Yd = slice(Y, range{c0, c1}, range{0, k});
+
+            auto Cd = slice(C, range{c0, c1}, range{c0, c1});
+            if (herm)
+                her2k(uplo, NO_TRANS, real_t(-0.5), Xd, Yd, real_t(1), Cd);
+            else
+                syr2k(uplo, NO_TRANS, real_t(-0.5), Xd, Yd, real_t(1), Cd);
+
+            if (uplo == Uplo::Lower && c1 < m) {
+                auto C21 = slice(C, range{c1, m}, range{c0, c1});
+                gemm(NO_TRANS, op, T(-1), slice(X, range{c1, m}, range{0, k}),
+                     Yd, T(1), C21);
+            }
+            else if (uplo == Uplo::Upper && c0 > 0) {
+                auto C12 = slice(C, range{0, c0}, range{c0, c1});
+                gemm(NO_TRANS, op, T(-1), slice(X, range{0, c0}, range{0, k}),
+                     Yd, T(1), C12);
+            }
+        }
+    }
+
+    /** Factors a panel of a symmetric or Hermitian matrix with the rook
+     * diagonal pivoting method, see hetrf_rook().
+     *
+     * The columns j0:k of L and D are computed, where k is returned. If the
+     * panel does not reach the last column, k - j0 is nb-1 or nb, with nb
+     * the number of columns of W. As in hetf3(), the panel keeps
+     * $W = L(:,j0:k) D(j0:k,j0:k)$, each candidate column is updated with
+     * gemv before it is searched, and the trailing matrix A(k:n,k:n) is
+     * updated at the end with hetrf_update().
+     *
+     * The interchanges are applied to the rows of the columns j0:k of L while
+     * the panel is factored, and undone afterwards. On exit, each column of L
+     * is stored as in the unblocked algorithm.
+     *
+     * @param[in] uplo Upper or Lower.
+     * @param[in,out] A n-by-n matrix, factored up to column j0.
+     * @param[in,out] ipiv Vector of size n.
+     * @param[in] j0 First column of the panel.
+     * @param W n-by-nb matrix, nb >= 2.
+     * @param x Vector of size nb.
+     * @param[in] herm True if A is Hermitian, false if it is symmetric.
+     * @param[in,out] info Set to j+1 if the column j of the panel is zero and
+     *      info is zero on entry.
+     */
+    template <TLAPACK_SMATRIX matrix_t,
+              TLAPACK_VECTOR ipiv_t,
+              TLAPACK_SMATRIX matrixW_t,
+              TLAPACK_SVECTOR vector_t>
+    size_type<matrix_t> hetrf_rook_panel(Uplo uplo,
+                                         matrix_t& A,
+                                         ipiv_t& ipiv,
+                                         size_type<matrix_t> j0,
+                                         matrixW_t& W,
+                                         vector_t& x,
+                                         bool herm,
+                                         int& info)
+    {
+        using T = type_t<matrix_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // Constants
+        const idx_t n = nrows(A);
+        const idx_t nb = ncols(W);
+        const bool upper = (uplo == Uplo::Upper);
+        const bool last = (n - j0 <= nb);
+        const real_t alpha = (real_t(1) + sqrt(real_t(17))) / real_t(8);
+
+        // The upper triangle is factored as the lower triangle of the matrix
+        // whose rows and columns are in reverse order. Rows and columns of W,
+        // and entries of x, are reversed as well, so that slices of A, W and
+        // x are consistent operands for the BLAS.
+        auto mi = [&](idx_t i) { return upper ? n - 1 - i : i; };
+        auto mr = [&](idx_t i0, idx_t i1) {
+            return upper ? range{n - i1, n - i0} : range{i0, i1};
+        };
+        auto wi = [&](idx_t c) { return upper ? nb - 1 - c : c; };
+        auto wr = [&](idx_t c0, idx_t c1) {
+            return upper ? range{nb - c1, nb - c0} : range{c0, c1};
+        };
+        auto a = [&](idx_t i, idx_t j) -> T& { return A(mi(i), mi(j)); };
+        auto w = [&](idx_t i, idx_t c) -> T& { return W(mi(i), wi(c)); };
+        auto setpiv = [&](idx_t k, idx_t p, bool twobytwo) {
+            const int pp = (int)mi(p);
+            ipiv[mi(k)] = twobytwo ? -pp - 1 : pp;
+        };
+        auto getpiv = [&](idx_t k) {
+            const int p = ipiv[mi(k)];
+            return mi((idx_t)((p < 0) ? -p - 1 : p));
+        };
+        auto cj = [herm](const T& t) { return herm ? conj(t) : t; };
+        auto absdiag = [herm](const T& t) {
+            return herm ? abs(real(t)) : abs1(t);
+        };
+
+        // Row of the largest entry of w(r0:r1,c)
+        auto wmax = [&](idx_t r0, idx_t r1, idx_t c) {
+            const idx_t i = iamax(slice(W, mr(r0, r1), wi(c)));
+            return upper ? r1 - 1 - i : r0 + i;
+        };
+
+        // w(k:n,c) -= L(k:n,j0:k) w(r,0:k-j0)^op
+        auto update = [&](idx_t k, idx_t r, idx_t c) {
+            const idx_t kw = k - j0;
+            if (kw == 0) return;
+            for (idx_t q = 0; q < kw; ++q)
+                x[wi(q)] = cj(w(r, q));
+            auto y = slice(W, mr(k, n), wi(c));
+            gemv(NO_TRANS, T(-1), slice(A, mr(k, n), mr(j0, k)),
+                 slice(x, wr(0, kw)), T(1), y);
+        };
+
+        // Swaps the rows r and s of w(:,0:nc)
+        auto swapw = [&](idx_t r, idx_t s, idx_t nc) {
+            auto wr1 = slice(W, mi(r), wr(0, nc));
+            auto wr2 = slice(W, mi(s), wr(0, nc));
+            tlapack::swap(wr1, wr2);
+        };
+
+        idx_t k = j0;
+        while (k < n && (last || k - j0 + 1 < nb)) {
+            const idx_t kw = k - j0;
+            idx_t kstep = 1;
+            idx_t p = k;
+            idx_t kp = k;
+
+            // Updated column k in w(:,kw)
+            auto wk = slice(W, mr(k, n), wi(kw));
+            copy(slice(A, mr(k, n), mi(k)), wk);
+            update(k, k, kw);
+            if (herm) w(k, kw) = real(w(k, kw));
+
+            // Largest off-diagonal entry in column k
+            const real_t absakk = absdiag(w(k, kw));
+            idx_t imax = (k + 1 < n) ? wmax(k + 1, n, kw) : k;
+            real_t colmax = (k + 1 < n) ? abs1(w(imax, kw)) : real_t(0);
+
+            const bool zero = (max(absakk, colmax) == real_t(0));
+            if (zero) {
+                // Column k is zero
+                if (info == 0) info = k + 1;
+            }
+            else if (absakk < alpha * colmax) {
+                // Rook search: stop at an entry that is the largest in its
+                // row and column, or at a 1-by-1 pivot on the diagonal.
+                // w(:,kw+1) holds the updated column imax, and w(:,kw) the
+                // updated column p.
+                while (true) {
+                    auto w1 = slice(W, mr(k, imax), wi(kw + 1));
+                    copy(slice(A, mi(imax), mr(k, imax)), w1);
+                    if (herm) {
+                        for (idx_t i = k; i < imax; ++i)
+                            w(i, kw + 1) = conj(w(i, kw + 1));
+                    }
+                    auto w2 = slice(W, mr(imax, n), wi(kw + 1));
+                    copy(slice(A, mr(imax, n), mi(imax)), w2);
+                    update(k, imax, kw + 1);
+                    if (herm) w(imax, kw + 1) = real(w(imax, kw + 1));
+
+                    idx_t jmax = wmax(k, imax, kw + 1);
+                    real_t rowmax = abs1(w(jmax, kw + 1));
+                    if (imax + 1 < n) {
+                        const idx_t i = wmax(imax + 1, n, kw + 1);
+                        if (abs1(w(i, kw + 1)) > rowmax) {
+                            rowmax = abs1(w(i, kw + 1));
+                            jmax = i;
+                        }
+                    }
+
+                    const bool pivot1 =
+                        !(absdiag(w(imax, kw + 1)) < alpha * rowmax);
+                    if (!pivot1 && (p == jmax || rowmax <= colmax)) {
+                        kp = imax;
+                        kstep = 2;
+                        break;
+                    }
+                    auto w0 = slice(W, mr(k, n), wi(kw));
+                    copy(slice(W, mr(k, n), wi(kw + 1)), w0);
+                    if (pivot1) {
+                        kp = imax;
+                        break;
+                    }
+                    p = imax;
+                    colmax = rowmax;
+                    imax = jmax;
+                }
+            }
+
+            // Interchanges in the trailing matrix, in the rows of L(:,j0:k)
+            // and in the rows of W
+            const idx_t kk = k + kstep - 1;
+            if (kstep == 2 && p != k) {
+                heswapr(a, j0, k, p, n, herm);
+                swapw(k, p, kw + kstep);
+            }
+            if (kp != kk) {
+                heswapr(a, j0, kk, kp, n, herm);
+                swapw(kk, kp, kw + kstep);
+            }
+
+            if (kstep == 1) {
+                // 1-by-1 pivot block D(k)
+                auto ak = slice(A, mr(k, n), mi(k));
+                copy(slice(W, mr(k, n), wi(kw)), ak);
+                if (herm) a(k, k) = real(a(k, k));
+                if (!zero && k + 1 < n) {
+                    auto lk = slice(A, mr(k + 1, n), mi(k));
+                    rscl(herm ? real(a(k, k)) : a(k, k), lk);
+                }
+                setpiv(k, kp, false);
+            }
+            else {
+                // 2-by-2 pivot block D(k:k+1). The inverse of D is computed
+                // after scaling by its off-diagonal entry, which is the
+                // largest entry of D.
+                const T d21 = w(k + 1, kw);
+                const T d11 = w(k + 1, kw + 1) / d21;
+                const T d22 = w(k, kw) / cj(d21);
+                const T e21 = T(1) / (d11 * d22 - T(1)) / d21;
+                for (idx_t j = k + 2; j < n; ++j) {
+                    a(j, k) = cj(e21) * (d11 * w(j, kw) - w(j, kw + 1));
+                    a(j, k + 1) = e21 * (d22 * w(j, kw + 1) - w(j, kw));
+                }
+                a(k, k) = herm ? T(real(w(k, kw))) : w(k, kw);
+                a(k + 1, k) = d21;
+                a(k + 1, k + 1) =
+                    herm ? T(real(w(k + 1, kw + 1))) : w(k + 1, kw + 1);
+                setpiv(k, p, true);
+                setpiv(k + 1, kp, true);
+            }
+
+            k += kstep;
+        }
+
+        // Update the trailing matrix,
+        //      A(k:n,k:n) -= L(k:n,j0:k) W(k:n,0:k-j0)^op
+        if (k < n) {
+            auto A22 = slice(A, mr(k, n), mr(k, n));
+            hetrf_update(uplo, herm, slice(A, mr(k, n), mr(j0, k)),
+                         slice(W, mr(k, n), wr(0, k - j0)), A22, nb);
+        }
+
+        // Undo the interchanges of the rows of L(:,j0:k), in reverse order,
+        // so that each column keeps the interchanges applied before it was
+        // computed only
+        auto swapl = [&](idx_t r, idx_t s, idx_t j1) {
+            if (r == s || j1 == j0) return;
+            auto lr = slice(A, mi(r), mr(j0, j1));
+            auto ls = slice(A, mi(s), mr(j0, j1));
+            tlapack::swap(lr, ls);
+        };
+        for (idx_t j = k; j > j0;) {
+            const idx_t jj = j - 1;
+            if (ipiv[mi(jj)] >= 0) {
+                j = jj;
+                swapl(jj, getpiv(jj), j);
+            }
+            else {
+                j = jj - 1;
+                swapl(jj, getpiv(jj), j);
+                swapl(jj - 1, getpiv(jj - 1), j);
+            }
+        }
+
+        return k;
+    }
+
+}  // namespace internal
+
+/** Worspace query of hetrf_rook()
+ *
+ * @param[in] A n-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t>
+constexpr WorkInfo hetrf_rook_worksize(const matrix_t& A,
+                                       const BlockedLDLOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = nrows(A);
+    const idx_t nb = max(idx_t(2), min((idx_t)opts.nb, n));
+
+    if constexpr (is_same_v<T, type_t<matrix_t>>)
+        return (n > 0) ? WorkInfo((n + 1) * nb) : WorkInfo(0);
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief hetrf_rook()
+ * Workspace is provided as an argument.
+ * @copydetails hetrf_rook()
+ *
+ * @param work Workspace. Use the workspace query to determine the size
+ * needed.
+ *
+ * @ingroup workspace
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR ipiv_t,
+          TLAPACK_WORKSPACE work_t>
+int hetrf_rook_work(uplo_t uplo,
+                    matrix_t& A,
+                    ipiv_t& ipiv,
+                    work_t& work,
+                    const BlockedLDLOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nb = max(idx_t(2), min((idx_t)opts.nb, n));
+    const bool herm = (opts.invariant == Op::ConjTrans);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check((idx_t)size(ipiv) >= n);
+    tlapack_check(opts.invariant == Op::Trans ||
+                  opts.invariant == Op::ConjTrans);
+
+    // Quick return
+    if (n == 0) return 0;
+
+    auto [W, work1] = reshape(work, n, nb);
+    auto [x, work2] = reshape(work1, nb);
+
+    int info = 0;
+    for (idx_t j0 = 0; j0 < n;)
+        j0 = internal::hetrf_rook_panel(uplo, A, ipiv, j0, W, x, herm, info);
+
+    return info;
+}
+
+/** Computes the factorization of a symmetric or Hermitian matrix A using the
+ * bounded Bunch-Kaufman (rook) diagonal pivoting method.
+ *
+ * The factorization has the same form as the one from hetrf_blocked(),
+ *      $A = U D U^{op},$ if uplo = Upper, or
+ *      $A = L D L^{op},$ if uplo = Lower,
+ * but the pivot search continues along rows and columns until it finds an
+ * entry that is the largest in both its row and its column. This bounds the
+ * entries of L resp. U by $1/(1-\alpha) \approx 2.78$, where
+ * $\alpha = (1+\sqrt{17})/8$, which is not the case in the Bunch-Kaufman
+ * method.
+ *
+ * The matrix is factored in panels of nb columns. The candidate columns of
+ * the pivot search are updated with gemv within a panel, and the trailing
+ * matrix is updated with gemm after each panel.
+ *
+ * A 2-by-2 pivot block may need two interchanges. If uplo = Lower and D has a
+ * 2-by-2 block at the diagonals $i,i+1$, then rows and columns $i$ and
+ * $-ipiv[i]-1$ were interchanged, and then rows and columns $i+1$ and
+ * $-ipiv[i+1]-1$ were interchanged. If uplo = Upper and the block is at the
+ * diagonals $i-1,i$, the interchanges are $i$ with $-ipiv[i]-1$, and then
+ * $i-1$ with $-ipiv[i-1]-1$. 1-by-1 pivots are stored as in hetrf_blocked().
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the symmetric matrix A of size n-by-n.
+ *      On exit, the factors $D$ and $U$ or $L$, stored with the upper or
+ *      lower triangular parts of the blocks of $D$ at the same positions of
+ *      $U$ or $L$.
+ *
+ * @param[out] ipiv Vector of size n. The interchanges described above.
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size. Values below 2 are treated as 2.
+ *      - invariant: Op::Trans (symmetric) or Op::ConjTrans (Hermitian).
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if $D(i-1,i-1)$ is exactly zero.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR ipiv_t>
+int hetrf_rook(uplo_t uplo,
+               matrix_t& A,
+               ipiv_t& ipiv,
+               const BlockedLDLOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetrf_rook_worksize<T>(A, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetrf_rook_work(uplo, A, ipiv, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRF_ROOK_HH
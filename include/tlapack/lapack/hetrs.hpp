@@ -0,0 +1,346 @@
+/// @file hetrs.hpp Solves a symmetric or Hermitian linear system using the
+/// factorization computed by hetrf().
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrs.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrs_rook.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrs_aa.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRS_HH
+#define TLAPACK_HETRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/hetrf.hpp"
+#include "tlapack/lapack/laswp.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Solves the tridiagonal system T X = B using Gaussian elimination with
+     * partial pivoting, as in LAPACK's xGTSV.
+     *
+     * On entry, dl, d and du are the subdiagonal, diagonal and superdiagonal
+     * of T. On exit, they are overwritten by the factor U, and dl holds its
+     * second superdiagonal.
+     *
+     * @return 0: successful exit.
+     * @return i, 0 < i <= n, if U(i-1,i-1) is exactly zero.
+     */
+    template <TLAPACK_SVECTOR dl_t,
+              TLAPACK_SVECTOR d_t,
+              TLAPACK_SVECTOR du_t,
+              TLAPACK_SMATRIX matrixB_t>
+    int gtsv_pivoted(dl_t& dl, d_t& d, du_t& du, matrixB_t& B)
+    {
+        using T = type_t<matrixB_t>;
+        using idx_t = size_type<matrixB_t>;
+
+        const idx_t n = size(d);
+        const idx_t nrhs = ncols(B);
+
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            if (abs1(d[i]) >= abs1(dl[i])) {
+                // No row interchange required
+                if (d[i] == T(0)) return i + 1;
+                const T fact = dl[i] / d[i];
+                d[i + 1] -= fact * du[i];
+                for (idx_t j = 0; j < nrhs; ++j)
+                    B(i + 1, j) -= fact * B(i, j);
+                dl[i] = T(0);
+            }
+            else {
+                // Interchange rows i and i+1
+                const T fact = d[i] / dl[i];
+                d[i] = dl[i];
+                const T temp = d[i + 1];
+                d[i + 1] = du[i] - fact * temp;
+                if (i + 2 < n) {
+                    dl[i] = du[i + 1];
+                    du[i + 1] = -fact * dl[i];
+                }
+                else
+                    dl[i] = T(0);
+                du[i] = temp;
+                for (idx_t j = 0; j < nrhs; ++j) {
+                    const T aux = B(i, j);
+                    B(i, j) = B(i + 1, j);
+                    B(i + 1, j) = aux - fact * B(i + 1, j);
+                }
+            }
+        }
+        if (d[n - 1] == T(0)) return n;
+
+        // Back substitution with U
+        for (idx_t j = 0; j < nrhs; ++j) {
+            B(n - 1, j) /= d[n - 1];
+            if (n > 1) {
+                B(n - 2, j) -= du[n - 2] * B(n - 1, j);
+                B(n - 2, j) /= d[n - 2];
+                for (idx_t i = n - 2; i-- > 0;) {
+                    B(i, j) -= du[i] * B(i + 1, j) + dl[i] * B(i + 2, j);
+                    B(i, j) /= d[i];
+                }
+            }
+        }
+
+        return 0;
+    }
+
+}  // namespace internal
+
+/** Worspace query of hetrs()
+ *
+ * @param[in] A n-by-n matrix.
+ * @param[in] B n-by-nrhs matrix.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrixA_t, TLAPACK_SMATRIX matrixB_t>
+constexpr WorkInfo hetrs_worksize(const matrixA_t& A,
+                                  const matrixB_t& B,
+                                  const HetrfOpts& opts = {})
+{
+    if (opts.variant == HetrfVariant::Aasen && is_same_v<T, type_t<matrixA_t>>)
+        return WorkInfo(3 * nrows(A));
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief hetrs()
+ * Workspace is provided as an argument.
+ * @copydetails hetrs()
+ *
+ * @param work Workspace. Use the workspace query to determine the size
+ * needed.
+ *
+ * @ingroup workspace
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_VECTOR ipiv_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_WORKSPACE work_t>
+int hetrs_work(uplo_t uplo,
+               const matrixA_t& A,
+               const ipiv_t& ipiv,
+               matrixB_t& B,
+               work_t& work,
+               const HetrfOpts& opts = {})
+{
+    using T = type_t<matrixB_t>;
+    using idx_t = size_type<matrixA_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+    const bool upper = (uplo == Uplo::Upper);
+    const bool herm = (opts.invariant == Op::ConjTrans);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(ncols(A) == n);
+    tlapack_check((idx_t)size(ipiv) >= n);
+    tlapack_check(nrows(B) == n);
+    tlapack_check(opts.invariant == Op::Trans ||
+                  opts.invariant == Op::ConjTrans);
+    tlapack_check(opts.variant == HetrfVariant::Blocked ||
+                  opts.variant == HetrfVariant::Rook ||
+                  opts.variant == HetrfVariant::Aasen);
+
+    // Quick return
+    if (n == 0 || nrhs == 0) return 0;
+
+    auto cj = [herm](const T& x) { return herm ? conj(x) : x; };
+
+    if (opts.variant == HetrfVariant::Aasen) {
+        // Solve A X = B with P A P^T = L T L^op or P A P^T = U T U^op
+        auto [dl, work1] = reshape(work, n - 1);
+        auto [d, work2] = reshape(work1, n);
+        auto [du, work3] = reshape(work2, n - 1);
+        const auto diag = [&](idx_t i) -> T {
+            return herm ? T(real(A(i, i))) : A(i, i);
+        };
+
+        if (upper) {
+            const auto U = slice(A, range{0, n - 1}, range{1, n});
+            auto B1 = rows(B, range{0, n - 1});
+
+            laswp(BACKWARD, B, ipiv);
+            trsm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), U, B1);
+            for (idx_t i = 0; i + 1 < n; ++i) {
+                du[i] = A(i, i + 1);
+                dl[i] = cj(A(i, i + 1));
+            }
+            for (idx_t i = 0; i < n; ++i)
+                d[i] = diag(i);
+            int info = internal::gtsv_pivoted(dl, d, du, B);
+            if (info != 0) return info;
+            trsm(LEFT_SIDE, UPPER_TRIANGLE, opts.invariant, UNIT_DIAG, T(1), U,
+                 B1);
+            laswp(FORWARD, B, ipiv);
+        }
+        else {
+            const auto L = slice(A, range{1, n}, range{0, n - 1});
+            auto B1 = rows(B, range{1, n});
+
+            laswp(FORWARD, B, ipiv);
+            trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), L, B1);
+            for (idx_t i = 0; i + 1 < n; ++i) {
+                dl[i] = A(i + 1, i);
+                du[i] = cj(A(i + 1, i));
+            }
+            for (idx_t i = 0; i < n; ++i)
+                d[i] = diag(i);
+            int info = internal::gtsv_pivoted(dl, d, du, B);
+            if (info != 0) return info;
+            trsm(LEFT_SIDE, LOWER_TRIANGLE, opts.invariant, UNIT_DIAG, T(1), L,
+                 B1);
+            laswp(BACKWARD, B, ipiv);
+        }
+
+        return 0;
+    }
+
+    // Bunch-Kaufman and rook pivoting. The upper triangle is used as the
+    // lower triangle of the matrix whose rows and columns are in reverse
+    // order, see hetrf_rook().
+    const bool rook = (opts.variant == HetrfVariant::Rook);
+    auto a = [&](idx_t i, idx_t j) -> T {
+        return upper ? A(n - 1 - i, n - 1 - j) : A(i, j);
+    };
+    auto b = [&](idx_t i, idx_t j) -> T& {
+        return upper ? B(n - 1 - i, j) : B(i, j);
+    };
+    auto twobytwo = [&](idx_t k) { return ipiv[upper ? n - 1 - k : k] < 0; };
+    auto swaprows = [&](idx_t k) {
+        int p = ipiv[upper ? n - 1 - k : k];
+        if (p < 0) p = -p - 1;
+        const idx_t pp = upper ? n - 1 - (idx_t)p : (idx_t)p;
+        if (pp != k) {
+            for (idx_t j = 0; j < nrhs; ++j) {
+                const T aux = b(k, j);
+                b(k, j) = b(pp, j);
+                b(pp, j) = aux;
+            }
+        }
+    };
+
+    // Solve L D Y = B
+    for (idx_t k = 0; k < n;) {
+        if (!twobytwo(k)) {
+            swaprows(k);
+            const T dk = herm ? T(real(a(k, k))) : a(k, k);
+            for (idx_t j = 0; j < nrhs; ++j) {
+                const T bk = b(k, j);
+                for (idx_t i = k + 1; i < n; ++i)
+                    b(i, j) -= a(i, k) * bk;
+                b(k, j) = bk / dk;
+            }
+            k += 1;
+        }
+        else {
+            // In the Bunch-Kaufman method, only row k+1 is interchanged
+            if (rook) swaprows(k);
+            swaprows(k + 1);
+            const T d21 = a(k + 1, k);
+            const T d11 = a(k, k) / cj(d21);
+            const T d22 = a(k + 1, k + 1) / d21;
+            const T denom = d11 * d22 - T(1);
+            for (idx_t j = 0; j < nrhs; ++j) {
+                const T b1 = b(k, j);
+                const T b2 = b(k + 1, j);
+                for (idx_t i = k + 2; i < n; ++i)
+                    b(i, j) -= a(i, k) * b1 + a(i, k + 1) * b2;
+                const T bk = b1 / cj(d21);
+                const T bkp1 = b2 / d21;
+                b(k, j) = (d22 * bk - bkp1) / denom;
+                b(k + 1, j) = (d11 * bkp1 - bk) / denom;
+            }
+            k += 2;
+        }
+    }
+
+    // Solve L^op X = Y
+    for (idx_t k = n; k > 0;) {
+        const idx_t kstep = twobytwo(k - 1) ? 2 : 1;
+        for (idx_t j = 0; j < nrhs; ++j) {
+            for (idx_t kk = k - kstep; kk < k; ++kk) {
+                T s = b(kk, j);
+                for (idx_t i = k; i < n; ++i)
+                    s -= cj(a(i, kk)) * b(i, j);
+                b(kk, j) = s;
+            }
+        }
+        swaprows(k - 1);
+        if (kstep == 2 && rook) swaprows(k - 2);
+        k -= kstep;
+    }
+
+    return 0;
+}
+
+/** Solves a symmetric or Hermitian linear system A X = B using the
+ * factorization computed by hetrf().
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: The factorization is $A = U D U^{op}$ or
+ *        $P A P^T = U T U^{op}$;
+ *      - Uplo::Lower: The factorization is $A = L D L^{op}$ or
+ *        $P A P^T = L T L^{op}$.
+ *
+ * @param[in] A n-by-n matrix.
+ *      The factors computed by hetrf() with the same options.
+ *
+ * @param[in] ipiv Vector of size n. The interchanges computed by hetrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit, the solution X.
+ *
+ * @param[in] opts Options. Must be the ones used in hetrf().
+ *      - variant: Blocked, Rook or Aasen;
+ *      - invariant: Op::Trans (symmetric) or Op::ConjTrans (Hermitian).
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the tridiagonal matrix T of Aasen's factorization
+ *      is exactly singular. In this case, the solution could not be computed.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_VECTOR ipiv_t,
+          TLAPACK_SMATRIX matrixB_t>
+int hetrs(uplo_t uplo,
+          const matrixA_t& A,
+          const ipiv_t& ipiv,
+          matrixB_t& B,
+          const HetrfOpts& opts = {})
+{
+    using T = type_t<matrixB_t>;
+
+    // Functor
+    Create<matrixA_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetrs_worksize<T>(A, B, opts);
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetrs_work(uplo, A, ipiv, B, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRS_HH
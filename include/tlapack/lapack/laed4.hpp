@@ -606,10 +606,11 @@ int laed4(
             }
             zz[1] = z[ii] * z[ii];
 
-            std::vector<real_t> sub(delta.begin() + iim1, delta.end());
+            std::vector<real_t> sub{delta[iim1], delta[iim1 + 1],
+                                    delta[iim1 + 2]};
             info = laed6(niter, orgati, c, sub, zz, w, eta);
 
-            if (info == 0) {
+            if (info != 0) {
                 return info;
             }
         }
@@ -792,10 +793,11 @@ int laed4(
                     }
                 }
 
-                std::vector<real_t> sub(delta.begin() + iim1, delta.end());
+                std::vector<real_t> sub{delta[iim1], delta[iim1 + 1],
+                                        delta[iim1 + 2]};
                 info = laed6(niter, orgati, c, sub, zz, w, eta);
 
-                if (info == 0) {
+                if (info != 0) {
                     return info;
                 }
             }
@@ -64,6 +64,10 @@ namespace tlapack {
  *      On exit, the orthogonal updates applied to A are accumulated
  *      into Z.
  *
+ * @note If A is a 2x2 matrix with sizes known at compile time, e.g., an
+ *      mdspan with static extents or a fixed-size Eigen matrix, the Schur
+ *      factorization is computed directly by lahqr_schur22().
+ *
  * @ingroup auxiliary
  */
 template <TLAPACK_CSMATRIX matrix_t,
@@ -109,6 +113,24 @@ int lahqr(bool want_t,
     if (nh <= 0) return 0;
     if (nh == 1) w[ilo] = A(ilo, ilo);
 
+    // 2x2 matrices with sizes known at compile time are standardized directly
+    if constexpr (static_nrows<matrix_t> == 2 && static_ncols<matrix_t> == 2) {
+        if (nh == 2) {
+            real_t cs;
+            TA sn;
+            complex_type<TA> w0, w1;
+            lahqr_schur22(A(0, 0), A(0, 1), A(1, 0), A(1, 1), w0, w1, cs, sn);
+            w[0] = w0;
+            w[1] = w1;
+            if (want_z) {
+                auto x = col(Z, 0);
+                auto y = col(Z, 1);
+                rot(x, y, cs, sn);
+            }
+            return 0;
+        }
+    }
+
     // itmax is the total number of QR iterations allowed.
     // For most matrices, 3 shifts per eigenvalue is enough, so
     // we set itmax to 30 times nh as a safe limit.
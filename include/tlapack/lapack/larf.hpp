@@ -293,7 +293,7 @@ void larf(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = larf_worksize<T>(side, storeMode, x, tau, C0, C1);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return larf_work(side, storeMode, x, tau, C0, C1, work);
@@ -525,7 +525,7 @@ void larf(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = larf_worksize<T>(side, direction, storeMode, v, tau, C);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return larf_work(side, direction, storeMode, v, tau, C, work);
@@ -538,7 +538,7 @@ int larfb(side_t side,
     // Allocates workspace
     WorkInfo workinfo =
         larfb_worksize<T>(side, trans, direction, storeMode, V, Tmatrix, C);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return larfb_work(side, trans, direction, storeMode, V, Tmatrix, C, work);
@@ -0,0 +1,95 @@
+/// @file laswp.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlaswp.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASWP_HH
+#define TLAPACK_LASWP_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for laswp()
+struct LaswpOpts {
+    /// Columns per block. 0: tuned value, see tuned_option(). Values
+    /// nb >= ncols(A), e.g., std::numeric_limits<size_t>::max(), interchange
+    /// whole rows at once.
+    size_t nb = 0;
+};
+
+/** Performs a sequence of row interchanges on a matrix A.
+ *
+ * Row i of A is interchanged with row piv[i] for each i = 0,...,k-1, where
+ * k is the size of piv. The interchanges are applied to blocks of nb
+ * columns at a time, so that all the interchanges in a block are done while
+ * its columns are in cache. This is much faster than swapping one full row
+ * at a time when A is column major and has many columns.
+ *
+ * @param[in] direction
+ *      - Direction::Forward: apply the interchanges for i = 0,...,k-1.
+ *        This is P^T A if P is the permutation of the LU factorization
+ *        P A = L U computed by getrf().
+ *      - Direction::Backward: apply the interchanges for i = k-1,...,0.
+ *        This is P A.
+ *
+ * @param[in,out] A m-by-n matrix.
+ *
+ * @param[in] piv Vector of size k <= m.
+ *      The pivot indices in the format of getrf(), i.e., i <= piv[i] < m.
+ *
+ * @param[in] opts Options.
+ *      - nb: Number of columns of A in each block.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_DIRECTION direction_t,
+          TLAPACK_MATRIX matrix_t,
+          TLAPACK_VECTOR piv_t>
+void laswp(direction_t direction,
+           matrix_t& A,
+           const piv_t& piv,
+           const LaswpOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+
+    // constants
+    const idx_t n = ncols(A);
+    const idx_t k = size(piv);
+    const size_t nb_opt = tuned_option<T>(opts.nb, "laswp", "nb", n, 32);
+    const idx_t nb = (nb_opt < (size_t)n) ? (idx_t)nb_opt : n;
+
+    // check arguments
+    tlapack_check_false(direction != Direction::Forward &&
+                        direction != Direction::Backward);
+    tlapack_check_false(k > nrows(A));
+
+    // Quick return
+    if (n == 0 || k == 0) return;
+
+    for (idx_t j0 = 0; j0 < n; j0 += nb) {
+        const idx_t j1 = min(j0 + nb, n);
+        for (idx_t ii = 0; ii < k; ++ii) {
+            const idx_t i = (direction == Direction::Forward) ? ii : k - 1 - ii;
+            const idx_t p = piv[i];
+            if (p != i) {
+                for (idx_t j = j0; j < j1; ++j) {
+                    const T aux = A(i, j);
+                    A(i, j) = A(p, j);
+                    A(p, j) = aux;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASWP_HH
@@ -0,0 +1,255 @@
+/// @file latrd.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlatrd.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LATRD_HH
+#define TLAPACK_LATRD_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/hemv.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Computes y := A x, where A is Hermitian, splitting the rows of y in
+     * blocks that are computed independently according to exec.
+     *
+     * The block of rows r0:r1 of A is formed from the diagonal block
+     * A(r0:r1,r0:r1) and from the blocks of the triangle referenced by uplo
+     * in the same rows and columns. With a sequential policy, this is a single
+     * call to hemv().
+     */
+    template <TLAPACK_SMATRIX A_t,
+              TLAPACK_SVECTOR x_t,
+              TLAPACK_SVECTOR y_t,
+              class uplo_t>
+    void latrd_hemv(uplo_t uplo,
+                    const A_t& A,
+                    const x_t& x,
+                    y_t& y,
+                    const ExecutionPolicy& exec)
+    {
+        using T = type_t<A_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<A_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const real_t one(1);
+        const real_t zero(0);
+        const idx_t n = nrows(A);
+
+        parallel_for_blocks(exec, n, idx_t(64), [&](idx_t r0, idx_t r1) {
+            auto yr = slice(y, range{r0, r1});
+            hemv(uplo, one, slice(A, range{r0, r1}, range{r0, r1}),
+                 slice(x, range{r0, r1}), zero, yr);
+            if (uplo == Uplo::Lower) {
+                if (r0 > 0)
+                    gemv(NO_TRANS, one, slice(A, range{r0, r1}, range{0, r0}),
+                         slice(x, range{0, r0}), one, yr);
+                if (r1 < n)
+                    gemv(CONJ_TRANS, one,
+                         slice(A, range{r1, n}, range{r0, r1}),
+                         slice(x, range{r1, n}), one, yr);
+            }
+            else {
+                if (r0 > 0)
+                    gemv(CONJ_TRANS, one,
+                         slice(A, range{0, r0}, range{r0, r1}),
+                         slice(x, range{0, r0}), one, yr);
+                if (r1 < n)
+                    gemv(NO_TRANS, one, slice(A, range{r0, r1}, range{r1, n}),
+                         slice(x, range{r1, n}), one, yr);
+            }
+        });
+    }
+
+}  // namespace internal
+
+/** Reduces nb rows and columns of a Hermitian matrix A to real symmetric
+ * tridiagonal form by a unitary similarity transformation Q**H * A * Q, and
+ * returns the matrix W which is needed to apply the transformation to the
+ * unreduced part of A.
+ *
+ * If uplo = Uplo::Upper, reduces the last nb rows and columns of A. If
+ * uplo = Uplo::Lower, reduces the first nb rows and columns of A. The
+ * unreduced part of A can then be updated with
+ * \[
+ *          A := A - V * W**H - W * V**H,
+ * \]
+ * where V contains the Householder vectors. This is done by hetrd().
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the nb reduced columns contain the elementary reflectors. The
+ *      off-diagonal elements of the tridiagonal matrix are stored in e, and
+ *      their positions in A are set to one.
+ *
+ * @param[out] e Vector of length n-1.
+ *      If uplo = Uplo::Upper, e[n-nb-1:n-1] contains the off-diagonal
+ *      elements of the last nb columns of the tridiagonal matrix.
+ *      If uplo = Uplo::Lower, e[0:nb] contains the off-diagonal elements of
+ *      the first nb columns of the tridiagonal matrix.
+ *
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors, stored in the same
+ *      positions as e.
+ *
+ * @param[out] W n-by-nb matrix.
+ *      The matrix W used to update the unreduced part of A.
+ *
+ * @param[in] exec Execution policy of the products by the Hermitian matrix,
+ *      which are split by blocks of rows.
+ *
+ * @return 0 if success
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_SVECTOR e_t,
+          TLAPACK_SVECTOR tau_t,
+          TLAPACK_SMATRIX W_t,
+          class uplo_t>
+int latrd(uplo_t uplo,
+          A_t& A,
+          e_t& e,
+          tau_t& tau,
+          W_t& W,
+          const ExecutionPolicy& exec = {})
+{
+    using T = type_t<A_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const real_t zero(0);
+    const real_t half(0.5);
+    const idx_t n = nrows(A);
+    const idx_t nb = ncols(W);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(nrows(W) == n);
+    tlapack_check(nb <= n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if (uplo == Uplo::Upper) {
+        // Reduce last nb columns of upper triangle
+        for (idx_t i = n - 1; i + nb >= n && i != idx_t(-1); --i) {
+            const idx_t iw = i + nb - n;
+
+            if (i + 1 < n) {
+                // Update A(0:i+1,i)
+                A(i, i) = real(A(i, i));
+                auto ai = slice(A, range{0, i + 1}, range{i, i + 1});
+                gemm(NO_TRANS, CONJ_TRANS, -one,
+                     slice(A, range{0, i + 1}, range{i + 1, n}),
+                     slice(W, range{i, i + 1}, range{iw + 1, nb}), one, ai);
+                gemm(NO_TRANS, CONJ_TRANS, -one,
+                     slice(W, range{0, i + 1}, range{iw + 1, nb}),
+                     slice(A, range{i, i + 1}, range{i + 1, n}), one, ai);
+                A(i, i) = real(A(i, i));
+            }
+
+            if (i > 0) {
+                // Generate elementary reflector H(i-1) to annihilate
+                // A(0:i-1,i)
+                auto v = slice(A, range{0, i}, i);
+                larfg(BACKWARD, COLUMNWISE_STORAGE, v, tau[i - 1]);
+                e[i - 1] = real(v[i - 1]);
+                v[i - 1] = one;
+
+                // Compute W(0:i,iw)
+                auto w = slice(W, range{0, i}, iw);
+                internal::latrd_hemv(UPPER_TRIANGLE,
+                                     slice(A, range{0, i}, range{0, i}), v, w,
+                                     exec);
+                if (i + 1 < n) {
+                    auto t = slice(W, range{i + 1, n}, iw);
+                    const auto W1 = slice(W, range{0, i}, range{iw + 1, nb});
+                    const auto A1 = slice(A, range{0, i}, range{i + 1, n});
+                    gemv(CONJ_TRANS, one, W1, v, zero, t);
+                    gemv(NO_TRANS, -one, A1, t, one, w);
+                    gemv(CONJ_TRANS, one, A1, v, zero, t);
+                    gemv(NO_TRANS, -one, W1, t, one, w);
+                }
+                scal(tau[i - 1], w);
+                const T alpha = -half * tau[i - 1] * dot(w, v);
+                axpy(alpha, v, w);
+            }
+        }
+    }
+    else {
+        // Reduce first nb columns of lower triangle
+        for (idx_t i = 0; i < nb; ++i) {
+            // Update A(i:n,i)
+            A(i, i) = real(A(i, i));
+            if (i > 0) {
+                auto ai = slice(A, range{i, n}, range{i, i + 1});
+                gemm(NO_TRANS, CONJ_TRANS, -one,
+                     slice(A, range{i, n}, range{0, i}),
+                     slice(W, range{i, i + 1}, range{0, i}), one, ai);
+                gemm(NO_TRANS, CONJ_TRANS, -one,
+                     slice(W, range{i, n}, range{0, i}),
+                     slice(A, range{i, i + 1}, range{0, i}), one, ai);
+                A(i, i) = real(A(i, i));
+            }
+
+            if (i + 1 < n) {
+                // Generate elementary reflector H(i) to annihilate
+                // A(i+2:n,i)
+                auto v = slice(A, range{i + 1, n}, i);
+                larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[i]);
+                e[i] = real(v[0]);
+                v[0] = one;
+
+                // Compute W(i+1:n,i)
+                auto w = slice(W, range{i + 1, n}, i);
+                internal::latrd_hemv(LOWER_TRIANGLE,
+                                     slice(A, range{i + 1, n}, range{i + 1, n}),
+                                     v, w, exec);
+                if (i > 0) {
+                    auto t = slice(W, range{0, i}, i);
+                    const auto W1 = slice(W, range{i + 1, n}, range{0, i});
+                    const auto A1 = slice(A, range{i + 1, n}, range{0, i});
+                    gemv(CONJ_TRANS, one, W1, v, zero, t);
+                    gemv(NO_TRANS, -one, A1, t, one, w);
+                    gemv(CONJ_TRANS, one, A1, v, zero, t);
+                    gemv(NO_TRANS, -one, W1, t, one, w);
+                }
+                scal(tau[i], w);
+                const T alpha = -half * tau[i] * dot(w, v);
+                axpy(alpha, v, w);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LATRD_HH
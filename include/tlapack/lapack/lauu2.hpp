@@ -0,0 +1,131 @@
+/// @file lauu2.hpp Computes the product of a triangular matrix and its
+/// conjugate transpose using a level-2 algorithm.
+/// @note Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/zlauu2.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAUU2_HH
+#define TLAPACK_LAUU2_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes the product `C * C^H` or `C^H * C` in-place, where `C` is
+ * triangular, using a level-2 algorithm.
+ *
+ * If `C` is lower triangular, then lauu2 computes `C^H * C`. If `C` is upper
+ * triangular, then lauu2 computes `C * C^H`. The output (Hermitian) matrix is
+ * stored in place of the input triangular matrix.
+ *
+ * Row (or column) i of the result only depends on the entries of `C` in the
+ * rows (or columns) i:n, so that the result overwrites `C` from the first to
+ * the last row (or column). The inner loops access contiguous entries of
+ * column-major matrices. In the lower case, the dot products are unrolled
+ * over two columns and two partial sums.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of `C` is referenced; the strictly lower
+ *      triangular part of `C` is not referenced.
+ *      - Uplo::Lower: Lower triangle of `C` is referenced; the strictly upper
+ *      triangular part of `C` is not referenced.
+ *
+ * @param[in,out] C n-by-n (upper of lower) (triangular or symmetric) matrix.
+ *      On entry, the (upper of lower) part of the n-by-n triangular matrix.
+ *      On exit, the (upper of lower) part of the n-by-n symmetric matrix `C^H *
+ * C` or `C * C^H`.
+ *
+ * @return = 0: successful exit
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+int lauu2(uplo_t uplo, matrix_t& C)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t n = nrows(C);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(nrows(C) != ncols(C));
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    if (uplo == Uplo::Upper) {
+        // Column i of C * C^H
+        for (idx_t i = 0; i < n; ++i) {
+            const T aii = conj(C(i, i));
+            real_t s = real(C(i, i)) * real(C(i, i)) +
+                       imag(C(i, i)) * imag(C(i, i));
+            for (idx_t i2 = 0; i2 < i; ++i2)
+                C(i2, i) *= aii;
+            for (idx_t k = i + 1; k < n; ++k) {
+                const T cik = conj(C(i, k));
+                s += real(C(i, k)) * real(C(i, k)) +
+                     imag(C(i, k)) * imag(C(i, k));
+                for (idx_t i2 = 0; i2 < i; ++i2)
+                    C(i2, i) += cik * C(i2, k);
+            }
+            C(i, i) = s;
+        }
+    }
+    else {
+        // Row i of C^H * C
+        for (idx_t i = 0; i < n; ++i) {
+            const T aii = conj(C(i, i));
+            idx_t j = 0;
+            for (; j + 1 < i; j += 2) {
+                // Two columns at a time, with two partial sums each, so
+                // that the loads of column i are shared
+                T s0 = aii * C(i, j), s1(0);
+                T t0 = aii * C(i, j + 1), t1(0);
+                idx_t k = i + 1;
+                for (; k + 1 < n; k += 2) {
+                    const T c0 = conj(C(k, i));
+                    const T c1 = conj(C(k + 1, i));
+                    s0 += c0 * C(k, j);
+                    s1 += c1 * C(k + 1, j);
+                    t0 += c0 * C(k, j + 1);
+                    t1 += c1 * C(k + 1, j + 1);
+                }
+                if (k < n) {
+                    s0 += conj(C(k, i)) * C(k, j);
+                    t0 += conj(C(k, i)) * C(k, j + 1);
+                }
+                C(i, j) = s0 + s1;
+                C(i, j + 1) = t0 + t1;
+            }
+            if (j < i) {
+                T s0 = aii * C(i, j), s1(0);
+                idx_t k = i + 1;
+                for (; k + 1 < n; k += 2) {
+                    s0 += conj(C(k, i)) * C(k, j);
+                    s1 += conj(C(k + 1, i)) * C(k + 1, j);
+                }
+                if (k < n) s0 += conj(C(k, i)) * C(k, j);
+                C(i, j) = s0 + s1;
+            }
+            real_t s = real(C(i, i)) * real(C(i, i)) +
+                       imag(C(i, i)) * imag(C(i, i));
+            for (idx_t k = i + 1; k < n; ++k)
+                s += real(C(k, i)) * real(C(k, i)) +
+                     imag(C(k, i)) * imag(C(k, i));
+            C(i, i) = s;
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAUU2_HH
@@ -10,11 +10,22 @@
 #ifndef TLAPACK_LAUUM_RECURSIVETLAPACK_HH
 #define TLAPACK_LAUUM_RECURSIVETLAPACK_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/herk.hpp"
 #include "tlapack/blas/trmm.hpp"
+#include "tlapack/lapack/lauu2.hpp"
 
 namespace tlapack {
 
+/**
+ * Options struct for lauum_recursive()
+ */
+struct LauumOpts {
+    size_t nx = 0;  ///< Matrices of order at most nx are handled by
+                    ///< lauu2(). 0: tuned value, see tuned_option()
+};
+
 /** LAUUM is a specific type of inplace HERK. Given `C` a triangular
  * matrix (lower or upper), LAUUM computes the Hermitian matrix
  * `upper times lower`.
@@ -23,7 +34,8 @@ namespace tlapack {
  * is upper triangular in input, then LAUUM computes `C*C^H`. The output
  * (symmetric) matrix is stored in place of the input triangular matrix.
  *
- * This is the recursive variant.
+ * This is the recursive variant. The recursion stops at matrices of order
+ * at most opts.nx, which are handled by the level-2 routine lauu2().
  *
  * @param[in] uplo
  *      - Uplo::Upper: Upper triangle of `C` is referenced; the strictly lower
@@ -36,13 +48,16 @@ namespace tlapack {
  *      On exit, the (upper of lower) part of the n-by-n symmetric matrix `C^H *
  * C` or `C * C^H`.
  *
- * @return = 0: successful exit
+ * @param[in] opts Options.
+ *      - nx: Order of the matrices handled by lauu2().
  *
- * @todo: implement nx to bail out of recursion before 1-by-1 case
+ * @return = 0: successful exit
  *
  */
 template <TLAPACK_SMATRIX matrix_t>
-int lauum_recursive(const Uplo& uplo, matrix_t& C)
+int lauum_recursive(const Uplo& uplo,
+                    matrix_t& C,
+                    const LauumOpts& opts = {})
 
 {
     tlapack_check(nrows(C) == ncols(C));
@@ -61,13 +76,18 @@ int lauum_recursive(const Uplo& uplo, matrix_t& C)
     // Quick return
     if (n <= 0) return 0;
 
+    // The crossover point is chosen for the order of the full matrix
+    if (opts.nx == 0) {
+        LauumOpts optsNx = opts;
+        optsNx.nx = max<size_t>(1, tuned_value<T>("lauum", "nx", n, 128));
+        return lauum_recursive(uplo, C, optsNx);
+    }
+
     idx_t n0 = n / 2;
 
-    // 1-by-1 case for recursion
-    if (n == 1) {
-        real_t rC00 = real(C(0, 0));
-        real_t iC00 = imag(C(0, 0));
-        C(0, 0) = rC00 * rC00 + iC00 * iC00;
+    // Stop recursion
+    if (n <= (idx_t)opts.nx) {
+        lauu2(uplo, C);
     }
     else {
         if (uplo == Uplo::Lower) {
@@ -76,11 +96,11 @@ int lauum_recursive(const Uplo& uplo, matrix_t& C)
             auto C10 = slice(C, range(n0, n), range(0, n0));
             auto C11 = slice(C, range(n0, n), range(n0, n));
 
-            lauum_recursive(uplo, C00);
+            lauum_recursive(uplo, C00, opts);
             herk(LOWER_TRIANGLE, CONJ_TRANS, real_t(1), C10, real_t(1), C00);
             trmm(LEFT_SIDE, uplo, CONJ_TRANS, NON_UNIT_DIAG, real_t(1), C11,
                  C10);
-            lauum_recursive(uplo, C11);
+            lauum_recursive(uplo, C11, opts);
         }
         else {
             // Lower computes  L_hermitian * L
@@ -88,11 +108,11 @@ int lauum_recursive(const Uplo& uplo, matrix_t& C)
             auto C01 = slice(C, range(0, n0), range(n0, n));
             auto C11 = slice(C, range(n0, n), range(n0, n));
 
-            lauum_recursive(uplo, C00);
+            lauum_recursive(uplo, C00, opts);
             herk(UPPER_TRIANGLE, NO_TRANS, real_t(1), C01, real_t(1), C00);
             trmm(RIGHT_SIDE, uplo, CONJ_TRANS, NON_UNIT_DIAG, real_t(1), C11,
                  C01);
-            lauum_recursive(UPPER_TRIANGLE, C11);
+            lauum_recursive(UPPER_TRIANGLE, C11, opts);
         }
     }
 
@@ -479,7 +479,7 @@ int multishift_qr(bool want_t,
     // Allocates workspace
     WorkInfo workinfo =
         multishift_qr_worksize<TA>(want_t, want_z, ilo, ihi, A, w, Z, opts);
-    std::vector<TA> work_;
+    workspace_vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return multishift_qr_work(want_t, want_z, ilo, ihi, A, w, Z, work, opts);
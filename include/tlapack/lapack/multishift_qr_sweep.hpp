@@ -862,7 +862,7 @@ void multishift_QR_sweep(bool want_t,
     // Allocates workspace
     WorkInfo workinfo =
         multishift_QR_sweep_worksize<TA>(want_t, want_z, ilo, ihi, A, s, Z);
-    std::vector<TA> work_;
+    workspace_vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     multishift_QR_sweep_work(want_t, want_z, ilo, ihi, A, s, Z, work);
@@ -0,0 +1,255 @@
+/// @file pbtrf.hpp Computes the Cholesky factorization of a Hermitian positive
+/// definite band matrix stored in compact band format.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PBTRF_HH
+#define TLAPACK_PBTRF_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/herk.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/potf2.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for pbtrf()
+struct PbtrfOpts : public EcOpts {
+    PbtrfOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+
+    size_t nb = 0;  ///< Block size. 0: tuned value, see tuned_option()
+    size_t nx = 0;  ///< Level-2 if kd < nx. 0: tuned value, see
+                    ///< tuned_option()
+};
+
+namespace internal {
+
+    /** Level-2 Cholesky factorization of a Hermitian positive definite band
+     * matrix with kd off-diagonals in compact band storage.
+     *
+     * @see pbtrf()
+     *
+     * @ingroup computational
+     */
+    template <TLAPACK_UPLO uplo_t, typename T, class idx_t>
+    int pbtf2(uplo_t uplo, LegacyBandedMatrix<T, idx_t>& A, idx_t kd)
+    {
+        using real_t = real_type<T>;
+
+        // Constants
+        const real_t zero(0);
+        const idx_t n = ncols(A);
+
+        for (idx_t j = 0; j < n; ++j) {
+            // Compute U(j,j) or L(j,j) and test for non-positive-definiteness
+            real_t ajj = real(A(j, j));
+            if (!(ajj > zero)) {
+                tlapack_error(
+                    j + 1,
+                    "The leading minor of order j+1 is not positive definite,"
+                    " and the factorization could not be completed.");
+                return j + 1;
+            }
+            ajj = sqrt(ajj);
+            A(j, j) = T(ajj);
+
+            // Compute the elements j+1:j+kn of row (column) j and update the
+            // trailing kn-by-kn Hermitian block
+            const idx_t kn = min(kd, n - 1 - j);
+            if (uplo == Uplo::Upper) {
+                for (idx_t k = j + 1; k <= j + kn; ++k)
+                    A(j, k) /= ajj;
+                for (idx_t k = j + 1; k <= j + kn; ++k) {
+                    const T ajk = A(j, k);
+                    for (idx_t i = j + 1; i < k; ++i)
+                        A(i, k) -= conj(A(j, i)) * ajk;
+                    A(k, k) = real(A(k, k)) - real(conj(ajk) * ajk);
+                }
+            }
+            else {
+                for (idx_t i = j + 1; i <= j + kn; ++i)
+                    A(i, j) /= ajj;
+                for (idx_t k = j + 1; k <= j + kn; ++k) {
+                    const T akj = conj(A(k, j));
+                    A(k, k) = real(A(k, k)) - real(A(k, j) * akj);
+                    for (idx_t i = k + 1; i <= j + kn; ++i)
+                        A(i, k) -= A(i, j) * akj;
+                }
+            }
+        }
+
+        return 0;
+    }
+
+}  // namespace internal
+
+/** Computes the Cholesky factorization of a Hermitian positive definite band
+ * matrix A stored in compact band format.
+ *
+ * The factorization has the form
+ *     $A = U^H U,$ if uplo = Upper, or
+ *     $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular band matrix and L is lower triangular, both
+ * with the same number kd of off-diagonals as A.
+ *
+ * Only O(n kd) memory is used. The matrix is processed in block columns of
+ * size nb. The diagonal blocks, the blocks in the band next to them, and the
+ * trailing updates are dense views of the compact storage (see band_block()),
+ * so that most of the work is done by trsm(), herk() and gemm(). The
+ * triangular part of the off-diagonal block that crosses the edge of the band
+ * is copied to an nb-by-nb workspace. If kd < nx or nb > kd, the level-2
+ * algorithm is used instead. With the reference BLAS, the blocks are too small
+ * to pay off for narrower bands.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: The upper band of A is referenced, kd = upperband(A);
+ *      - Uplo::Lower: The lower band of A is referenced, kd = lowerband(A).
+ *
+ * @param[in,out] A
+ *      n-by-n banded matrix in compact storage.
+ *      On entry, the Hermitian band matrix A.
+ *      On successful exit, the factor U or L in the same band.
+ *
+ * @param[in] opts Options.
+ *      - nb: Block size.
+ *      - nx: Smallest band size kd for which the blocked code is used.
+ *
+ * @return = 0: successful exit
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *     positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, typename T, class idx_t>
+int pbtrf(uplo_t uplo,
+          LegacyBandedMatrix<T, idx_t>& A,
+          const PbtrfOpts& opts = {})
+{
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const idx_t kd = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+    const idx_t nb = tuned_option<T>(opts.nb, "pbtrf", "nb", n, 32);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == n);
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    // Unblocked code
+    if (nb <= 1 || nb > kd ||
+        kd < (idx_t)tuned_option<T>(opts.nx, "pbtrf", "nx", n, 256))
+        return internal::pbtf2(uplo, A, kd);
+
+    // Workspace for the triangular block that crosses the edge of the band
+    Create<LegacyMatrix<T, idx_t>> new_matrix;
+    workspace_vector<T> work_;
+    auto work = new_matrix(work_, nb, nb);
+    laset(GENERAL, real_t(0), real_t(0), work);
+
+    for (idx_t i = 0; i < n; i += nb) {
+        const idx_t ib = min(nb, n - i);
+
+        // Factor the diagonal block
+        auto A11 = band_block(A, i, i, ib, ib);
+        int info = potf2(uplo, A11);
+        if (info != 0) {
+            tlapack_error(info + i,
+                          "The leading minor of the reported order is not "
+                          "positive definite,"
+                          " and the factorization could not be completed.");
+            return info + i;
+        }
+        if (i + ib >= n) break;
+
+        // The off-diagonal block row (column) is split into A12, which lies
+        // entirely in the band, and A13, whose upper (lower) triangle is
+        // outside the band. A22 and A33 are the diagonal blocks they update.
+        const idx_t i2 = min(kd - ib, n - i - ib);
+        const idx_t i3 = (n > i + kd) ? min(ib, n - i - kd) : idx_t(0);
+
+        if (uplo == Uplo::Upper) {
+            auto A12 = band_block(A, i, i + ib, ib, i2);
+            auto work13 = slice(work, range{0, ib}, range{0, i3});
+
+            if (i2 > 0) {
+                auto A22 = band_block(A, i + ib, i + ib, i2, i2);
+                trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one,
+                     A11, A12);
+                herk(UPPER_TRIANGLE, CONJ_TRANS, -one, A12, one, A22);
+            }
+
+            if (i3 > 0) {
+                // Copy the lower triangle of A13 into the workspace
+                for (idx_t jj = 0; jj < i3; ++jj)
+                    for (idx_t ii = jj; ii < ib; ++ii)
+                        work13(ii, jj) = A(i + ii, i + kd + jj);
+
+                trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one,
+                     A11, work13);
+                if (i2 > 0) {
+                    auto A23 = band_block(A, i + ib, i + kd, i2, i3);
+                    gemm(CONJ_TRANS, NO_TRANS, -one, A12, work13, one, A23);
+                }
+                auto A33 = band_block(A, i + kd, i + kd, i3, i3);
+                herk(UPPER_TRIANGLE, CONJ_TRANS, -one, work13, one, A33);
+
+                // Copy the lower triangle of A13 back into the band
+                for (idx_t jj = 0; jj < i3; ++jj)
+                    for (idx_t ii = jj; ii < ib; ++ii)
+                        A(i + ii, i + kd + jj) = work13(ii, jj);
+            }
+        }
+        else {
+            auto A21 = band_block(A, i + ib, i, i2, ib);
+            auto work31 = slice(work, range{0, i3}, range{0, ib});
+
+            if (i2 > 0) {
+                auto A22 = band_block(A, i + ib, i + ib, i2, i2);
+                trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one,
+                     A11, A21);
+                herk(LOWER_TRIANGLE, NO_TRANS, -one, A21, one, A22);
+            }
+
+            if (i3 > 0) {
+                // Copy the upper triangle of A31 into the workspace
+                for (idx_t jj = 0; jj < ib; ++jj)
+                    for (idx_t ii = 0; ii < min(jj + 1, i3); ++ii)
+                        work31(ii, jj) = A(i + kd + ii, i + jj);
+
+                trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one,
+                     A11, work31);
+                if (i2 > 0) {
+                    auto A32 = band_block(A, i + kd, i + ib, i3, i2);
+                    gemm(NO_TRANS, CONJ_TRANS, -one, work31, A21, one, A32);
+                }
+                auto A33 = band_block(A, i + kd, i + kd, i3, i3);
+                herk(LOWER_TRIANGLE, NO_TRANS, -one, work31, one, A33);
+
+                // Copy the upper triangle of A31 back into the band
+                for (idx_t jj = 0; jj < ib; ++jj)
+                    for (idx_t ii = 0; ii < min(jj + 1, i3); ++ii)
+                        A(i + kd + ii, i + jj) = work31(ii, jj);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PBTRF_HH
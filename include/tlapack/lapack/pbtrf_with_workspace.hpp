@@ -71,7 +71,7 @@ void pbtrf_with_workspace(uplo_t uplo,
 
     idx_t n = nrows(A);
 
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, nb, nb);
 
     laset(Uplo::General, real_t(0), real_t(0), work);
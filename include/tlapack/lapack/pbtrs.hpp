@@ -0,0 +1,110 @@
+/// @file pbtrs.hpp Solves a linear system with a Hermitian positive definite
+/// band matrix using the Cholesky factorization computed by pbtrf().
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PBTRS_HH
+#define TLAPACK_PBTRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/** Solves the system of equations $A X = B$ with a Hermitian positive
+ * definite band matrix A using the Cholesky factorization $A = U^H U$ or
+ * $A = L L^H$ computed by pbtrf().
+ *
+ * The two triangular band solves sweep once over the compact storage for all
+ * columns of B, so that each column of the factor is read only twice.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: A was factored as $U^H U$, kd = upperband(A);
+ *      - Uplo::Lower: A was factored as $L L^H$, kd = lowerband(A).
+ *
+ * @param[in] A n-by-n banded matrix in compact storage.
+ *      The factor U or L from pbtrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, typename T, class idx_t, TLAPACK_MATRIX matrixB_t>
+int pbtrs(uplo_t uplo,
+          const LegacyBandedMatrix<T, idx_t>& A,
+          matrixB_t& B)
+{
+    using TB = type_t<matrixB_t>;
+
+    // Constants
+    const idx_t n = ncols(A);
+    const idx_t nrhs = ncols(B);
+    const idx_t kd = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+
+    // Check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == n);
+    tlapack_check((idx_t)nrows(B) == n);
+
+    // Quick return
+    if (n == 0 || nrhs == 0) return 0;
+
+    if (uplo == Uplo::Upper) {
+        // Solve U^H Y = B
+        for (idx_t j = 0; j < n; ++j) {
+            const idx_t i0 = (j > kd) ? j - kd : idx_t(0);
+            for (idx_t k = 0; k < nrhs; ++k) {
+                TB s = B(j, k);
+                for (idx_t i = i0; i < j; ++i)
+                    s -= conj(A(i, j)) * B(i, k);
+                B(j, k) = s / real(A(j, j));
+            }
+        }
+        // Solve U X = Y
+        for (idx_t j = n; j-- > 0;) {
+            const idx_t i0 = (j > kd) ? j - kd : idx_t(0);
+            for (idx_t k = 0; k < nrhs; ++k) {
+                const TB bjk = B(j, k) / real(A(j, j));
+                B(j, k) = bjk;
+                for (idx_t i = i0; i < j; ++i)
+                    B(i, k) -= A(i, j) * bjk;
+            }
+        }
+    }
+    else {
+        // Solve L Y = B
+        for (idx_t j = 0; j < n; ++j) {
+            const idx_t i1 = min(n, j + kd + 1);
+            for (idx_t k = 0; k < nrhs; ++k) {
+                const TB bjk = B(j, k) / real(A(j, j));
+                B(j, k) = bjk;
+                for (idx_t i = j + 1; i < i1; ++i)
+                    B(i, k) -= A(i, j) * bjk;
+            }
+        }
+        // Solve L^H X = Y
+        for (idx_t j = n; j-- > 0;) {
+            const idx_t i1 = min(n, j + kd + 1);
+            for (idx_t k = 0; k < nrhs; ++k) {
+                TB s = B(j, k);
+                for (idx_t i = j + 1; i < i1; ++i)
+                    s -= conj(A(i, j)) * B(i, k);
+                B(j, k) = s / real(A(j, j));
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PBTRS_HH
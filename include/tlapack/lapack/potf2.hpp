@@ -18,6 +18,86 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /** Cholesky factorization of an n-by-n matrix whose size is known at
+     * compile time.
+     *
+     * The referenced triangle is copied to a local array and all loops are
+     * unrolled, so that the entries are kept in registers. The result is the
+     * same as the one of potf2().
+     *
+     * @ingroup computational
+     */
+    template <int n, TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+    int potf2_unrolled(uplo_t uplo, matrix_t& A, const EcOpts& opts = {})
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+        using real_t = real_type<T>;
+
+        // Constants
+        const real_t one(1);
+        const real_t zero(0);
+
+        // a[i][j] = L(i,j) for i >= j, where L = U^H if uplo = Upper
+        T a[n][n];
+        static_for<0, n>([&](auto j) {
+            static_for<j, n>([&](auto i) {
+                a[i][j] = (uplo == Uplo::Lower)
+                              ? A(idx_t(i), idx_t(j))
+                              : conj(A(idx_t(j), idx_t(i)));
+            });
+        });
+
+        int info = 0;
+        static_for<0, n>([&](auto j) {
+            if (info != 0) return;
+
+            // Compute L(j,j) and test for non-positive-definiteness
+            T s(0);
+            static_for<0, j>([&](auto k) { s += conj(a[j][k]) * a[j][k]; });
+            real_t ajj = real(a[j][j]) - real(s);
+            if (!(ajj > zero)) {
+                info = j + 1;
+                return;
+            }
+            ajj = sqrt(ajj);
+            a[j][j] = T(ajj);
+
+            // Compute elements j+1:n of column j
+            const real_t rajj = one / ajj;
+            static_for<j + 1, n>([&](auto i) {
+                T aij = a[i][j];
+                static_for<0, j>(
+                    [&](auto k) { aij -= a[i][k] * conj(a[j][k]); });
+                a[i][j] = aij * rajj;
+            });
+        });
+
+        // Copy back the columns that were completed
+        const int ndone = (info == 0) ? n : info - 1;
+        static_for<0, n>([&](auto j) {
+            if (j >= ndone) return;
+            static_for<j, n>([&](auto i) {
+                if (uplo == Uplo::Lower)
+                    A(idx_t(i), idx_t(j)) = a[i][j];
+                else
+                    A(idx_t(j), idx_t(i)) = conj(a[i][j]);
+            });
+        });
+
+        if (info != 0) {
+            tlapack_error_if(
+                opts.ec.internal, info,
+                "The leading minor of order j+1 is not positive definite,"
+                " and the factorization could not be completed.");
+        }
+        return info;
+    }
+
+}  // namespace internal
+
 /** Computes the Cholesky factorization of a Hermitian
  * positive definite matrix A using a level-2 algorithm.
  *
@@ -46,16 +126,23 @@ namespace tlapack {
  *      - On successful exit, the factor U or L from the Cholesky
  *      factorization $A = U^H U$ or $A = L L^H.$
  *
+ * @param[in] opts Options.
+ *      Define the behavior of Exception Handling.
+ *
  * @return = 0: successful exit
  * @return i, 0 < i <= n, if the leading minor of order i is not
  *     positive definite, and the factorization could not be completed.
  *
+ * @note If the size of A is known at compile time, e.g., for mdspan with
+ *     static extents or fixed-size Eigen matrices, and is at most
+ *     internal::max_unrolled_size, the loops are fully unrolled.
+ *
  * @ingroup computational
  */
 template <TLAPACK_UPLO uplo_t,
           TLAPACK_SMATRIX matrix_t,
           disable_if_allow_optblas_t<matrix_t> = 0>
-int potf2(uplo_t uplo, matrix_t& A)
+int potf2(uplo_t uplo, matrix_t& A, const EcOpts& opts = {})
 {
     using T = type_t<matrix_t>;
     using real_t = real_type<T>;
@@ -74,6 +161,11 @@ int potf2(uplo_t uplo, matrix_t& A)
     // Quick return
     if (n <= 0) return 0;
 
+    // Small matrices with sizes known at compile time
+    if constexpr (internal::use_unrolled_kernel<matrix_t>)
+        return internal::potf2_unrolled<static_nrows<matrix_t>>(uplo, A,
+                                                                opts);
+
     if (uplo == Uplo::Upper) {
         // Compute the Cholesky factorization A = U^H * U
         for (idx_t j = 0; j < n; ++j) {
@@ -86,8 +178,8 @@ int potf2(uplo_t uplo, matrix_t& A)
                 A(j, j) = T(ajj);
             }
             else {
-                tlapack_error(
-                    j + 1,
+                tlapack_error_if(
+                    opts.ec.internal, j + 1,
                     "The leading minor of order j+1 is not positive definite,"
                     " and the factorization could not be completed.");
                 return j + 1;
@@ -122,8 +214,8 @@ int potf2(uplo_t uplo, matrix_t& A)
                 A(j, j) = T(ajj);
             }
             else {
-                tlapack_error(
-                    j + 1,
+                tlapack_error_if(
+                    opts.ec.internal, j + 1,
                     "The leading minor of order j+1 is not positive definite,"
                     " and the factorization could not be completed.");
                 return j + 1;
@@ -155,7 +247,7 @@ int potf2(uplo_t uplo, matrix_t& A)
 template <TLAPACK_UPLO uplo_t,
           TLAPACK_LEGACY_MATRIX matrix_t,
           enable_if_allow_optblas_t<matrix_t> = 0>
-int potf2(uplo_t uplo, matrix_t& A)
+int potf2(uplo_t uplo, matrix_t& A, const EcOpts& opts = {})
 {
     // Legacy objects
     auto A_ = legacy_matrix(A);
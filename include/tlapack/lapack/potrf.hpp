@@ -29,7 +29,7 @@ enum class PotrfVariant : char {
 
 /// @brief Options struct for potrf()
 struct PotrfOpts : public BlockedCholeskyOpts {
-    constexpr PotrfOpts(const EcOpts& opts = {}) : BlockedCholeskyOpts(opts){};
+    PotrfOpts(const EcOpts& opts = {}) : BlockedCholeskyOpts(opts){};
 
     PotrfVariant variant = PotrfVariant::Blocked;
 };
@@ -67,6 +67,9 @@ struct PotrfOpts : public BlockedCholeskyOpts {
  *      - variant:
  *          - Recursive = 'R',
  *          - Blocked = 'B'
+ *      If the size of A is known at compile time and is at most
+ *      internal::max_unrolled_size, the unrolled kernel of potf2() is used
+ *      for any variant.
  *
  * @return 0: successful exit.
  * @return i, 0 < i <= n, if the leading minor of order i is not
@@ -85,6 +88,10 @@ int potrf(uplo_t uplo, matrix_t& A, const PotrfOpts& opts = {})
                   opts.variant == PotrfVariant::Level2 ||
                   opts.variant == PotrfVariant::RightLooking);
 
+    // Small matrices with sizes known at compile time
+    if constexpr (internal::use_unrolled_kernel<matrix_t>)
+        return potf2(uplo, A);
+
     // Call variant
     if (opts.variant == PotrfVariant::Blocked)
         return potrf_blocked(uplo, A, opts);
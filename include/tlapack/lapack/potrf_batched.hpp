@@ -0,0 +1,163 @@
+/// @file potrf_batched.hpp Computes the Cholesky factorization of a batch of
+/// small Hermitian positive definite matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_BATCHED_HH
+#define TLAPACK_POTRF_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/batched/Batch.hpp"
+#include "tlapack/lapack/potrf2.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorization of each matrix A[b] of a batch of
+ * Hermitian positive definite matrices.
+ *
+ * Each factorization has the same semantics as potrf2(uplo, A[b]), except
+ * that errors are reported in info instead of thrown.
+ *
+ * For real types, groups of matrices are copied to an interleaved layout
+ * (batch index innermost) and factored together, so that the loops over the
+ * matrices of a group run in SIMD lanes. A matrix that is not positive
+ * definite is factored again by potrf2() to reproduce the partial
+ * factorization of the reference routine. For complex types, potrf2() is
+ * called on each matrix.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of each A[b] is referenced;
+ *      - Uplo::Lower: Lower triangle of each A[b] is referenced.
+ *
+ * @param[in,out] A Batch of n-by-n matrices, e.g., a LegacyStridedBatch or
+ *      a std::vector of matrices. All matrices must have the same size.
+ *      On exit, the factors U or L of each matrix.
+ *
+ * @param[out] info Vector of size A.size().
+ *      info[b] is the return value of potrf2 for A[b].
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy used to split the batch among threads.
+ *
+ * @return 0 if all factorizations succeed, or b+1 where b is the first matrix
+ *      such that info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, class batch_t, class info_t>
+int potrf_batched(uplo_t uplo,
+                  batch_t& A,
+                  info_t& info,
+                  const BatchOpts& opts = {})
+{
+    using matrix_t = std::decay_t<decltype(A[0])>;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr std::size_t L = internal::batch_lanes<T>;
+
+    const std::size_t nbatch = A.size();
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check((std::size_t)size(info) >= nbatch);
+
+    // quick return
+    if (nbatch == 0) return 0;
+
+    const idx_t n = nrows(A[0]);
+    for (std::size_t b = 0; b < nbatch; ++b) {
+        tlapack_check(nrows(A[b]) == n && ncols(A[b]) == n);
+    }
+
+    if constexpr (!internal::has_interleaved_kernels<T>) {
+        internal::for_each_group<1>(
+            opts.exec, nbatch, [&](std::size_t b, std::size_t) {
+                auto&& Ab = A[b];
+                info[b] = potrf2(uplo, Ab, NO_ERROR_CHECK);
+            });
+    }
+    else {
+        internal::for_each_group<L>(opts.exec, nbatch, [&](std::size_t b0,
+                                                           std::size_t b1) {
+            const std::size_t nb = b1 - b0;
+            internal::InterleavedMatrix<T, L> P(n, n);
+
+            // Copy the referenced triangle to the lower triangle of P. Unused
+            // lanes hold the identity.
+            for (std::size_t l = 0; l < L; ++l) {
+                if (l < nb) {
+                    auto&& Ab = A[b0 + l];
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = j; i < n; ++i)
+                            P(i, j)[l] =
+                                (uplo == Uplo::Lower) ? Ab(i, j) : Ab(j, i);
+                }
+                else {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = j; i < n; ++i)
+                            P(i, j)[l] = (i == j) ? T(1) : T(0);
+                }
+            }
+
+            // Right-looking Cholesky on all lanes
+            int infoP[L] = {};
+            T r[L];
+            for (idx_t j = 0; j < n; ++j) {
+                T* pjj = P(j, j);
+                for (std::size_t l = 0; l < L; ++l) {
+                    const bool ok = (pjj[l] > T(0));
+                    if (!ok && infoP[l] == 0) infoP[l] = int(j + 1);
+                    pjj[l] = ok ? std::sqrt(pjj[l]) : T(1);
+                    r[l] = T(1) / pjj[l];
+                }
+                for (idx_t i = j + 1; i < n; ++i) {
+                    T* pij = P(i, j);
+                    for (std::size_t l = 0; l < L; ++l)
+                        pij[l] *= r[l];
+                }
+                for (idx_t k = j + 1; k < n; ++k) {
+                    const T* pkj = P(k, j);
+                    for (idx_t i = k; i < n; ++i) {
+                        T* pik = P(i, k);
+                        const T* pij = P(i, j);
+                        for (std::size_t l = 0; l < L; ++l)
+                            pik[l] -= pij[l] * pkj[l];
+                    }
+                }
+            }
+
+            // Copy back the factors. Matrices that failed are factored by the
+            // reference routine.
+            for (std::size_t l = 0; l < nb; ++l) {
+                auto&& Ab = A[b0 + l];
+                if (infoP[l] != 0) {
+                    info[b0 + l] = potrf2(uplo, Ab, NO_ERROR_CHECK);
+                    continue;
+                }
+                for (idx_t j = 0; j < n; ++j) {
+                    for (idx_t i = j; i < n; ++i) {
+                        if (uplo == Uplo::Lower)
+                            Ab(i, j) = P(i, j)[l];
+                        else
+                            Ab(j, i) = P(i, j)[l];
+                    }
+                }
+                info[b0 + l] = 0;
+            }
+        });
+    }
+
+    return internal::first_batch_info(info, nbatch);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_BATCHED_HH
@@ -11,6 +11,8 @@
 #ifndef TLAPACK_POTRF_BLOCKED_HH
 #define TLAPACK_POTRF_BLOCKED_HH
 
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/herk.hpp"
@@ -20,11 +22,114 @@
 namespace tlapack {
 
 struct BlockedCholeskyOpts : public EcOpts {
-    constexpr BlockedCholeskyOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+    BlockedCholeskyOpts(const EcOpts& opts = {}) : EcOpts(opts){};
 
-    size_t nb = 32;  ///< Block size
+    size_t nb = 0;  ///< Block size. 0: tuned value, see tuned_option()
+    ExecutionPolicy exec = {};  ///< Execution policy of the block updates
 };
 
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts);
+
+namespace internal {
+
+    /** Cholesky factorization of a tile-major matrix whose diagonal tiles
+     * are square.
+     *
+     * This is the right-looking tile algorithm. All operations act on
+     * contiguous tiles. The diagonal tiles are factored with potrf_blocked()
+     * using the block size opts.nb. The solves with the diagonal tile, and
+     * then the updates of each block column (or row) of the trailing matrix,
+     * are processed in parallel according to opts.exec.
+     *
+     * @see potrf_blocked()
+     */
+    template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+    int potrf_tile_major(uplo_t uplo,
+                         matrix_t& A,
+                         const BlockedCholeskyOpts& opts)
+    {
+        using T = type_t<matrix_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrix_t>;
+
+        // Constants
+        const real_t one(1);
+        const idx_t nt = A.nt();
+
+        BlockedCholeskyOpts tileOpts = opts;
+        tileOpts.exec = ExecutionPolicy::sequential();
+
+        for (idx_t k = 0; k < nt; ++k) {
+            auto Akk = A.tile(k, k);
+            int info = potrf_blocked(uplo, Akk, tileOpts);
+            if (info != 0) {
+                const idx_t j = (k > 0) ? k * A.nb - A.j0 : 0;
+                tlapack_error_if(
+                    opts.ec.internal, info + j,
+                    "The leading minor of the reported order is not "
+                    "positive definite,"
+                    " and the factorization could not be completed.");
+                return info + j;
+            }
+
+            if (uplo == Uplo::Upper) {
+                internal::parallel_for_blocks(
+                    opts.exec, nt - k - 1, idx_t(1), [&](idx_t j0, idx_t j1) {
+                        for (idx_t j = k + 1 + j0; j < k + 1 + j1; ++j) {
+                            auto Akj = A.tile(k, j);
+                            trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS,
+                                 NON_UNIT_DIAG, one, Akk, Akj);
+                        }
+                    });
+                internal::parallel_for_blocks(
+                    opts.exec, nt - k - 1, idx_t(1), [&](idx_t j0, idx_t j1) {
+                        for (idx_t j = k + 1 + j0; j < k + 1 + j1; ++j) {
+                            const auto Akj = A.tile(k, j);
+                            auto Ajj = A.tile(j, j);
+                            herk(UPPER_TRIANGLE, CONJ_TRANS, -one, Akj, one,
+                                 Ajj);
+                            for (idx_t i = k + 1; i < j; ++i) {
+                                const auto Aki = A.tile(k, i);
+                                auto Aij = A.tile(i, j);
+                                gemm(CONJ_TRANS, NO_TRANS, -one, Aki, Akj, one,
+                                     Aij);
+                            }
+                        }
+                    });
+            }
+            else {
+                internal::parallel_for_blocks(
+                    opts.exec, nt - k - 1, idx_t(1), [&](idx_t i0, idx_t i1) {
+                        for (idx_t i = k + 1 + i0; i < k + 1 + i1; ++i) {
+                            auto Aik = A.tile(i, k);
+                            trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS,
+                                 NON_UNIT_DIAG, one, Akk, Aik);
+                        }
+                    });
+                internal::parallel_for_blocks(
+                    opts.exec, nt - k - 1, idx_t(1), [&](idx_t j0, idx_t j1) {
+                        for (idx_t j = k + 1 + j0; j < k + 1 + j1; ++j) {
+                            const auto Ajk = A.tile(j, k);
+                            auto Ajj = A.tile(j, j);
+                            herk(LOWER_TRIANGLE, NO_TRANS, -one, Ajk, one,
+                                 Ajj);
+                            for (idx_t i = j + 1; i < nt; ++i) {
+                                const auto Aik = A.tile(i, k);
+                                auto Aij = A.tile(i, j);
+                                gemm(NO_TRANS, CONJ_TRANS, -one, Aik, Ajk, one,
+                                     Aij);
+                            }
+                        }
+                    });
+            }
+        }
+
+        return 0;
+    }
+
+}  // namespace internal
+
 /** Computes the Cholesky factorization of a Hermitian
  * positive definite matrix A using a blocked algorithm.
  *
@@ -33,6 +138,11 @@ struct BlockedCholeskyOpts : public EcOpts {
  *      $A = L L^H,$ if uplo = Lower,
  * where U is an upper triangular matrix and L is lower triangular.
  *
+ * If A is a TileMajorMatrix whose diagonal tiles are square, the blocks of
+ * the algorithm are the tiles of A, so that all operations act on contiguous
+ * memory. In this case, opts.nb is the block size used inside the diagonal
+ * tiles.
+ *
  * @tparam uplo_t
  *      Access type: Upper or Lower.
  *      Either Uplo or any class that implements `operator Uplo()`.
@@ -54,7 +164,13 @@ struct BlockedCholeskyOpts : public EcOpts {
  *      factorization $A = U^H U$ or $A = L L^H.$
  *
  * @param[in] opts Options.
- *      Define the behavior of checks for NaNs.
+ *      - Define the behavior of checks for NaNs. If opts.ec.internal is
+ *      false, a matrix that is not positive definite is only reported by
+ *      the return value.
+ *      - nb: Block size.
+ *      - exec: Execution policy. The update of each block row (or column) is
+ *      split into blocks of at least nb columns (or rows) that are
+ *      processed in parallel.
  *
  * @return 0: successful exit.
  * @return i, 0 < i <= n, if the leading minor of order i is not
@@ -73,7 +189,7 @@ int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts)
     // Constants
     const real_t one(1);
     const idx_t n = nrows(A);
-    const idx_t nb = opts.nb;
+    const idx_t nb = tuned_option<T>(opts.nb, "potrf", "nb", n, 32);
 
     // check arguments
     tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
@@ -82,9 +198,15 @@ int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts)
     // Quick return
     if (n <= 0) return 0;
 
+    // Work on contiguous tiles if the diagonal tiles of A are square
+    if constexpr (layout<matrix_t> == Layout::TileMajor) {
+        if (A.mb == A.nb && A.i0 == A.j0)
+            return internal::potrf_tile_major(uplo, A, opts);
+    }
+
     // Unblocked code
-    else if (nb >= n)
-        return potf2(uplo, A);
+    if (nb >= n)
+        return potf2(uplo, A, opts);
 
     // Blocked code
     else {
@@ -98,10 +220,10 @@ int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts)
 
                 herk(UPPER_TRIANGLE, CONJ_TRANS, -one, A1J, one, AJJ);
 
-                int info = potf2(UPPER_TRIANGLE, AJJ);
+                int info = potf2(UPPER_TRIANGLE, AJJ, opts);
                 if (info != 0) {
-                    tlapack_error(
-                        info + j,
+                    tlapack_error_if(
+                        opts.ec.internal, info + j,
                         "The leading minor of the reported order is not "
                         "positive definite,"
                         " and the factorization could not be completed.");
@@ -114,9 +236,14 @@ int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts)
                     auto C = slice(A, range{j, j + jb}, range{j + jb, n});
 
                     // Compute the current block row
-                    gemm(CONJ_TRANS, NO_TRANS, -one, A1J, B, one, C);
-                    trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG,
-                         one, AJJ, C);
+                    internal::parallel_for_blocks(
+                        opts.exec, n - j - jb, nb, [&](idx_t k0, idx_t k1) {
+                            auto Bk = cols(B, range{k0, k1});
+                            auto Ck = cols(C, range{k0, k1});
+                            gemm(CONJ_TRANS, NO_TRANS, -one, A1J, Bk, one, Ck);
+                            trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS,
+                                 NON_UNIT_DIAG, one, AJJ, Ck);
+                        });
                 }
             }
         }
@@ -130,10 +257,10 @@ int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts)
 
                 herk(LOWER_TRIANGLE, NO_TRANS, -one, AJ1, one, AJJ);
 
-                int info = potf2(LOWER_TRIANGLE, AJJ);
+                int info = potf2(LOWER_TRIANGLE, AJJ, opts);
                 if (info != 0) {
-                    tlapack_error(
-                        info + j,
+                    tlapack_error_if(
+                        opts.ec.internal, info + j,
                         "The leading minor of the reported order is not "
                         "positive definite,"
                         " and the factorization could not be completed.");
@@ -145,10 +272,15 @@ int potrf_blocked(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts)
                     auto B = slice(A, range{j + jb, n}, range{0, j});
                     auto C = slice(A, range{j + jb, n}, range{j, j + jb});
 
-                    // Compute the current block row
-                    gemm(NO_TRANS, CONJ_TRANS, -one, B, AJ1, one, C);
-                    trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG,
-                         one, AJJ, C);
+                    // Compute the current block column
+                    internal::parallel_for_blocks(
+                        opts.exec, n - j - jb, nb, [&](idx_t k0, idx_t k1) {
+                            auto Bk = rows(B, range{k0, k1});
+                            auto Ck = rows(C, range{k0, k1});
+                            gemm(NO_TRANS, CONJ_TRANS, -one, Bk, AJ1, one, Ck);
+                            trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS,
+                                 NON_UNIT_DIAG, one, AJJ, Ck);
+                        });
                 }
             }
         }
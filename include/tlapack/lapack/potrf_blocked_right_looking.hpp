@@ -13,6 +13,7 @@
 #define TLAPACK_POTRF_BLOCKED_RL_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/herk.hpp"
 #include "tlapack/blas/trsm.hpp"
 #include "tlapack/lapack/potf2.hpp"
@@ -49,7 +50,11 @@ namespace tlapack {
  *      factorization $A = U^H U$ or $A = L L^H.$
  *
  * @param[in] opts Options.
- *      Define the behavior of checks for NaNs.
+ *      - Define the behavior of checks for NaNs.
+ *      - nb: Block size.
+ *      - exec: Execution policy. The triangular solves and the update of the
+ *      trailing matrix are split into blocks of at least nb columns (or rows)
+ *      that are processed in parallel.
  *
  * @return 0: successful exit.
  * @return i, 0 < i <= n, if the leading minor of order i is not
@@ -68,7 +73,7 @@ int potrf_rl(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts = {})
     // Constants
     const real_t one(1);
     const idx_t n = nrows(A);
-    const idx_t nb = opts.nb;
+    const idx_t nb = tuned_option<T>(opts.nb, "potrf", "nb", n, 32);
 
     // check arguments
     tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
@@ -104,9 +109,24 @@ int potrf_rl(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts = {})
                     auto B = slice(A, range{j, j + jb}, range{j + jb, n});
                     auto C = slice(A, range{j + jb, n}, range{j + jb, n});
 
-                    trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG,
-                         one, AJJ, B);
-                    herk(UPPER_TRIANGLE, CONJ_TRANS, -one, B, one, C);
+                    internal::parallel_for_blocks(
+                        opts.exec, n - j - jb, nb, [&](idx_t k0, idx_t k1) {
+                            auto Bk = cols(B, range{k0, k1});
+                            trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS,
+                                 NON_UNIT_DIAG, one, AJJ, Bk);
+                        });
+
+                    // Update the upper triangle of C by block columns
+                    internal::parallel_for_blocks(
+                        opts.exec, n - j - jb, nb, [&](idx_t k0, idx_t k1) {
+                            auto B0 = cols(B, range{0, k0});
+                            auto Bk = cols(B, range{k0, k1});
+                            auto C0k = slice(C, range{0, k0}, range{k0, k1});
+                            auto Ckk = slice(C, range{k0, k1}, range{k0, k1});
+                            gemm(CONJ_TRANS, NO_TRANS, -one, B0, Bk, one, C0k);
+                            herk(UPPER_TRIANGLE, CONJ_TRANS, -one, Bk, one,
+                                 Ckk);
+                        });
                 }
             }
         }
@@ -131,9 +151,24 @@ int potrf_rl(uplo_t uplo, matrix_t& A, const BlockedCholeskyOpts& opts = {})
                     auto B = slice(A, range{j + jb, n}, range{j, j + jb});
                     auto C = slice(A, range{j + jb, n}, range{j + jb, n});
 
-                    trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG,
-                         one, AJJ, B);
-                    herk(LOWER_TRIANGLE, NO_TRANS, -one, B, one, C);
+                    internal::parallel_for_blocks(
+                        opts.exec, n - j - jb, nb, [&](idx_t k0, idx_t k1) {
+                            auto Bk = rows(B, range{k0, k1});
+                            trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS,
+                                 NON_UNIT_DIAG, one, AJJ, Bk);
+                        });
+
+                    // Update the lower triangle of C by block columns
+                    const idx_t nC = n - j - jb;
+                    internal::parallel_for_blocks(
+                        opts.exec, nC, nb, [&](idx_t k0, idx_t k1) {
+                            auto Bk = rows(B, range{k0, k1});
+                            auto B1 = rows(B, range{k1, nC});
+                            auto Ckk = slice(C, range{k0, k1}, range{k0, k1});
+                            auto C1k = slice(C, range{k1, nC}, range{k0, k1});
+                            herk(LOWER_TRIANGLE, NO_TRANS, -one, Bk, one, Ckk);
+                            gemm(NO_TRANS, CONJ_TRANS, -one, B1, Bk, one, C1k);
+                        });
                 }
             }
         }
@@ -0,0 +1,206 @@
+/// @file potrf_tiled.hpp Computes the Cholesky factorization of a Hermitian
+/// positive definite matrix A using a tiled algorithm.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_TILED_HH
+#define TLAPACK_POTRF_TILED_HH
+
+#include <atomic>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/herk.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/potrf2.hpp"
+#include "tlapack/tiled/TiledMatrix.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorization of a Hermitian
+ * positive definite matrix A using a tiled algorithm.
+ *
+ * The factorization has the form
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular matrix and L is lower triangular.
+ *
+ * The matrix is partitioned into nb-by-nb tiles. Each factorization of a
+ * diagonal tile (potrf2), triangular solve (trsm), Hermitian rank-k update
+ * (herk) and matrix product (gemm) on tiles is a task of a tiled::TaskGraph.
+ * The tasks are executed by the threads of the execution policy as soon as
+ * their dependencies are satisfied.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the Hermitian matrix A of size n-by-n.
+ *
+ *      - If uplo = Uplo::Upper, the strictly lower
+ *      triangular part of A is not referenced.
+ *
+ *      - If uplo = Uplo::Lower, the strictly upper
+ *      triangular part of A is not referenced.
+ *
+ *      - On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] opts Options.
+ *      - nb: Tile size.
+ *      - exec: Execution policy used to run the tasks.
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *      positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+int potrf_tiled(uplo_t uplo, matrix_t& A, const TiledOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+    using tiled::Access;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+    const idx_t nb = opts.nb;
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(nb > 0);
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    tiled::TiledMatrix<matrix_t> tA(A, nb, nb);
+    const idx_t nt = tA.nt();
+
+    // The first failure stops the remaining tasks
+    std::atomic<idx_t> info{0};
+
+    tiled::TaskGraph g;
+    for (idx_t k = 0; k < nt; ++k) {
+        // Factorize the diagonal tile
+        g.insert_task(
+            [&, k]() {
+                if (info != 0) return;
+                auto Akk = tA.tile(k, k);
+                const int infokk = potrf2(uplo, Akk, NO_ERROR_CHECK);
+                if (infokk != 0) info = k * nb + infokk;
+            },
+            {{tA.handle(k, k), Access::ReadWrite}}, 3);
+
+        if (uplo == Uplo::Upper) {
+            for (idx_t j = k + 1; j < nt; ++j) {
+                g.insert_task(
+                    [&, k, j]() {
+                        if (info != 0) return;
+                        auto Akk = tA.tile(k, k);
+                        auto Akj = tA.tile(k, j);
+                        trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS,
+                             NON_UNIT_DIAG, one, Akk, Akj);
+                    },
+                    {{tA.handle(k, k), Access::Read},
+                     {tA.handle(k, j), Access::ReadWrite}},
+                    (j == k + 1) ? 2 : 0);
+            }
+            for (idx_t j = k + 1; j < nt; ++j) {
+                g.insert_task(
+                    [&, k, j]() {
+                        if (info != 0) return;
+                        auto Akj = tA.tile(k, j);
+                        auto Ajj = tA.tile(j, j);
+                        herk(UPPER_TRIANGLE, CONJ_TRANS, -one, Akj, one, Ajj);
+                    },
+                    {{tA.handle(k, j), Access::Read},
+                     {tA.handle(j, j), Access::ReadWrite}},
+                    (j == k + 1) ? 1 : 0);
+                for (idx_t i = k + 1; i < j; ++i) {
+                    g.insert_task(
+                        [&, k, i, j]() {
+                            if (info != 0) return;
+                            auto Aki = tA.tile(k, i);
+                            auto Akj = tA.tile(k, j);
+                            auto Aij = tA.tile(i, j);
+                            gemm(CONJ_TRANS, NO_TRANS, -one, Aki, Akj, one,
+                                 Aij);
+                        },
+                        {{tA.handle(k, i), Access::Read},
+                         {tA.handle(k, j), Access::Read},
+                         {tA.handle(i, j), Access::ReadWrite}},
+                        (i == k + 1) ? 1 : 0);
+                }
+            }
+        }
+        else {
+            for (idx_t i = k + 1; i < nt; ++i) {
+                g.insert_task(
+                    [&, k, i]() {
+                        if (info != 0) return;
+                        auto Akk = tA.tile(k, k);
+                        auto Aik = tA.tile(i, k);
+                        trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS,
+                             NON_UNIT_DIAG, one, Akk, Aik);
+                    },
+                    {{tA.handle(k, k), Access::Read},
+                     {tA.handle(i, k), Access::ReadWrite}},
+                    (i == k + 1) ? 2 : 0);
+            }
+            for (idx_t i = k + 1; i < nt; ++i) {
+                g.insert_task(
+                    [&, k, i]() {
+                        if (info != 0) return;
+                        auto Aik = tA.tile(i, k);
+                        auto Aii = tA.tile(i, i);
+                        herk(LOWER_TRIANGLE, NO_TRANS, -one, Aik, one, Aii);
+                    },
+                    {{tA.handle(i, k), Access::Read},
+                     {tA.handle(i, i), Access::ReadWrite}},
+                    (i == k + 1) ? 1 : 0);
+                for (idx_t j = k + 1; j < i; ++j) {
+                    g.insert_task(
+                        [&, k, i, j]() {
+                            if (info != 0) return;
+                            auto Aik = tA.tile(i, k);
+                            auto Ajk = tA.tile(j, k);
+                            auto Aij = tA.tile(i, j);
+                            gemm(NO_TRANS, CONJ_TRANS, -one, Aik, Ajk, one,
+                                 Aij);
+                        },
+                        {{tA.handle(i, k), Access::Read},
+                         {tA.handle(j, k), Access::Read},
+                         {tA.handle(i, j), Access::ReadWrite}},
+                        (j == k + 1) ? 1 : 0);
+                }
+            }
+        }
+    }
+    g.execute(opts.exec);
+
+    const int infoA = (int)info;
+    if (infoA != 0) {
+        tlapack_error(infoA,
+                      "The leading minor of the reported order is not "
+                      "positive definite,"
+                      " and the factorization could not be completed.");
+    }
+    return infoA;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_TILED_HH
@@ -0,0 +1,69 @@
+/// @file ptsv.hpp Solves a linear system with a Hermitian positive definite
+/// tridiagonal matrix.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PTSV_HH
+#define TLAPACK_PTSV_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/pttrf.hpp"
+#include "tlapack/lapack/pttrs.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for ptsv()
+struct PtsvOpts : public EcOpts {
+    PtsvOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+
+    size_t nb = 0;              ///< @see PttrsOpts
+    ExecutionPolicy exec = {};  ///< @see PttrsOpts
+};
+
+/** Solves the system of equations $A X = B$ with a Hermitian positive
+ * definite tridiagonal matrix A.
+ *
+ * A is factored as $A = L D L^H$ by pttrf(), and the factorization is used by
+ * pttrs() to solve the system.
+ *
+ * @param[in,out] D Vector of size n.
+ *      On entry, the diagonal of A.
+ *      On successful exit, the diagonal matrix D.
+ *
+ * @param[in,out] E Vector of size n-1.
+ *      On entry, the subdiagonal of A.
+ *      On successful exit, the subdiagonal of the factor L.
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On successful exit, the matrix X.
+ *
+ * @param[in] opts Options.
+ *      - ec: Error checks of pttrf().
+ *      - nb, exec: Options of pttrs().
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not positive
+ *      definite. The solution has not been computed.
+ *
+ * @ingroup variant_interface
+ */
+template <TLAPACK_VECTOR d_t, TLAPACK_VECTOR e_t, TLAPACK_MATRIX matrixB_t>
+int ptsv(d_t& D, e_t& E, matrixB_t& B, const PtsvOpts& opts = {})
+{
+    int info = pttrf(D, E, opts);
+    if (info != 0) return info;
+
+    PttrsOpts trsOpts;
+    trsOpts.nb = opts.nb;
+    trsOpts.exec = opts.exec;
+    return pttrs(D, E, B, trsOpts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PTSV_HH
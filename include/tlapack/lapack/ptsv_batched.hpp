@@ -0,0 +1,201 @@
+/// @file ptsv_batched.hpp Solves a batch of small linear systems with
+/// Hermitian positive definite tridiagonal matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PTSV_BATCHED_HH
+#define TLAPACK_PTSV_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/batched/Batch.hpp"
+#include "tlapack/lapack/ptsv.hpp"
+
+namespace tlapack {
+
+/** Solves the systems of equations $A[b] X[b] = B[b]$ of a batch of
+ * Hermitian positive definite tridiagonal matrices.
+ *
+ * Each solve has the same semantics as ptsv(col(D,b), col(E,b), B[b]), except
+ * that errors are reported in info instead of thrown.
+ *
+ * For real types, groups of systems are copied to an interleaved layout
+ * (batch index innermost) and solved together, so that the recurrences of
+ * the systems of a group run in SIMD lanes. A matrix that is not positive
+ * definite is processed again by ptsv() to reproduce the partial
+ * factorization of the reference routine. For complex types, ptsv() is
+ * called on each system.
+ *
+ * @param[in,out] D n-by-nbatch matrix.
+ *      On entry, column b is the diagonal of A[b].
+ *      On successful exit, column b is the diagonal matrix D of pttrf().
+ *
+ * @param[in,out] E (n-1)-by-nbatch matrix.
+ *      On entry, column b is the subdiagonal of A[b].
+ *      On successful exit, column b is the subdiagonal of the factor L.
+ *
+ * @param[in,out] B Batch of n-by-nrhs matrices, e.g., a LegacyStridedBatch
+ *      or a std::vector of matrices. All matrices must have the same size.
+ *      On successful exit, the solutions X[b].
+ *
+ * @param[out] info Vector of size nbatch.
+ *      info[b] is the return value of ptsv for the system b.
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy used to split the batch among threads.
+ *
+ * @return 0 if all systems are solved, or b+1 where b is the first system
+ *      such that info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixD_t,
+          TLAPACK_SMATRIX matrixE_t,
+          class batch_t,
+          class info_t>
+int ptsv_batched(matrixD_t& D,
+                 matrixE_t& E,
+                 batch_t& B,
+                 info_t& info,
+                 const BatchOpts& opts = {})
+{
+    using matrix_t = std::decay_t<decltype(B[0])>;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrixD_t>;
+    constexpr std::size_t L = internal::batch_lanes<T>;
+
+    const std::size_t nbatch = B.size();
+
+    // check arguments
+    tlapack_check((std::size_t)ncols(D) == nbatch);
+    tlapack_check((std::size_t)ncols(E) == nbatch);
+    tlapack_check((std::size_t)size(info) >= nbatch);
+
+    // quick return
+    if (nbatch == 0) return 0;
+
+    const idx_t n = nrows(D);
+    const idx_t nrhs = ncols(B[0]);
+    tlapack_check(n == 0 || nrows(E) + 1 == n);
+    for (std::size_t b = 0; b < nbatch; ++b) {
+        tlapack_check(nrows(B[b]) == n && ncols(B[b]) == nrhs);
+    }
+
+    if constexpr (!internal::has_interleaved_kernels<T> ||
+                  !is_same_v<T, type_t<matrixD_t>> ||
+                  !is_same_v<T, type_t<matrixE_t>>) {
+        internal::for_each_group<1>(
+            opts.exec, nbatch, [&](std::size_t b, std::size_t) {
+                auto Db = col(D, b);
+                auto Eb = col(E, b);
+                auto&& Bb = B[b];
+                info[b] = ptsv(Db, Eb, Bb, PtsvOpts(NO_ERROR_CHECK));
+            });
+    }
+    else {
+        internal::for_each_group<L>(opts.exec, nbatch, [&](std::size_t b0,
+                                                           std::size_t b1) {
+            const std::size_t nb = b1 - b0;
+            internal::InterleavedMatrix<T, L> Pd(n, 1);
+            internal::InterleavedMatrix<T, L> Pe(n, 1);
+            internal::InterleavedMatrix<T, L> PB(n, nrhs);
+
+            // Copy the systems to the lanes. Unused lanes hold the identity.
+            for (std::size_t l = 0; l < L; ++l) {
+                if (l < nb) {
+                    auto&& Bb = B[b0 + l];
+                    for (idx_t i = 0; i < n; ++i)
+                        Pd(i, 0)[l] = D(i, b0 + l);
+                    for (idx_t i = 0; i + 1 < n; ++i)
+                        Pe(i, 0)[l] = E(i, b0 + l);
+                    for (idx_t j = 0; j < nrhs; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            PB(i, j)[l] = Bb(i, j);
+                }
+                else {
+                    for (idx_t i = 0; i < n; ++i)
+                        Pd(i, 0)[l] = T(1);
+                    for (idx_t i = 0; i + 1 < n; ++i)
+                        Pe(i, 0)[l] = T(0);
+                    for (idx_t j = 0; j < nrhs; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            PB(i, j)[l] = T(0);
+                }
+            }
+
+            // L D L^T factorization on all lanes
+            int infoP[L] = {};
+            for (idx_t i = 0; i < n; ++i) {
+                T* di = Pd(i, 0);
+                for (std::size_t l = 0; l < L; ++l) {
+                    const bool ok = (di[l] > T(0));
+                    if (!ok && infoP[l] == 0) infoP[l] = int(i + 1);
+                    if (!ok) di[l] = T(1);
+                }
+                if (i + 1 < n) {
+                    T* ei = Pe(i, 0);
+                    T* di1 = Pd(i + 1, 0);
+                    for (std::size_t l = 0; l < L; ++l) {
+                        const T e = ei[l];
+                        ei[l] = e / di[l];
+                        di1[l] -= ei[l] * e;
+                    }
+                }
+            }
+
+            // Solve L D L^T X = B on all lanes
+            for (idx_t j = 0; j < nrhs; ++j) {
+                for (idx_t i = 1; i < n; ++i) {
+                    T* bi = PB(i, j);
+                    const T* bi1 = PB(i - 1, j);
+                    const T* ei = Pe(i - 1, 0);
+                    for (std::size_t l = 0; l < L; ++l)
+                        bi[l] -= ei[l] * bi1[l];
+                }
+                if (n > 0) {
+                    T* bn = PB(n - 1, j);
+                    const T* dn = Pd(n - 1, 0);
+                    for (std::size_t l = 0; l < L; ++l)
+                        bn[l] /= dn[l];
+                }
+                for (idx_t i = n - 1; i-- > 0;) {
+                    T* bi = PB(i, j);
+                    const T* bi1 = PB(i + 1, j);
+                    const T* di = Pd(i, 0);
+                    const T* ei = Pe(i, 0);
+                    for (std::size_t l = 0; l < L; ++l)
+                        bi[l] = bi[l] / di[l] - ei[l] * bi1[l];
+                }
+            }
+
+            // Copy back the results. Systems that failed are processed by
+            // the reference routine.
+            for (std::size_t l = 0; l < nb; ++l) {
+                auto&& Bb = B[b0 + l];
+                if (infoP[l] != 0) {
+                    auto Db = col(D, b0 + l);
+                    auto Eb = col(E, b0 + l);
+                    info[b0 + l] = ptsv(Db, Eb, Bb, PtsvOpts(NO_ERROR_CHECK));
+                    continue;
+                }
+                for (idx_t i = 0; i < n; ++i)
+                    D(i, b0 + l) = Pd(i, 0)[l];
+                for (idx_t i = 0; i + 1 < n; ++i)
+                    E(i, b0 + l) = Pe(i, 0)[l];
+                for (idx_t j = 0; j < nrhs; ++j)
+                    for (idx_t i = 0; i < n; ++i)
+                        Bb(i, j) = PB(i, j)[l];
+                info[b0 + l] = 0;
+            }
+        });
+    }
+
+    return internal::first_batch_info(info, nbatch);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PTSV_BATCHED_HH
@@ -0,0 +1,245 @@
+/// @file ptsv_partitioned.hpp Solves a large linear system with a Hermitian
+/// positive definite tridiagonal matrix by partitioning it among threads.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PTSV_PARTITIONED_HH
+#define TLAPACK_PTSV_PARTITIONED_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/pttrf.hpp"
+#include "tlapack/lapack/pttrs.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for ptsv_partitioned()
+struct PtsvPartitionedOpts : public EcOpts {
+    PtsvPartitionedOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+
+    ExecutionPolicy exec = {};  ///< Execution policy over the partitions
+    size_t nmin = 0;  ///< Minimum number of rows per partition. 0: tuned
+                      ///< value, see tuned_option()
+};
+
+/** Solves the system of equations $A X = B$ with a Hermitian positive
+ * definite tridiagonal matrix A, splitting the work on the rows of A among
+ * the threads of the execution policy.
+ *
+ * The rows of A are split into p contiguous partitions, each of at least
+ * nmin rows. The last row of each partition but the last one is a separator,
+ * and the remaining rows of the partition form an interior block $A_k$.
+ * Reordering the unknowns with the separators last gives
+ * \[
+ *      \begin{bmatrix} A_I & A_{IS} \\ A_{SI} & A_S \end{bmatrix},
+ * \]
+ * where $A_I = diag(A_0, \dots, A_{p-1})$. In parallel, each $A_k$ is
+ * factored by pttrf() and solved for its two coupling columns (the spikes).
+ * The Schur complement $A_S - A_{SI} A_I^{-1} A_{IS}$ is a Hermitian positive
+ * definite tridiagonal matrix of order p-1 that is formed from the ends of
+ * the spikes and solved sequentially. The interior unknowns are then
+ * recovered in parallel.
+ *
+ * The arithmetic is about twice that of ptsv(), so this routine only pays off
+ * for large n and a parallel execution policy. If the policy is sequential or
+ * n < 2*nmin, the system is solved by pttrf() and pttrs() on a copy of D
+ * and E.
+ *
+ * @param[in] D Vector of size n. The diagonal of A.
+ *
+ * @param[in] E Vector of size n-1. The subdiagonal of A.
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On successful exit, the matrix X.
+ *
+ * @param[in] opts Options.
+ *      - ec: Error checks.
+ *      - exec: Execution policy over the partitions.
+ *      - nmin: Minimum number of rows per partition.
+ *
+ * @return 0: successful exit.
+ * @return i > 0 if A is not positive definite. i-1 is the row where the
+ *      factorization of an interior block or of the Schur complement broke
+ *      down. The solution has not been computed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SVECTOR d_t, TLAPACK_SVECTOR e_t, TLAPACK_SMATRIX matrixB_t>
+int ptsv_partitioned(const d_t& D,
+                     const e_t& E,
+                     matrixB_t& B,
+                     const PtsvPartitionedOpts& opts = {})
+{
+    using T = type_t<matrixB_t>;
+    using idx_t = size_type<matrixB_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors for creating new matrices and vectors
+    Create<matrixB_t> new_matrix;
+    Create<vector_type<d_t>> new_dvector;
+    Create<vector_type<e_t>> new_evector;
+
+    // Constants
+    const idx_t n = size(D);
+    const idx_t nrhs = ncols(B);
+    const idx_t nmin = max(
+        idx_t(2), (idx_t)tuned_option<T>(opts.nmin, "ptsv_partitioned", "nmin",
+                                         n, 16384));
+
+    // Check arguments
+    tlapack_check_false(n > 0 && (idx_t)size(E) + 1 != n);
+    tlapack_check_false((idx_t)nrows(B) != n);
+
+    // Quick return
+    if (n == 0) return 0;
+
+    // Number of partitions
+    idx_t p = 1;
+    ThreadPool* pool = nullptr;
+    std::size_t nthreads = 1;
+    if (opts.exec.is_parallel() && n >= 2 * nmin) {
+        pool = (opts.exec.pool) ? opts.exec.pool : &default_thread_pool();
+        nthreads = opts.exec.nthreads;
+        if (nthreads == 0 || nthreads > pool->size()) nthreads = pool->size();
+        p = min((idx_t)nthreads, n / nmin);
+    }
+
+    // Copy D and E, since they are overwritten by the factorizations
+    workspace_vector<type_t<d_t>> Dw_;
+    auto Dw = new_dvector(Dw_, n);
+    workspace_vector<type_t<e_t>> Ew_;
+    auto Ew = new_evector(Ew_, n - 1);
+    for (idx_t i = 0; i < n; ++i)
+        Dw[i] = D[i];
+    for (idx_t i = 0; i + 1 < n; ++i)
+        Ew[i] = E[i];
+
+    // Sequential solve
+    if (p < 2) {
+        int info = pttrf(Dw, Ew, NO_ERROR_CHECK);
+        if (info == 0) {
+            PttrsOpts trsOpts;
+            trsOpts.exec = opts.exec;
+            pttrs(Dw, Ew, B, trsOpts);
+        }
+        tlapack_error_if(opts.ec.internal && info != 0, info,
+                         "The matrix is not positive definite.");
+        return info;
+    }
+
+    // Partition k has rows [r(k), r(k+1)). Its interior block has rows
+    // [r(k), s(k)), and s(k) = r(k+1)-1 is a separator for k < p-1.
+    auto r = [n, p](idx_t k) { return (k * n) / p; };
+    auto s = [&](idx_t k) { return (k + 1 < p) ? r(k + 1) - 1 : n; };
+
+    auto run = [&](auto&& task) {
+        pool->parallel_for(std::size_t(p), task, nthreads);
+    };
+
+    // Spikes: column 0 holds A_k^{-1} e_first and column 1 holds
+    // A_k^{-1} e_last on the rows of each interior block
+    workspace_vector<T> W_;
+    auto W = new_matrix(W_, n, 2);
+    laset(GENERAL, T(0), T(0), W);
+
+    // Factor the interior blocks and compute the spikes
+    std::vector<int> infoBlock(p, 0);
+    run([&](std::size_t kk) {
+        const idx_t k = idx_t(kk);
+        const idx_t a = r(k), b = s(k);
+        auto Dk = slice(Dw, range{a, b});
+        auto Ek = slice(Ew, range{a, b - 1});
+        infoBlock[k] = pttrf(Dk, Ek, NO_ERROR_CHECK);
+        if (infoBlock[k] != 0) return;
+        W(a, 0) = T(1);
+        W(b - 1, 1) = T(1);
+        auto Wk = slice(W, range{a, b}, range{0, 2});
+        pttrs(Dk, Ek, Wk);
+    });
+    for (idx_t k = 0; k < p; ++k) {
+        if (infoBlock[k] != 0) {
+            const int info = int(r(k)) + infoBlock[k];
+            tlapack_error_if(opts.ec.internal, info,
+                             "The matrix is not positive definite.");
+            return info;
+        }
+    }
+
+    // Form and factor the Schur complement of order m = p-1
+    const idx_t m = p - 1;
+    workspace_vector<type_t<d_t>> Sd_;
+    auto Sd = new_dvector(Sd_, m);
+    workspace_vector<type_t<e_t>> Se_;
+    auto Se = new_evector(Se_, m - 1);
+    for (idx_t k = 0; k < m; ++k) {
+        const idx_t sk = s(k);
+        Sd[k] = real(D[sk]) -
+                real(E[sk - 1] * conj(E[sk - 1])) * real(W(sk - 1, 1)) -
+                real(E[sk] * conj(E[sk])) * real(W(sk + 1, 0));
+        if (k + 1 < m) {
+            const idx_t sk1 = s(k + 1);
+            Se[k] = -E[sk] * E[sk1 - 1] * W(sk1 - 1, 0);
+        }
+    }
+    {
+        const int infoS = pttrf(Sd, Se, NO_ERROR_CHECK);
+        if (infoS != 0) {
+            const int info = int(s(infoS - 1)) + 1;
+            tlapack_error_if(opts.ec.internal, info,
+                             "The matrix is not positive definite.");
+            return info;
+        }
+    }
+
+    if (nrhs == 0) return 0;
+
+    // Solve the interior blocks
+    run([&](std::size_t kk) {
+        const idx_t k = idx_t(kk);
+        const idx_t a = r(k), b = s(k);
+        auto Dk = slice(Dw, range{a, b});
+        auto Ek = slice(Ew, range{a, b - 1});
+        auto Bk = slice(B, range{a, b}, range{0, nrhs});
+        pttrs(Dk, Ek, Bk);
+    });
+
+    // Solve the Schur complement system for the separators
+    workspace_vector<T> G_;
+    auto G = new_matrix(G_, m, nrhs);
+    for (idx_t j = 0; j < nrhs; ++j) {
+        for (idx_t k = 0; k < m; ++k) {
+            const idx_t sk = s(k);
+            G(k, j) = B(sk, j) - E[sk - 1] * B(sk - 1, j) -
+                      conj(E[sk]) * B(sk + 1, j);
+        }
+    }
+    pttrs(Sd, Se, G);
+    for (idx_t j = 0; j < nrhs; ++j)
+        for (idx_t k = 0; k < m; ++k)
+            B(s(k), j) = G(k, j);
+
+    // Recover the interior unknowns
+    run([&](std::size_t kk) {
+        const idx_t k = idx_t(kk);
+        const idx_t a = r(k), b = s(k);
+        for (idx_t j = 0; j < nrhs; ++j) {
+            const T xa = (a > 0) ? T(E[a - 1] * B(a - 1, j)) : T(0);
+            const T xb = (b < n) ? T(conj(E[b - 1]) * B(b, j)) : T(0);
+            for (idx_t i = a; i < b; ++i)
+                B(i, j) -= xa * W(i, 0) + xb * W(i, 1);
+        }
+    });
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PTSV_PARTITIONED_HH
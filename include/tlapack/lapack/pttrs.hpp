@@ -0,0 +1,102 @@
+/// @file pttrs.hpp Solves a linear system with a Hermitian positive definite
+/// tridiagonal matrix using the factorization computed by pttrf().
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PTTRS_HH
+#define TLAPACK_PTTRS_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for pttrs()
+struct PttrsOpts {
+    size_t nb = 0;  ///< Columns of B per sweep. 0: tuned value, see
+                    ///< tuned_option()
+    ExecutionPolicy exec = {};  ///< Execution policy over the columns of B
+};
+
+/** Solves the system of equations $A X = B$ with a Hermitian positive
+ * definite tridiagonal matrix A using the factorization $A = L D L^H$
+ * computed by pttrf().
+ *
+ * The columns of B are processed in blocks of nb. Each sweep goes down (or
+ * up) the rows once for the whole block, so that the innermost loop runs over
+ * independent columns instead of along the recurrence of a single column.
+ * The blocks are split among the threads of the execution policy.
+ *
+ * @param[in] D Vector of size n.
+ *      The diagonal matrix D from pttrf().
+ *
+ * @param[in] E Vector of size n-1.
+ *      The subdiagonal of the unit lower bidiagonal factor L from pttrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @param[in] opts Options.
+ *      - nb: Number of columns of B in each sweep.
+ *      - exec: Execution policy over the blocks of columns of B.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_VECTOR d_t, TLAPACK_VECTOR e_t, TLAPACK_MATRIX matrixB_t>
+int pttrs(const d_t& D, const e_t& E, matrixB_t& B, const PttrsOpts& opts = {})
+{
+    using TB = type_t<matrixB_t>;
+    using idx_t = size_type<matrixB_t>;
+
+    // Constants
+    const idx_t n = size(D);
+    const idx_t nrhs = ncols(B);
+    const idx_t nb =
+        max(idx_t(1), (idx_t)tuned_option<TB>(opts.nb, "pttrs", "nb", n, 32));
+
+    // Check arguments
+    tlapack_check_false(n > 0 && (idx_t)size(E) + 1 != n);
+    tlapack_check_false((idx_t)nrows(B) != n);
+
+    // Quick return
+    if (n == 0 || nrhs == 0) return 0;
+
+    internal::parallel_for_blocks(opts.exec, nrhs, nb, [&](idx_t k0,
+                                                           idx_t k1) {
+        for (idx_t j0 = k0; j0 < k1; j0 += nb) {
+            const idx_t j1 = min(j0 + nb, k1);
+
+            // Solve L Y = B
+            for (idx_t i = 1; i < n; ++i) {
+                const auto ei = E[i - 1];
+                for (idx_t k = j0; k < j1; ++k)
+                    B(i, k) -= ei * B(i - 1, k);
+            }
+
+            // Solve D L^H X = Y
+            const auto dn = real(D[n - 1]);
+            for (idx_t k = j0; k < j1; ++k)
+                B(n - 1, k) /= dn;
+            for (idx_t i = n - 1; i-- > 0;) {
+                const auto di = real(D[i]);
+                const auto ei = conj(E[i]);
+                for (idx_t k = j0; k < j1; ++k)
+                    B(i, k) = B(i, k) / di - ei * B(i + 1, k);
+            }
+        }
+    });
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PTTRS_HH
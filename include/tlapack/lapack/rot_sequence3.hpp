@@ -12,6 +12,7 @@
 
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/rot.hpp"
+#include "tlapack/lapack/rot_sequence.hpp"
 
 namespace tlapack {
 
@@ -133,7 +134,7 @@ void rot_sequence3(
                 for (idx_t ib = 0; ib < n; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, n);
                     // Startup phase
-                    for (idx_t i1 = 0; i1 < n; ++i1) {
+                    for (idx_t i1 = ib; i1 < ib2; ++i1) {
                         for (idx_t j = 0; j < l - 1; ++j) {
                             for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                                 idx_t g = m - 2 - g2;
@@ -336,12 +337,14 @@ void rot_sequence3(
                     for (idx_t j = 0; j < l - 1; ++j) {
                         for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                             idx_t g = n - 2 - g2;
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
-                                T temp = C(g, i) * A(i1, g) +
-                                         conj(S(g, i)) * A(i1, g + 1);
-                                A(i1, g + 1) = -S(g, i) * A(i1, g) +
-                                               C(g, i) * A(i1, g + 1);
-                                A(i1, g) = temp;
+                                T temp = c0 * a0[i1] + conj(s0) * a1[i1];
+                                a1[i1] = -s0 * a0[i1] + c0 * a1[i1];
+                                a0[i1] = temp;
                             }
                         }
                     }
@@ -349,45 +352,49 @@ void rot_sequence3(
                     for (idx_t j = l - 1; j + 1 < n - 1; j += 2) {
                         for (idx_t i = 0, g2 = j; i + 1 < l; i += 2, g2 -= 2) {
                             idx_t g = n - 2 - g2;
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto s1 = S(g - 1, i);
+                            const auto c1 = C(g - 1, i);
+                            const auto c2 = C(g + 1, i + 1);
+                            const auto s2 = S(g + 1, i + 1);
+                            const auto c3 = C(g, i + 1);
+                            const auto s3 = S(g, i + 1);
+                            T* const am1 = &A(0, g - 1);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
+                            T* const a2 = &A(0, g + 2);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 //
                                 // Apply first rotation
                                 //
 
                                 // A(i1,g) after first rotation
-                                T temp1 = C(g, i) * A(i1, g) +
-                                          conj(S(g, i)) * A(i1, g + 1);
+                                T temp1 = c0 * a0[i1] + conj(s0) * a1[i1];
                                 // A(i1,g+1) after first rotation
-                                T temp2 = -S(g, i) * A(i1, g) +
-                                          C(g, i) * A(i1, g + 1);
+                                T temp2 = -s0 * a0[i1] + c0 * a1[i1];
 
                                 //
                                 // Apply second rotation
                                 //
 
                                 // A(i1,g) after second rotation
-                                T temp3 = -S(g - 1, i) * A(i1, g - 1) +
-                                          C(g - 1, i) * temp1;
-                                A(i1, g - 1) = C(g - 1, i) * A(i1, g - 1) +
-                                               conj(S(g - 1, i)) * temp1;
+                                T temp3 = -s1 * am1[i1] + c1 * temp1;
+                                am1[i1] = c1 * am1[i1] + conj(s1) * temp1;
                                 //
                                 // Apply third rotation
                                 //
 
                                 // A(i1,g+1) after third rotation
-                                T temp4 = C(g + 1, i + 1) * temp2 +
-                                          conj(S(g + 1, i + 1)) * A(i1, g + 2);
-                                A(i1, g + 2) = -S(g + 1, i + 1) * temp2 +
-                                               C(g + 1, i + 1) * A(i1, g + 2);
+                                T temp4 = c2 * temp2 + conj(s2) * a2[i1];
+                                a2[i1] = -s2 * temp2 + c2 * a2[i1];
 
                                 //
                                 // Apply fourth rotation
                                 //
 
-                                A(i1, g) = C(g, i + 1) * temp3 +
-                                           conj(S(g, i + 1)) * temp4;
-                                A(i1, g + 1) =
-                                    -S(g, i + 1) * temp3 + C(g, i + 1) * temp4;
+                                a0[i1] = c3 * temp3 + conj(s3) * temp4;
+                                a1[i1] = -s3 * temp3 + c3 * temp4;
                             }
                         }
                         if (l % 2 == 1) {
@@ -396,20 +403,23 @@ void rot_sequence3(
                             idx_t g2 = j - (l - 1);
                             idx_t g = n - 2 - g2;
 
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto c1 = C(g - 1, i);
+                            const auto s1 = S(g - 1, i);
+                            T* const am1 = &A(0, g - 1);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 // Apply first rotation
-                                T temp = C(g, i) * A(i1, g) +
-                                         conj(S(g, i)) * A(i1, g + 1);
-                                A(i1, g + 1) = -S(g, i) * A(i1, g) +
-                                               C(g, i) * A(i1, g + 1);
-                                A(i1, g) = temp;
+                                T temp = c0 * a0[i1] + conj(s0) * a1[i1];
+                                a1[i1] = -s0 * a0[i1] + c0 * a1[i1];
+                                a0[i1] = temp;
 
                                 // Apply second rotation
-                                T temp2 = C(g - 1, i) * A(i1, g - 1) +
-                                          conj(S(g - 1, i)) * A(i1, g);
-                                A(i1, g) = -S(g - 1, i) * A(i1, g - 1) +
-                                           C(g - 1, i) * A(i1, g);
-                                A(i1, g - 1) = temp2;
+                                T temp2 = c1 * am1[i1] + conj(s1) * a0[i1];
+                                a0[i1] = -s1 * am1[i1] + c1 * a0[i1];
+                                am1[i1] = temp2;
                             }
                         }
                     }
@@ -417,12 +427,14 @@ void rot_sequence3(
                     for (idx_t j = ((n - l + 1) % 2); j < l; ++j) {
                         for (idx_t i = j, g2 = n - 2; i < l; ++i, --g2) {
                             idx_t g = n - 2 - g2;
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
-                                T temp = C(g, i) * A(i1, g) +
-                                         conj(S(g, i)) * A(i1, g + 1);
-                                A(i1, g + 1) = -S(g, i) * A(i1, g) +
-                                               C(g, i) * A(i1, g + 1);
-                                A(i1, g) = temp;
+                                T temp = c0 * a0[i1] + conj(s0) * a1[i1];
+                                a1[i1] = -s0 * a0[i1] + c0 * a1[i1];
+                                a0[i1] = temp;
                             }
                         }
                     }
@@ -436,55 +448,61 @@ void rot_sequence3(
                     // Startup phase
                     for (idx_t j = 0; j < l - 1; ++j) {
                         for (idx_t i = 0, g = j; i < j + 1; ++i, --g) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
-                                T temp = C(g, i) * A(i1, g) +
-                                         conj(S(g, i)) * A(i1, g + 1);
-                                A(i1, g + 1) = -S(g, i) * A(i1, g) +
-                                               C(g, i) * A(i1, g + 1);
-                                A(i1, g) = temp;
+                                T temp = c0 * a0[i1] + conj(s0) * a1[i1];
+                                a1[i1] = -s0 * a0[i1] + c0 * a1[i1];
+                                a0[i1] = temp;
                             }
                         }
                     }
                     // Pipeline phase
                     for (idx_t j = l - 1; j + 1 < n - 1; j += 2) {
                         for (idx_t i = 0, g = j; i + 1 < l; i += 2, g -= 2) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto c1 = C(g + 1, i);
+                            const auto s1 = S(g + 1, i);
+                            const auto s2 = S(g - 1, i + 1);
+                            const auto c2 = C(g - 1, i + 1);
+                            const auto c3 = C(g, i + 1);
+                            const auto s3 = S(g, i + 1);
+                            T* const am1 = &A(0, g - 1);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
+                            T* const a2 = &A(0, g + 2);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 //
                                 // Apply first rotation
                                 //
 
                                 // A(i1,g) after first rotation
-                                T temp1 = C(g, i) * A(i1, g) +
-                                          conj(S(g, i)) * A(i1, g + 1);
+                                T temp1 = c0 * a0[i1] + conj(s0) * a1[i1];
                                 // A(i1,g+1) after first rotation
-                                T temp2 = -S(g, i) * A(i1, g) +
-                                          C(g, i) * A(i1, g + 1);
+                                T temp2 = -s0 * a0[i1] + c0 * a1[i1];
 
                                 //
                                 // Apply second rotation
                                 //
 
                                 // A(i1,g+1) after second rotation
-                                T temp3 = C(g + 1, i) * temp2 +
-                                          conj(S(g + 1, i)) * A(i1, g + 2);
-                                A(i1, g + 2) = -S(g + 1, i) * temp2 +
-                                               C(g + 1, i) * A(i1, g + 2);
+                                T temp3 = c1 * temp2 + conj(s1) * a2[i1];
+                                a2[i1] = -s1 * temp2 + c1 * a2[i1];
 
                                 //
                                 // Apply third rotation
                                 //
 
                                 // A(i1,g) after third rotation
-                                T temp4 = -S(g - 1, i + 1) * A(i1, g - 1) +
-                                          C(g - 1, i + 1) * temp1;
-                                A(i1, g - 1) = C(g - 1, i + 1) * A(i1, g - 1) +
-                                               conj(S(g - 1, i + 1)) * temp1;
+                                T temp4 = -s2 * am1[i1] + c2 * temp1;
+                                am1[i1] = c2 * am1[i1] + conj(s2) * temp1;
 
                                 // Apply fourth rotation
-                                A(i1, g) = C(g, i + 1) * temp4 +
-                                           conj(S(g, i + 1)) * temp3;
-                                A(i1, g + 1) =
-                                    -S(g, i + 1) * temp4 + C(g, i + 1) * temp3;
+                                a0[i1] = c3 * temp4 + conj(s3) * temp3;
+                                a1[i1] = -s3 * temp4 + c3 * temp3;
                             }
                         }
                         if (l % 2 == 1) {
@@ -492,32 +510,37 @@ void rot_sequence3(
                             idx_t i = l - 1;
                             idx_t g = j - (l - 1);
 
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto c1 = C(g + 1, i);
+                            const auto s1 = S(g + 1, i);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
+                            T* const a2 = &A(0, g + 2);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 // Apply first rotation
-                                T temp = C(g, i) * A(i1, g) +
-                                         conj(S(g, i)) * A(i1, g + 1);
-                                A(i1, g + 1) = -S(g, i) * A(i1, g) +
-                                               C(g, i) * A(i1, g + 1);
-                                A(i1, g) = temp;
+                                T temp = c0 * a0[i1] + conj(s0) * a1[i1];
+                                a1[i1] = -s0 * a0[i1] + c0 * a1[i1];
+                                a0[i1] = temp;
 
                                 // Apply second rotation
-                                T temp2 = C(g + 1, i) * A(i1, g + 1) +
-                                          conj(S(g + 1, i)) * A(i1, g + 2);
-                                A(i1, g + 2) = -S(g + 1, i) * A(i1, g + 1) +
-                                               C(g + 1, i) * A(i1, g + 2);
-                                A(i1, g + 1) = temp2;
+                                T temp2 = c1 * a1[i1] + conj(s1) * a2[i1];
+                                a2[i1] = -s1 * a1[i1] + c1 * a2[i1];
+                                a1[i1] = temp2;
                             }
                         }
                     }
                     // Shutdown phase
                     for (idx_t j = ((n - l + 1) % 2); j < l; ++j) {
                         for (idx_t i = j, g = n - 2; i < l; ++i, --g) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            T* const a0 = &A(0, g);
+                            T* const a1 = &A(0, g + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
-                                T temp = C(g, i) * A(i1, g) +
-                                         conj(S(g, i)) * A(i1, g + 1);
-                                A(i1, g + 1) = -S(g, i) * A(i1, g) +
-                                               C(g, i) * A(i1, g + 1);
-                                A(i1, g) = temp;
+                                T temp = c0 * a0[i1] + conj(s0) * a1[i1];
+                                a1[i1] = -s0 * a0[i1] + c0 * a1[i1];
+                                a0[i1] = temp;
                             }
                         }
                     }
@@ -536,11 +559,13 @@ void rot_sequence3(
                     for (idx_t j = 0; j < l - 1; ++j) {
                         for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                             idx_t g = m - 2 - g2;
-                            for (idx_t i1 = 0; i1 < n; ++i1) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 T temp =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
-                                A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
-                                               C(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
+                                A(g + 1, i1) = -conj(s0) * A(g, i1) +
+                                               c0 * A(g + 1, i1);
                                 A(g, i1) = temp;
                             }
                         }
@@ -549,6 +574,14 @@ void rot_sequence3(
                     for (idx_t j = l - 1; j + 1 < m - 1; j += 2) {
                         for (idx_t i = 0, g2 = j; i + 1 < l; i += 2, g2 -= 2) {
                             idx_t g = m - 2 - g2;
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto s1 = S(g - 1, i);
+                            const auto c1 = C(g - 1, i);
+                            const auto c2 = C(g + 1, i + 1);
+                            const auto s2 = S(g + 1, i + 1);
+                            const auto c3 = C(g, i + 1);
+                            const auto s3 = S(g, i + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 //
                                 // Apply first rotation
@@ -556,36 +589,32 @@ void rot_sequence3(
 
                                 // A(g,i1) after first rotation
                                 T temp1 =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
                                 // A(g+1,i1) after first rotation
-                                T temp2 = -conj(S(g, i)) * A(g, i1) +
-                                          C(g, i) * A(g + 1, i1);
+                                T temp2 = -conj(s0) * A(g, i1) +
+                                          c0 * A(g + 1, i1);
 
                                 //
                                 // Apply second rotation
                                 //
 
                                 // A(g,i1) after second rotation
-                                T temp3 = -conj(S(g - 1, i)) * A(g - 1, i1) +
-                                          C(g - 1, i) * temp1;
-                                A(g - 1, i1) = C(g - 1, i) * A(g - 1, i1) +
-                                               S(g - 1, i) * temp1;
+                                T temp3 = -conj(s1) * A(g - 1, i1) + c1 * temp1;
+                                A(g - 1, i1) = c1 * A(g - 1, i1) + s1 * temp1;
 
                                 //
                                 // Apply third rotation
                                 //
 
                                 // A(g+1,i1) after third rotation
-                                T temp4 = C(g + 1, i + 1) * temp2 +
-                                          S(g + 1, i + 1) * A(g + 2, i1);
-                                A(g + 2, i1) = -conj(S(g + 1, i + 1)) * temp2 +
-                                               C(g + 1, i + 1) * A(g + 2, i1);
+                                T temp4 = c2 * temp2 + s2 * A(g + 2, i1);
+                                A(g + 2, i1) = -conj(s2) * temp2 +
+                                               c2 * A(g + 2, i1);
 
                                 // Apply fourth rotation
                                 A(g, i1) =
-                                    C(g, i + 1) * temp3 + S(g, i + 1) * temp4;
-                                A(g + 1, i1) = -conj(S(g, i + 1)) * temp3 +
-                                               C(g, i + 1) * temp4;
+                                    c3 * temp3 + s3 * temp4;
+                                A(g + 1, i1) = -conj(s3) * temp3 + c3 * temp4;
                             }
                         }
 
@@ -596,19 +625,22 @@ void rot_sequence3(
                             idx_t g2 = j - (l - 1);
                             idx_t g = m - 2 - g2;
 
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto c1 = C(g - 1, i);
+                            const auto s1 = S(g - 1, i);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 // Apply first rotation
                                 T temp =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
-                                A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
-                                               C(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
+                                A(g + 1, i1) = -conj(s0) * A(g, i1) +
+                                               c0 * A(g + 1, i1);
                                 A(g, i1) = temp;
 
                                 // Apply second rotation
-                                T temp2 = C(g - 1, i) * A(g - 1, i1) +
-                                          S(g - 1, i) * A(g, i1);
-                                A(g, i1) = -conj(S(g - 1, i)) * A(g - 1, i1) +
-                                           C(g - 1, i) * A(g, i1);
+                                T temp2 = c1 * A(g - 1, i1) + s1 * A(g, i1);
+                                A(g, i1) = -conj(s1) * A(g - 1, i1) +
+                                           c1 * A(g, i1);
                                 A(g - 1, i1) = temp2;
                             }
                         }
@@ -617,11 +649,13 @@ void rot_sequence3(
                     for (idx_t j = ((m - l + 1) % 2); j < l; ++j) {
                         for (idx_t i = j, g2 = m - 2; i < l; ++i, --g2) {
                             idx_t g = m - 2 - g2;
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 T temp =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
-                                A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
-                                               C(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
+                                A(g + 1, i1) = -conj(s0) * A(g, i1) +
+                                               c0 * A(g + 1, i1);
                                 A(g, i1) = temp;
                             }
                         }
@@ -636,11 +670,13 @@ void rot_sequence3(
                     // Startup phase
                     for (idx_t j = 0; j < l - 1; ++j) {
                         for (idx_t i = 0, g = j; i < j + 1; ++i, --g) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 T temp =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
-                                A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
-                                               C(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
+                                A(g + 1, i1) = -conj(s0) * A(g, i1) +
+                                               c0 * A(g + 1, i1);
                                 A(g, i1) = temp;
                             }
                         }
@@ -648,6 +684,14 @@ void rot_sequence3(
                     // Pipeline phase
                     for (idx_t j = l - 1; j + 1 < m - 1; j += 2) {
                         for (idx_t i = 0, g = j; i + 1 < l; i += 2, g -= 2) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto c1 = C(g + 1, i);
+                            const auto s1 = S(g + 1, i);
+                            const auto s2 = S(g - 1, i + 1);
+                            const auto c2 = C(g - 1, i + 1);
+                            const auto c3 = C(g, i + 1);
+                            const auto s3 = S(g, i + 1);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 //
                                 // Apply first rotation
@@ -655,20 +699,19 @@ void rot_sequence3(
 
                                 // A(g,i1) after first rotation
                                 T temp1 =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
                                 // A(g+1,i1) after first rotation
-                                T temp2 = -conj(S(g, i)) * A(g, i1) +
-                                          C(g, i) * A(g + 1, i1);
+                                T temp2 = -conj(s0) * A(g, i1) +
+                                          c0 * A(g + 1, i1);
 
                                 //
                                 // Apply second rotation
                                 //
 
                                 // A(g+1,i1) after second rotation
-                                T temp3 = C(g + 1, i) * temp2 +
-                                          S(g + 1, i) * A(g + 2, i1);
-                                A(g + 2, i1) = -conj(S(g + 1, i)) * temp2 +
-                                               C(g + 1, i) * A(g + 2, i1);
+                                T temp3 = c1 * temp2 + s1 * A(g + 2, i1);
+                                A(g + 2, i1) = -conj(s1) * temp2 +
+                                               c1 * A(g + 2, i1);
 
                                 //
                                 // Apply third rotation
@@ -676,16 +719,13 @@ void rot_sequence3(
 
                                 // A(g,i1) after third rotation
                                 T temp4 =
-                                    -conj(S(g - 1, i + 1)) * A(g - 1, i1) +
-                                    C(g - 1, i + 1) * temp1;
-                                A(g - 1, i1) = C(g - 1, i + 1) * A(g - 1, i1) +
-                                               S(g - 1, i + 1) * temp1;
+                                    -conj(s2) * A(g - 1, i1) + c2 * temp1;
+                                A(g - 1, i1) = c2 * A(g - 1, i1) + s2 * temp1;
 
                                 // Apply fourth rotation
                                 A(g, i1) =
-                                    C(g, i + 1) * temp4 + S(g, i + 1) * temp3;
-                                A(g + 1, i1) = -conj(S(g, i + 1)) * temp4 +
-                                               C(g, i + 1) * temp3;
+                                    c3 * temp4 + s3 * temp3;
+                                A(g + 1, i1) = -conj(s3) * temp4 + c3 * temp3;
                             }
                         }
 
@@ -695,20 +735,23 @@ void rot_sequence3(
                             idx_t i = l - 1;
                             idx_t g = j - (l - 1);
 
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
+                            const auto c1 = C(g + 1, i);
+                            const auto s1 = S(g + 1, i);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 // Apply first rotation
                                 T temp =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
-                                A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
-                                               C(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
+                                A(g + 1, i1) = -conj(s0) * A(g, i1) +
+                                               c0 * A(g + 1, i1);
                                 A(g, i1) = temp;
 
                                 // Apply second rotation
-                                T temp2 = C(g + 1, i) * A(g + 1, i1) +
-                                          S(g + 1, i) * A(g + 2, i1);
+                                T temp2 = c1 * A(g + 1, i1) + s1 * A(g + 2, i1);
                                 A(g + 2, i1) =
-                                    -conj(S(g + 1, i)) * A(g + 1, i1) +
-                                    C(g + 1, i) * A(g + 2, i1);
+                                    -conj(s1) * A(g + 1, i1) +
+                                    c1 * A(g + 2, i1);
                                 A(g + 1, i1) = temp2;
                             }
                         }
@@ -716,11 +759,13 @@ void rot_sequence3(
                     // Shutdown phase
                     for (idx_t j = ((m - l + 1) % 2); j < l; ++j) {
                         for (idx_t i = j, g = m - 2; i < l; ++i, --g) {
+                            const auto c0 = C(g, i);
+                            const auto s0 = S(g, i);
                             for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 T temp =
-                                    C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
-                                A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
-                                               C(g, i) * A(g + 1, i1);
+                                    c0 * A(g, i1) + s0 * A(g + 1, i1);
+                                A(g + 1, i1) = -conj(s0) * A(g, i1) +
+                                               c0 * A(g + 1, i1);
                                 A(g, i1) = temp;
                             }
                         }
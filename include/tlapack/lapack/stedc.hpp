@@ -0,0 +1,577 @@
+/// @file stedc.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dstedc.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed1.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed2.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEDC_HH
+#define TLAPACK_STEDC_HH
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laed4.hpp"
+#include "tlapack/lapack/lamrg.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/steqr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for stedc
+ */
+struct StedcOpts {
+    /// Subproblems of size at most nmin are solved by steqr(). 0: tuned
+    /// value, see tuned_option()
+    size_t nmin = 0;
+    ExecutionPolicy exec = {};  ///< Execution policy of the independent
+                                ///< subproblems and of the eigenvector
+                                ///< updates
+};
+
+namespace internal {
+
+    /**
+     * Merges the eigendecompositions of two adjacent subproblems.
+     *
+     * On entry, Q = diag(Q1, Q2) and d contain the eigenvectors and the
+     * eigenvalues, in ascending order, of the m-by-m and (n-m)-by-(n-m)
+     * subproblems. On exit, Q and d contain the eigenvectors and the
+     * eigenvalues, in ascending order, of
+     *
+     *      Q diag(d) Q^T + rho z z^T,  z = [Q1(m-1,:), Q2(0,:)]^T.
+     *
+     * Eigenpairs are deflated when the corresponding entry of z is small or
+     * when two eigenvalues are close. The remaining eigenvalues are the roots
+     * of the secular equation, computed by laed4(). The eigenvectors are
+     * computed as in Gu and Eisenstat, and are multiplied by Q with two
+     * calls to gemm() that skip the zero blocks of Q.
+     *
+     * @param[in,out] d Real vector of length n.
+     * @param[in,out] Q n-by-n real matrix.
+     * @param W n-by-n real workspace.
+     * @param U n-by-n real workspace.
+     * @param Qout n-by-n real workspace.
+     * @param[in] m Size of the first subproblem. 0 < m < n.
+     * @param[in] rho Off-diagonal element that couples the subproblems.
+     * @param[in] opts Options.
+     *
+     * @return 0 if success.
+     * @return 1 if laed4() failed to converge.
+     */
+    template <class d_t, class matrix_t>
+    int stedc_merge(d_t& d,
+                    matrix_t& Q,
+                    matrix_t& W,
+                    matrix_t& U,
+                    matrix_t& Qout,
+                    size_type<matrix_t> m,
+                    type_t<matrix_t> rho,
+                    const StedcOpts& opts)
+    {
+        using idx_t = size_type<matrix_t>;
+        using real_t = type_t<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+        const idx_t nb = max<idx_t>(opts.nmin, 1);
+        const real_t eps = uroundoff<real_t>();
+
+        // Local workspaces
+        workspace_vector<real_t> z(n), dlamda(n), w(n), dnew(n);
+        workspace_vector<idx_t> indx(n), indxp(n), coltyp(n), g(n), perm(n);
+
+        // Form the updating vector z with unit norm
+        const real_t sqrt2 = sqrt(real_t(2));
+        for (idx_t i = 0; i < m; ++i)
+            z[i] = Q(m - 1, i) / sqrt2;
+        for (idx_t i = m; i < n; ++i)
+            z[i] = ((rho < zero) ? -Q(m, i) : Q(m, i)) / sqrt2;
+        rho = real_t(2) * abs(rho);
+
+        // Permutation that sorts d in ascending order
+        lamrg(m, n - m, d, 1, 1, indx);
+
+        // Column types of Q: 1 if the nonzeros are in the rows 0:m, 3 if
+        // they are in the rows m:n, 2 if the column is dense and 4 if the
+        // column is deflated
+        for (idx_t i = 0; i < n; ++i)
+            coltyp[i] = (i < m) ? 1 : 3;
+
+        // Deflation tolerance
+        real_t zmax(0), dmax(0);
+        for (idx_t i = 0; i < n; ++i) {
+            zmax = max(zmax, abs(z[i]));
+            dmax = max(dmax, abs(d[i]));
+        }
+        const real_t tol = real_t(8) * eps * max(dmax, zmax);
+
+        // Deflation. The k eigenvalues that are not deflated are listed in
+        // indxp[0:k] in ascending order
+        idx_t k = 0;
+        if (rho * zmax <= tol) {
+            for (idx_t i = 0; i < n; ++i)
+                coltyp[i] = 4;
+        }
+        else {
+            idx_t pj = n;
+            for (idx_t jj = 0; jj < n; ++jj) {
+                const idx_t nj = indx[jj];
+
+                // Deflate due to a small entry of z
+                if (rho * abs(z[nj]) <= tol) {
+                    coltyp[nj] = 4;
+                    continue;
+                }
+
+                if (pj == n) {
+                    pj = nj;
+                    continue;
+                }
+
+                // Check if the eigenvalues are close enough to deflate
+                real_t s = z[pj];
+                real_t c = z[nj];
+                const real_t tau = lapy2(c, s);
+                real_t t = d[nj] - d[pj];
+                c /= tau;
+                s = -s / tau;
+                if (abs(t * c * s) <= tol) {
+                    // Deflate d[pj] with a rotation
+                    z[nj] = tau;
+                    z[pj] = zero;
+                    if (coltyp[nj] != coltyp[pj]) coltyp[nj] = 2;
+                    coltyp[pj] = 4;
+
+                    auto qp = col(Q, pj);
+                    auto qn = col(Q, nj);
+                    rot(qp, qn, c, s);
+
+                    t = d[pj] * c * c + d[nj] * s * s;
+                    d[nj] = d[pj] * s * s + d[nj] * c * c;
+                    d[pj] = t;
+                }
+                else
+                    indxp[k++] = pj;
+                pj = nj;
+            }
+            if (pj != n) indxp[k++] = pj;
+        }
+
+        // Group the columns that are not deflated by column type. The column
+        // indxp[i] of Q goes to the column g[i] of the grouped matrix
+        idx_t ctot[3] = {0, 0, 0};
+        for (idx_t i = 0; i < k; ++i)
+            ++ctot[coltyp[indxp[i]] - 1];
+        idx_t pos[3] = {0, ctot[0], ctot[0] + ctot[1]};
+        for (idx_t i = 0; i < k; ++i)
+            g[i] = pos[coltyp[indxp[i]] - 1]++;
+        const idx_t n12 = ctot[0] + ctot[1];
+        const idx_t n23 = ctot[1] + ctot[2];
+
+        // Qtop and Qbot store the nonzero blocks of the grouped columns
+        auto Qtop = slice(W, range{0, m}, range{0, n12});
+        auto Qbot = slice(W, range{m, n}, range{0, n23});
+        for (idx_t i = 0; i < k; ++i) {
+            const idx_t p = indxp[i];
+            dlamda[i] = d[p];
+            w[i] = z[p];
+            if (coltyp[p] <= 2)
+                for (idx_t r = 0; r < m; ++r)
+                    Qtop(r, g[i]) = Q(r, p);
+            if (coltyp[p] >= 2)
+                for (idx_t r = m; r < n; ++r)
+                    Qbot(r - m, g[i] - ctot[0]) = Q(r, p);
+        }
+
+        if (k > 0) {
+            // Solve the secular equation. Delta(:,j) stores dlamda - dnew[j]
+            auto Delta = slice(Qout, range{0, k}, range{0, k});
+            std::atomic<int> info(0);
+            parallel_for_blocks(opts.exec, k, nb, [&](idx_t j0, idx_t j1) {
+                for (idx_t j = j0; j < j1; ++j) {
+                    auto delta = col(Delta, j);
+                    if (laed4(k, j, dlamda, w, delta, rho, dnew[j]) != 0)
+                        info = 1;
+                }
+            });
+            if (info != 0) return info;
+
+            // Eigenvectors of the rank-one modification, with rows in the
+            // grouped order
+            auto Uk = slice(U, range{0, k}, range{0, k});
+            if (k == 1)
+                Uk(0, 0) = one;
+            else if (k == 2) {
+                for (idx_t j = 0; j < k; ++j)
+                    for (idx_t i = 0; i < k; ++i)
+                        Uk(g[i], j) = Delta(i, j);
+            }
+            else {
+                // Recompute w so that the eigenvectors are numerically
+                // orthogonal (Gu and Eisenstat)
+                parallel_for_blocks(
+                    opts.exec, k, nb, [&](idx_t i0, idx_t i1) {
+                        for (idx_t i = i0; i < i1; ++i) {
+                            real_t wi = Delta(i, i);
+                            for (idx_t j = 0; j < k; ++j)
+                                if (j != i)
+                                    wi *= Delta(i, j) / (dlamda[i] - dlamda[j]);
+                            w[i] = (w[i] < zero) ? -sqrt(-wi) : sqrt(-wi);
+                        }
+                    });
+
+                parallel_for_blocks(
+                    opts.exec, k, nb, [&](idx_t j0, idx_t j1) {
+                        for (idx_t j = j0; j < j1; ++j) {
+                            auto u = col(Uk, j);
+                            for (idx_t i = 0; i < k; ++i)
+                                u[g[i]] = w[i] / Delta(i, j);
+                            scal(one / nrm2(u), u);
+                        }
+                    });
+            }
+
+            // Update the eigenvectors: Qout = [Qtop 0; 0 Qbot] U
+            parallel_for_blocks(opts.exec, k, nb, [&](idx_t j0, idx_t j1) {
+                auto Qout1 = slice(Qout, range{0, m}, range{j0, j1});
+                auto Qout2 = slice(Qout, range{m, n}, range{j0, j1});
+                if (n12 > 0) {
+                    const auto U1 = slice(Uk, range{0, n12}, range{j0, j1});
+                    gemm(NO_TRANS, NO_TRANS, one, Qtop, U1, zero, Qout1);
+                }
+                else
+                    laset(GENERAL, zero, zero, Qout1);
+                if (n23 > 0) {
+                    const auto U2 = slice(Uk, range{ctot[0], k}, range{j0, j1});
+                    gemm(NO_TRANS, NO_TRANS, one, Qbot, U2, zero, Qout2);
+                }
+                else
+                    laset(GENERAL, zero, zero, Qout2);
+            });
+        }
+
+        // Copy the deflated eigenpairs
+        for (idx_t i = 0, j = k; i < n; ++i) {
+            if (coltyp[i] == 4) {
+                for (idx_t r = 0; r < n; ++r)
+                    Qout(r, j) = Q(r, i);
+                dnew[j++] = d[i];
+            }
+        }
+
+        // Sort the eigenpairs in ascending order
+        std::iota(perm.begin(), perm.end(), idx_t(0));
+        std::stable_sort(perm.begin(), perm.end(), [&](idx_t a, idx_t b) {
+            return dnew[a] < dnew[b];
+        });
+        for (idx_t j = 0; j < n; ++j) {
+            d[j] = dnew[perm[j]];
+            for (idx_t r = 0; r < n; ++r)
+                Q(r, j) = Qout(r, perm[j]);
+        }
+
+        return 0;
+    }
+
+    /**
+     * Computes the eigendecomposition of an unreduced symmetric tridiagonal
+     * matrix using divide and conquer.
+     *
+     * @param[in,out] d Real vector of length n.
+     *      On exit, the eigenvalues in ascending order.
+     * @param[in,out] e Real vector of length n-1. Destroyed on exit.
+     * @param[out] Q n-by-n real matrix. The eigenvectors.
+     * @param W n-by-n real workspace.
+     * @param U n-by-n real workspace.
+     * @param Qout n-by-n real workspace.
+     * @param[in] opts Options.
+     *
+     * @return 0 if success.
+     * @return nonzero if steqr() or laed4() failed.
+     */
+    template <class d_t, class e_t, class matrix_t>
+    int stedc_recursive(d_t& d,
+                        e_t& e,
+                        matrix_t& Q,
+                        matrix_t& W,
+                        matrix_t& U,
+                        matrix_t& Qout,
+                        const StedcOpts& opts)
+    {
+        using idx_t = size_type<matrix_t>;
+        using real_t = type_t<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+
+        if (n <= max<idx_t>(opts.nmin, 1)) {
+            laset(GENERAL, zero, one, Q);
+            return steqr(true, d, e, Q);
+        }
+
+        // Divide: T = diag(T1, T2) + |rho| v v^T
+        const idx_t m = n / 2;
+        const real_t rho = e[m - 1];
+        d[m - 1] -= abs(rho);
+        d[m] -= abs(rho);
+
+        auto d1 = slice(d, range{0, m});
+        auto d2 = slice(d, range{m, n});
+        auto e1 = slice(e, range{0, m - 1});
+        auto e2 = slice(e, range{m, n - 1});
+        auto Q1 = slice(Q, range{0, m}, range{0, m});
+        auto Q2 = slice(Q, range{m, n}, range{m, n});
+        auto W1 = slice(W, range{0, m}, range{0, m});
+        auto W2 = slice(W, range{m, n}, range{m, n});
+        auto U1 = slice(U, range{0, m}, range{0, m});
+        auto U2 = slice(U, range{m, n}, range{m, n});
+        auto Qout1 = slice(Qout, range{0, m}, range{0, m});
+        auto Qout2 = slice(Qout, range{m, n}, range{m, n});
+
+        // Conquer: the subproblems are independent and use disjoint blocks
+        // of the workspaces
+        int info1 = 0, info2 = 0;
+        auto solve = [&](std::size_t i) {
+            if (i == 0)
+                info1 = stedc_recursive(d1, e1, Q1, W1, U1, Qout1, opts);
+            else
+                info2 = stedc_recursive(d2, e2, Q2, W2, U2, Qout2, opts);
+        };
+        if (opts.exec.is_parallel()) {
+            ThreadPool& pool =
+                (opts.exec.pool) ? *opts.exec.pool : default_thread_pool();
+            pool.parallel_for(2, solve, opts.exec.nthreads);
+        }
+        else {
+            solve(0);
+            solve(1);
+        }
+        if (info1 != 0) return info1;
+        if (info2 != 0) return info2;
+
+        auto Q12 = slice(Q, range{0, m}, range{m, n});
+        auto Q21 = slice(Q, range{m, n}, range{0, m});
+        laset(GENERAL, zero, zero, Q12);
+        laset(GENERAL, zero, zero, Q21);
+
+        // Merge
+        return stedc_merge(d, Q, W, U, Qout, m, rho, opts);
+    }
+
+}  // namespace internal
+
+/**
+ * STEDC computes all eigenvalues and, optionally, eigenvectors of a
+ * real symmetric tridiagonal matrix using the divide and conquer method.
+ *
+ * The eigenvectors of a full Hermitian matrix can also be found by STEDC if
+ * this matrix has previously been reduced matrix to real symmetric
+ * tridiagonal form, by HETD2 for example.
+ *
+ * The matrix is first split into unreduced blocks. Each block of size larger
+ * than opts.nmin is split in two halves, which are solved recursively and
+ * merged by solving a secular equation. Blocks of size at most opts.nmin are
+ * solved by steqr(). The eigenvectors of each block are then applied to Z
+ * with gemm().
+ *
+ * @return 0, successful exit.
+ * @return nonzero, the algorithm failed to compute an eigenvalue.
+ *
+ * @param[in] want_z bool
+ *            = 'false': Compute eigenvalues only. Uses steqr().
+ *            = 'true': Compute eigenvalues and eigenvectors of the original
+ *              symmetric matrix. On entry, Z must contain the orthogonal
+ *              matrix used to reduce the original matrix to tridiagonal form
+ *              or initialized to the identity matrix. (See description of Z
+ *              below.)
+ *
+ * @param[in,out] d real vector of length n.
+ *      On entry, the diagonal elements of the real symmetric
+ *      tridiagonal matrix.
+ *      On exit, if return = 0, the eigenvalues in ascending order.
+ *
+ * @param[in,out] e real vector of length n-1.
+ *      On entry, the off-diagonal elements of the real symmetric
+ *      tridiagonal matrix.
+ *      On exit, "e" has been destroyed.
+ *
+ * @param[in,out] Z real or complex n-by-n matrix
+ *      if compz = 'false', then Z is not referenced.
+ *      if compz = 'true', on entry, either the n-by-n unitary matrix used in
+ *      the reduction to tridiagonal form or initialized to the identity matrix.
+ *      Z can be either a real orthogonal or complex unitary matrix.
+ *      On exit, if return = 0, then Z contains the orthonormal eigenvectors of
+ *      the original Hermitian matrix or of the real symmetric tridiagonal
+ *      matrix.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nmin: Size of the subproblems solved by steqr().
+ *      - @c opts.exec: Execution policy. If parallel, independent
+ *        subproblems are solved concurrently, and the secular equations and
+ *        the eigenvector updates are split by columns.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR d_t,
+          TLAPACK_SVECTOR e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int stedc(bool want_z,
+          d_t& d,
+          e_t& e,
+          matrix_t& Z,
+          const StedcOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using r_matrix_t = real_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<r_matrix_t> new_real_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t nmin =
+        max<idx_t>(tuned_option<T>(opts.nmin, "stedc", "nmin", n, 25), 1);
+    const real_t eps = uroundoff<real_t>();
+
+    // Options of the recursion, with the size of the subproblems resolved
+    StedcOpts optsRec = opts;
+    optsRec.nmin = nmin;
+
+    // check arguments
+    tlapack_check(n <= 1 || (idx_t)size(e) >= n - 1);
+    if (want_z) tlapack_check(ncols(Z) == n);
+
+    // Quick return if possible
+    if (n <= 1) return 0;
+
+    // Divide and conquer is only used for the eigenvectors
+    if (!want_z || n <= nmin) return steqr(want_z, d, e, Z);
+
+    const idx_t nz = nrows(Z);
+
+    // Allocate workspaces
+    workspace_vector<real_t> Q_, W_, U_, Qout_;
+    auto Q = new_real_matrix(Q_, n, n);
+    auto W = new_real_matrix(W_, n, n);
+    auto U = new_real_matrix(U_, n, n);
+    auto Qout = new_real_matrix(Qout_, n, n);
+    workspace_vector<T> Zt_;
+    auto Zt = new_matrix(Zt_, nz, n);
+
+    for (idx_t start = 0; start < n;) {
+        // Find the unreduced block d[start:end]
+        idx_t end = start;
+        for (; end + 1 < n; ++end) {
+            const real_t tiny =
+                eps * sqrt(abs(d[end])) * sqrt(abs(d[end + 1]));
+            if (abs(e[end]) <= tiny) {
+                e[end] = zero;
+                break;
+            }
+        }
+        ++end;
+
+        const idx_t nb = end - start;
+        auto db = slice(d, range{start, end});
+        auto eb = slice(e, range{start, end - 1});
+        auto Zb = slice(Z, range{0, nz}, range{start, end});
+
+        if (nb > 1 && nb <= nmin) {
+            const int info = steqr(true, db, eb, Zb);
+            if (info != 0) return info;
+        }
+        else if (nb > 1) {
+            // Scale the block to avoid overflow and underflow
+            real_t orgnrm(0);
+            for (idx_t i = 0; i < nb; ++i)
+                orgnrm = max(orgnrm, abs(db[i]));
+            for (idx_t i = 0; i + 1 < nb; ++i)
+                orgnrm = max(orgnrm, abs(eb[i]));
+            for (idx_t i = 0; i < nb; ++i)
+                db[i] /= orgnrm;
+            for (idx_t i = 0; i + 1 < nb; ++i)
+                eb[i] /= orgnrm;
+
+            auto Qb = slice(Q, range{0, nb}, range{0, nb});
+            auto Wb = slice(W, range{0, nb}, range{0, nb});
+            auto Ub = slice(U, range{0, nb}, range{0, nb});
+            auto Qoutb = slice(Qout, range{0, nb}, range{0, nb});
+            const int info =
+                internal::stedc_recursive(db, eb, Qb, Wb, Ub, Qoutb, optsRec);
+            if (info != 0) return info;
+
+            for (idx_t i = 0; i < nb; ++i)
+                db[i] *= orgnrm;
+
+            // Zb = Zb * Qb
+            auto Ztb = slice(Zt, range{0, nz}, range{0, nb});
+            internal::parallel_for_blocks(
+                opts.exec, nb, nmin, [&](idx_t j0, idx_t j1) {
+                    const auto Qj = cols(Qb, range{j0, j1});
+                    auto Ztj = cols(Ztb, range{j0, j1});
+                    gemm(NO_TRANS, NO_TRANS, one, Zb, Qj, zero, Ztj);
+                });
+            lacpy(GENERAL, Ztb, Zb);
+        }
+
+        start = end;
+    }
+
+    // Use selection sort to minize swaps of eigenvectors
+    for (idx_t i = 0; i < n - 1; ++i) {
+        idx_t k = i;
+        real_t p = d[i];
+        for (idx_t j = i + 1; j < n; ++j) {
+            if (d[j] < p) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if (k != i) {
+            d[k] = d[i];
+            d[i] = p;
+            auto z1 = col(Z, i);
+            auto z2 = col(Z, k);
+            tlapack::swap(z1, z2);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEDC_HH
@@ -12,6 +12,7 @@
 #ifndef TLAPACK_STEQR_HH
 #define TLAPACK_STEQR_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/iamax.hpp"
 #include "tlapack/blas/lartg.hpp"
@@ -21,63 +22,83 @@
 #include "tlapack/lapack/laev2.hpp"
 #include "tlapack/lapack/lapy2.hpp"
 #include "tlapack/lapack/lasrt.hpp"
+#include "tlapack/lapack/rot_sequence3.hpp"
 
 namespace tlapack {
 
 /**
- * STEQR computes all eigenvalues and, optionally, eigenvectors of a
- * real symmetric tridiagonal matrix using the implicit QL or QR method.
- *
- * The eigenvectors of a full Hermitian matrix can also be found by STEQR if
- * this matrix has previously been reduced matrix to real symmetric
- * tridiagonal form, by HETRD for example.
- *
- * @return 0, successful exit.
- * @return i, 0 < i <= n, the algorithm has failed to find all the eigenvalues
- *            in a total of 30*n iterations; if return = i, then i elements
- *            of e have not converged to zero; on exit, d and e contain the
- *            elements of a symmetric tridiagonal matrix which is orthogonally
- *            similar to the original matrix.
+ * Options struct for steqr
+ */
+struct SteqrOpts {
+    /// Number of QR sweeps whose rotations are accumulated before they are
+    /// applied to Z by rot_sequence3(). If nsweeps = 1, each rotation is
+    /// applied to Z as soon as it is computed. 0: tuned value, see
+    /// tuned_option()
+    size_t nsweeps = 0;
+    /// The rotations are accumulated only if n > nmin. 0: tuned value, see
+    /// tuned_option()
+    size_t nmin = 0;
+};
+
+/** Workspace query of steqr()
  *
  * @param[in] want_z bool
- *            = 'false': Compute eigenvalues only.
- *            = 'true': Compute eigenvalues and eigenvectors of the original
- *              symmetric matrix. On entry, Z must contain the orthogonal
- *              matrix used to reduce the original matrix to tridiagonal form
- *              or initialized to the identity matrix. (See description of Z
- *              below.)
+ * @param[in] d real vector of length n.
+ * @param[in] e real vector of length n-1.
+ * @param[in] Z n-by-n matrix.
+ * @param[in] opts Options.
  *
- * @param[in,out] d real vector of length n.
- *      On entry, the diagonal elements of the real symmetric
- *      tridiagonal matrix.
- *      On exit, if return = 0, the eigenvalues in ascending order.
+ * @return WorkInfo The amount workspace required.
  *
- * @param[in,out] e real vector of length n-1.
- *      On entry, the off-diagonal elements of the real symmetric
- *      tridiagonal matrix.
- *      On exit, "e" has been destroyed.
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t, class d_t, class e_t>
+constexpr WorkInfo steqr_worksize(bool want_z,
+                                  const d_t& d,
+                                  const e_t& e,
+                                  const matrix_t& Z,
+                                  const SteqrOpts& opts = {})
+{
+    using TZ = type_t<matrix_t>;
+
+    const size_t n = size(d);
+    const size_t nsweeps =
+        tuned_option<TZ>(opts.nsweeps, "steqr", "nsweeps", n, 32);
+    const size_t nmin = tuned_option<TZ>(opts.nmin, "steqr", "nmin", n, 128);
+
+    // Cosines and sines of the accumulated rotations
+    if (want_z && nsweeps > 1 && n > nmin)
+        return WorkInfo(n - 1, 2 * nsweeps);
+
+    return WorkInfo(0);
+}
+
+/** @copybrief steqr()
+ * Workspace is provided as an argument.
+ * @copydetails steqr()
  *
- * @param[in,out] Z real or complex n-by-n matrix
- *      if compz = 'false', then Z is not referenced.
- *      if compz = 'true', on entry, either the n-by-n unitary matrix used in
- *      the reduction to tridiagonal form or initialized to the identity matrix.
- *      Z can be either a real orthogonal or complex unitary matrix.
- *      On exit, if return = 0, then Z contains the orthonormal eigenvectors of
- *      the original Hermitian matrix or of the real symmetric tridiagonal
- *      matrix.
+ * @param work Real workspace. Use the workspace query to determine the size
+ *      needed.
  *
  * @ingroup computational
  */
 template <TLAPACK_SMATRIX matrix_t,
           class d_t,
           class e_t,
+          TLAPACK_WORKSPACE work_t,
           enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
           enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
-int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
+int steqr_work(bool want_z,
+               d_t& d,
+               e_t& e,
+               matrix_t& Z,
+               work_t& work,
+               const SteqrOpts& opts = {})
 {
     using idx_t = size_type<matrix_t>;
     using T = type_t<matrix_t>;
     using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
 
     // constants
     const real_t two(2);
@@ -94,6 +115,59 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
     const real_t eps2 = square(eps);
     const real_t safmin = safe_min<real_t>();
 
+    // The rotations of up to nsweeps consecutive sweeps in the same direction
+    // are stored in the columns of C and S, and applied to the columns
+    // zlo:zhi of Z at once by rot_sequence3()
+    const idx_t nsweeps_opt =
+        tuned_option<T>(opts.nsweeps, "steqr", "nsweeps", n, 32);
+    const bool accumulate =
+        want_z && nsweeps_opt > 1 &&
+        n > (idx_t)tuned_option<T>(opts.nmin, "steqr", "nmin", n, 128);
+    const idx_t nsweeps = (accumulate) ? nsweeps_opt : 0;
+    auto [C, work1] = reshape(work, (accumulate) ? n - 1 : 0, nsweeps);
+    auto [S, work2] = reshape(work1, (accumulate) ? n - 1 : 0, nsweeps);
+    idx_t jsweep = 0;
+    idx_t zlo = n;
+    idx_t zhi = 0;
+    bool zforward = true;
+
+    // Applies the accumulated rotations to Z
+    auto flush_rotations = [&]() {
+        if (jsweep == 0) return;
+        const auto Cj = slice(C, range{zlo, zhi - 1}, range{0, jsweep});
+        const auto Sj = slice(S, range{zlo, zhi - 1}, range{0, jsweep});
+        auto Zj = cols(Z, range{zlo, zhi});
+        // rot_sequence3() applies rotation 0 first in the backward direction
+        if (zforward)
+            rot_sequence3(RIGHT_SIDE, BACKWARD, Cj, Sj, Zj);
+        else
+            rot_sequence3(RIGHT_SIDE, FORWARD, Cj, Sj, Zj);
+        jsweep = 0;
+        zlo = n;
+        zhi = 0;
+    };
+
+    // Starts a new column of rotations acting on the columns i0:i1 of Z. The
+    // accumulated rotations are applied first if the direction changes, or
+    // if i0:i1 is not a large part of the columns zlo:zhi they act on
+    auto new_sweep = [&](bool forward, idx_t i0, idx_t i1) {
+        if (jsweep > 0 && (forward != zforward || i0 < zlo || i1 > zhi ||
+                           2 * (i1 - i0) < zhi - zlo))
+            flush_rotations();
+        zforward = forward;
+        zlo = min(zlo, i0);
+        zhi = max(zhi, i1);
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            C(i, jsweep) = one;
+            S(i, jsweep) = zero;
+        }
+    };
+
+    // Finishes the current column of rotations
+    auto end_sweep = [&]() {
+        if (++jsweep == nsweeps) flush_rotations();
+    };
+
     // Compute the eigenvalues and eigenvectors of the tridiagonal
     // matrix.
     const idx_t itmax = 30 * n;
@@ -115,6 +189,7 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
     for (idx_t iter = 0; iter < itmax; iter++) {
         if (iter == itmax) {
             // The QR algorithm failed to converge, return with error.
+            if (accumulate) flush_rotations();
             return istop;
         }
 
@@ -147,9 +222,17 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
                 real_t cs, sn;
                 laev2(d[istart], e[istart], d[istart + 1], s1, s2, cs, sn);
 
-                auto z1 = col(Z, istart);
-                auto z2 = col(Z, istart + 1);
-                rot(z1, z2, cs, sn);
+                if (accumulate) {
+                    new_sweep(zforward, istart, istart + 2);
+                    C(istart, jsweep) = cs;
+                    S(istart, jsweep) = sn;
+                    end_sweep();
+                }
+                else {
+                    auto z1 = col(Z, istart);
+                    auto z2 = col(Z, istart + 1);
+                    rot(z1, z2, cs, sn);
+                }
             }
             else {
                 lae2(d[istart], e[istart], d[istart + 1], s1, s2);
@@ -183,6 +266,8 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
             real_t c = one;
             p = zero;
 
+            if (accumulate) new_sweep(true, istart, istop);
+
             // Chase bulge from top to bottom
             for (idx_t i = istart; i < istop - 1; ++i) {
                 real_t f = s * e[i];
@@ -195,7 +280,11 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
                 d[i] = g + p;
                 g = c * r - b;
                 // If eigenvalues are desired, then apply rotations
-                if (want_z) {
+                if (accumulate) {
+                    C(i, jsweep) = c;
+                    S(i, jsweep) = s;
+                }
+                else if (want_z) {
                     auto z1 = col(Z, i);
                     auto z2 = col(Z, i + 1);
                     rot(z1, z2, c, s);
@@ -203,6 +292,8 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
             }
             d[istop - 1] = d[istop - 1] - p;
             e[istop - 2] = g;
+
+            if (accumulate) end_sweep();
         }
         else {
             // QL iteration
@@ -217,6 +308,8 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
             real_t c = one;
             p = zero;
 
+            if (accumulate) new_sweep(false, istart, istop);
+
             // Chase bulge from bottom to top
             for (idx_t i = istop - 1; i > istart; --i) {
                 real_t f = s * e[i - 1];
@@ -229,7 +322,11 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
                 d[i] = g + p;
                 g = c * r - b;
                 // If eigenvalues are desired, then apply rotations
-                if (want_z) {
+                if (accumulate) {
+                    C(i - 1, jsweep) = c;
+                    S(i - 1, jsweep) = -s;
+                }
+                else if (want_z) {
                     auto z1 = col(Z, i);
                     auto z2 = col(Z, i - 1);
                     rot(z1, z2, c, s);
@@ -237,9 +334,13 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
             }
             d[istart] = d[istart] - p;
             e[istart] = g;
+
+            if (accumulate) end_sweep();
         }
     }
 
+    if (accumulate) flush_rotations();
+
     // Order eigenvalues and eigenvectors
     if (!want_z) {
         // Use quick sort
@@ -269,6 +370,80 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
     return 0;
 }
 
+/**
+ * STEQR computes all eigenvalues and, optionally, eigenvectors of a
+ * real symmetric tridiagonal matrix using the implicit QL or QR method.
+ *
+ * The eigenvectors of a full Hermitian matrix can also be found by STEQR if
+ * this matrix has previously been reduced matrix to real symmetric
+ * tridiagonal form, by HETRD for example.
+ *
+ * @return 0, successful exit.
+ * @return i, 0 < i <= n, the algorithm has failed to find all the eigenvalues
+ *            in a total of 30*n iterations; if return = i, then i elements
+ *            of e have not converged to zero; on exit, d and e contain the
+ *            elements of a symmetric tridiagonal matrix which is orthogonally
+ *            similar to the original matrix.
+ *
+ * @param[in] want_z bool
+ *            = 'false': Compute eigenvalues only.
+ *            = 'true': Compute eigenvalues and eigenvectors of the original
+ *              symmetric matrix. On entry, Z must contain the orthogonal
+ *              matrix used to reduce the original matrix to tridiagonal form
+ *              or initialized to the identity matrix. (See description of Z
+ *              below.)
+ *
+ * @param[in,out] d real vector of length n.
+ *      On entry, the diagonal elements of the real symmetric
+ *      tridiagonal matrix.
+ *      On exit, if return = 0, the eigenvalues in ascending order.
+ *
+ * @param[in,out] e real vector of length n-1.
+ *      On entry, the off-diagonal elements of the real symmetric
+ *      tridiagonal matrix.
+ *      On exit, "e" has been destroyed.
+ *
+ * @param[in,out] Z real or complex n-by-n matrix
+ *      if compz = 'false', then Z is not referenced.
+ *      if compz = 'true', on entry, either the n-by-n unitary matrix used in
+ *      the reduction to tridiagonal form or initialized to the identity matrix.
+ *      Z can be either a real orthogonal or complex unitary matrix.
+ *      On exit, if return = 0, then Z contains the orthonormal eigenvectors of
+ *      the original Hermitian matrix or of the real symmetric tridiagonal
+ *      matrix.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nsweeps: Number of sweeps whose rotations are applied to Z
+ *        together.
+ *      - @c opts.nmin: The rotations are accumulated only if n > nmin.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int steqr(bool want_z,
+          d_t& d,
+          e_t& e,
+          matrix_t& Z,
+          const SteqrOpts& opts = {})
+{
+    using work_t = real_type<matrix_t>;
+    using real_t = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = steqr_worksize<real_t>(want_z, d, e, Z, opts);
+    workspace_vector<real_t> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return steqr_work(want_z, d, e, Z, work, opts);
+}
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_STEQR_HH
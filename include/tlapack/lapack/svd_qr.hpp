@@ -12,83 +12,97 @@
 #ifndef TLAPACK_SVD_QR_HH
 #define TLAPACK_SVD_QR_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/iamax.hpp"
 #include "tlapack/blas/lartg.hpp"
 #include "tlapack/blas/rot.hpp"
 #include "tlapack/blas/swap.hpp"
 #include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/rot_sequence3.hpp"
 #include "tlapack/lapack/singularvalues22.hpp"
 #include "tlapack/lapack/svd22.hpp"
 
 namespace tlapack {
 
 /**
- * Computes the singular values and, optionally, the right and/or
- * left singular vectors from the singular value decomposition (SVD) of
- * a real N-by-N (upper or lower) bidiagonal matrix B using the implicit
- * zero-shift QR algorithm. The SVD of B has the form
- *      B = Q * S * P**T
- * where S is the diagonal matrix of singular values, Q is an orthogonal
- * matrix of left singular vectors, and P is an orthogonal matrix of
- * right singular vectors.  If left singular vectors are requested, this
- * subroutine actually returns U*Q instead of Q, and, if right singular
- * vectors are requested, this subroutine returns P**T*VT instead of
- * P**T, for given real input matrices U and VT.  When U and VT are the
- * orthogonal matrices that reduce a general matrix A to bidiagonal
- * form:  A = U*B*VT, as computed by gebrd, then
- *      A = (U*Q) * S * (P**T*VT)
- * is the SVD of A.
- *
- * See "Computing  Small Singular Values of Bidiagonal Matrices With
- * Guaranteed High Relative Accuracy," by J. Demmel and W. Kahan,
- * LAPACK Working Note #3 (or SIAM J. Sci. Statist. Comput. vol. 11,
- * no. 5, pp. 873-912, Sept 1990) and
- * "Accurate singular values and differential qd algorithms," by
- * B. Parlett and V. Fernando, Technical Report CPAM-554, Mathematics
- * Department, University of California at Berkeley, July 1992
- * for a detailed description of the algorithm.
- *
- * @return  0 if success
+ * Options struct for svd_qr
+ */
+struct SvdQrOpts {
+    /// Number of QR sweeps whose rotations are accumulated before they are
+    /// applied to U and Vt by rot_sequence3(). If nsweeps <= 1, each rotation
+    /// is applied to U and Vt as soon as it is computed. 0: tuned value, see
+    /// tuned_option()
+    size_t nsweeps = 0;
+    /// The rotations are accumulated only if n > nmin. 0: tuned value, see
+    /// tuned_option()
+    size_t nmin = 0;
+};
+
+/** Workspace query of svd_qr()
  *
  * @param[in] uplo
- *      Uplo::Upper, B is upper bidiagonal
- *      Uplo::Lower, B is lower bidiagonal
- *
  * @param[in] want_u bool
- *
  * @param[in] want_vt bool
+ * @param[in] d Real vector of length n.
+ * @param[in] e Real vector of length n-1.
+ * @param[in] U nu-by-n matrix.
+ * @param[in] Vt n-by-nvt matrix.
+ * @param[in] opts Options.
  *
- * @param[in,out] d Real vector of length n.
- *      On entry, diagonal elements of the bidiagonal matrix B.
- *      On exit, the singular values of B in decreasing order.
+ * @return WorkInfo The amount workspace required.
  *
- * @param[in,out] e Real vector of length n-1.
- *      On entry, off-diagonal elements of the bidiagonal matrix B.
- *      On exit, the singular values of B in decreasing order.
- *
- * @param[in,out] U nu-by-m matrix.
- *      On entry, an nu-by-n unitary matrix.
- *      On exit, U is overwritten by U * Q.
+ * @ingroup workspace_query
+ */
+template <class T, class matrix_t, class d_t, class e_t>
+constexpr WorkInfo svd_qr_worksize(Uplo uplo,
+                                   bool want_u,
+                                   bool want_vt,
+                                   const d_t& d,
+                                   const e_t& e,
+                                   const matrix_t& U,
+                                   const matrix_t& Vt,
+                                   const SvdQrOpts& opts = {})
+{
+    using TU = type_t<matrix_t>;
+
+    const size_t n = size(d);
+    const size_t nsweeps =
+        tuned_option<TU>(opts.nsweeps, "svd_qr", "nsweeps", n, 32);
+    const size_t nmin = tuned_option<TU>(opts.nmin, "svd_qr", "nmin", n, 128);
+
+    // Cosines and sines of the rotations accumulated for U and for Vt
+    const size_t nmat = size_t(want_u) + size_t(want_vt);
+    if (nmat > 0 && nsweeps > 1 && n > nmin)
+        return WorkInfo(n - 1, 2 * nmat * nsweeps);
+
+    return WorkInfo(0);
+}
+
+/** @copybrief svd_qr()
+ * Workspace is provided as an argument.
+ * @copydetails svd_qr()
  *
- * @param[in,out] Vt n-by-nvt matrix.
- *      On entry, an n-by-nvt unitary matrix.
- *      On exit, Vt is overwritten by P^H * Vt.
+ * @param work Real workspace. Use the workspace query to determine the size
+ *      needed.
  *
  * @ingroup computational
  */
 template <class matrix_t,
           class d_t,
           class e_t,
+          TLAPACK_WORKSPACE work_t,
           enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
           enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
-int svd_qr(Uplo uplo,
-           bool want_u,
-           bool want_vt,
-           d_t& d,
-           e_t& e,
-           matrix_t& U,
-           matrix_t& Vt)
+int svd_qr_work(Uplo uplo,
+                bool want_u,
+                bool want_vt,
+                d_t& d,
+                e_t& e,
+                matrix_t& U,
+                matrix_t& Vt,
+                work_t& work,
+                const SvdQrOpts& opts = {})
 {
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
@@ -108,6 +122,88 @@ int svd_qr(Uplo uplo,
     // Quick return
     if (n == 0) return 0;
 
+    // The rotations of up to nsweeps consecutive sweeps in the same direction
+    // are stored in the columns of CU and SU, for U, and of CV and SV, for
+    // Vt. They are applied to the columns zlo:zhi of U and to the rows zlo:zhi
+    // of Vt at once by rot_sequence3()
+    const idx_t nsweeps_opt =
+        tuned_option<T>(opts.nsweeps, "svd_qr", "nsweeps", n, 32);
+    const bool accumulate =
+        (want_u || want_vt) && nsweeps_opt > 1 &&
+        n > (idx_t)tuned_option<T>(opts.nmin, "svd_qr", "nmin", n, 128);
+    const idx_t nsweeps = (accumulate) ? nsweeps_opt : 0;
+    const idx_t nu = (accumulate && want_u) ? n - 1 : 0;
+    const idx_t nv = (accumulate && want_vt) ? n - 1 : 0;
+    auto [CU, work1] = reshape(work, nu, nsweeps);
+    auto [SU, work2] = reshape(work1, nu, nsweeps);
+    auto [CV, work3] = reshape(work2, nv, nsweeps);
+    auto [SV, work4] = reshape(work3, nv, nsweeps);
+    idx_t jsweep = 0;
+    idx_t zlo = n;
+    idx_t zhi = 0;
+    bool zforward = true;
+
+    // Applies the accumulated rotations to U and Vt
+    auto flush_rotations = [&]() {
+        if (jsweep == 0) return;
+        // rot_sequence3() applies rotation 0 first in the backward direction
+        const Direction direction =
+            (zforward) ? Direction::Backward : Direction::Forward;
+        if (want_u) {
+            const auto Cj = slice(CU, range{zlo, zhi - 1}, range{0, jsweep});
+            const auto Sj = slice(SU, range{zlo, zhi - 1}, range{0, jsweep});
+            auto Uj = cols(U, range{zlo, zhi});
+            rot_sequence3(RIGHT_SIDE, direction, Cj, Sj, Uj);
+        }
+        if (want_vt) {
+            const auto Cj = slice(CV, range{zlo, zhi - 1}, range{0, jsweep});
+            const auto Sj = slice(SV, range{zlo, zhi - 1}, range{0, jsweep});
+            auto Vtj = rows(Vt, range{zlo, zhi});
+            rot_sequence3(LEFT_SIDE, direction, Cj, Sj, Vtj);
+        }
+        jsweep = 0;
+        zlo = n;
+        zhi = 0;
+    };
+
+    // Starts a new column of rotations acting on the indices i0:i1. The
+    // accumulated rotations are applied first if the direction changes, or
+    // if i0:i1 is not a large part of the indices zlo:zhi they act on
+    auto new_sweep = [&](bool forward, idx_t i0, idx_t i1) {
+        if (jsweep > 0 && (forward != zforward || i0 < zlo || i1 > zhi ||
+                           2 * (i1 - i0) < zhi - zlo))
+            flush_rotations();
+        zforward = forward;
+        zlo = min(zlo, i0);
+        zhi = max(zhi, i1);
+        for (idx_t i = 0; i < nu; ++i) {
+            CU(i, jsweep) = one;
+            SU(i, jsweep) = zero;
+        }
+        for (idx_t i = 0; i < nv; ++i) {
+            CV(i, jsweep) = one;
+            SV(i, jsweep) = zero;
+        }
+    };
+
+    // Stores the rotations acting on the indices i and i+1 of U and Vt
+    auto store_rotations = [&](idx_t i, real_t cu, real_t su, real_t cv,
+                               real_t sv) {
+        if (want_u) {
+            CU(i, jsweep) = cu;
+            SU(i, jsweep) = su;
+        }
+        if (want_vt) {
+            CV(i, jsweep) = cv;
+            SV(i, jsweep) = sv;
+        }
+    };
+
+    // Finishes the current column of rotations
+    auto end_sweep = [&]() {
+        if (++jsweep == nsweeps) flush_rotations();
+    };
+
     // If the matrix is lower bidiagonal, apply a sequence of rotations
     // to make it upper bidiagonal.
     if (uplo == Uplo::Lower) {
@@ -164,6 +260,7 @@ int svd_qr(Uplo uplo,
     for (idx_t iter = 0; iter <= itmax; ++iter) {
         if (iter == itmax) {
             // The QR algorithm failed to converge, return with error.
+            if (accumulate) flush_rotations();
             return istop;
         }
 
@@ -201,15 +298,22 @@ int svd_qr(Uplo uplo,
             e[istart] = zero;
 
             // Update singular vectors if desired
-            if (want_u) {
-                auto u1 = col(U, istart);
-                auto u2 = col(U, istart + 1);
-                rot(u1, u2, csl, snl);
+            if (accumulate) {
+                new_sweep(zforward, istart, istart + 2);
+                store_rotations(istart, csl, snl, csr, snr);
+                end_sweep();
             }
-            if (want_vt) {
-                auto vt1 = row(Vt, istart);
-                auto vt2 = row(Vt, istart + 1);
-                rot(vt1, vt2, csr, snr);
+            else {
+                if (want_u) {
+                    auto u1 = col(U, istart);
+                    auto u2 = col(U, istart + 1);
+                    rot(u1, u2, csl, snl);
+                }
+                if (want_vt) {
+                    auto vt1 = row(Vt, istart);
+                    auto vt2 = row(Vt, istart + 1);
+                    rot(vt1, vt2, csr, snr);
+                }
             }
 
             istop = istop - 2;
@@ -310,23 +414,29 @@ int svd_qr(Uplo uplo,
                 sn = zero;
                 oldcs = one;
                 oldsn = zero;
+                if (accumulate) new_sweep(true, istart, istop);
                 for (idx_t i = istart; i < istop - 1; ++i) {
                     lartg(d[i] * cs, e[i], cs, sn, r);
                     if (i > istart) e[i - 1] = oldsn * r;
                     lartg(oldcs * r, d[i + 1] * sn, oldcs, oldsn, d[i]);
 
                     // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i);
-                        auto u2 = col(U, i + 1);
-                        rot(u1, u2, oldcs, oldsn);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i);
-                        auto vt2 = row(Vt, i + 1);
-                        rot(vt1, vt2, cs, sn);
+                    if (accumulate)
+                        store_rotations(i, oldcs, oldsn, cs, sn);
+                    else {
+                        if (want_u) {
+                            auto u1 = col(U, i);
+                            auto u2 = col(U, i + 1);
+                            rot(u1, u2, oldcs, oldsn);
+                        }
+                        if (want_vt) {
+                            auto vt1 = row(Vt, i);
+                            auto vt2 = row(Vt, i + 1);
+                            rot(vt1, vt2, cs, sn);
+                        }
                     }
                 }
+                if (accumulate) end_sweep();
                 real_t h = d[istop - 1] * cs;
                 d[istop - 1] = h * oldcs;
                 e[istop - 2] = h * oldsn;
@@ -337,23 +447,29 @@ int svd_qr(Uplo uplo,
                 sn = zero;
                 oldcs = one;
                 oldsn = zero;
+                if (accumulate) new_sweep(false, istart, istop);
                 for (idx_t i = istop - 1; i > istart; --i) {
                     lartg(d[i] * cs, e[i - 1], cs, sn, r);
                     if (i < istop - 1) e[i] = oldsn * r;
                     lartg(oldcs * r, d[i - 1] * sn, oldcs, oldsn, d[i]);
 
                     // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i - 1);
-                        auto u2 = col(U, i);
-                        rot(u1, u2, cs, -sn);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i - 1);
-                        auto vt2 = row(Vt, i);
-                        rot(vt1, vt2, oldcs, -oldsn);
+                    if (accumulate)
+                        store_rotations(i - 1, cs, -sn, oldcs, -oldsn);
+                    else {
+                        if (want_u) {
+                            auto u1 = col(U, i - 1);
+                            auto u2 = col(U, i);
+                            rot(u1, u2, cs, -sn);
+                        }
+                        if (want_vt) {
+                            auto vt1 = row(Vt, i - 1);
+                            auto vt2 = row(Vt, i);
+                            rot(vt1, vt2, oldcs, -oldsn);
+                        }
                     }
                 }
+                if (accumulate) end_sweep();
                 real_t h = d[istart] * cs;
                 d[istart] = h * oldcs;
                 e[istart] = h * oldsn;
@@ -366,6 +482,7 @@ int svd_qr(Uplo uplo,
                 real_t f = (abs(d[istart]) - shift) *
                            (real_t(sgn(d[istart])) + shift / d[istart]);
                 real_t g = e[istart];
+                if (accumulate) new_sweep(true, istart, istop);
                 for (idx_t i = istart; i < istop - 1; ++i) {
                     real_t r, csl, snl, csr, snr;
                     lartg(f, g, csr, snr, r);
@@ -385,23 +502,29 @@ int svd_qr(Uplo uplo,
                     }
 
                     // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i);
-                        auto u2 = col(U, i + 1);
-                        rot(u1, u2, csl, snl);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i);
-                        auto vt2 = row(Vt, i + 1);
-                        rot(vt1, vt2, csr, snr);
+                    if (accumulate)
+                        store_rotations(i, csl, snl, csr, snr);
+                    else {
+                        if (want_u) {
+                            auto u1 = col(U, i);
+                            auto u2 = col(U, i + 1);
+                            rot(u1, u2, csl, snl);
+                        }
+                        if (want_vt) {
+                            auto vt1 = row(Vt, i);
+                            auto vt2 = row(Vt, i + 1);
+                            rot(vt1, vt2, csr, snr);
+                        }
                     }
                 }
                 e[istop - 2] = f;
+                if (accumulate) end_sweep();
             }
             else {
                 real_t f = (abs(d[istop - 1]) - shift) *
                            (real_t(sgn(d[istop - 1])) + shift / d[istop - 1]);
                 real_t g = e[istop - 2];
+                if (accumulate) new_sweep(false, istart, istop);
                 for (idx_t i = istop - 1; i > istart; --i) {
                     real_t r, csl, snl, csr, snr;
                     lartg(f, g, csr, snr, r);
@@ -421,22 +544,29 @@ int svd_qr(Uplo uplo,
                     }
 
                     // Update singular vectors if desired
-                    if (want_u) {
-                        auto u1 = col(U, i - 1);
-                        auto u2 = col(U, i);
-                        rot(u1, u2, csr, -snr);
-                    }
-                    if (want_vt) {
-                        auto vt1 = row(Vt, i - 1);
-                        auto vt2 = row(Vt, i);
-                        rot(vt1, vt2, csl, -snl);
+                    if (accumulate)
+                        store_rotations(i - 1, csr, -snr, csl, -snl);
+                    else {
+                        if (want_u) {
+                            auto u1 = col(U, i - 1);
+                            auto u2 = col(U, i);
+                            rot(u1, u2, csr, -snr);
+                        }
+                        if (want_vt) {
+                            auto vt1 = row(Vt, i - 1);
+                            auto vt2 = row(Vt, i);
+                            rot(vt1, vt2, csl, -snl);
+                        }
                     }
                 }
                 e[istart] = f;
+                if (accumulate) end_sweep();
             }
         }
     }
 
+    if (accumulate) flush_rotations();
+
     // All singular values converged, so make them positive
     for (idx_t i = 0; i < n; ++i) {
         if (d[i] < zero) {
@@ -471,6 +601,94 @@ int svd_qr(Uplo uplo,
     return 0;
 }
 
+/**
+ * Computes the singular values and, optionally, the right and/or
+ * left singular vectors from the singular value decomposition (SVD) of
+ * a real N-by-N (upper or lower) bidiagonal matrix B using the implicit
+ * zero-shift QR algorithm. The SVD of B has the form
+ *      B = Q * S * P**T
+ * where S is the diagonal matrix of singular values, Q is an orthogonal
+ * matrix of left singular vectors, and P is an orthogonal matrix of
+ * right singular vectors.  If left singular vectors are requested, this
+ * subroutine actually returns U*Q instead of Q, and, if right singular
+ * vectors are requested, this subroutine returns P**T*VT instead of
+ * P**T, for given real input matrices U and VT.  When U and VT are the
+ * orthogonal matrices that reduce a general matrix A to bidiagonal
+ * form:  A = U*B*VT, as computed by gebrd, then
+ *      A = (U*Q) * S * (P**T*VT)
+ * is the SVD of A.
+ *
+ * See "Computing  Small Singular Values of Bidiagonal Matrices With
+ * Guaranteed High Relative Accuracy," by J. Demmel and W. Kahan,
+ * LAPACK Working Note #3 (or SIAM J. Sci. Statist. Comput. vol. 11,
+ * no. 5, pp. 873-912, Sept 1990) and
+ * "Accurate singular values and differential qd algorithms," by
+ * B. Parlett and V. Fernando, Technical Report CPAM-554, Mathematics
+ * Department, University of California at Berkeley, July 1992
+ * for a detailed description of the algorithm.
+ *
+ * @return  0 if success
+ *
+ * @param[in] uplo
+ *      Uplo::Upper, B is upper bidiagonal
+ *      Uplo::Lower, B is lower bidiagonal
+ *
+ * @param[in] want_u bool
+ *
+ * @param[in] want_vt bool
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, diagonal elements of the bidiagonal matrix B.
+ *      On exit, the singular values of B in decreasing order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, off-diagonal elements of the bidiagonal matrix B.
+ *      On exit, the singular values of B in decreasing order.
+ *
+ * @param[in,out] U nu-by-m matrix.
+ *      On entry, an nu-by-n unitary matrix.
+ *      On exit, U is overwritten by U * Q.
+ *
+ * @param[in,out] Vt n-by-nvt matrix.
+ *      On entry, an n-by-nvt unitary matrix.
+ *      On exit, Vt is overwritten by P^H * Vt.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nsweeps: Number of sweeps whose rotations are applied to U
+ *        and Vt together.
+ *      - @c opts.nmin: The rotations are accumulated only if n > nmin.
+ *
+ * @ingroup alloc_workspace
+ */
+template <class matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int svd_qr(Uplo uplo,
+           bool want_u,
+           bool want_vt,
+           d_t& d,
+           e_t& e,
+           matrix_t& U,
+           matrix_t& Vt,
+           const SvdQrOpts& opts = {})
+{
+    using work_t = real_type<matrix_t>;
+    using real_t = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo =
+        svd_qr_worksize<real_t>(uplo, want_u, want_vt, d, e, U, Vt, opts);
+    workspace_vector<real_t> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return svd_qr_work(uplo, want_u, want_vt, d, e, U, Vt, work, opts);
+}
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_SVD_QR_HH
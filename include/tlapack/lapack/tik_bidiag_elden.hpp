@@ -82,7 +82,7 @@ void tik_bidiag_elden(matrixA_t& A, matrixb_t& b, real_t lambda)
         e[j] = real(A(j, j + 1));
 
     // Declare and initialize baug
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, n, k);
 
     // Augment zeros onto b
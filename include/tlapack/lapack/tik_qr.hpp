@@ -51,7 +51,7 @@ void tik_qr(matrixA_t& A, matrixb_t& b, real_t lambda)
     const idx_t k = ncols(b);
 
     // Do a QR factorization on A
-    std::vector<T> tau1_;
+    workspace_vector<T> tau1_;
     auto tau1 = new_vector(tau1_, n);
 
     geqrf(A, tau1);
@@ -60,7 +60,7 @@ void tik_qr(matrixA_t& A, matrixb_t& b, real_t lambda)
     unmqr(LEFT_SIDE, CONJ_TRANS, A, tau1, b);
 
     // Initailize R augmented L
-    std::vector<T> Raug_;
+    workspace_vector<T> Raug_;
     auto Raug = new_matrix(Raug_, n + n, n);
     laset(GENERAL, real_t(0), real_t(0), Raug);
 
@@ -70,13 +70,13 @@ void tik_qr(matrixA_t& A, matrixb_t& b, real_t lambda)
     laset(GENERAL, real_t(0), lambda, lam_view);
 
     // Do a QR factorization on Raug
-    std::vector<T> tau2_;
+    workspace_vector<T> tau2_;
     auto tau2 = new_vector(tau2_, n);
 
     geqrf(Raug, tau2);
 
     // Initalize b augmented with zeros
-    std::vector<T> baug_;
+    workspace_vector<T> baug_;
     auto baug = new_matrix(baug_, n + n, k);
 
     auto b_bottom = slice(baug, range{n, n + n}, range{0, k});
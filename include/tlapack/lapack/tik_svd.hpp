@@ -73,9 +73,9 @@ void tik_svd(matrixA_t& A, matrixb_t& b, real_t lambda)
         e[j] = real(A(j, j + 1));
 
     // Allocate and initialize Q2 and P2
-    std::vector<T> Q2_;
+    workspace_vector<T> Q2_;
     auto Q2 = new_matrix(Q2_, n, n);
-    std::vector<T> P2_;
+    workspace_vector<T> P2_;
     auto P2 = new_matrix(P2_, n, n);
     const real_t zero(0);
     const real_t one(1);
@@ -85,7 +85,7 @@ void tik_svd(matrixA_t& A, matrixb_t& b, real_t lambda)
     int err = svd_qr(Uplo::Upper, true, true, d, e, Q2, P2);
 
     // Apply Q2ᴴ
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, n, k);
     gemm(CONJ_TRANS, NO_TRANS, real_t(1), Q2, x, work);
 
@@ -0,0 +1,216 @@
+/// @file tik_svd_path.hpp Solves a Tikhonov regularized least squares problem
+/// for a sequence of regularization parameters using one SVD.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TIK_SVD_PATH_HH
+#define TLAPACK_TIK_SVD_PATH_HH
+
+#include <limits>
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/bidiag.hpp>
+#include <tlapack/lapack/laset.hpp>
+#include <tlapack/lapack/svd_qr.hpp>
+#include <tlapack/lapack/unmlq.hpp>
+#include <tlapack/lapack/unmqr.hpp>
+
+/**
+ * @brief Solves the Tikhonov regularized least squares problems
+ * \[
+ *      \min_x \|A x - b\|_2^2 + \lambda_l^2 \|x\|_2^2
+ * \]
+ * for all parameters $\lambda_l$ of the vector lambdas.
+ *
+ * tik_svd() computes the bidiagonalization and the SVD of A for each lambda.
+ * Here, they are computed once: with $A = U \Sigma V^H$ and $c = U^H b$,
+ * each solution is $x_l = V diag(\sigma_i / (\sigma_i^2 + \lambda_l^2)) c$,
+ * which costs $O(n^2 k)$ operations per lambda instead of $O(m n^2)$.
+ *
+ * The norms of the residual and of the solution, and the generalized
+ * cross-validation function
+ * \[
+ *      G(\lambda) = \frac{\|A x - b\|_F^2}
+ *                        {(m - \sum_i \sigma_i^2/(\sigma_i^2+\lambda^2))^2},
+ * \]
+ * are evaluated from the SVD in $O(n k)$ operations per lambda. The pairs
+ * (rnorm[l], xnorm[l]) are the points of the L-curve.
+ *
+ * Singular values $\sigma_i \le \max(m,n) \epsilon \sigma_1$, where
+ * $\epsilon$ is the machine precision, are treated as zero: they are not used
+ * in the solutions, and the corresponding components of b count in the
+ * residual.
+ *
+ * @param[in,out] A is an m-by-n matrix where m >= n.
+ *      On exit, A is overwritten by its bidiagonal decomposition.
+ * @param[in,out] b
+ *      On entry, b is a m-by-k matrix.
+ *
+ *      On exit, b is overwritten by $Q_1^H b$, where $Q_1$ is the left
+ *      orthogonal factor of the bidiagonal decomposition.
+ * @param[in] lambdas Vector of size nl with the regularization parameters.
+ *      If lambdas[l] = 0, x_l is the minimum norm least squares solution
+ *      of the problem truncated to the numerical rank of A.
+ * @param[out] X n-by-(nl*k) matrix. The columns l*k to (l+1)*k-1 store the
+ *      solution for lambdas[l]. If X has no columns, the solutions are not
+ *      computed.
+ * @param[out] rnorm Vector of size nl. rnorm[l] = $\|A x_l - b\|_F$.
+ * @param[out] xnorm Vector of size nl. xnorm[l] = $\|x_l\|_F$.
+ * @param[out] gcv Vector of size nl. gcv[l] = $G(\lambda_l)$, or +inf if the
+ *      denominator of $G(\lambda_l)$ is zero, e.g., for $\lambda_l = 0$ and
+ *      m = n.
+ *
+ * @return The index l that minimizes gcv[l], or 0 if lambdas is empty.
+ */
+
+using namespace tlapack;
+
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixb_t,
+          TLAPACK_VECTOR lambdas_t,
+          TLAPACK_SMATRIX matrixX_t,
+          TLAPACK_VECTOR rnorm_t,
+          TLAPACK_VECTOR xnorm_t,
+          TLAPACK_VECTOR gcv_t>
+size_type<matrixA_t> tik_svd_path(matrixA_t& A,
+                                  matrixb_t& b,
+                                  const lambdas_t& lambdas,
+                                  matrixX_t& X,
+                                  rnorm_t& rnorm,
+                                  xnorm_t& xnorm,
+                                  gcv_t& gcv)
+{
+    using T = type_t<matrixA_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+    using range = pair<idx_t, idx_t>;
+
+    Create<matrixA_t> new_matrix;
+
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = ncols(b);
+    const idx_t nl = size(lambdas);
+    const bool want_x = (ncols(X) > 0);
+
+    // check arguments
+    tlapack_check(m >= n);
+    tlapack_check(nrows(b) == m);
+    tlapack_check(!want_x || (nrows(X) == n && ncols(X) == nl * k));
+    tlapack_check(size(rnorm) >= nl && size(xnorm) >= nl && size(gcv) >= nl);
+
+    // quick return
+    if (nl == 0) return 0;
+
+    std::vector<T> tauv(n);
+    std::vector<T> tauw(n);
+
+    // Bidiagonal decomposition and c = Q1ᴴ b
+    bidiag(A, tauv, tauw);
+    unmqr(LEFT_SIDE, CONJ_TRANS, A, tauv, b);
+
+    // Extract diagonal and superdiagonal
+    std::vector<real_t> d(n);
+    std::vector<real_t> e(max(n, idx_t(1)) - 1);
+    for (idx_t j = 0; j < n; ++j)
+        d[j] = real(A(j, j));
+    for (idx_t j = 0; j + 1 < n; ++j)
+        e[j] = real(A(j, j + 1));
+
+    // SVD of the bidiagonal matrix, B = Q2 diag(d) P2
+    workspace_vector<T> Q2_;
+    auto Q2 = new_matrix(Q2_, n, n);
+    workspace_vector<T> P2_;
+    auto P2 = new_matrix(P2_, n, n);
+    laset(Uplo::General, real_t(0), real_t(1), Q2);
+    laset(Uplo::General, real_t(0), real_t(1), P2);
+    svd_qr(Uplo::Upper, true, true, d, e, Q2, P2);
+
+    // c = Q2ᴴ (Q1ᴴ b)(0:n,:)
+    workspace_vector<T> C_;
+    auto C = new_matrix(C_, n, k);
+    auto b1 = slice(b, range{0, n}, range{0, k});
+    gemm(CONJ_TRANS, NO_TRANS, real_t(1), Q2, b1, C);
+
+    // V = P1ᴴ P2ᴴ, so that x = V w
+    workspace_vector<T> V_;
+    auto V = new_matrix(V_, n, n);
+    if (want_x) {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                V(i, j) = conj(P2(j, i));
+        if (n > 1) {
+            auto V1 = slice(V, range{1, n}, range{0, n});
+            unmlq(LEFT_SIDE, CONJ_TRANS, slice(A, range{0, n - 1}, range{1, n}),
+                  slice(tauw, range{0, n - 1}), V1);
+        }
+    }
+
+    // Squared norms of the columns of c and of the part of b outside the
+    // range of A
+    std::vector<real_t> c2(n, real_t(0));
+    for (idx_t j = 0; j < k; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            c2[i] += real(C(i, j) * conj(C(i, j)));
+    real_t r2perp(0);
+    for (idx_t j = 0; j < k; ++j)
+        for (idx_t i = n; i < m; ++i)
+            r2perp += real(b(i, j) * conj(b(i, j)));
+
+    workspace_vector<T> W_;
+    auto W = new_matrix(W_, n, k);
+    std::vector<real_t> f(n);
+
+    // Rank tolerance
+    real_t dmax(0);
+    for (idx_t i = 0; i < n; ++i)
+        dmax = max(dmax, abs(d[i]));
+    const real_t rtol = real_t(max(m, n)) * ulp<real_t>() * dmax;
+
+    idx_t lbest = 0;
+    for (idx_t l = 0; l < nl; ++l) {
+        const real_t lambda2 = real_t(lambdas[l]) * real_t(lambdas[l]);
+
+        // Filter factors d/(d²+λ²), and residual, solution norm and GCV
+        // function. Singular values below the rank tolerance contribute
+        // nothing to the solution, as in the minimum norm least squares
+        // solution.
+        real_t r2 = r2perp, x2(0), trace(0);
+        for (idx_t i = 0; i < n; ++i) {
+            const real_t s2 = d[i] * d[i];
+            const real_t den = s2 + lambda2;
+            if (abs(d[i]) <= rtol || den == real_t(0)) {
+                f[i] = real_t(0);
+                r2 += c2[i];
+                continue;
+            }
+            const real_t g = lambda2 / den;
+            f[i] = d[i] / den;
+            r2 += g * g * c2[i];
+            x2 += f[i] * f[i] * c2[i];
+            trace += s2 / den;
+        }
+        rnorm[l] = sqrt(r2);
+        xnorm[l] = sqrt(x2);
+        const real_t dof = real_t(m) - trace;
+        gcv[l] = (dof > real_t(0)) ? r2 / (dof * dof)
+                                   : std::numeric_limits<real_t>::infinity();
+        if (gcv[l] < gcv[lbest]) lbest = l;
+
+        // Solution x = V diag(f) c
+        if (want_x) {
+            for (idx_t j = 0; j < k; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    W(i, j) = f[i] * C(i, j);
+            auto Xl = slice(X, range{0, n}, range{l * k, (l + 1) * k});
+            gemm(NO_TRANS, NO_TRANS, real_t(1), V, W, Xl);
+        }
+    }
+
+    return lbest;
+}
+
+#endif  // TLAPACK_TIK_SVD_PATH_HH
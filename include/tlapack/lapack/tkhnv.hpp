@@ -1,6 +1,7 @@
 #include "tik_bidiag_elden.hpp"
 #include "tik_qr.hpp"
 #include "tik_svd.hpp"
+#include "tik_svd_path.hpp"
 #include "tlapack/base/utils.hpp"
 
 using namespace tlapack;
@@ -0,0 +1,789 @@
+/// @file trevc3.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dtrevc3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TREVC3_HH
+#define TLAPACK_TREVC3_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lahqr_eig22.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for trevc3
+ */
+struct Trevc3Opts {
+    /// Number of eigenvectors back-transformed at once by gemm(). nb >= 2,
+    /// or 0: tuned value, see tuned_option()
+    size_t nb = 0;
+};
+
+namespace internal {
+
+    /**
+     * Solves the 2-by-2 system
+     *
+     *      [ a  b ] [ x1 ]       [ b1 ]
+     *      [ c  d ] [ x2 ] = s * [ b2 ]
+     *
+     * using Gaussian elimination with complete pivoting. On entry, x1 and x2
+     * contain b1 and b2. Pivots smaller than smin are replaced by smin.
+     *
+     * @return The scale factor s <= 1, chosen so that the entries of the
+     *      solution do not exceed bignum.
+     */
+    template <class S, class real_t>
+    real_t trevc3_solve22(S a,
+                          S b,
+                          S c,
+                          S d,
+                          S& x1,
+                          S& x2,
+                          const real_t& smin,
+                          const real_t& bignum) noexcept
+    {
+        const real_t one(1);
+
+        // Move the entry of largest magnitude to a
+        const real_t cmax = max(max(abs1(a), abs1(b)), max(abs1(c), abs1(d)));
+        const bool swap_cols = (abs1(a) != cmax && abs1(c) != cmax);
+        if (abs1(a) != cmax && abs1(b) != cmax) {
+            std::swap(a, c);
+            std::swap(b, d);
+            std::swap(x1, x2);
+        }
+        if (swap_cols) {
+            std::swap(a, b);
+            std::swap(c, d);
+        }
+
+        if (abs1(a) < smin) a = smin;
+        const S l = c / a;
+        S u = d - l * b;
+        if (abs1(u) < smin) u = smin;
+        S r1 = x1;
+        S r2 = x2 - l * x1;
+
+        // Scale to avoid overflow in the division by u
+        real_t scale = one;
+        const real_t bnd = max(abs1(r1), abs1(r2));
+        if (bnd > one && abs1(u) < one && bnd >= bignum * abs1(u)) {
+            scale = one / bnd;
+            r1 *= scale;
+            r2 *= scale;
+        }
+
+        const S y2 = r2 / u;
+        const S y1 = r1 / a - (b / a) * y2;
+        x1 = swap_cols ? y2 : y1;
+        x2 = swap_cols ? y1 : y2;
+
+        return scale;
+    }
+
+    /**
+     * Solves u x = s b for a scalar x. Pivots smaller than smin are replaced
+     * by smin.
+     *
+     * @return The scale factor s <= 1, chosen so that |x| does not exceed
+     *      bignum.
+     */
+    template <class S, class real_t>
+    real_t trevc3_solve11(S u,
+                          S& x,
+                          const real_t& smin,
+                          const real_t& bignum) noexcept
+    {
+        const real_t one(1);
+
+        if (abs1(u) < smin) u = smin;
+
+        // Scale to avoid overflow in the division by u
+        real_t scale = one;
+        if (abs1(u) < one && abs1(x) >= bignum * abs1(u)) {
+            scale = one / abs1(x);
+            x *= scale;
+        }
+        x /= u;
+
+        return scale;
+    }
+
+    /**
+     * Solves (T(0:k,0:k) - lambda I) x = s b by backward substitution, where
+     * T is upper quasi-triangular. On entry, get(i) returns b(i). On exit,
+     * get(i) returns x(i). set(i, v) stores v in the i-th entry, and
+     * scale(s) multiplies all the entries by s.
+     *
+     * The scale factor s <= 1 prevents overflow as in LAPACK's xLATRS.
+     * cnorm[j] is the 1-norm of T(0:j,j).
+     */
+    template <class matrix_t,
+              class S,
+              class real_t,
+              class cnorm_t,
+              class get_t,
+              class set_t,
+              class scale_t>
+    void trevc3_backsolve(const matrix_t& T,
+                          size_type<matrix_t> k,
+                          const S& lambda,
+                          const real_t& smin,
+                          const cnorm_t& cnorm,
+                          get_t&& get,
+                          set_t&& set,
+                          scale_t&& scale)
+    {
+        using idx_t = size_type<matrix_t>;
+        using TT = type_t<matrix_t>;
+
+        const real_t one(1);
+        const real_t eps = ulp<real_t>();
+        const real_t smlnum = safe_min<real_t>() * (real_t(ncols(T)) / eps);
+        const real_t bignum = (one - eps) / smlnum;
+
+        idx_t j = k;
+        while (j > 0) {
+            if (is_real<TT> && j >= 2 && T(j - 1, j - 2) != TT(0)) {
+                // 2-by-2 diagonal block in rows j-2 and j-1
+                S x1 = get(j - 2);
+                S x2 = get(j - 1);
+                const real_t s = trevc3_solve22(
+                    S(T(j - 2, j - 2)) - lambda, S(T(j - 2, j - 1)),
+                    S(T(j - 1, j - 2)), S(T(j - 1, j - 1)) - lambda, x1, x2,
+                    smin, bignum);
+                if (s != one) scale(s);
+
+                // Scale to avoid overflow when updating the right-hand side
+                const real_t xnorm = max(abs1(x1), abs1(x2));
+                const real_t beta =
+                    real(cnorm[j - 2]) + real(cnorm[j - 1]);
+                if (xnorm > one && beta > bignum / xnorm) {
+                    scale(one / xnorm);
+                    x1 /= xnorm;
+                    x2 /= xnorm;
+                }
+
+                set(j - 2, x1);
+                set(j - 1, x2);
+                for (idx_t i = 0; i + 2 < j; ++i)
+                    set(i, get(i) - T(i, j - 2) * x1 - T(i, j - 1) * x2);
+                j -= 2;
+            }
+            else {
+                S x = get(j - 1);
+                const real_t s = trevc3_solve11(S(T(j - 1, j - 1)) - lambda,
+                                                x, smin, bignum);
+                if (s != one) scale(s);
+
+                // Scale to avoid overflow when updating the right-hand side
+                const real_t xnorm = abs1(x);
+                if (xnorm > one && real(cnorm[j - 1]) > bignum / xnorm) {
+                    scale(one / xnorm);
+                    x /= xnorm;
+                }
+
+                set(j - 1, x);
+                for (idx_t i = 0; i + 1 < j; ++i)
+                    set(i, get(i) - T(i, j - 1) * x);
+                j -= 1;
+            }
+        }
+    }
+
+    /**
+     * Solves (T(k:n,k:n)^H - mu I) y = s b by forward substitution, where T
+     * is upper quasi-triangular. On entry, get(i) returns b(i). On exit,
+     * get(i) returns y(i). set(i, v) stores v in the i-th entry, and
+     * scale(s) multiplies all the entries by s.
+     *
+     * The scale factor s <= 1 prevents overflow as in LAPACK's xLATRS.
+     * rnorm[j] is the 1-norm of T(j,j+1:n).
+     */
+    template <class matrix_t,
+              class S,
+              class real_t,
+              class rnorm_t,
+              class get_t,
+              class set_t,
+              class scale_t>
+    void trevc3_forwardsolve(const matrix_t& T,
+                             size_type<matrix_t> k,
+                             const S& mu,
+                             const real_t& smin,
+                             const rnorm_t& rnorm,
+                             get_t&& get,
+                             set_t&& set,
+                             scale_t&& scale)
+    {
+        using idx_t = size_type<matrix_t>;
+        using TT = type_t<matrix_t>;
+
+        const idx_t n = ncols(T);
+        const real_t one(1);
+        const real_t eps = ulp<real_t>();
+        const real_t smlnum = safe_min<real_t>() * (real_t(n) / eps);
+        const real_t bignum = (one - eps) / smlnum;
+
+        idx_t j = k;
+        while (j < n) {
+            if (is_real<TT> && j + 1 < n && T(j + 1, j) != TT(0)) {
+                // 2-by-2 diagonal block in rows j and j+1
+                S y1 = get(j);
+                S y2 = get(j + 1);
+                const real_t s = trevc3_solve22(
+                    S(T(j, j)) - mu, S(T(j + 1, j)), S(T(j, j + 1)),
+                    S(T(j + 1, j + 1)) - mu, y1, y2, smin, bignum);
+                if (s != one) scale(s);
+
+                // Scale to avoid overflow when updating the right-hand side
+                const real_t ynorm = max(abs1(y1), abs1(y2));
+                const real_t beta = real(rnorm[j]) + real(rnorm[j + 1]);
+                if (ynorm > one && beta > bignum / ynorm) {
+                    scale(one / ynorm);
+                    y1 /= ynorm;
+                    y2 /= ynorm;
+                }
+
+                set(j, y1);
+                set(j + 1, y2);
+                for (idx_t i = j + 2; i < n; ++i)
+                    set(i, get(i) - T(j, i) * y1 - T(j + 1, i) * y2);
+                j += 2;
+            }
+            else {
+                S y = get(j);
+                const real_t s =
+                    trevc3_solve11(S(conj(T(j, j))) - mu, y, smin, bignum);
+                if (s != one) scale(s);
+
+                // Scale to avoid overflow when updating the right-hand side
+                const real_t ynorm = abs1(y);
+                if (ynorm > one && real(rnorm[j]) > bignum / ynorm) {
+                    scale(one / ynorm);
+                    y /= ynorm;
+                }
+
+                set(j, y);
+                for (idx_t i = j + 1; i < n; ++i)
+                    set(i, get(i) - conj(T(j, i)) * y);
+                j += 1;
+            }
+        }
+    }
+
+    /// Returns the eigenvalue with nonnegative imaginary part of the 2-by-2
+    /// diagonal block of T starting at k
+    template <class matrix_t>
+    complex_type<type_t<matrix_t>> trevc3_eig22(const matrix_t& T,
+                                                size_type<matrix_t> k)
+    {
+        complex_type<type_t<matrix_t>> s1, s2;
+        lahqr_eig22(T(k, k), T(k, k + 1), T(k + 1, k), T(k + 1, k + 1), s1,
+                    s2);
+        return (imag(s1) >= 0) ? s1 : s2;
+    }
+
+    /**
+     * Computes the right eigenvector of the upper quasi-triangular matrix T
+     * associated with the diagonal block that starts at k, and stores it in
+     * the column jx of X. If the block is 2-by-2, the real and imaginary parts
+     * of the eigenvector associated with the eigenvalue with positive
+     * imaginary part are stored in the columns jx and jx+1.
+     *
+     * cnorm[j] is the 1-norm of T(0:j,j). See trevc3_backsolve().
+     *
+     * @return The size of the diagonal block.
+     */
+    template <class matrix_t, class X_t, class cnorm_t>
+    size_type<matrix_t> trevc3_right(const matrix_t& T,
+                                     size_type<matrix_t> k,
+                                     X_t& X,
+                                     size_type<X_t> jx,
+                                     const cnorm_t& cnorm)
+    {
+        using idx_t = size_type<matrix_t>;
+        using TT = type_t<matrix_t>;
+        using real_t = real_type<TT>;
+        using complex_t = complex_type<TT>;
+
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = ncols(T);
+        const idx_t m = nrows(X);
+        const real_t eps = ulp<real_t>();
+        const real_t smlnum = safe_min<real_t>() * (real_t(n) / eps);
+
+        if constexpr (is_real<TT>) {
+            if (k + 1 < n && T(k + 1, k) != TT(0)) {
+                // Complex right eigenvector of a real matrix
+                const complex_t lambda = trevc3_eig22(T, k);
+                const real_t smin = max(eps * abs1(lambda), smlnum);
+
+                complex_t xk, xk1;
+                if (abs(T(k, k + 1)) >= abs(T(k + 1, k))) {
+                    xk = one;
+                    xk1 = (lambda - T(k, k)) / T(k, k + 1);
+                }
+                else {
+                    xk = (lambda - T(k + 1, k + 1)) / T(k + 1, k);
+                    xk1 = one;
+                }
+
+                auto get = [&](idx_t i) {
+                    return complex_t(X(i, jx), X(i, jx + 1));
+                };
+                auto set = [&](idx_t i, const complex_t& v) {
+                    X(i, jx) = real(v);
+                    X(i, jx + 1) = imag(v);
+                };
+                auto scale = [&](const real_t& alpha) {
+                    for (idx_t i = 0; i < k + 2; ++i) {
+                        X(i, jx) *= alpha;
+                        X(i, jx + 1) *= alpha;
+                    }
+                };
+
+                for (idx_t i = 0; i < k; ++i)
+                    set(i, -(T(i, k) * xk + T(i, k + 1) * xk1));
+                set(k, xk);
+                set(k + 1, xk1);
+                for (idx_t i = k + 2; i < m; ++i) {
+                    X(i, jx) = zero;
+                    X(i, jx + 1) = zero;
+                }
+
+                trevc3_backsolve(T, k, lambda, smin, cnorm, get, set, scale);
+
+                return 2;
+            }
+        }
+
+        // Real eigenvector of a real matrix, or eigenvector of a complex
+        // matrix
+        const TT lambda = T(k, k);
+        const real_t smin = max(eps * abs1(lambda), smlnum);
+
+        auto get = [&](idx_t i) { return X(i, jx); };
+        auto set = [&](idx_t i, const TT& v) { X(i, jx) = v; };
+        auto scale = [&](const real_t& alpha) {
+            for (idx_t i = 0; i <= k; ++i)
+                X(i, jx) *= alpha;
+        };
+
+        for (idx_t i = 0; i < k; ++i)
+            X(i, jx) = -T(i, k);
+        X(k, jx) = one;
+        for (idx_t i = k + 1; i < m; ++i)
+            X(i, jx) = zero;
+
+        trevc3_backsolve(T, k, lambda, smin, cnorm, get, set, scale);
+
+        return 1;
+    }
+
+    /**
+     * Computes the left eigenvector of the upper quasi-triangular matrix T
+     * associated with the diagonal block that starts at k, and stores it in
+     * the column jx of X. If the block is 2-by-2, the real and imaginary parts
+     * of the eigenvector associated with the eigenvalue with positive
+     * imaginary part are stored in the columns jx and jx+1.
+     *
+     * rnorm[j] is the 1-norm of T(j,j+1:n). See trevc3_forwardsolve().
+     *
+     * @return The size of the diagonal block.
+     */
+    template <class matrix_t, class X_t, class rnorm_t>
+    size_type<matrix_t> trevc3_left(const matrix_t& T,
+                                    size_type<matrix_t> k,
+                                    X_t& X,
+                                    size_type<X_t> jx,
+                                    const rnorm_t& rnorm)
+    {
+        using idx_t = size_type<matrix_t>;
+        using TT = type_t<matrix_t>;
+        using real_t = real_type<TT>;
+        using complex_t = complex_type<TT>;
+
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = ncols(T);
+        const real_t eps = ulp<real_t>();
+        const real_t smlnum = safe_min<real_t>() * (real_t(n) / eps);
+
+        if constexpr (is_real<TT>) {
+            if (k + 1 < n && T(k + 1, k) != TT(0)) {
+                // Complex left eigenvector of a real matrix
+                const complex_t mu = conj(trevc3_eig22(T, k));
+                const real_t smin = max(eps * abs1(mu), smlnum);
+
+                complex_t yk, yk1;
+                if (abs(T(k + 1, k)) >= abs(T(k, k + 1))) {
+                    yk = one;
+                    yk1 = (mu - T(k, k)) / T(k + 1, k);
+                }
+                else {
+                    yk = (mu - T(k + 1, k + 1)) / T(k, k + 1);
+                    yk1 = one;
+                }
+
+                auto get = [&](idx_t i) {
+                    return complex_t(X(i, jx), X(i, jx + 1));
+                };
+                auto set = [&](idx_t i, const complex_t& v) {
+                    X(i, jx) = real(v);
+                    X(i, jx + 1) = imag(v);
+                };
+                auto scale = [&](const real_t& alpha) {
+                    for (idx_t i = k; i < n; ++i) {
+                        X(i, jx) *= alpha;
+                        X(i, jx + 1) *= alpha;
+                    }
+                };
+
+                for (idx_t i = 0; i < k; ++i) {
+                    X(i, jx) = zero;
+                    X(i, jx + 1) = zero;
+                }
+                set(k, yk);
+                set(k + 1, yk1);
+                for (idx_t i = k + 2; i < n; ++i)
+                    set(i, -(T(k, i) * yk + T(k + 1, i) * yk1));
+
+                trevc3_forwardsolve(T, k + 2, mu, smin, rnorm, get, set,
+                                    scale);
+
+                return 2;
+            }
+        }
+
+        // Real eigenvector of a real matrix, or eigenvector of a complex
+        // matrix
+        const TT mu = conj(T(k, k));
+        const real_t smin = max(eps * abs1(mu), smlnum);
+
+        auto get = [&](idx_t i) { return X(i, jx); };
+        auto set = [&](idx_t i, const TT& v) { X(i, jx) = v; };
+        auto scale = [&](const real_t& alpha) {
+            for (idx_t i = k; i < n; ++i)
+                X(i, jx) *= alpha;
+        };
+
+        for (idx_t i = 0; i < k; ++i)
+            X(i, jx) = zero;
+        X(k, jx) = one;
+        for (idx_t i = k + 1; i < n; ++i)
+            X(i, jx) = -conj(T(k, i));
+
+        trevc3_forwardsolve(T, k + 1, mu, smin, rnorm, get, set, scale);
+
+        return 1;
+    }
+
+    /// Scales the column j of V, or the columns j and j+1 if nk = 2, so that
+    /// the entry of largest magnitude has abs1() = 1
+    template <class matrix_t>
+    void trevc3_normalize(matrix_t& V,
+                          size_type<matrix_t> j,
+                          size_type<matrix_t> nk)
+    {
+        using idx_t = size_type<matrix_t>;
+        using real_t = real_type<type_t<matrix_t>>;
+
+        const idx_t m = nrows(V);
+
+        real_t emax(0);
+        for (idx_t i = 0; i < m; ++i) {
+            const real_t e =
+                (nk == 2) ? abs(V(i, j)) + abs(V(i, j + 1)) : abs1(V(i, j));
+            if (e > emax) emax = e;
+        }
+        if (emax == real_t(0)) return;
+
+        const real_t remax = real_t(1) / emax;
+        for (idx_t jj = j; jj < j + nk; ++jj)
+            for (idx_t i = 0; i < m; ++i)
+                V(i, jj) *= remax;
+    }
+
+}  // namespace internal
+
+/** Workspace query of trevc3()
+ *
+ * @param[in] want_vl bool
+ * @param[in] want_vr bool
+ * @param[in] backtransform bool
+ * @param[in] T n-by-n matrix.
+ * @param[in] VL n-by-n matrix.
+ * @param[in] VR n-by-n matrix.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t>
+constexpr WorkInfo trevc3_worksize(bool want_vl,
+                                   bool want_vr,
+                                   bool backtransform,
+                                   const matrix_t& A,
+                                   const matrix_t& VL,
+                                   const matrix_t& VR,
+                                   const Trevc3Opts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = ncols(A);
+
+    if (!(want_vl || want_vr) || n == 0) return WorkInfo(0);
+
+    // Norms of the rows and columns of T, and the eigenvectors of T and the
+    // back-transformed eigenvectors of a block
+    if (backtransform) {
+        const idx_t nb = max<idx_t>(
+            2, min<idx_t>(tuned_option<T>(opts.nb, "trevc3", "nb", n, 32), n));
+        return WorkInfo(n, 2 + 2 * nb);
+    }
+
+    return WorkInfo(n, 2);
+}
+
+/** @copybrief trevc3()
+ * Workspace is provided as an argument.
+ * @copydetails trevc3()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_WORKSPACE work_t>
+int trevc3_work(bool want_vl,
+                bool want_vr,
+                bool backtransform,
+                const matrix_t& A,
+                matrix_t& VL,
+                matrix_t& VR,
+                work_t& work,
+                const Trevc3Opts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const idx_t nb = max<idx_t>(
+        2, min<idx_t>(tuned_option<T>(opts.nb, "trevc3", "nb", n, 32), n));
+
+    // check arguments
+    tlapack_check(nrows(A) == n);
+    tlapack_check(opts.nb != 1);
+    if (want_vl) {
+        tlapack_check(ncols(VL) == n);
+        tlapack_check(nrows(VL) == n);
+    }
+    if (want_vr) {
+        tlapack_check(ncols(VR) == n);
+        tlapack_check(nrows(VR) == n);
+    }
+
+    // Quick return
+    if (n == 0 || !(want_vl || want_vr)) return 0;
+
+    // Size of the diagonal block of A that starts at k
+    auto block_size = [&](idx_t k) -> idx_t {
+        return (is_real<T> && k + 1 < n && A(k + 1, k) != T(zero)) ? 2 : 1;
+    };
+
+    // 1-norms of the strictly upper triangular parts of the columns and rows
+    // of A, used to prevent overflow in the triangular solves
+    auto [norms, work1] = reshape(work, n, 2);
+    auto cnorm = col(norms, 0);
+    auto rnorm = col(norms, 1);
+    for (idx_t j = 0; j < n; ++j) {
+        cnorm[j] = zero;
+        rnorm[j] = zero;
+    }
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < j; ++i) {
+            cnorm[j] += abs1(A(i, j));
+            rnorm[i] += abs1(A(i, j));
+        }
+
+    if (!backtransform) {
+        // Eigenvectors of A
+        for (idx_t k = 0; k < n;) {
+            idx_t nk = 1;
+            if (want_vr) nk = internal::trevc3_right(A, k, VR, k, cnorm);
+            if (want_vl) nk = internal::trevc3_left(A, k, VL, k, rnorm);
+            k += nk;
+        }
+    }
+    else {
+        // Eigenvectors of a block of at most nb eigenvalues are stored in X.
+        // They are back-transformed by a matrix-matrix product with VR or VL,
+        // which is stored in Y and copied to VR or VL.
+        auto [X, work2] = reshape(work1, n, nb);
+        auto [Y, work3] = reshape(work2, n, nb);
+
+        if (want_vr) {
+            // The eigenvectors k = kbeg, ..., kend-1 only need the columns
+            // 0:kend of VR. Proceed from the last block to the first.
+            for (idx_t kend = n; kend > 0;) {
+                idx_t kbeg = (kend > nb) ? kend - nb : 0;
+                if (kbeg > 0 && block_size(kbeg - 1) == 2) ++kbeg;
+                const idx_t nk = kend - kbeg;
+
+                for (idx_t k = kbeg; k < kend;)
+                    k += internal::trevc3_right(A, k, X, k - kbeg, cnorm);
+
+                const auto Xk = slice(X, range{0, kend}, range{0, nk});
+                auto Yk = slice(Y, range{0, n}, range{0, nk});
+                gemm(NO_TRANS, NO_TRANS, one, cols(VR, range{0, kend}), Xk,
+                     Yk);
+                auto VRk = cols(VR, range{kbeg, kend});
+                lacpy(GENERAL, Yk, VRk);
+
+                kend = kbeg;
+            }
+        }
+
+        if (want_vl) {
+            // The eigenvectors k = kbeg, ..., kend-1 only need the columns
+            // kbeg:n of VL. Proceed from the first block to the last.
+            for (idx_t kbeg = 0; kbeg < n;) {
+                idx_t kend = min(kbeg + nb, n);
+                if (kend < n && block_size(kend - 1) == 2) --kend;
+                const idx_t nk = kend - kbeg;
+
+                for (idx_t k = kbeg; k < kend;)
+                    k += internal::trevc3_left(A, k, X, k - kbeg, rnorm);
+
+                const auto Xk = slice(X, range{kbeg, n}, range{0, nk});
+                auto Yk = slice(Y, range{0, n}, range{0, nk});
+                gemm(NO_TRANS, NO_TRANS, one, cols(VL, range{kbeg, n}), Xk,
+                     Yk);
+                auto VLk = cols(VL, range{kbeg, kend});
+                lacpy(GENERAL, Yk, VLk);
+
+                kbeg = kend;
+            }
+        }
+    }
+
+    // Normalize the eigenvectors
+    for (idx_t k = 0; k < n;) {
+        const idx_t nk = block_size(k);
+        if (want_vr) internal::trevc3_normalize(VR, k, nk);
+        if (want_vl) internal::trevc3_normalize(VL, k, nk);
+        k += nk;
+    }
+
+    return 0;
+}
+
+/**
+ * Computes some or all of the right and/or left eigenvectors of an upper
+ * quasi-triangular matrix T, using level 3 BLAS for the back-transformation.
+ *
+ * Matrices of this type are produced by the Schur factorization of a
+ * general matrix: A = Q T Q^H, as computed by multishift_qr().
+ *
+ * The right eigenvector x and the left eigenvector y of T corresponding to
+ * an eigenvalue w are defined by:
+ *
+ *      T x = w x,  y^H T = w y^H.
+ *
+ * If backtransform is true, this routine returns the matrices Q X and/or
+ * Q Y, where Q is an input matrix. If Q is the unitary factor that reduces a
+ * matrix A to Schur form T, then Q X and Q Y are the matrices of right and
+ * left eigenvectors of A. The eigenvectors are computed nb at a time, and the
+ * back-transformation of each block is a matrix-matrix product.
+ *
+ * If T is real, the 2-by-2 diagonal blocks of T correspond to pairs of
+ * complex conjugate eigenvalues. The real and imaginary parts of the
+ * eigenvector of the eigenvalue with positive imaginary part are stored in
+ * two consecutive columns. The eigenvector of the other eigenvalue of the
+ * pair is the complex conjugate.
+ *
+ * Each eigenvector is scaled so that the element of largest magnitude has
+ * magnitude 1; here the magnitude of a complex number (x,y) is taken to be
+ * |x| + |y|.
+ *
+ * As in the reference LAPACK, the triangular solves are scaled to prevent
+ * overflow, and small pivots are perturbed to avoid division by zero.
+ *
+ * @return 0 if success.
+ *
+ * @param[in] want_vl bool
+ *      If true, compute the left eigenvectors.
+ *
+ * @param[in] want_vr bool
+ *      If true, compute the right eigenvectors.
+ *
+ * @param[in] backtransform bool
+ *      If true, back-transform the eigenvectors using the matrices in VL and
+ *      VR.
+ *
+ * @param[in] T n-by-n upper quasi-triangular matrix.
+ *      If T is complex, it must be upper triangular. If T is real, the 2-by-2
+ *      diagonal blocks must be in the standard form used by multishift_qr().
+ *
+ * @param[in,out] VL n-by-n matrix.
+ *      On entry, if want_vl and backtransform are true, the matrix Q.
+ *      On exit, if want_vl is true, the left eigenvectors in the same order
+ *      as the eigenvalues in the diagonal of T.
+ *      If want_vl is false, VL is not referenced.
+ *
+ * @param[in,out] VR n-by-n matrix.
+ *      On entry, if want_vr and backtransform are true, the matrix Q.
+ *      On exit, if want_vr is true, the right eigenvectors in the same order
+ *      as the eigenvalues in the diagonal of T.
+ *      If want_vr is false, VR is not referenced.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Number of eigenvectors back-transformed at once.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t>
+int trevc3(bool want_vl,
+           bool want_vr,
+           bool backtransform,
+           const matrix_t& T,
+           matrix_t& VL,
+           matrix_t& VR,
+           const Trevc3Opts& opts = {})
+{
+    using work_t = matrix_type<matrix_t>;
+    using TT = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = trevc3_worksize<TT>(want_vl, want_vr, backtransform,
+                                            T, VL, VR, opts);
+    workspace_vector<TT> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return trevc3_work(want_vl, want_vr, backtransform, T, VL, VR, work,
+                       opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TREVC3_HH
@@ -29,7 +29,7 @@ void trge_qr2(matrix_t& A, vector_t& tau)
     idx_t m = nrows(A) - n;
 
     // Generate a workspace
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, m + n, 1);
 
     for (idx_t i = 0; i < n - 1; ++i) {
@@ -39,7 +39,7 @@ void trge_ung2r(matrix_t& W, vector_t& tau)
     auto W0 = slice(W, n - 1, range{n, k});
     auto W1 = slice(W, range{n, m + n}, range{n, k});
 
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, m + n, 1);
 
     if (k > n)
@@ -10,6 +10,7 @@
 #ifndef TLAPACK_TRMM_BLOCKED_MIXED_HH
 #define TLAPACK_TRMM_BLOCKED_MIXED_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/trmm.hpp"
@@ -21,7 +22,7 @@ namespace tlapack {
  * Options struct for trmm_blocked_mixed
  */
 struct TrmmBlockedOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned_default("trmm_blocked", "nb", 32);  ///< Block size
 };
 
 /**
@@ -0,0 +1,130 @@
+/// @file trti2.hpp Computes the inverse of a triangular matrix using a level-2
+/// algorithm.
+/// @note Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/ztrti2.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TRTI2_HH
+#define TLAPACK_TRTI2_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes the inverse of a triangular matrix in-place using a level-2
+ * algorithm.
+ *
+ * The columns of the inverse are computed one at a time. Column j is the
+ * product of the part of the inverse already computed with column j of C,
+ * scaled by -1/C(j,j). The product is a triangular matrix-vector product
+ * that runs down the columns of C, so that the inner loops access contiguous
+ * entries of column-major matrices.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of C is referenced; the strictly lower
+ *      triangular part of C is not referenced.
+ *      - Uplo::Lower: Lower triangle of C is referenced; the strictly upper
+ *      triangular part of C is not referenced.
+ *
+ * @param[in] diag
+ *     Whether C has a unit or non-unit diagonal:
+ *      - Diag::Unit:    C is assumed to be unit triangular.
+ *      - Diag::NonUnit: C is not assumed to be unit triangular.
+ *
+ * @param[in,out] C n-by-n matrix.
+ *      On entry, the n-by-n triangular matrix to be inverted.
+ *      On exit, the inverse. C is not modified if it is singular.
+ *
+ * @param[in] opts Options.
+ *      Define the behavior of Exception Handling.
+ *
+ * @return = 0: successful exit
+ * @return = i+1: if C(i,i) is exactly zero.  The triangular
+ *          matrix is singular and its inverse can not be computed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+int trti2(uplo_t uplo, Diag diag, matrix_t& C, const EcOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t n = nrows(C);
+    const real_t one(1);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false(nrows(C) != ncols(C));
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    // Check for singularity
+    if (diag == Diag::NonUnit) {
+        for (idx_t i = 0; i < n; ++i) {
+            if (C(i, i) == T(0)) {
+                tlapack_error_if(opts.ec.internal, i + 1,
+                                 "A diagonal of entry of triangular "
+                                 "matrix is exactly zero.");
+                return i + 1;
+            }
+        }
+    }
+
+    if (uplo == Uplo::Upper) {
+        for (idx_t j = 0; j < n; ++j) {
+            T ajj;
+            if (diag == Diag::NonUnit) {
+                C(j, j) = one / C(j, j);
+                ajj = -C(j, j);
+            }
+            else
+                ajj = T(-1);
+
+            // C(0:j,j) := ajj * inv(C(0:j,0:j)) * C(0:j,j)
+            for (idx_t k = 0; k < j; ++k) {
+                const T temp = C(k, j);
+                for (idx_t i = 0; i < k; ++i)
+                    C(i, j) += temp * C(i, k);
+                if (diag == Diag::NonUnit) C(k, j) *= C(k, k);
+            }
+            for (idx_t i = 0; i < j; ++i)
+                C(i, j) *= ajj;
+        }
+    }
+    else {
+        for (idx_t j = n; j-- > 0;) {
+            T ajj;
+            if (diag == Diag::NonUnit) {
+                C(j, j) = one / C(j, j);
+                ajj = -C(j, j);
+            }
+            else
+                ajj = T(-1);
+
+            // C(j+1:n,j) := ajj * inv(C(j+1:n,j+1:n)) * C(j+1:n,j)
+            for (idx_t k = n; k-- > j + 1;) {
+                const T temp = C(k, j);
+                for (idx_t i = k + 1; i < n; ++i)
+                    C(i, j) += temp * C(i, k);
+                if (diag == Diag::NonUnit) C(k, j) *= C(k, k);
+            }
+            for (idx_t i = j + 1; i < n; ++i)
+                C(i, j) *= ajj;
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TRTI2_HH
@@ -10,14 +10,27 @@
 #ifndef TLAPACK_TRTRI_RECURSIVE_HH
 #define TLAPACK_TRTRI_RECURSIVE_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/trti2.hpp"
 
 namespace tlapack {
 
+/**
+ * Options struct for trtri_recursive()
+ */
+struct TrtriOpts : public EcOpts {
+    TrtriOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+
+    size_t nx = 0;  ///< Matrices of order at most nx are inverted by
+                    ///< trti2(). 0: tuned value, see tuned_option()
+};
+
 /** TRTRI computes the inverse of a triangular matrix in-place
  * Input is a triangular matrix, output is its inverse
- * This is the recursive variant
+ * This is the recursive variant. The recursion stops at matrices of order
+ * at most opts.nx, which are inverted by the level-2 routine trti2().
  *
  * @param[in] uplo
  *      - Uplo::Upper: Upper triangle of C is referenced; the strictly lower
@@ -34,13 +47,13 @@ namespace tlapack {
  *      On exit, the inverse.
  *
  * @param[in] opts Options.
+ *      - nx: Order of the matrices inverted by trti2().
+ *      - ec: Define the behavior of Exception Handling.
  *
  * @return = 0: successful exit
  * @return = i+1: if C(i,i) is exactly zero.  The triangular
  *          matrix is singular and its inverse can not be computed.
  *
- * @todo: implement nx to bail out of recursion before 1-by-1 case
- *
  * @ingroup computational
  *
  */
@@ -48,15 +61,13 @@ template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
 int trtri_recursive(uplo_t uplo,
                     Diag diag,
                     matrix_t& C,
-                    const EcOpts& opts = {})
+                    const TrtriOpts& opts = {})
 {
     using T = type_t<matrix_t>;
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
-    using real_t = real_type<T>;
 
     const idx_t n = nrows(C);
-    const real_t zero(0);
 
     // check arguments
     tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
@@ -66,24 +77,18 @@ int trtri_recursive(uplo_t uplo,
     // Quick return
     if (n <= 0) return 0;
 
+    // The crossover point is chosen for the order of the full matrix
+    if (opts.nx == 0) {
+        TrtriOpts optsNx = opts;
+        optsNx.nx = max<size_t>(1, tuned_value<T>("trtri", "nx", n, 128));
+        return trtri_recursive(uplo, diag, C, optsNx);
+    }
+
     idx_t n0 = n / 2;
 
-    if (n == 1) {
-        if (diag == Diag::NonUnit) {
-            if (C(0, 0) != zero) {
-                C(0, 0) = real_t(1.) / C(0, 0);
-                return 0;
-            }
-            else {
-                tlapack_error_if(opts.ec.internal, 1,
-                                 "A diagonal of entry of triangular "
-                                 "matrix is exactly zero.");
-                return 1;
-            }
-        }
-        else {
-            return 0;
-        }
+    // Stop recursion
+    if (n <= (idx_t)opts.nx) {
+        return trti2(uplo, diag, C, opts);
     }
     else {
         if (uplo == Uplo::Lower) {
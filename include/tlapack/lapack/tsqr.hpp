@@ -0,0 +1,362 @@
+/// @file tsqr.hpp Computes the QR factorization of a tall and skinny matrix
+/// using a reduction tree (TSQR).
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TSQR_HH
+#define TLAPACK_TSQR_HH
+
+#include "tlapack/base/parallel.hpp"
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trmm.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/larfb.hpp"
+#include "tlapack/lapack/larfg.hpp"
+#include "tlapack/lapack/larft.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for tsqr
+ */
+struct TsqrOpts {
+    size_t mb = 0;  ///< Rows per leaf block. 0: tuned value, see
+                    ///< tuned_option()
+    size_t nb = 0;  ///< Block size of the leaf factorizations. 0: tuned
+                    ///< value of geqrf(), see tuned_option()
+    ExecutionPolicy exec = {};  ///< Execution policy of the leaves and of
+                                ///< each level of the tree
+};
+
+/** Number of row blocks of the TSQR factorization of A
+ *
+ * The rows of A are split into p = max(1, floor(m/max(mb,n))) blocks. All
+ * blocks have floor(m/p) rows, except the last one, which has the remaining
+ * rows. Each block has at least n rows.
+ *
+ * @param[in] A m-by-n matrix, m >= n.
+ * @param[in] opts Options.
+ *      - mb: Rows per leaf block.
+ *
+ * @see tsqr()
+ */
+template <TLAPACK_SMATRIX A_t>
+constexpr size_type<A_t> tsqr_nblocks(const A_t& A, const TsqrOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t mb = max(
+        (idx_t)tuned_option<type_t<A_t>>(opts.mb, "tsqr", "mb", m, 1024),
+        max(n, idx_t(1)));
+
+    return max(idx_t(1), m / mb);
+}
+
+namespace internal {
+
+    /// Rows of the row block b of an m-row matrix split into p blocks
+    template <class idx_t>
+    constexpr pair<idx_t, idx_t> tsqr_block(idx_t b, idx_t p, idx_t m)
+    {
+        const idx_t mb = m / p;
+        return pair<idx_t, idx_t>(b * mb, (b + 1 == p) ? m : (b + 1) * mb);
+    }
+
+    /** Computes the QR factorization of two stacked upper triangular
+     * matrices,
+     *      [ R1 ] = (I - V Tm V^H) [ R ]
+     *      [ R2 ]                  [ 0 ],   V = [ I  ]
+     *                                           [ V2 ].
+     *
+     * On exit, R overwrites the upper triangle of R1, the upper triangular
+     * V2 overwrites the upper triangle of R2 and Tm holds the upper
+     * triangular factor of the block reflector. The strictly lower triangles
+     * of R1 and R2 are not referenced.
+     */
+    template <TLAPACK_SMATRIX R1_t, TLAPACK_SMATRIX R2_t, TLAPACK_SMATRIX T_t>
+    void tsqr_merge(R1_t& R1, R2_t& R2, T_t& Tm)
+    {
+        using T = type_t<R1_t>;
+        using idx_t = size_type<R1_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = ncols(R1);
+
+        for (idx_t j = 0; j < n; ++j) {
+            auto v = slice(R2, range(0, j + 1), j);
+            T tau;
+            larfg(COLUMNWISE_STORAGE, R1(j, j), v, tau);
+
+            // Apply H(j)^H to the trailing columns
+            for (idx_t c = j + 1; c < n; ++c) {
+                T w = R1(j, c);
+                for (idx_t i = 0; i <= j; ++i)
+                    w += conj(v[i]) * R2(i, c);
+                w *= conj(tau);
+                R1(j, c) -= w;
+                for (idx_t i = 0; i <= j; ++i)
+                    R2(i, c) -= v[i] * w;
+            }
+
+            // Tm(0:j,j) = -tau Tm(0:j,0:j) V2(:,0:j)^H v, since the identity
+            // blocks of V do not overlap
+            for (idx_t i = 0; i < j; ++i) {
+                T s(0);
+                for (idx_t r = 0; r <= i; ++r)
+                    s += conj(R2(r, i)) * v[r];
+                Tm(i, j) = -tau * s;
+            }
+            for (idx_t i = 0; i < j; ++i) {
+                T s(0);
+                for (idx_t r = i; r < j; ++r)
+                    s += Tm(i, r) * Tm(r, j);
+                Tm(i, j) = s;
+            }
+            Tm(j, j) = tau;
+        }
+    }
+
+    /** Applies the block reflector H = I - V Tm V^H from tsqr_merge() to the
+     * pair of blocks C1 and C2:
+     *      [ C1 ] := op(H) [ C1 ],  if side = Left, or
+     *      [ C2 ]          [ C2 ]
+     *      [ C1 C2 ] := [ C1 C2 ] op(H),  if side = Right.
+     *
+     * W is a workspace with the dimensions of C1.
+     */
+    template <TLAPACK_SMATRIX V2_t,
+              TLAPACK_SMATRIX T_t,
+              TLAPACK_SMATRIX C1_t,
+              TLAPACK_SMATRIX C2_t,
+              TLAPACK_SMATRIX W_t>
+    void tsqr_merge_apply(Side side,
+                          Op trans,
+                          const V2_t& V2,
+                          const T_t& Tm,
+                          C1_t& C1,
+                          C2_t& C2,
+                          W_t& W)
+    {
+        using T = type_t<W_t>;
+        using idx_t = size_type<C1_t>;
+
+        const idx_t m = nrows(C1);
+        const idx_t n = ncols(C1);
+        const Op opT = (trans == Op::NoTrans) ? Op::NoTrans : Op::ConjTrans;
+
+        // W = V^H C or W = C V
+        lacpy(GENERAL, C2, W);
+        if (side == Side::Left)
+            trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, T(1),
+                 V2, W);
+        else
+            trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, T(1), V2,
+                 W);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                W(i, j) += C1(i, j);
+
+        // W = op(Tm) W or W = W op(Tm)
+        trmm(side, UPPER_TRIANGLE, opT, NON_UNIT_DIAG, T(1), Tm, W);
+
+        // C1 -= W, C2 -= V2 W or C2 -= W V2^H
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                C1(i, j) -= W(i, j);
+        if (side == Side::Left)
+            trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, T(1), V2,
+                 W);
+        else
+            trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, T(1),
+                 V2, W);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                C2(i, j) -= W(i, j);
+    }
+
+    /** Applies the reflectors of the reduction tree of tsqr() to C.
+     *
+     * The block b of C is the set of rows (side = Left) or columns
+     * (side = Right) b*stride, ..., b*stride+n-1. The levels of the tree are
+     * applied in the order of the factorization if forward = true, and in
+     * the reverse order otherwise. The workspace of the merges is allocated
+     * once, with one block per pair of the first level of the tree.
+     */
+    template <TLAPACK_SMATRIX A_t, TLAPACK_SMATRIX TT_t, TLAPACK_SMATRIX C_t>
+    void tsqr_apply_tree(Side side,
+                         Op trans,
+                         bool forward,
+                         const A_t& A,
+                         const TT_t& TT,
+                         C_t& C,
+                         size_type<A_t> stride,
+                         const ExecutionPolicy& exec)
+    {
+        using work_t = matrix_type<C_t>;
+        using T = type_t<work_t>;
+        using idx_t = size_type<A_t>;
+        using range = pair<idx_t, idx_t>;
+
+        Create<work_t> new_matrix;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t p = (ncols(TT) / n + 1) / 2;
+        if (p <= 1) return;
+
+        // Workspace of the p/2 merges of the first level
+        const idx_t wm = (side == Side::Left) ? n : nrows(C);
+        const idx_t wn = (side == Side::Left) ? ncols(C) : n;
+        workspace_vector<T> W_;
+        auto W = new_matrix(W_, wm, (p / 2) * wn);
+
+        idx_t nlevels = 0;
+        while ((idx_t(1) << nlevels) < p)
+            ++nlevels;
+
+        for (idx_t l = 0; l < nlevels; ++l) {
+            const idx_t s = idx_t(1) << (forward ? l : nlevels - 1 - l);
+            const idx_t npairs = (p - s + 2 * s - 1) / (2 * s);
+            parallel_for_blocks(exec, npairs, idx_t(1), [&](idx_t k0,
+                                                            idx_t k1) {
+                for (idx_t k = k0; k < k1; ++k) {
+                    const idx_t i = 2 * s * k;
+                    const idx_t j = i + s;
+                    const idx_t rj = tsqr_block(j, p, m).first;
+                    const auto V2 = slice(A, range(rj, rj + n), range(0, n));
+                    const auto Tm = slice(TT, range(0, n),
+                                          range((p + j - 1) * n, (p + j) * n));
+                    const range Ci(i * stride, i * stride + n);
+                    const range Cj(j * stride, j * stride + n);
+                    auto Wk = cols(W, range(k * wn, (k + 1) * wn));
+                    if (side == Side::Left) {
+                        auto C1 = rows(C, Ci);
+                        auto C2 = rows(C, Cj);
+                        tsqr_merge_apply(side, trans, V2, Tm, C1, C2, Wk);
+                    }
+                    else {
+                        auto C1 = cols(C, Ci);
+                        auto C2 = cols(C, Cj);
+                        tsqr_merge_apply(side, trans, V2, Tm, C1, C2, Wk);
+                    }
+                }
+            });
+        }
+    }
+
+}  // namespace internal
+
+/** Computes the QR factorization of a tall and skinny m-by-n matrix A using
+ * a reduction tree (TSQR).
+ *
+ * The rows of A are split into p blocks $A_0, \dots, A_{p-1}$ of at least
+ * n rows each (see tsqr_nblocks()). Each block is factored independently,
+ * $A_b = Q_b R_b$, and the triangular factors are then merged pairwise along
+ * a binary tree: at the level with stride s, the factors of the blocks i
+ * and i+s, i a multiple of 2s, are replaced by the QR factorization of
+ * $[R_i; R_{i+s}]$. The leaves and the merges of the same level are
+ * independent, and run in parallel according to opts.exec. Only the leaves
+ * sweep the full height of A, which is what makes the method efficient for
+ * matrices with m >> n.
+ *
+ * The orthogonal factor is kept in tree form:
+ *  - The reflectors of the leaf b are stored below the diagonal of the block
+ *    $A_b$, and the upper triangular factor of its block reflector is stored
+ *    in TT(0:n, b*n:(b+1)*n).
+ *  - The merge that eliminates the block j > 0 has a block reflector
+ *    $I - V T V^H$ with $V = [I; V_2]$, where $V_2$ is upper triangular. $V_2$
+ *    overwrites the upper triangle of the first n rows of $A_j$ and T is
+ *    stored in TT(0:n, (p+j-1)*n:(p+j)*n).
+ *
+ * Use unmqr_tsqr() to apply Q and ungqr_tsqr() to form it.
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix, m >= n.
+ *      On exit, the upper triangle of the first n rows contains the n-by-n
+ *      upper triangular matrix R. The other entries, with TT, represent the
+ *      unitary matrix Q as described above.
+ *
+ * @param[out] TT n-by-(2p-1)n matrix, where p = tsqr_nblocks(A, opts).
+ *      The triangular factors of the block reflectors.
+ *
+ * @param[in] opts Options.
+ *      - mb: Rows per leaf block.
+ *      - nb: Block size of the leaf factorizations.
+ *      - exec: Execution policy.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SMATRIX TT_t>
+int tsqr(A_t& A, TT_t& TT, const TsqrOpts& opts = {})
+{
+    using T = type_t<A_t>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t p = tsqr_nblocks(A, opts);
+
+    // check arguments
+    tlapack_check(m >= n);
+    tlapack_check(nrows(TT) >= n);
+    tlapack_check(ncols(TT) == (2 * p - 1) * n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    GeqrfOpts geqrfOpts;
+    geqrfOpts.nb = opts.nb;
+
+    // Scalar factors of the leaves, one column per leaf
+    Create<matrix_type<A_t>> new_matrix;
+    workspace_vector<T> tau_;
+    auto tau = new_matrix(tau_, n, p);
+
+    // Leaves
+    internal::parallel_for_blocks(
+        opts.exec, p, idx_t(1), [&](idx_t b0, idx_t b1) {
+            for (idx_t b = b0; b < b1; ++b) {
+                auto Ab = rows(A, internal::tsqr_block(b, p, m));
+                auto Tb = slice(TT, range(0, n), range(b * n, (b + 1) * n));
+                auto taub = col(tau, b);
+                geqrf(Ab, taub, geqrfOpts);
+                larft(FORWARD, COLUMNWISE_STORAGE, Ab, taub, Tb);
+            }
+        });
+
+    // Reduction tree
+    for (idx_t s = 1; s < p; s *= 2) {
+        const idx_t npairs = (p - s + 2 * s - 1) / (2 * s);
+        internal::parallel_for_blocks(
+            opts.exec, npairs, idx_t(1), [&](idx_t k0, idx_t k1) {
+                for (idx_t k = k0; k < k1; ++k) {
+                    const idx_t i = 2 * s * k;
+                    const idx_t j = i + s;
+                    const idx_t ri = internal::tsqr_block(i, p, m).first;
+                    const idx_t rj = internal::tsqr_block(j, p, m).first;
+                    auto R1 = slice(A, range(ri, ri + n), range(0, n));
+                    auto R2 = slice(A, range(rj, rj + n), range(0, n));
+                    auto Tm = slice(TT, range(0, n),
+                                    range((p + j - 1) * n, (p + j) * n));
+                    internal::tsqr_merge(R1, R2, Tm);
+                }
+            });
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TSQR_HH
@@ -211,7 +211,7 @@ int ungbr_q(const size_type<matrix_t> k,
 
     // Allocates workspace
     WorkInfo workinfo = ungbr_q_worksize<T>(k, A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungbr_q_work(k, A, tau, work, opts);
@@ -321,7 +321,7 @@ int ungbr_p(const size_type<matrix_t> k,
 
     // Allocates workspace
     WorkInfo workinfo = ungbr_p_worksize<T>(k, A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungbr_p_work(k, A, tau, work, opts);
@@ -160,7 +160,7 @@ int unghr(size_type<matrix_t> ilo,
 
     // Allocates workspace
     WorkInfo workinfo = unghr_worksize<T>(ilo, ihi, A, tau);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unghr_work(ilo, ihi, A, tau, work);
@@ -116,7 +116,7 @@ int ungl2(matrix_t& Q, const vector_t& tauw)
 
     // Allocates workspace
     WorkInfo workinfo = ungl2_worksize<T>(Q, tauw);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungl2_work(Q, tauw, work);
@@ -371,7 +371,7 @@ int ungq(direction_t direction,
 
     // Allocates workspace
     WorkInfo workinfo = ungq_worksize<T>(direction, storeMode, A, tau, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungq_work(direction, storeMode, A, tau, work, opts);
@@ -306,7 +306,7 @@ int ungq_level2(direction_t direction,
 
     // Allocates workspace
     WorkInfo workinfo = ungq_level2_worksize<T>(direction, storeMode, A, tau);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungq_level2_work(direction, storeMode, A, tau, work);
@@ -0,0 +1,97 @@
+/// @file ungqr_tsqr.hpp Generates the m-by-n matrix Q from tlapack::tsqr()
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_UNGQR_TSQR_HH
+#define TLAPACK_UNGQR_TSQR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/tsqr.hpp"
+
+namespace tlapack {
+
+/** Generates the m-by-n matrix Q with orthonormal columns from tsqr().
+ *
+ * Q is formed as $Q = Q_{leaves} Y$, where $Y = M_1 \cdots M_L [I; 0]$ is
+ * computed first with the block reflectors $M_l$ of the reduction tree.
+ * Y has only n nonzero rows per leaf block, so that this step is cheap. Then
+ * each leaf applies its block reflector to its block of Y, in parallel
+ * according to opts.exec.
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On entry, the factorization computed by tsqr().
+ *      On exit, the m-by-n matrix Q.
+ *
+ * @param[in] TT n-by-(2p-1)n matrix.
+ *      The triangular factors computed by tsqr().
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy.
+ *
+ * @return 0 if success.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SMATRIX TT_t>
+int ungqr_tsqr(A_t& A, const TT_t& TT, const TsqrOpts& opts = {})
+{
+    using T = type_t<A_t>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<A_t> new_matrix;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t p = (n > 0) ? (ncols(TT) / n + 1) / 2 : 1;
+
+    // check arguments
+    tlapack_check(m >= n);
+    tlapack_check(nrows(TT) >= n);
+    tlapack_check(ncols(TT) == (2 * p - 1) * n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Y = M_1 ... M_L [I; 0], with n rows per block
+    workspace_vector<T> Y_;
+    auto Y = new_matrix(Y_, p * n, n);
+    laset(GENERAL, T(0), T(1), Y);
+    internal::tsqr_apply_tree(LEFT_SIDE, NO_TRANS, false, A, TT, Y, n,
+                              opts.exec);
+
+    // A_b = Q_b [Y_b; 0]
+    internal::parallel_for_blocks(
+        opts.exec, p, idx_t(1), [&](idx_t b0, idx_t b1) {
+            Create<A_t> new_matrix;
+            for (idx_t b = b0; b < b1; ++b) {
+                const range rb = internal::tsqr_block(b, p, m);
+                auto Ab = rows(A, rb);
+                const auto Tb =
+                    slice(TT, range(0, n), range(b * n, (b + 1) * n));
+
+                workspace_vector<T> V_;
+                auto Vb = new_matrix(V_, rb.second - rb.first, n);
+                lacpy(GENERAL, Ab, Vb);
+
+                laset(GENERAL, T(0), T(0), Ab);
+                auto Ab0 = rows(Ab, range(0, n));
+                lacpy(GENERAL, rows(Y, range(b * n, (b + 1) * n)), Ab0);
+                larfb(LEFT_SIDE, NO_TRANS, FORWARD, COLUMNWISE_STORAGE, Vb, Tb,
+                      Ab);
+            }
+        });
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_UNGQR_TSQR_HH
@@ -132,7 +132,7 @@ int unm2l(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = unm2l_worksize<TA>(side, trans, A, tau, C);
-    std::vector<TA> work_;
+    workspace_vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_level2_work(side, trans, BACKWARD, COLUMNWISE_STORAGE, A, tau,
@@ -133,7 +133,7 @@ int unml2(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = unml2_worksize<T>(side, trans, A, tau, C);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_level2_work(side, trans, FORWARD, ROWWISE_STORAGE, A, tau, C,
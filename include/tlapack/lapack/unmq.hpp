@@ -306,7 +306,7 @@ int unmq(side_t side,
     // Allocates workspace
     WorkInfo workinfo =
         unmq_worksize<T>(side, trans, direction, storeMode, V, tau, C, opts);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_work(side, trans, direction, storeMode, V, tau, C, work, opts);
@@ -331,7 +331,7 @@ int unmq_level2(side_t side,
     // Allocates workspace
     WorkInfo workinfo =
         unmq_level2_worksize<T>(side, trans, direction, storeMode, V, tau, C);
-    std::vector<T> work_;
+    workspace_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_level2_work(side, trans, direction, storeMode, V, tau, C, work);
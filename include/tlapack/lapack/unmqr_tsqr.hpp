@@ -0,0 +1,124 @@
+/// @file unmqr_tsqr.hpp Multiplies the general m-by-n matrix C by Q from
+/// tlapack::tsqr()
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_UNMQR_TSQR_HH
+#define TLAPACK_UNMQR_TSQR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/tsqr.hpp"
+
+namespace tlapack {
+
+/** Applies the unitary matrix Q from tsqr() to a general m-by-n matrix C.
+ *
+ * The matrix Q is the product of the block reflectors of the leaves and of
+ * the reduction tree of tsqr(). The leaves and the merges of the same level
+ * of the tree are applied in parallel according to opts.exec.
+ *
+ * @param[in] side Specifies which side op(Q) is to be applied.
+ *      - Side::Left:  C := op(Q) C;
+ *      - Side::Right: C := C op(Q).
+ *
+ * @param[in] trans The operation $op(Q)$ to be used:
+ *      - Op::NoTrans:      $op(Q) = Q$;
+ *      - Op::ConjTrans:    $op(Q) = Q^H$.
+ *      Op::Trans is a valid value if the data type of A is real. In this case,
+ *      the algorithm treats Op::Trans as Op::ConjTrans.
+ *
+ * @param[in] A
+ *      - side = Side::Left:    m-by-k matrix;
+ *      - side = Side::Right:   n-by-k matrix.
+ *      The factorization computed by tsqr().
+ *
+ * @param[in] TT k-by-(2p-1)k matrix.
+ *      The triangular factors computed by tsqr().
+ *
+ * @param[in,out] C m-by-n matrix.
+ *      On exit, C is replaced by one of the following:
+ *      - side = Side::Left  and trans = Op::NoTrans:    $Q C$;
+ *      - side = Side::Right and trans = Op::NoTrans:    $C Q$;
+ *      - side = Side::Left  and trans = Op::ConjTrans:  $C := Q^H C$;
+ *      - side = Side::Right and trans = Op::ConjTrans:  $C := C Q^H$.
+ *
+ * @param[in] opts Options.
+ *      - exec: Execution policy.
+ *
+ * @return 0 if success.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_SMATRIX TT_t,
+          TLAPACK_SMATRIX C_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t>
+int unmqr_tsqr(side_t side,
+               trans_t trans,
+               const A_t& A,
+               const TT_t& TT,
+               C_t& C,
+               const TsqrOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t k = ncols(A);
+    const idx_t p = (k > 0) ? (ncols(TT) / k + 1) / 2 : 1;
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::ConjTrans &&
+                        (trans != Op::Trans || is_complex<type_t<A_t>>));
+    tlapack_check(m >= k);
+    tlapack_check(nrows(TT) >= k);
+    tlapack_check(ncols(TT) == (2 * p - 1) * k);
+    tlapack_check(((side == Side::Left) ? nrows(C) : ncols(C)) == m);
+
+    // quick return
+    if (k <= 0 || nrows(C) <= 0 || ncols(C) <= 0) return 0;
+
+    // Q = Q_leaves M_1 M_2 ... M_L, where M_l is the product of the block
+    // reflectors of the level l of the tree
+    const bool leavesFirst = (side == Side::Left) == (trans != Op::NoTrans);
+
+    auto leaves = [&]() {
+        internal::parallel_for_blocks(
+            opts.exec, p, idx_t(1), [&](idx_t b0, idx_t b1) {
+                for (idx_t b = b0; b < b1; ++b) {
+                    const range rb = internal::tsqr_block(b, p, m);
+                    const auto Vb = rows(A, rb);
+                    const auto Tb =
+                        slice(TT, range(0, k), range(b * k, (b + 1) * k));
+                    if (side == Side::Left) {
+                        auto Cb = rows(C, rb);
+                        larfb(side, trans, FORWARD, COLUMNWISE_STORAGE, Vb, Tb,
+                              Cb);
+                    }
+                    else {
+                        auto Cb = cols(C, rb);
+                        larfb(side, trans, FORWARD, COLUMNWISE_STORAGE, Vb, Tb,
+                              Cb);
+                    }
+                }
+            });
+    };
+
+    if (leavesFirst) leaves();
+    internal::tsqr_apply_tree(side, Op(trans), leavesFirst, A, TT, C, m / p,
+                              opts.exec);
+    if (!leavesFirst) leaves();
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_UNMQR_TSQR_HH
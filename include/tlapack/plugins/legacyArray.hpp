@@ -81,8 +81,10 @@ namespace traits {
     /// Create LegacyMatrix @see Create
     template <class U, class idx_t, Layout layout>
     struct CreateFunctor<LegacyMatrix<U, idx_t, layout>, int> {
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v, idx_t m, idx_t n) const
+        template <class T, class Alloc>
+        constexpr auto operator()(std::vector<T, Alloc>& v,
+                                  idx_t m,
+                                  idx_t n) const
         {
             assert(m >= 0 && n >= 0);
             v.resize(m * n);  // Allocates space in memory
@@ -105,8 +107,8 @@ namespace traits {
     /// Create LegacyVector @see Create
     template <class U, class idx_t, typename int_t, Direction D>
     struct CreateFunctor<LegacyVector<U, idx_t, int_t, D>, int> {
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v, idx_t n) const
+        template <class T, class Alloc>
+        constexpr auto operator()(std::vector<T, Alloc>& v, idx_t n) const
         {
             assert(n >= 0);
             v.resize(n);  // Allocates space in memory
@@ -193,6 +195,20 @@ constexpr auto upperband(const LegacyBandedMatrix<T, idx_t>& A) noexcept
     return A.ku;
 }
 
+// Dense view of the block A(i:i+m, j:j+n) of a LegacyBandedMatrix
+//
+// The view has leading dimension kl+ku, so that consecutive columns of the
+// view go through the same rows of A. Only the entries of the block that lie
+// inside the band may be referenced, and m <= kl+ku is required.
+template <typename T, class idx_t>
+constexpr auto band_block(
+    const LegacyBandedMatrix<T, idx_t>& A, idx_t i, idx_t j, idx_t m, idx_t n)
+{
+    assert(m <= A.kl + A.ku || n == 0);
+    return LegacyMatrix<T, idx_t>(m, n, &A.ptr[(A.ku + i) + j * (A.ku + A.kl)],
+                                  (m <= A.kl + A.ku) ? A.kl + A.ku : m);
+}
+
 // -----------------------------------------------------------------------------
 // Block operations for const LegacyMatrix
 
@@ -0,0 +1,404 @@
+/// @file tileMajor.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TILEMAJOR_HH
+#define TLAPACK_TILEMAJOR_HH
+
+#include <cassert>
+
+#include "tlapack/TileMajorMatrix.hpp"
+#include "tlapack/base/arrayTraits.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+// -----------------------------------------------------------------------------
+// Helpers
+
+namespace traits {
+    namespace internal {
+        template <typename T, class idx_t>
+        std::true_type is_tile_major_type_f(const TileMajorMatrix<T, idx_t>*);
+
+        template <typename T, class idx_t>
+        std::true_type is_tile_major_type_f(const TileMajorVector<T, idx_t>*);
+
+        std::false_type is_tile_major_type_f(const void*);
+    }  // namespace internal
+
+    /// True if T is a TileMajorMatrix or a TileMajorVector
+    template <class T>
+    constexpr bool is_tile_major_type =
+        decltype(internal::is_tile_major_type_f(std::declval<T*>()))::value;
+}  // namespace traits
+
+// -----------------------------------------------------------------------------
+// Data traits
+
+namespace traits {
+    /// Layout for TileMajorMatrix
+    template <typename T, class idx_t>
+    struct layout_trait<TileMajorMatrix<T, idx_t>, int> {
+        static constexpr Layout value = Layout::TileMajor;
+    };
+
+    template <typename T, class idx_t>
+    struct real_type_traits<TileMajorMatrix<T, idx_t>, int> {
+        using type = TileMajorMatrix<real_type<T>, idx_t>;
+    };
+
+    template <typename T, class idx_t>
+    struct real_type_traits<TileMajorVector<T, idx_t>, int> {
+        using type = LegacyVector<real_type<T>, idx_t, idx_t>;
+    };
+
+    template <typename T, class idx_t>
+    struct complex_type_traits<TileMajorMatrix<T, idx_t>, int> {
+        using type = TileMajorMatrix<complex_type<T>, idx_t>;
+    };
+
+    template <typename T, class idx_t>
+    struct complex_type_traits<TileMajorVector<T, idx_t>, int> {
+        using type = LegacyVector<complex_type<T>, idx_t, idx_t>;
+    };
+
+    /// Create TileMajorMatrix @see Create
+    ///
+    /// The new matrix has a single tile, so that it is also a contiguous
+    /// column-major matrix.
+    template <class U, class idx_t>
+    struct CreateFunctor<TileMajorMatrix<U, idx_t>, int> {
+        template <class T, class Alloc>
+        constexpr auto operator()(std::vector<T, Alloc>& v,
+                                  idx_t m,
+                                  idx_t n) const
+        {
+            assert(m >= 0 && n >= 0);
+            v.resize(m * n);  // Allocates space in memory
+            return TileMajorMatrix<T, idx_t>(m, n, v.data(),
+                                             (m > 0) ? m : idx_t(1),
+                                             (n > 0) ? n : idx_t(1));
+        }
+    };
+}  // namespace traits
+
+// -----------------------------------------------------------------------------
+// Data descriptors
+
+// Number of rows of TileMajorMatrix
+template <typename T, class idx_t>
+constexpr auto nrows(const TileMajorMatrix<T, idx_t>& A) noexcept
+{
+    return A.m;
+}
+
+// Number of columns of TileMajorMatrix
+template <typename T, class idx_t>
+constexpr auto ncols(const TileMajorMatrix<T, idx_t>& A) noexcept
+{
+    return A.n;
+}
+
+// Size of TileMajorMatrix
+template <typename T, class idx_t>
+constexpr auto size(const TileMajorMatrix<T, idx_t>& A) noexcept
+{
+    return A.m * A.n;
+}
+
+// Size of TileMajorVector
+template <typename T, class idx_t>
+constexpr auto size(const TileMajorVector<T, idx_t>& x) noexcept
+{
+    return x.n;
+}
+
+// -----------------------------------------------------------------------------
+// Block operations for TileMajorMatrix
+//
+// Submatrices keep the tiling of the original matrix. Rows, columns and
+// diagonals are TileMajorVector objects. Use TileMajorMatrix::tile() and
+// TileMajorMatrix::block() to obtain contiguous column-major tiles.
+
+#define isSlice(SliceSpec) !std::is_convertible<SliceSpec, idx_t>::value
+
+// Slice TileMajorMatrix
+template <
+    typename T,
+    class idx_t,
+    class SliceSpecRow,
+    class SliceSpecCol,
+    typename std::enable_if<isSlice(SliceSpecRow) && isSlice(SliceSpecCol),
+                            int>::type = 0>
+constexpr auto slice(const TileMajorMatrix<T, idx_t>& A,
+                     SliceSpecRow&& rows,
+                     SliceSpecCol&& cols) noexcept
+{
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= nrows(A));
+    assert(cols.first >= 0 and cols.first <= cols.second);
+    assert((idx_t)cols.second <= ncols(A));
+    return A.view(rows.first, rows.second, cols.first, cols.second);
+}
+template <
+    typename T,
+    class idx_t,
+    class SliceSpecRow,
+    class SliceSpecCol,
+    typename std::enable_if<isSlice(SliceSpecRow) && isSlice(SliceSpecCol),
+                            int>::type = 0>
+constexpr auto slice(TileMajorMatrix<T, idx_t>& A,
+                     SliceSpecRow&& rows,
+                     SliceSpecCol&& cols) noexcept
+{
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= nrows(A));
+    assert(cols.first >= 0 and cols.first <= cols.second);
+    assert((idx_t)cols.second <= ncols(A));
+    return A.view(rows.first, rows.second, cols.first, cols.second);
+}
+
+#undef isSlice
+
+// Slice TileMajorMatrix over a single row
+template <typename T, class idx_t, class SliceSpecCol>
+constexpr auto slice(const TileMajorMatrix<T, idx_t>& A,
+                     size_type<TileMajorMatrix<T, idx_t>> rowIdx,
+                     SliceSpecCol&& cols) noexcept
+{
+    assert(rowIdx >= 0 and rowIdx < nrows(A));
+    assert(cols.first >= 0 and cols.first <= cols.second);
+    assert((idx_t)cols.second <= ncols(A));
+    return TileMajorVector<const T, idx_t>(A.view(0, A.m, 0, A.n),
+                                           cols.second - cols.first, rowIdx,
+                                           cols.first, 0, 1);
+}
+template <typename T, class idx_t, class SliceSpecCol>
+constexpr auto slice(TileMajorMatrix<T, idx_t>& A,
+                     size_type<TileMajorMatrix<T, idx_t>> rowIdx,
+                     SliceSpecCol&& cols) noexcept
+{
+    assert(rowIdx >= 0 and rowIdx < nrows(A));
+    assert(cols.first >= 0 and cols.first <= cols.second);
+    assert((idx_t)cols.second <= ncols(A));
+    return TileMajorVector<T, idx_t>(A, cols.second - cols.first, rowIdx,
+                                     cols.first, 0, 1);
+}
+
+// Slice TileMajorMatrix over a single column
+template <typename T, class idx_t, class SliceSpecRow>
+constexpr auto slice(const TileMajorMatrix<T, idx_t>& A,
+                     SliceSpecRow&& rows,
+                     size_type<TileMajorMatrix<T, idx_t>> colIdx) noexcept
+{
+    assert(colIdx >= 0 and colIdx < ncols(A));
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= nrows(A));
+    return TileMajorVector<const T, idx_t>(A.view(0, A.m, 0, A.n),
+                                           rows.second - rows.first,
+                                           rows.first, colIdx, 1, 0);
+}
+template <typename T, class idx_t, class SliceSpecRow>
+constexpr auto slice(TileMajorMatrix<T, idx_t>& A,
+                     SliceSpecRow&& rows,
+                     size_type<TileMajorMatrix<T, idx_t>> colIdx) noexcept
+{
+    assert(colIdx >= 0 and colIdx < ncols(A));
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= nrows(A));
+    return TileMajorVector<T, idx_t>(A, rows.second - rows.first, rows.first,
+                                     colIdx, 1, 0);
+}
+
+// Get rows of TileMajorMatrix
+template <typename T, class idx_t, class SliceSpec>
+constexpr auto rows(const TileMajorMatrix<T, idx_t>& A,
+                    SliceSpec&& rows) noexcept
+{
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= nrows(A));
+    return A.view(rows.first, rows.second, 0, A.n);
+}
+template <typename T, class idx_t, class SliceSpec>
+constexpr auto rows(TileMajorMatrix<T, idx_t>& A, SliceSpec&& rows) noexcept
+{
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= nrows(A));
+    return A.view(rows.first, rows.second, 0, A.n);
+}
+
+// Get columns of TileMajorMatrix
+template <typename T, class idx_t, class SliceSpec>
+constexpr auto cols(const TileMajorMatrix<T, idx_t>& A,
+                    SliceSpec&& cols) noexcept
+{
+    assert(cols.first >= 0 and cols.first <= cols.second);
+    assert((idx_t)cols.second <= ncols(A));
+    return A.view(0, A.m, cols.first, cols.second);
+}
+template <typename T, class idx_t, class SliceSpec>
+constexpr auto cols(TileMajorMatrix<T, idx_t>& A, SliceSpec&& cols) noexcept
+{
+    assert(cols.first >= 0 and cols.first <= cols.second);
+    assert((idx_t)cols.second <= ncols(A));
+    return A.view(0, A.m, cols.first, cols.second);
+}
+
+// Get a row of TileMajorMatrix
+template <typename T, class idx_t>
+constexpr auto row(const TileMajorMatrix<T, idx_t>& A,
+                   size_type<TileMajorMatrix<T, idx_t>> rowIdx) noexcept
+{
+    assert(rowIdx >= 0 and rowIdx < nrows(A));
+    return TileMajorVector<const T, idx_t>(A.view(0, A.m, 0, A.n), A.n, rowIdx,
+                                           0, 0, 1);
+}
+template <typename T, class idx_t>
+constexpr auto row(TileMajorMatrix<T, idx_t>& A,
+                   size_type<TileMajorMatrix<T, idx_t>> rowIdx) noexcept
+{
+    assert(rowIdx >= 0 and rowIdx < nrows(A));
+    return TileMajorVector<T, idx_t>(A, A.n, rowIdx, 0, 0, 1);
+}
+
+// Get a column of TileMajorMatrix
+template <typename T, class idx_t>
+constexpr auto col(const TileMajorMatrix<T, idx_t>& A,
+                   size_type<TileMajorMatrix<T, idx_t>> colIdx) noexcept
+{
+    assert(colIdx >= 0 and colIdx < ncols(A));
+    return TileMajorVector<const T, idx_t>(A.view(0, A.m, 0, A.n), A.m, 0,
+                                           colIdx, 1, 0);
+}
+template <typename T, class idx_t>
+constexpr auto col(TileMajorMatrix<T, idx_t>& A,
+                   size_type<TileMajorMatrix<T, idx_t>> colIdx) noexcept
+{
+    assert(colIdx >= 0 and colIdx < ncols(A));
+    return TileMajorVector<T, idx_t>(A, A.m, 0, colIdx, 1, 0);
+}
+
+// Diagonal of a TileMajorMatrix
+template <typename T, class idx_t>
+constexpr auto diag(const TileMajorMatrix<T, idx_t>& A,
+                    int diagIdx = 0) noexcept
+{
+    assert(diagIdx >= 0 || (idx_t)(-diagIdx) < nrows(A));
+    assert(diagIdx <= 0 || (idx_t)diagIdx < ncols(A));
+    const idx_t i0 = (diagIdx >= 0) ? 0 : (idx_t)(-diagIdx);
+    const idx_t j0 = (diagIdx >= 0) ? (idx_t)diagIdx : 0;
+    const idx_t n = std::min(A.m - i0, A.n - j0);
+    return TileMajorVector<const T, idx_t>(A.view(0, A.m, 0, A.n), n, i0, j0,
+                                           1, 1);
+}
+template <typename T, class idx_t>
+constexpr auto diag(TileMajorMatrix<T, idx_t>& A, int diagIdx = 0) noexcept
+{
+    assert(diagIdx >= 0 || (idx_t)(-diagIdx) < nrows(A));
+    assert(diagIdx <= 0 || (idx_t)diagIdx < ncols(A));
+    const idx_t i0 = (diagIdx >= 0) ? 0 : (idx_t)(-diagIdx);
+    const idx_t j0 = (diagIdx >= 0) ? (idx_t)diagIdx : 0;
+    const idx_t n = std::min(A.m - i0, A.n - j0);
+    return TileMajorVector<T, idx_t>(A, n, i0, j0, 1, 1);
+}
+
+// Slice TileMajorVector
+template <typename T, class idx_t, class SliceSpec>
+constexpr auto slice(const TileMajorVector<T, idx_t>& v,
+                     SliceSpec&& rows) noexcept
+{
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= size(v));
+    return TileMajorVector<const T, idx_t>(
+        v.A.view(0, v.A.m, 0, v.A.n), rows.second - rows.first,
+        v.i0 + rows.first * v.di, v.j0 + rows.first * v.dj, v.di, v.dj);
+}
+template <typename T, class idx_t, class SliceSpec>
+constexpr auto slice(TileMajorVector<T, idx_t>& v, SliceSpec&& rows) noexcept
+{
+    assert(rows.first >= 0 and rows.first <= rows.second);
+    assert((idx_t)rows.second <= size(v));
+    return TileMajorVector<T, idx_t>(v.A, rows.second - rows.first,
+                                     v.i0 + rows.first * v.di,
+                                     v.j0 + rows.first * v.dj, v.di, v.dj);
+}
+
+// Reshape TileMajorMatrix
+//
+// Only matrices that lie inside a single tile can be reshaped, which is the
+// case of the matrices created with Create<TileMajorMatrix>. The new
+// matrices are column-major.
+template <typename T, class idx_t>
+auto reshape(TileMajorMatrix<T, idx_t>& A,
+             size_type<TileMajorMatrix<T, idx_t>> m,
+             size_type<TileMajorMatrix<T, idx_t>> n)
+{
+    if (A.mt() > 1 || A.nt() > 1)
+        throw std::domain_error(
+            "Cannot reshape a matrix that spans more than one tile.");
+    auto B = A.block(0, A.m, 0, A.n);
+    return reshape(B, m, n);
+}
+template <typename T, class idx_t>
+auto reshape(TileMajorMatrix<T, idx_t>& A,
+             size_type<TileMajorMatrix<T, idx_t>> n)
+{
+    if (A.mt() > 1 || A.nt() > 1)
+        throw std::domain_error(
+            "Cannot reshape a matrix that spans more than one tile.");
+    auto B = A.block(0, A.m, 0, A.n);
+    return reshape(B, n);
+}
+
+// -----------------------------------------------------------------------------
+// Deduce matrix and vector type from two provided ones
+
+namespace traits {
+
+    template <typename T>
+    constexpr bool cast_to_tile_major_type =
+        is_tile_major_type<T> || cast_to_legacy_type<T>;
+
+    // for two types
+    template <class matrixA_t, typename matrixB_t>
+    struct matrix_type_traits<
+        matrixA_t,
+        matrixB_t,
+        typename std::enable_if<
+            ((is_tile_major_type<matrixA_t> ||
+              is_tile_major_type<matrixB_t>) &&
+             cast_to_tile_major_type<matrixA_t> &&
+             cast_to_tile_major_type<matrixB_t>),
+            int>::type> {
+        using T = scalar_type<type_t<matrixA_t>, type_t<matrixB_t>>;
+        using idx_t = size_type<matrixA_t>;
+
+        using type = TileMajorMatrix<T, idx_t>;
+    };
+
+    // for two types
+    template <typename vecA_t, typename vecB_t>
+    struct vector_type_traits<
+        vecA_t,
+        vecB_t,
+        typename std::enable_if<
+            ((is_tile_major_type<vecA_t> || is_tile_major_type<vecB_t>) &&
+             cast_to_tile_major_type<vecA_t> &&
+             cast_to_tile_major_type<vecB_t>),
+            int>::type> {
+        using T = scalar_type<type_t<vecA_t>, type_t<vecB_t>>;
+        using idx_t = size_type<vecA_t>;
+
+        using type = LegacyVector<T, idx_t, idx_t>;
+    };
+
+}  // namespace traits
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TILEMAJOR_HH
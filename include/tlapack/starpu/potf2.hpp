@@ -19,7 +19,7 @@ namespace tlapack {
 
 /// Overload of potf2 for starpu::Matrix
 template <class uplo_t, class T>
-int potf2(uplo_t uplo, starpu::Matrix<T>& A)
+int potf2(uplo_t uplo, starpu::Matrix<T>& A, const EcOpts& opts = {})
 {
     using starpu::idx_t;
 
@@ -33,7 +33,7 @@ int potf2(uplo_t uplo, starpu::Matrix<T>& A)
 
     // Use blocked algorithm if matrix contains more than one tile
     if (nx > 1 || ny > 1) {
-        BlockedCholeskyOpts potrf_opts;
+        BlockedCholeskyOpts potrf_opts(opts);
         potrf_opts.nb = min(min(A.nblockrows(), A.nblockcols()), n - 1);
         return potrf_blocked(uplo, A, potrf_opts);
     }
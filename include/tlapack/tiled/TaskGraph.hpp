@@ -0,0 +1,331 @@
+/// @file tiled/TaskGraph.hpp
+/// @brief Task graph with dependency tracking and a work-stealing executor.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TILED_TASKGRAPH_HH
+#define TLAPACK_TILED_TASKGRAPH_HH
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "tlapack/base/parallel.hpp"
+
+namespace tlapack {
+
+/// Options for the tiled algorithms
+struct TiledOpts {
+    size_t nb = 256;  ///< Tile size
+    ExecutionPolicy exec =
+        ExecutionPolicy::parallel();  ///< Threads used to execute the tasks
+};
+
+namespace tiled {
+
+    /// Access mode of a task to a piece of data
+    enum class Access : char {
+        Read = 'R',       ///< The task reads the data
+        Write = 'W',      ///< The task overwrites the data
+        ReadWrite = 'X',  ///< The task reads and modifies the data
+    };
+
+    /// Handle that identifies a piece of data, e.g., a tile
+    using handle_t = const void*;
+
+    /// Data accessed by a task
+    struct Dependency {
+        handle_t handle;
+        Access mode;
+    };
+
+    /**
+     * @brief Graph of tasks inserted in sequential order.
+     *
+     * Tasks are inserted with the list of data they access, as in a sequential
+     * program. The dependencies between tasks are inferred from the accesses:
+     * a task depends on the last task that wrote each piece of data it
+     * accesses, and a task that writes a piece of data also depends on all
+     * tasks that read that data since the last write. execute() then runs the
+     * graph on a set of threads with a work-stealing scheduler, respecting
+     * the dependencies.
+     *
+     * Example:
+     * @code{.cpp}
+     *      tiled::TaskGraph g;
+     *      g.insert_task([&]() { potrf(LOWER_TRIANGLE, A00); },
+     *                    {{&A(0, 0), tiled::Access::ReadWrite}});
+     *      g.insert_task([&]() { trsm(...); },
+     *                    {{&A(0, 0), tiled::Access::Read},
+     *                     {&A(nb, 0), tiled::Access::ReadWrite}});
+     *      g.execute(ExecutionPolicy::parallel());
+     * @endcode
+     */
+    class TaskGraph {
+       public:
+        /// Number of tasks in the graph
+        std::size_t size() const noexcept { return tasks.size(); }
+
+        /**
+         * @brief Insert a task in the graph.
+         *
+         * @param[in] f Callable object with signature void().
+         * @param[in] deps Data accessed by the task.
+         * @param[in] priority Tasks with higher priority are executed first
+         *      among the ones that become ready at the same time.
+         */
+        template <class F>
+        void insert_task(F&& f,
+                         std::initializer_list<Dependency> deps,
+                         int priority = 0)
+        {
+            insert_task(std::forward<F>(f), std::vector<Dependency>(deps),
+                        priority);
+        }
+
+        /// @copydoc insert_task()
+        template <class F>
+        void insert_task(F&& f,
+                         const std::vector<Dependency>& deps,
+                         int priority = 0)
+        {
+            const std::size_t id = tasks.size();
+            tasks.emplace_back(std::forward<F>(f), priority);
+
+            std::vector<std::size_t> preds;
+            for (const auto& d : deps) {
+                HandleState& h = handles[d.handle];
+                if (d.mode == Access::Read) {
+                    if (h.writer != npos) preds.push_back(h.writer);
+                    h.readers.push_back(id);
+                }
+                else {
+                    if (h.writer != npos) preds.push_back(h.writer);
+                    for (std::size_t r : h.readers)
+                        if (r != id) preds.push_back(r);
+                    h.readers.clear();
+                    h.writer = id;
+                }
+            }
+
+            std::sort(preds.begin(), preds.end());
+            preds.erase(std::unique(preds.begin(), preds.end()), preds.end());
+            for (std::size_t p : preds) {
+                if (p == id) continue;
+                tasks[p].succ.push_back(id);
+                ++tasks[id].npred;
+            }
+        }
+
+        /**
+         * @brief Execute all tasks in the graph and clear it.
+         *
+         * Each thread keeps a deque of ready tasks. A thread runs the tasks
+         * of its own deque in LIFO order, which favors data reuse, and steals
+         * the oldest tasks of other threads when its deque is empty.
+         *
+         * If a task throws, the tasks that were not started yet are skipped
+         * and the first exception is rethrown after all threads finish.
+         *
+         * @param[in] exec Execution policy.
+         */
+        void execute(const ExecutionPolicy& exec = {})
+        {
+            const std::size_t ntasks = tasks.size();
+            if (ntasks == 0) return;
+
+            ThreadPool& pool = (exec.pool) ? *exec.pool : default_thread_pool();
+            std::size_t nthreads = exec.nthreads;
+            if (nthreads == 0 || nthreads > pool.size())
+                nthreads = pool.size();
+
+            Executor ex(*this, nthreads);
+            if (nthreads <= 1)
+                ex.work(0);
+            else
+                pool.parallel_for(
+                    nthreads, [&](std::size_t w) { ex.work(w); }, nthreads);
+
+            clear();
+            if (ex.error) std::rethrow_exception(ex.error);
+        }
+
+        /// Remove all tasks and all data handles from the graph
+        void clear() noexcept
+        {
+            tasks.clear();
+            handles.clear();
+        }
+
+       private:
+        static constexpr std::size_t npos = std::size_t(-1);
+
+        struct Task {
+            std::function<void()> f;
+            int priority;
+            std::vector<std::size_t> succ;
+            std::size_t npred = 0;
+            std::atomic<std::size_t> remaining{0};
+
+            template <class F>
+            Task(F&& f, int priority)
+                : f(std::forward<F>(f)), priority(priority)
+            {}
+        };
+
+        struct HandleState {
+            std::size_t writer = npos;
+            std::vector<std::size_t> readers;
+        };
+
+        /// Work-stealing execution of a task graph
+        struct Executor {
+            struct WorkQueue {
+                std::mutex mtx;
+                std::deque<std::size_t> q;
+            };
+
+            std::deque<Task>& tasks;
+            const std::size_t nqueues;
+            std::unique_ptr<WorkQueue[]> queues;
+            std::atomic<std::size_t> nready{0};
+            std::atomic<std::size_t> ncompleted{0};
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+            std::mutex mtx;
+            std::condition_variable cv;
+
+            Executor(TaskGraph& g, std::size_t nqueues)
+                : tasks(g.tasks),
+                  nqueues(nqueues),
+                  queues(new WorkQueue[nqueues])
+            {
+                std::vector<std::size_t> ready;
+                for (std::size_t i = 0; i < tasks.size(); ++i) {
+                    tasks[i].remaining.store(tasks[i].npred,
+                                             std::memory_order_relaxed);
+                    if (tasks[i].npred == 0) ready.push_back(i);
+                }
+                std::stable_sort(ready.begin(), ready.end(),
+                                 [&](std::size_t a, std::size_t b) {
+                                     return tasks[a].priority <
+                                            tasks[b].priority;
+                                 });
+                // Deal the ready tasks so that the ones with highest priority
+                // are on the back of the deques
+                for (std::size_t i = 0; i < ready.size(); ++i)
+                    queues[i % nqueues].q.push_back(ready[i]);
+                nready = ready.size();
+            }
+
+            void push(std::size_t w, std::vector<std::size_t>& ready)
+            {
+                std::stable_sort(ready.begin(), ready.end(),
+                                 [&](std::size_t a, std::size_t b) {
+                                     return tasks[a].priority <
+                                            tasks[b].priority;
+                                 });
+                {
+                    std::lock_guard<std::mutex> lock(queues[w].mtx);
+                    for (std::size_t t : ready)
+                        queues[w].q.push_back(t);
+                }
+                nready += ready.size();
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                }
+                if (ready.size() > 1)
+                    cv.notify_all();
+                else
+                    cv.notify_one();
+            }
+
+            bool pop(std::size_t w, std::size_t& t)
+            {
+                // Own deque: newest task first
+                {
+                    std::lock_guard<std::mutex> lock(queues[w].mtx);
+                    if (!queues[w].q.empty()) {
+                        t = queues[w].q.back();
+                        queues[w].q.pop_back();
+                        --nready;
+                        return true;
+                    }
+                }
+                // Steal the oldest task from another thread
+                for (std::size_t k = 1; k < nqueues; ++k) {
+                    WorkQueue& victim = queues[(w + k) % nqueues];
+                    std::lock_guard<std::mutex> lock(victim.mtx);
+                    if (!victim.q.empty()) {
+                        t = victim.q.front();
+                        victim.q.pop_front();
+                        --nready;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void work(std::size_t w)
+            {
+                const std::size_t ntasks = tasks.size();
+                std::vector<std::size_t> ready;
+                while (true) {
+                    std::size_t t;
+                    if (!pop(w, t)) {
+                        std::unique_lock<std::mutex> lock(mtx);
+                        cv.wait(lock, [&]() {
+                            return nready > 0 || ncompleted == ntasks;
+                        });
+                        if (ncompleted == ntasks) return;
+                        continue;
+                    }
+
+                    if (!failed) {
+                        try {
+                            tasks[t].f();
+                        }
+                        catch (...) {
+                            std::lock_guard<std::mutex> lock(mtx);
+                            if (!error) error = std::current_exception();
+                            failed = true;
+                        }
+                    }
+
+                    ready.clear();
+                    for (std::size_t s : tasks[t].succ)
+                        if (--tasks[s].remaining == 0) ready.push_back(s);
+                    if (!ready.empty()) push(w, ready);
+
+                    if (++ncompleted == ntasks) {
+                        {
+                            std::lock_guard<std::mutex> lock(mtx);
+                        }
+                        cv.notify_all();
+                        return;
+                    }
+                }
+            }
+        };
+
+        std::deque<Task> tasks;
+        std::unordered_map<handle_t, HandleState> handles;
+    };
+
+}  // namespace tiled
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TILED_TASKGRAPH_HH
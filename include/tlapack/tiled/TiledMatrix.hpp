@@ -0,0 +1,122 @@
+/// @file tiled/TiledMatrix.hpp
+/// @brief Partition of a matrix into tiles.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TILED_TILEDMATRIX_HH
+#define TLAPACK_TILED_TILEDMATRIX_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/tiled/TaskGraph.hpp"
+
+namespace tlapack {
+namespace tiled {
+
+    /**
+     * @brief Tile descriptor of a matrix.
+     *
+     * Partitions a m-by-n matrix A into mt-by-nt tiles of size mb-by-nb. The
+     * tiles in the last block row and block column may be smaller. The object
+     * holds a reference to A, so A must outlive it.
+     *
+     * Each tile is identified by a handle, which is used to declare the data
+     * accessed by the tasks of a TaskGraph.
+     */
+    template <TLAPACK_MATRIX matrix_t>
+    class TiledMatrix {
+       public:
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        TiledMatrix(matrix_t& A, idx_t mb, idx_t nb) : A(A), mb(mb), nb(nb)
+        {
+            tlapack_check(mb > 0 && nb > 0);
+        }
+
+        /// Number of block rows
+        idx_t mt() const noexcept { return (nrows(A) + mb - 1) / mb; }
+
+        /// Number of block columns
+        idx_t nt() const noexcept { return (ncols(A) + nb - 1) / nb; }
+
+        /// Row range of the block row i
+        range rows(idx_t i) const noexcept
+        {
+            return range(i * mb, min((i + 1) * mb, nrows(A)));
+        }
+
+        /// Column range of the block column j
+        range cols(idx_t j) const noexcept
+        {
+            return range(j * nb, min((j + 1) * nb, ncols(A)));
+        }
+
+        /// Number of rows in the block row i
+        idx_t tile_nrows(idx_t i) const noexcept
+        {
+            return rows(i).second - rows(i).first;
+        }
+
+        /// Number of columns in the block column j
+        idx_t tile_ncols(idx_t j) const noexcept
+        {
+            return cols(j).second - cols(j).first;
+        }
+
+        /// Tile (i,j)
+        auto tile(idx_t i, idx_t j) { return slice(A, rows(i), cols(j)); }
+
+        /// Block of tiles (i0:i1, j0:j1)
+        auto tiles(idx_t i0, idx_t i1, idx_t j0, idx_t j1)
+        {
+            return slice(A, range(rows(i0).first, rows(i1 - 1).second),
+                         range(cols(j0).first, cols(j1 - 1).second));
+        }
+
+        /// Handle of tile (i,j)
+        handle_t handle(idx_t i, idx_t j) const noexcept
+        {
+            return &A(rows(i).first, cols(j).first);
+        }
+
+        /// Dependencies on the tiles (i0:i1, j)
+        std::vector<Dependency> column(idx_t i0,
+                                       idx_t i1,
+                                       idx_t j,
+                                       Access mode) const
+        {
+            std::vector<Dependency> deps;
+            for (idx_t i = i0; i < i1; ++i)
+                deps.push_back({handle(i, j), mode});
+            return deps;
+        }
+
+        /// Dependencies on the tiles (i, j0:j1)
+        std::vector<Dependency> row(idx_t i,
+                                    idx_t j0,
+                                    idx_t j1,
+                                    Access mode) const
+        {
+            std::vector<Dependency> deps;
+            for (idx_t j = j0; j < j1; ++j)
+                deps.push_back({handle(i, j), mode});
+            return deps;
+        }
+
+        /// The matrix
+        matrix_t& matrix() noexcept { return A; }
+
+       private:
+        matrix_t& A;
+        const idx_t mb;
+        const idx_t nb;
+    };
+
+}  // namespace tiled
+}  // namespace tlapack
+
+#endif  // TLAPACK_TILED_TILEDMATRIX_HH
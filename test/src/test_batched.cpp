@@ -0,0 +1,212 @@
+/// @file test_batched.cpp
+/// @brief Test the batched factorizations against the single-matrix routines
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/geqr2_batched.hpp>
+#include <tlapack/lapack/gesvd_batched.hpp>
+#include <tlapack/lapack/getrf_batched.hpp>
+#include <tlapack/lapack/potrf_batched.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Batched factorizations match the single-matrix routines",
+                   "[batched][potrf][getrf][geqr2][gesvd]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const std::size_t nbatch = GENERATE(1, 21);
+    const idx_t m = GENERATE(1, 4, 9);
+    const idx_t n = GENERATE(1, 4, 7);
+    const std::size_t nthreads = GENERATE(1, 3);
+
+    ThreadPool pool(2);
+    BatchOpts opts;
+    opts.exec = ExecutionPolicy::parallel(nthreads, &pool);
+
+    DYNAMIC_SECTION("nbatch = " << nbatch << " m = " << m << " n = " << n
+                                << " nthreads = " << nthreads)
+    {
+        const idx_t k = min(m, n);
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(20 * max(m, n)) * eps;
+
+        // Batches of matrices
+        std::vector<std::vector<T>> A_(nbatch), B_(nbatch), C_(nbatch);
+        std::vector<matrix_t> A, B, C;
+        for (std::size_t b = 0; b < nbatch; ++b) {
+            A.push_back(new_matrix(A_[b], m, n));
+            B.push_back(new_matrix(B_[b], m, n));
+            C.push_back(new_matrix(C_[b], m, n));
+            mm.random(A[b]);
+        }
+        std::vector<int> info(nbatch);
+
+        // Returns norm(B[b] - C[b]) / norm(A[b])
+        auto relative_difference = [&](std::size_t b) {
+            const real_t normA = lange(MAX_NORM, A[b]);
+            for (idx_t j = 0; j < ncols(C[b]); ++j)
+                for (idx_t i = 0; i < nrows(C[b]); ++i)
+                    C[b](i, j) -= B[b](i, j);
+            return lange(MAX_NORM, C[b]) / normA;
+        };
+
+        SECTION("potrf")
+        {
+            if (m == n) {
+                for (std::size_t b = 0; b < nbatch; ++b)
+                    for (idx_t j = 0; j < n; ++j)
+                        A[b](j, j) += real_t(n);
+                // A matrix that is not positive definite
+                A[nbatch - 1](n - 1, n - 1) = real_t(-1);
+
+                for (const Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+                    for (std::size_t b = 0; b < nbatch; ++b) {
+                        lacpy(GENERAL, A[b], B[b]);
+                        lacpy(GENERAL, A[b], C[b]);
+                    }
+                    const int ret = potrf_batched(uplo, C, info, opts);
+                    CHECK(ret == int(nbatch));
+                    for (std::size_t b = 0; b < nbatch; ++b) {
+                        const int infoB = potrf2(uplo, B[b], NO_ERROR_CHECK);
+                        CHECK(info[b] == infoB);
+                        CHECK(relative_difference(b) <= tol);
+                    }
+                }
+            }
+        }
+
+        SECTION("getrf")
+        {
+            std::vector<std::vector<idx_t>> piv(nbatch, std::vector<idx_t>(k));
+            for (std::size_t b = 0; b < nbatch; ++b) {
+                lacpy(GENERAL, A[b], B[b]);
+                lacpy(GENERAL, A[b], C[b]);
+            }
+            CHECK(getrf_batched(C, piv, info, opts) == 0);
+            for (std::size_t b = 0; b < nbatch; ++b) {
+                std::vector<idx_t> pivB(k);
+                CHECK(info[b] == getrf(B[b], pivB));
+                CHECK(piv[b] == pivB);
+                CHECK(relative_difference(b) <= tol);
+            }
+        }
+
+        SECTION("geqr2")
+        {
+            std::vector<std::vector<T>> tau(nbatch, std::vector<T>(k));
+            for (std::size_t b = 0; b < nbatch; ++b) {
+                lacpy(GENERAL, A[b], B[b]);
+                lacpy(GENERAL, A[b], C[b]);
+            }
+            geqr2_batched(C, tau, opts);
+            for (std::size_t b = 0; b < nbatch; ++b) {
+                std::vector<T> tauB(k);
+                geqr2(B[b], tauB);
+                for (idx_t i = 0; i < k; ++i)
+                    CHECK(abs1(tau[b][i] - tauB[i]) <= tol);
+                CHECK(relative_difference(b) <= tol);
+            }
+        }
+
+        SECTION("gesvd")
+        {
+            std::vector<std::vector<T>> U_(nbatch), Vt_(nbatch);
+            std::vector<matrix_t> U, Vt;
+            for (std::size_t b = 0; b < nbatch; ++b) {
+                U.push_back(new_matrix(U_[b], m, k));
+                Vt.push_back(new_matrix(Vt_[b], k, n));
+                lacpy(GENERAL, A[b], C[b]);
+            }
+            std::vector<std::vector<real_t>> s(nbatch,
+                                               std::vector<real_t>(k));
+            CHECK(gesvd_batched(true, true, C, s, U, Vt, info, opts) == 0);
+
+            for (std::size_t b = 0; b < nbatch; ++b) {
+                CHECK(info[b] == 0);
+
+                // Singular values of the reference routine
+                std::vector<real_t> sB(k);
+                lacpy(GENERAL, A[b], B[b]);
+                gesvd(false, false, B[b], sB, B[b], B[b]);
+                for (idx_t i = 0; i < k; ++i)
+                    CHECK(abs(s[b][i] - sB[i]) <= tol * sB[0]);
+
+                // A = U S Vt
+                for (idx_t j = 0; j < k; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        U[b](i, j) *= s[b][j];
+                lacpy(GENERAL, A[b], B[b]);
+                lacpy(GENERAL, A[b], C[b]);
+                gemm(NO_TRANS, NO_TRANS, real_t(-1), U[b], Vt[b], real_t(1),
+                     C[b]);
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        B[b](i, j) = T(0);
+                CHECK(relative_difference(b) <= tol);
+            }
+        }
+    }
+}
+
+TEST_CASE("Strided batches", "[batched][getrf]")
+{
+    using idx_t = std::size_t;
+
+    MatrixMarket mm;
+
+    const idx_t n = 5, ldim = 6, nbatch = 11;
+    const idx_t stride = ldim * n + 3;
+    std::vector<double> A_(stride * nbatch), B_(stride * nbatch);
+    LegacyStridedBatch<double> A{n, n, A_.data(), ldim, stride, nbatch};
+    LegacyStridedBatch<double> B{n, n, B_.data(), ldim, stride, nbatch};
+    for (idx_t b = 0; b < nbatch; ++b) {
+        auto Ab = A[b];
+        auto Bb = B[b];
+        mm.random(Ab);
+        lacpy(GENERAL, Ab, Bb);
+    }
+
+    std::vector<std::vector<idx_t>> piv(nbatch, std::vector<idx_t>(n));
+    std::vector<int> info(nbatch);
+    CHECK(getrf_batched(A, piv, info, BatchOpts{}) == 0);
+
+    for (idx_t b = 0; b < nbatch; ++b) {
+        auto Ab = A[b];
+        auto Bb = B[b];
+        std::vector<idx_t> pivB(n);
+        getrf(Bb, pivB);
+        CHECK(piv[b] == pivB);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs(Ab(i, j) - Bb(i, j)) <= 100 * ulp<double>());
+    }
+
+    // Padding between matrices is not touched
+    for (idx_t b = 0; b < nbatch; ++b)
+        for (idx_t i = n * ldim; i < stride; ++i)
+            CHECK(A_[b * stride + i] == 0);
+}
@@ -0,0 +1,150 @@
+/// @file test_bdsdc.cpp
+/// @brief Test divide and conquer bidiagonal SVD
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// tlapack routines
+#include <tlapack/blas/copy.hpp>
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/bdsdc.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+#include <tlapack/lapack/svd_qr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("bdsdc is backward stable",
+                   "[bdsdc][svd]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Pseudo random number generator
+    PCG32 prng;
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const idx_t n = GENERATE(1, 2, 10, 40, 100);
+    const idx_t nmin = GENERATE(2, 25);
+    const Uplo uplo = GENERATE(Uplo::Upper, Uplo::Lower);
+    const std::string matrix_type = GENERATE("Random", "Clustered", "Split");
+    const bool parallel = GENERATE(false, true);
+
+    DYNAMIC_SECTION("n = " << n << " nmin = " << nmin << " uplo = " << uplo
+                           << " matrix = " << matrix_type
+                           << " parallel = " << parallel)
+    {
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20. * n) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, n, n);
+        std::vector<T> Pt_;
+        auto Pt = new_matrix(Pt_, n, n);
+
+        std::vector<real_t> d(n), d_copy(n), d_qr(n);
+        std::vector<real_t> e(max<idx_t>(n, 1) - 1), e_copy(size(e)),
+            e_qr(size(e));
+
+        // Generate the bidiagonal matrix
+        for (idx_t j = 0; j < n; ++j) {
+            if (matrix_type == "Clustered")
+                d[j] = one + real_t(j % 3) * eps;
+            else
+                d[j] = rand_helper<real_t>(prng);
+        }
+        for (idx_t j = 0; j + 1 < n; ++j) {
+            if (matrix_type == "Clustered")
+                e[j] = real_t(1e-3);
+            else if (matrix_type == "Split" && j % 7 == 6)
+                e[j] = zero;
+            else
+                e[j] = rand_helper<real_t>(prng);
+        }
+        copy(d, d_copy);
+        copy(e, e_copy);
+        copy(d, d_qr);
+        copy(e, e_qr);
+
+        laset(Uplo::General, zero, one, Q);
+        laset(Uplo::General, zero, one, Pt);
+
+        BdsdcOpts opts;
+        opts.nmin = nmin;
+        if (parallel) opts.exec = ExecutionPolicy::parallel(4);
+        int err = bdsdc(uplo, true, true, d, e, Q, Pt, opts);
+        REQUIRE(err == 0);
+
+        // Check that singular values are positive and sorted in decreasing
+        // order
+        for (idx_t i = 0; i < n; ++i) {
+            CHECK(d[i] >= zero);
+        }
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            CHECK(d[i] >= d[i + 1]);
+        }
+
+        // Compare with the singular values from svd_qr
+        err = svd_qr(uplo, false, false, d_qr, e_qr, Q, Pt);
+        REQUIRE(err == 0);
+        real_t dmax(0);
+        for (idx_t i = 0; i < n; ++i)
+            dmax = max(dmax, d_qr[i]);
+        for (idx_t i = 0; i < n; ++i) {
+            CHECK(abs(d[i] - d_qr[i]) <= tol * dmax);
+        }
+
+        // Test for Q's orthogonality
+        std::vector<T> Wq_;
+        auto Wq = new_matrix(Wq_, n, n);
+        auto orth_Q = check_orthogonality(Q, Wq);
+        CHECK(orth_Q <= tol);
+
+        // Test for Pt's orthogonality
+        std::vector<T> Wpt_;
+        auto Wpt = new_matrix(Wpt_, n, n);
+        auto orth_Pt = check_orthogonality(Pt, Wpt);
+        CHECK(orth_Pt <= tol);
+
+        // Test Q * S * Pt = B
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+        laset(Uplo::General, zero, zero, B);
+        for (idx_t j = 0; j < n; ++j) {
+            B(j, j) = d_copy[j];
+            if (j + 1 < n) {
+                if (uplo == Uplo::Upper)
+                    B(j, j + 1) = e_copy[j];
+                else
+                    B(j + 1, j) = e_copy[j];
+            }
+        }
+        real_t normB = lange(Norm::Max, B);
+        std::vector<T> K_;
+        auto K = new_matrix(K_, n, n);
+        lacpy(Uplo::General, Q, K);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                K(i, j) *= d[j];
+        gemm(Op::NoTrans, Op::NoTrans, real_t(1.), K, Pt, real_t(-1.), B);
+        real_t repres = lange(Norm::Max, B);
+        CHECK(repres <= tol * normB);
+    }
+}
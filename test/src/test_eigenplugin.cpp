@@ -11,6 +11,12 @@
 // Test utilities and definitions (must come before <T>LAPACK headers)
 #include "testutils.hpp"
 
+// Other routines
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/lahqr.hpp>
+#include <tlapack/lapack/potrf.hpp>
+
 template <class block_t>
 void test_block()
 {
@@ -227,3 +233,69 @@ TEST_CASE("Layout works", "[plugins]")
         CHECK(tlapack::layout<B> == tlapack::Layout::Strided);
     }
 }
+
+TEST_CASE("Fixed-size matrices use the unrolled kernels", "[plugins]")
+{
+    using tlapack::static_ncols;
+    using tlapack::static_nrows;
+
+    CHECK(static_nrows<Eigen::Matrix<float, 2, 5>> == 2);
+    CHECK(static_ncols<Eigen::Matrix<float, 2, 5>> == 5);
+    CHECK(static_nrows<Eigen::MatrixXd> == -1);
+    CHECK(static_ncols<Eigen::Matrix<double, 3, -1>> == -1);
+    CHECK(static_nrows<Eigen::Block<Eigen::Matrix4d, 2, 2>> == 2);
+    CHECK(tlapack::has_static_size<Eigen::Matrix3d>);
+    CHECK(!tlapack::has_static_size<Eigen::MatrixXd>);
+
+    const double tol = 100 * tlapack::ulp<double>();
+
+    Eigen::Matrix4d A4;
+    A4 << 4, 1, 2, 0.5, 1, 5, 1, 1, 2, 1, 6, 2, 0.5, 1, 2, 7;
+    Eigen::MatrixXd B4 = A4;
+
+    // potrf
+    {
+        Eigen::Matrix4d L = A4;
+        CHECK(tlapack::potrf(tlapack::LOWER_TRIANGLE, L) == 0);
+        Eigen::Matrix4d Lt = L.triangularView<Eigen::Lower>();
+        CHECK((Lt * Lt.transpose() - A4).norm() <= tol * A4.norm());
+    }
+
+    // getrf
+    {
+        Eigen::Matrix4d LU = A4;
+        Eigen::MatrixXd LU2 = B4;
+        std::vector<Eigen::Index> piv(4), piv2(4);
+        CHECK(tlapack::getrf(LU, piv) == 0);
+        CHECK(tlapack::getrf(LU2, piv2) == 0);
+        CHECK(piv == piv2);
+        CHECK((LU - LU2).norm() <= tol * A4.norm());
+    }
+
+    // geqr2
+    {
+        Eigen::Matrix<double, 4, 3> QR = A4.leftCols<3>();
+        Eigen::MatrixXd QR2 = B4.leftCols(3);
+        std::vector<double> tau(3), tau2(3);
+        tlapack::geqr2(QR, tau);
+        tlapack::geqr2(QR2, tau2);
+        for (int i = 0; i < 3; ++i)
+            CHECK(std::abs(tau[i] - tau2[i]) <= tol);
+        CHECK((QR - QR2).norm() <= tol * A4.norm());
+    }
+
+    // lahqr on a 2x2 matrix with complex eigenvalues
+    {
+        Eigen::Matrix2d A;
+        A << 1, 2, -3, 4;
+        Eigen::Matrix2d T = A;
+        Eigen::Matrix2d Z = Eigen::Matrix2d::Identity();
+        std::vector<std::complex<double>> w(2);
+        CHECK(tlapack::lahqr(true, true, 0, 2, T, w, Z) == 0);
+        CHECK(T(0, 0) == T(1, 1));
+        CHECK(T(0, 1) * T(1, 0) < 0);
+        CHECK(std::abs(w[0].real() - 2.5) <= tol);
+        CHECK(std::abs(w[0].imag() * w[1].imag() + 15. / 4.) <= 10 * tol);
+        CHECK((Z * T * Z.transpose() - A).norm() <= tol * A.norm());
+    }
+}
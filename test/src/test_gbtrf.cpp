@@ -0,0 +1,171 @@
+/// @file test_gbtrf.cpp
+/// @brief Test the LU factorization and solver for band matrices in compact
+/// band storage
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/gbtrf.hpp>
+#include <tlapack/lapack/gbtrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gbtrf and gbtrs solve band systems with partial pivoting",
+                   "[gbtrf][gbtrs][linear-solver]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 10, 100);
+    const idx_t kl = min(n - 1, (idx_t)GENERATE(0, 1, 7, 40));
+    const idx_t ku = min(n - 1, (idx_t)GENERATE(0, 3, 40));
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t nb = GENERATE(1, 4, 32);
+    const idx_t nrhs = 3;
+
+    DYNAMIC_SECTION("n = " << n << " kl = " << kl << " ku = " << ku
+                           << " trans = " << trans << " nb = " << nb)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<idx_t> piv(n);
+
+        // Band matrix, zero outside the band. The diagonal is not dominant,
+        // so that rows are interchanged.
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if (i > j + kl || j > i + ku) A(i, j) = T(0);
+        mm.random(B);
+        lacpy(GENERAL, B, X);
+
+        // Copy A to compact storage with kl extra superdiagonals for the
+        // fill-in
+        std::vector<T> AB_((2 * kl + ku + 1) * n);
+        LegacyBandedMatrix<T, idx_t> AB(n, n, kl, kl + ku, AB_.data());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = (j > ku) ? j - ku : 0; i < min(n, j + kl + 1); ++i)
+                AB(i, j) = A(i, j);
+
+        // nx = 1 uses the blocked code for any band size
+        GbtrfOpts opts;
+        opts.nb = nb;
+        opts.nx = 1;
+        REQUIRE(gbtrf(AB, piv, opts) == 0);
+        gbtrs(trans, AB, piv, X);
+
+        // B := op(A) X - B
+        gemm(trans, NO_TRANS, real_t(1), A, X, real_t(-1), B);
+
+        const real_t normA = lange(ONE_NORM, A);
+        const real_t normX = lange(ONE_NORM, X);
+        CHECK(lange(ONE_NORM, B) <= tol * normA * normX);
+    }
+}
+
+TEMPLATE_TEST_CASE("gbtrf factors rectangular band matrices",
+                   "[gbtrf]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    using sizes_t = pair<idx_t, idx_t>;
+    const sizes_t sizes = GENERATE((sizes_t(10, 4)), (sizes_t(4, 10)),
+                                   (sizes_t(57, 30)), (sizes_t(30, 57)));
+    const idx_t m = sizes.first;
+    const idx_t n = sizes.second;
+    const idx_t kl = min(m - 1, (idx_t)GENERATE(1, 7, 40));
+    const idx_t ku = min(n - 1, (idx_t)GENERATE(0, 3));
+    const idx_t nb = GENERATE(1, 4);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " kl = " << kl
+                           << " ku = " << ku << " nb = " << nb)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * max(m, n)) * eps;
+        const idx_t k = min(m, n);
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> M_;
+        auto M = new_matrix(M_, m, n);
+        std::vector<idx_t> piv(k);
+
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                if (i > j + kl || j > i + ku) A(i, j) = T(0);
+
+        std::vector<T> AB_((2 * kl + ku + 1) * n);
+        LegacyBandedMatrix<T, idx_t> AB(m, n, kl, kl + ku, AB_.data());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = (j > ku) ? j - ku : 0; i < min(m, j + kl + 1); ++i)
+                AB(i, j) = A(i, j);
+
+        GbtrfOpts opts;
+        opts.nb = nb;
+        opts.nx = 1;
+        REQUIRE(gbtrf(AB, piv, opts) == 0);
+
+        // M = P_0 L_0 P_1 L_1 ... P_{k-1} L_{k-1} U
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                M(i, j) = (i <= j && i + kl + ku >= j) ? AB(i, j) : T(0);
+        for (idx_t j = k; j-- > 0;) {
+            for (idx_t i = j + 1; i < min(m, j + kl + 1); ++i)
+                for (idx_t c = 0; c < n; ++c)
+                    M(i, c) += AB(i, j) * M(j, c);
+            const idx_t p = piv[j];
+            REQUIRE(p >= j);
+            REQUIRE(p < min(m, j + kl + 1));
+            if (p != j) {
+                for (idx_t c = 0; c < n; ++c)
+                    std::swap(M(j, c), M(p, c));
+            }
+        }
+
+        // M := M - A
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                M(i, j) -= A(i, j);
+
+        CHECK(lange(MAX_NORM, M) <= tol * lange(MAX_NORM, A));
+    }
+}
@@ -0,0 +1,314 @@
+/// @file test_geev.cpp
+/// @brief Test the nonsymmetric eigenvalue driver geev and trevc3
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/lapack/geev.hpp>
+#include <tlapack/lapack/trevc3.hpp>
+
+using namespace tlapack;
+
+/// Returns the j-th eigenvector stored in V, following the convention of geev
+template <class matrix_t, class vector_t>
+std::vector<complex_type<type_t<matrix_t>>> get_eigenvector(const matrix_t& V,
+                                                            const vector_t& w,
+                                                            size_t j)
+{
+    using T = type_t<matrix_t>;
+    using complex_t = complex_type<T>;
+
+    const size_t n = nrows(V);
+    std::vector<complex_t> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        if constexpr (is_real<T>) {
+            if (imag(w[j]) > 0)
+                v[i] = complex_t(V(i, j), V(i, j + 1));
+            else if (imag(w[j]) < 0)
+                v[i] = complex_t(V(i, j - 1), -V(i, j));
+            else
+                v[i] = V(i, j);
+        }
+        else
+            v[i] = V(i, j);
+    }
+    return v;
+}
+
+TEMPLATE_TEST_CASE("geev computes eigenvalues and eigenvectors",
+                   "[eigenvalues][geev]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = complex_type<real_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const std::string matrix_type = GENERATE("Random", "Isolated", "Graded",
+                                             "NonNormal", "Tiny", "Huge");
+    const idx_t n = GENERATE(1, 2, 3, 5, 10, 30, 100);
+    const idx_t nb = GENERATE(3, 32);
+    const Balance balance = GENERATE(Balance::None, Balance::Both);
+
+    const real_t zero(0);
+    const real_t eps = ulp<real_t>();
+    const real_t tol = real_t(50 * n) * eps;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> VL_;
+    auto VL = new_matrix(VL_, n, n);
+    std::vector<T> VR_;
+    auto VR = new_matrix(VR_, n, n);
+    std::vector<complex_t> w(n);
+    std::vector<complex_t> w2(n);
+
+    mm.random(A0);
+    if (matrix_type == "Isolated") {
+        // The first column and the last row isolate eigenvalues
+        for (idx_t i = 1; i < n; ++i)
+            A0(i, 0) = zero;
+        for (idx_t j = 0; j + 1 < n; ++j)
+            A0(n - 1, j) = zero;
+    }
+    else if (matrix_type == "Graded") {
+        // Badly scaled matrix D A D^{-1}
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A0(i, j) *= real_t(std::pow(2.0, int(i % 20) - int(j % 20)));
+    }
+    else if (matrix_type == "NonNormal") {
+        // Large strictly upper triangular part
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < j; ++i)
+                A0(i, j) *= real_t(100);
+    }
+    else if (matrix_type == "Tiny" || matrix_type == "Huge") {
+        // Entries whose squares underflow or overflow
+        const real_t s = (matrix_type == "Tiny") ? sqrt(safe_min<real_t>())
+                                                 : sqrt(safe_max<real_t>());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A0(i, j) *= s;
+    }
+    const real_t normA = lange(FROB_NORM, A0);
+
+    DYNAMIC_SECTION("matrix = " << matrix_type << " n = " << n << " nb = "
+                                << nb << " balance = " << (char)balance)
+    {
+        GeevOpts opts;
+        opts.balance = balance;
+        opts.nb_trevc = nb;
+
+        lacpy(GENERAL, A0, A);
+        int info = geev(true, true, A, w, VL, VR, opts);
+        REQUIRE(info == 0);
+
+        // The eigenvalues do not depend on the eigenvectors being computed,
+        // but they may be computed in a different order
+        lacpy(GENERAL, A0, A);
+        info = geev(false, false, A, w2, VL, VR, opts);
+        REQUIRE(info == 0);
+        for (idx_t j = 0; j < n; ++j) {
+            real_t dmin = abs1(w2[j] - w[0]);
+            for (idx_t i = 1; i < n; ++i)
+                dmin = min(dmin, abs1(w2[j] - w[i]));
+            CHECK(dmin <= tol * normA);
+        }
+
+        for (idx_t j = 0; j < n; ++j) {
+            const auto v = get_eigenvector(VR, w, j);
+            const auto u = get_eigenvector(VL, w, j);
+
+            // Check the normalization
+            real_t nv(0), nu(0);
+            for (idx_t i = 0; i < n; ++i) {
+                nv += square(abs(v[i]));
+                nu += square(abs(u[i]));
+            }
+            CHECK(abs(sqrt(nv) - real_t(1)) <= tol);
+            CHECK(abs(sqrt(nu) - real_t(1)) <= tol);
+
+            // Check A v = w v and A^H u = conj(w) u
+            real_t resv(0), resu(0);
+            for (idx_t i = 0; i < n; ++i) {
+                complex_t av(0), au(0);
+                for (idx_t k = 0; k < n; ++k) {
+                    av += A0(i, k) * v[k];
+                    au += conj(A0(k, i)) * u[k];
+                }
+                resv = max(resv, abs1(av - w[j] * v[i]));
+                resu = max(resu, abs1(au - conj(w[j]) * u[i]));
+            }
+            CHECK(resv <= tol * normA);
+            CHECK(resu <= tol * normA);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("trevc3 computes the eigenvectors of a Schur form",
+                   "[eigenvalues][trevc3]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = complex_type<real_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 4, 17);
+
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t eps = ulp<real_t>();
+    const real_t tol = real_t(50 * n) * eps;
+
+    std::vector<T> H_;
+    auto H = new_matrix(H_, n, n);
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> VL_;
+    auto VL = new_matrix(VL_, n, n);
+    std::vector<T> VR_;
+    auto VR = new_matrix(VR_, n, n);
+    std::vector<complex_t> w(n);
+
+    mm.hessenberg(H);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            H(i, j) = zero;
+    laset(GENERAL, zero, one, Q);
+    REQUIRE(multishift_qr(true, true, 0, n, H, w, Q) == 0);
+    const real_t normH = lange(FROB_NORM, H);
+
+    DYNAMIC_SECTION("n = " << n)
+    {
+        // Eigenvectors of the Schur form
+        trevc3(true, true, false, H, VL, VR);
+
+        for (idx_t j = 0; j < n; ++j) {
+            const auto v = get_eigenvector(VR, w, j);
+            const auto u = get_eigenvector(VL, w, j);
+
+            real_t resv(0), resu(0), vmax(0), umax(0);
+            for (idx_t i = 0; i < n; ++i) {
+                complex_t hv(0), hu(0);
+                for (idx_t k = 0; k < n; ++k) {
+                    hv += H(i, k) * v[k];
+                    hu += conj(H(k, i)) * u[k];
+                }
+                resv = max(resv, abs1(hv - w[j] * v[i]));
+                resu = max(resu, abs1(hu - conj(w[j]) * u[i]));
+                vmax = max(vmax, abs1(v[i]));
+                umax = max(umax, abs1(u[i]));
+            }
+            CHECK(resv <= tol * normH);
+            CHECK(resu <= tol * normH);
+            CHECK(abs(vmax - one) <= tol);
+            CHECK(abs(umax - one) <= tol);
+
+            // The right eigenvectors are upper triangular and the left
+            // eigenvectors are lower triangular
+            for (idx_t i = j + 2; i < n; ++i)
+                CHECK(v[i] == complex_t(0));
+            for (idx_t i = 0; i + 1 < j; ++i)
+                CHECK(u[i] == complex_t(0));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("trevc3 scales the solves to avoid overflow",
+                   "[eigenvalues][trevc3]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = complex_type<real_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t n = GENERATE(10, 40);
+
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t eps = ulp<real_t>();
+    const real_t tol = real_t(50 * n) * eps;
+
+    std::vector<T> H_;
+    auto H = new_matrix(H_, n, n);
+    std::vector<T> VL_;
+    auto VL = new_matrix(VL_, n, n);
+    std::vector<T> VR_;
+    auto VR = new_matrix(VR_, n, n);
+    std::vector<complex_t> w(n);
+
+    // Upper triangular matrix with close eigenvalues and a large strictly
+    // upper triangular part. The unscaled eigenvectors overflow.
+    const real_t delta = sqrt(eps);
+    for (idx_t j = 0; j < n; ++j) {
+        for (idx_t i = 0; i < j; ++i)
+            H(i, j) = real_t(100);
+        H(j, j) = real_t(j) * delta;
+        for (idx_t i = j + 1; i < n; ++i)
+            H(i, j) = zero;
+        w[j] = H(j, j);
+    }
+    const real_t normH = lange(FROB_NORM, H);
+
+    DYNAMIC_SECTION("n = " << n)
+    {
+        trevc3(true, true, false, H, VL, VR);
+
+        for (idx_t j = 0; j < n; ++j) {
+            const auto v = get_eigenvector(VR, w, j);
+            const auto u = get_eigenvector(VL, w, j);
+
+            real_t resv(0), resu(0), vmax(0), umax(0);
+            for (idx_t i = 0; i < n; ++i) {
+                complex_t hv(0), hu(0);
+                for (idx_t k = 0; k < n; ++k) {
+                    hv += H(i, k) * v[k];
+                    hu += conj(H(k, i)) * u[k];
+                }
+                resv = max(resv, abs1(hv - w[j] * v[i]));
+                resu = max(resu, abs1(hu - conj(w[j]) * u[i]));
+                vmax = max(vmax, abs1(v[i]));
+                umax = max(umax, abs1(u[i]));
+            }
+            CHECK(resv <= tol * normH);
+            CHECK(resu <= tol * normH);
+            CHECK(abs(vmax - one) <= tol);
+            CHECK(abs(umax - one) <= tol);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/// @file test_gemm_blocked.cpp
+/// @brief Test the cache-blocked matrix-matrix multiplication
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm_blocked.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gemm_blocked matches the reference triple loop",
+                   "[gemm][blas3]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 13, 40);
+    const idx_t n = GENERATE(1, 11, 37);
+    const idx_t k = GENERATE(1, 9, 33);
+    const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Op transB = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t blocksize = GENERATE(0, 5);
+
+    const T alpha = T(real_t(0.75));
+    const T beta = T(real_t(-1.25));
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " k = " << k
+                           << " transA = " << transA << " transB = " << transB
+                           << " blocksize = " << blocksize)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(k + 2) * eps;
+
+        // Matrices
+        std::vector<T> A_;
+        auto A = (transA == Op::NoTrans) ? new_matrix(A_, m, k)
+                                         : new_matrix(A_, k, m);
+        std::vector<T> B_;
+        auto B = (transB == Op::NoTrans) ? new_matrix(B_, k, n)
+                                         : new_matrix(B_, n, k);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, n);
+
+        mm.random(A);
+        mm.random(B);
+        mm.random(C);
+        lacpy(GENERAL, C, R);
+
+        const real_t normA = lange(MAX_NORM, A);
+        const real_t normB = lange(MAX_NORM, B);
+        const real_t normC = lange(MAX_NORM, C);
+
+        // Blocked multiplication. Small block sizes exercise the edge cases
+        // of the packing routines.
+        GemmBlockedOpts opts;
+        opts.mc = blocksize;
+        opts.kc = blocksize;
+        opts.nc = blocksize;
+        gemm_blocked(transA, transB, alpha, A, B, beta, C, opts);
+
+        // Reference
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < m; ++i) {
+                T sum(0);
+                for (idx_t l = 0; l < k; ++l) {
+                    const T a = (transA == Op::NoTrans) ? A(i, l)
+                                : (transA == Op::Trans) ? A(l, i)
+                                                        : conj(A(l, i));
+                    const T b = (transB == Op::NoTrans) ? B(l, j)
+                                : (transB == Op::Trans) ? B(j, l)
+                                                        : conj(B(j, l));
+                    sum += a * b;
+                }
+                R(i, j) = alpha * sum + beta * R(i, j);
+            }
+        }
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                R(i, j) -= C(i, j);
+
+        real_t normres = lange(MAX_NORM, R);
+        CHECK(normres <= tol * (real_t(k) * normA * normB + normC));
+    }
+}
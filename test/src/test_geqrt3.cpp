@@ -0,0 +1,154 @@
+/// @file test_geqrt3.cpp
+/// @brief Test the recursive QR factorization geqrt3 and its use as the panel
+/// factorization of geqrf
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+#include <tlapack/lapack/larfb.hpp>
+#include <tlapack/lapack/larft.hpp>
+
+// Other routines
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/geqrt3.hpp>
+#include <tlapack/lapack/ungqr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("geqrt3 computes the QR factorization and its T factor",
+                   "[qr][geqrt3]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 9, 40, 100);
+    const idx_t n = GENERATE(1, 9, 40);
+    const idx_t nx = GENERATE(1, 4, 64);
+
+    if (m >= n) {
+        DYNAMIC_SECTION("m = " << m << " n = " << n << " nx = " << nx)
+        {
+            const real_t eps = ulp<real_t>();
+            const real_t tol = real_t(10 * m) * eps;
+
+            std::vector<T> A_;
+            auto A = new_matrix(A_, m, n);
+            std::vector<T> F_;
+            auto F = new_matrix(F_, m, n);
+            std::vector<T> TT_;
+            auto TT = new_matrix(TT_, n, n);
+            std::vector<T> TT2_;
+            auto TT2 = new_matrix(TT2_, n, n);
+            std::vector<T> Q_;
+            auto Q = new_matrix(Q_, m, m);
+            std::vector<T> tau(n);
+
+            mm.random(A);
+            lacpy(GENERAL, A, F);
+
+            Geqrt3Opts opts;
+            opts.nx = nx;
+            REQUIRE(geqrt3(F, tau, TT, opts) == 0);
+
+            // The T factor is the one from larft
+            laset(GENERAL, T(0), T(0), TT2);
+            larft(FORWARD, COLUMNWISE_STORAGE, F, tau, TT2);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i <= j; ++i)
+                    TT2(i, j) -= TT(i, j);
+            CHECK(lange(MAX_NORM, TT2) <= tol);
+
+            // A = Q R, with Q = I - V T V^H
+            laset(GENERAL, T(0), T(1), Q);
+            larfb(LEFT_SIDE, NO_TRANS, FORWARD, COLUMNWISE_STORAGE, F, TT, Q);
+            CHECK(check_orthogonality(Q) <= tol);
+
+            std::vector<T> R_;
+            auto R = new_matrix(R_, m, n);
+            laset(GENERAL, T(0), T(0), R);
+            lacpy(UPPER_TRIANGLE, F, R);
+            std::vector<T> E_;
+            auto E = new_matrix(E_, m, n);
+            lacpy(GENERAL, A, E);
+            gemm(NO_TRANS, NO_TRANS, real_t(1), Q, R, real_t(-1), E);
+            CHECK(lange(MAX_NORM, E) <= tol * lange(MAX_NORM, A));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("geqrf with the recursive panel factorization",
+                   "[qr][geqrf]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(10, 77);
+    const idx_t n = GENERATE(10, 77);
+    const idx_t nb = GENERATE(1, 8, 32);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " nb = " << nb)
+    {
+        const idx_t k = min(m, n);
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * max(m, n)) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> F_;
+        auto F = new_matrix(F_, m, n);
+        std::vector<T> tau(k);
+
+        mm.random(A);
+        lacpy(GENERAL, A, F);
+        const real_t anorm = lange(MAX_NORM, A);
+
+        GeqrfOpts opts;
+        opts.nb = nb;
+        opts.panel = GeqrfPanel::Recursive;
+        opts.nx_panel = 2;
+        REQUIRE(geqrf(F, tau, opts) == 0);
+
+        // A = Q R
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, m, k);
+        lacpy(LOWER_TRIANGLE, cols(F, range(0, k)), Q);
+        ungqr(Q, tau);
+        CHECK(check_orthogonality(Q) <= tol);
+
+        std::vector<T> R_;
+        auto R = new_matrix(R_, k, n);
+        laset(GENERAL, T(0), T(0), R);
+        lacpy(UPPER_TRIANGLE, rows(F, range(0, k)), R);
+        gemm(NO_TRANS, NO_TRANS, real_t(1), Q, R, real_t(-1), A);
+        CHECK(lange(MAX_NORM, A) <= tol * anorm);
+    }
+}
@@ -0,0 +1,276 @@
+/// @file test_gesv_ir.cpp
+/// @brief Test the mixed precision solvers gesv_ir and posv_ir
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/herk.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/gesv_ir.hpp>
+#include <tlapack/lapack/posv_ir.hpp>
+
+using namespace tlapack;
+
+#define TEST_TYPES_IR                                                        \
+    (LegacyMatrix<double, std::size_t, Layout::ColMajor>),                   \
+        (LegacyMatrix<double, std::size_t, Layout::RowMajor>),               \
+        (LegacyMatrix<std::complex<double>, std::size_t, Layout::ColMajor>), \
+        (LegacyMatrix<std::complex<double>, std::size_t, Layout::RowMajor>)
+
+/// Returns ||B - A X||_1 / (||A||_1 ||X||_1 eps)
+template <class matrixA_t, class matrixB_t, class matrixX_t>
+real_type<type_t<matrixX_t>> scaled_residual(const matrixA_t& A,
+                                             const matrixB_t& B,
+                                             const matrixX_t& X)
+{
+    using T = type_t<matrixX_t>;
+    using real_t = real_type<T>;
+    using matrix_t = matrix_type<matrixX_t>;
+
+    Create<matrix_t> new_matrix;
+
+    std::vector<T> R_;
+    auto R = new_matrix(R_, nrows(B), ncols(B));
+    lacpy(GENERAL, B, R);
+    gemm(NO_TRANS, NO_TRANS, real_t(-1), A, X, real_t(1), R);
+
+    return lange(ONE_NORM, R) /
+           (lange(ONE_NORM, A) * lange(ONE_NORM, X) * ulp<real_t>());
+}
+
+TEMPLATE_TEST_CASE("gesv_ir solves a general linear system",
+                   "[linear-solver][gesv_ir][mixed]",
+                   TEST_TYPES_IR)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const std::string matrix_type =
+        GENERATE("Random", "Large", "IllConditioned");
+    const idx_t n = GENERATE(1, 7, 50, 200);
+    const idx_t nrhs = GENERATE(1, 5);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, nrhs);
+    std::vector<T> X_;
+    auto X = new_matrix(X_, n, nrhs);
+    std::vector<idx_t> piv(n);
+
+    mm.random(A0);
+    mm.random(B);
+    for (idx_t i = 0; i < n; ++i)
+        A0(i, i) += real_t(n);
+    if (matrix_type == "Large") {
+        // Entries that overflow in single precision
+        A0(0, 0) = real_t(1e40);
+    }
+    else if (matrix_type == "IllConditioned" && n > 1) {
+        // Two columns that are only distinguishable in double precision
+        for (idx_t i = 0; i < n; ++i)
+            A0(i, 1) = A0(i, 0);
+        A0(0, 1) += real_t(1e-9);
+    }
+    lacpy(GENERAL, A0, A);
+
+    DYNAMIC_SECTION("matrix = " << matrix_type << " n = " << n
+                                << " nrhs = " << nrhs)
+    {
+        int iter;
+        int info = gesv_ir(A, piv, B, X, iter);
+        REQUIRE(info == 0);
+
+        if (matrix_type == "Random") {
+            CHECK(iter >= 0);
+            // A is unchanged if the refinement converges
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    CHECK(A(i, j) == A0(i, j));
+        }
+        else if (matrix_type == "Large") {
+            CHECK(iter == -2);
+        }
+        else if (n > 1) {
+            CHECK(iter < 0);
+        }
+
+        CHECK(scaled_residual(A0, B, X) <= real_t(10) * real_t(n));
+    }
+}
+
+TEMPLATE_TEST_CASE("gesv_ir falls back when the refinement stalls",
+                   "[linear-solver][gesv_ir][mixed]",
+                   TEST_TYPES_IR)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = 30;
+    const idx_t nrhs = 3;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, nrhs);
+    std::vector<T> X_;
+    auto X = new_matrix(X_, n, nrhs);
+    std::vector<idx_t> piv(n);
+
+    mm.random(A0);
+    mm.random(B);
+    lacpy(GENERAL, A0, A);
+
+    // No refinement step is allowed
+    GesvIrOpts opts;
+    opts.itermax = 0;
+
+    int iter;
+    int info = gesv_ir(A, piv, B, X, iter, opts);
+    REQUIRE(info == 0);
+    CHECK(iter == -1);
+    CHECK(scaled_residual(A0, B, X) <= real_t(10) * real_t(n));
+}
+
+TEMPLATE_TEST_CASE("posv_ir solves a Hermitian positive definite system",
+                   "[linear-solver][posv_ir][mixed]",
+                   TEST_TYPES_IR)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const std::string matrix_type = GENERATE("Random", "Large");
+    const idx_t n = GENERATE(1, 7, 50, 200);
+    const idx_t nrhs = GENERATE(1, 5);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, nrhs);
+    std::vector<T> X_;
+    auto X = new_matrix(X_, n, nrhs);
+
+    // A0 = G^H G + n I
+    std::vector<T> G_;
+    auto G = new_matrix(G_, n, n);
+    mm.random(G);
+    mm.random(B);
+    herk(UPPER_TRIANGLE, CONJ_TRANS, real_t(1), G, real_t(0), A0);
+    for (idx_t i = 0; i < n; ++i)
+        A0(i, i) += real_t(n);
+    if (matrix_type == "Large") {
+        // Entries that overflow in single precision
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i <= j; ++i)
+                A0(i, j) *= real_t(1e40);
+    }
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 1; i < n; ++i)
+            A0(i, j) = conj(A0(j, i));
+    lacpy(GENERAL, A0, A);
+
+    DYNAMIC_SECTION("matrix = " << matrix_type << " n = " << n << " nrhs = "
+                                << nrhs << " uplo = " << uplo)
+    {
+        int iter;
+        int info = posv_ir(uplo, A, B, X, iter);
+        REQUIRE(info == 0);
+
+        if (matrix_type == "Random")
+            CHECK(iter >= 0);
+        else
+            CHECK(iter == -2);
+
+        CHECK(scaled_residual(A0, B, X) <= real_t(10) * real_t(n));
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "posv_ir falls back when A is not positive definite in low precision",
+    "[linear-solver][posv_ir][mixed]",
+    TEST_TYPES_IR)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t n = 2;
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, 1);
+    std::vector<T> X_;
+    auto X = new_matrix(X_, n, 1);
+
+    // A0 is singular in single precision, and B = A0 [1; 1]
+    A0(0, 0) = real_t(1);
+    A0(0, 1) = real_t(1);
+    A0(1, 0) = real_t(1);
+    A0(1, 1) = real_t(1) + real_t(1e-10);
+    B(0, 0) = A0(0, 0) + A0(0, 1);
+    B(1, 0) = A0(1, 0) + A0(1, 1);
+    lacpy(GENERAL, A0, A);
+
+    DYNAMIC_SECTION("uplo = " << uplo)
+    {
+        int iter;
+        int info = posv_ir(uplo, A, B, X, iter);
+        REQUIRE(info == 0);
+        CHECK(iter == -3);
+
+        // The condition number of A0 is about 4e10
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(X(i, 0) - real_t(1)) <= real_t(1e-4));
+        CHECK(scaled_residual(A0, B, X) <= real_t(10) * real_t(n));
+    }
+}
@@ -210,4 +210,115 @@ TEMPLATE_TEST_CASE("svd with full unitary matrix is backward stable",
         real_t repres = lange(Norm::Max, A_copy);
         CHECK(repres <= tol * normA);
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("svd of tall and wide matrices is backward stable",
+                   "[svd]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    idx_t m, n;
+
+    m = GENERATE(3, 40);
+    n = GENERATE(3, 40);
+    const bool full = GENERATE(false, true);
+    const bool u_in_a = GENERATE(false, true);
+    const float shapethresh = GENERATE(1.6f, 1.0e6f);
+    const GesvdVariant variant =
+        GENERATE(GesvdVariant::QR, GesvdVariant::DivideAndConquer);
+    idx_t k = min(m, n);
+    idx_t nu = full ? m : k;
+    idx_t nvt = full ? n : k;
+
+    PCG32 gen;
+    gen.seed(3);
+
+    const real_t eps = ulp<real_t>();
+    real_t tol = real_t(20. * max(m, n)) * eps;
+    // Use a slightly larger tolerance for half precision
+    if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> A_copy_;
+    auto A_copy = new_matrix(A_copy_, m, n);
+    std::vector<T> U_;
+    auto U = new_matrix(U_, m, nu);
+    std::vector<T> Vt_;
+    auto Vt = new_matrix(Vt_, nvt, n);
+
+    std::vector<real_t> s(k);
+
+    // Generate random m-by-n matrix
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    lacpy(Uplo::General, A, A_copy);
+    real_t normA = lange(Norm::Max, A);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " full = " << full
+                           << " u_in_a = " << u_in_a
+                           << " shapethresh = " << shapethresh
+                           << " variant = " << (char)variant)
+    {
+        GesvdOpts opts;
+        opts.variant = variant;
+        opts.shapethresh = shapethresh;
+        opts.u_in_a = u_in_a;
+        int err = gesvd(true, true, A, s, U, Vt, opts);
+        REQUIRE(err == 0);
+
+        for (idx_t i = 0; i + 1 < k; ++i) {
+            CHECK(s[i] >= s[i + 1]);
+        }
+
+        // Copy the left singular vectors to K
+        std::vector<T> K_;
+        auto K = new_matrix(K_, m, k);
+        if (u_in_a)
+            lacpy(Uplo::General, slice(A, range(0, m), range(0, k)), K);
+        else
+            lacpy(Uplo::General, slice(U, range(0, m), range(0, k)), K);
+
+        // Test for U's orthogonality
+        std::vector<T> Wu_;
+        auto Wu = new_matrix(Wu_, k, k);
+        auto orth_U = check_orthogonality(K, Wu);
+        CHECK(orth_U <= tol);
+
+        // Test for the orthogonality of the full U
+        if (full && !u_in_a) {
+            std::vector<T> Wf_;
+            auto Wf = new_matrix(Wf_, m, m);
+            auto orth_Uf = check_orthogonality(U, Wf);
+            CHECK(orth_Uf <= tol);
+        }
+
+        // Test for Vt's orthogonality
+        std::vector<T> Wvt_;
+        auto Wvt = new_matrix(Wvt_, nvt, nvt);
+        auto orth_Vt = check_orthogonality(Vt, Wvt);
+        CHECK(orth_Vt <= tol);
+
+        // Test U * S * V^H = A
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                K(i, j) *= s[j];
+        auto Vtk = slice(Vt, range(0, k), range(0, n));
+        gemm(Op::NoTrans, Op::NoTrans, real_t(1.), K, Vtk, real_t(-1.),
+             A_copy);
+        real_t repres = lange(Norm::Max, A_copy);
+        CHECK(repres <= tol * normA);
+    }
+}
@@ -43,7 +43,8 @@ TEMPLATE_TEST_CASE("LU factorization of a general m-by-n matrix",
     idx_t m = GENERATE(10, 20, 30);
     idx_t n = GENERATE(10, 20, 30);
     GetrfVariant variant =
-        GENERATE(GetrfVariant::Level0, GetrfVariant::Recursive);
+        GENERATE(GetrfVariant::Level0, GetrfVariant::Recursive,
+                 GetrfVariant::Blocked, GetrfVariant::Lookahead);
 
     DYNAMIC_SECTION("m = " << m << " n = " << n
                            << " variant = " << (char)variant)
@@ -74,7 +75,10 @@ TEMPLATE_TEST_CASE("LU factorization of a general m-by-n matrix",
         // Initialize piv vector to all zeros
         std::vector<idx_t> piv(k, idx_t(0));
         // Run getrf and both A and piv will be update
-        getrf(A, piv, GetrfOpts{variant});
+        GetrfOpts opts;
+        opts.variant = variant;
+        opts.nb = 7;
+        getrf(A, piv, opts);
 
         // A contains L and U now, then form A <--- LU
         if (m > n) {
@@ -0,0 +1,156 @@
+/// @file test_getrs.cpp
+/// @brief Test the recursive trsm and the LU solver getrs
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/trsm.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/getrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("trsm solves triangular systems of any order",
+                   "[trsm][blas3]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Orders larger than internal::trsm_nb use the recursive algorithm
+    const idx_t k = GENERATE(1, 64, 65, 150);
+    const idx_t p = GENERATE(1, 70);
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+
+    const T alpha = T(real_t(0.75));
+    const idx_t m = (side == Side::Left) ? k : p;
+    const idx_t n = (side == Side::Left) ? p : k;
+
+    DYNAMIC_SECTION("k = " << k << " p = " << p << " side = " << side
+                           << " uplo = " << uplo << " trans = " << trans
+                           << " diag = " << diag)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * k) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, k, k);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, m, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, n);
+
+        // Well conditioned triangular matrix. The opposite triangle is set
+        // to zero, and the diagonal is set to one when diag = Unit, so A can
+        // be used in gemm to check the solution.
+        mm.random(A);
+        for (idx_t j = 0; j < k; ++j) {
+            for (idx_t i = 0; i < k; ++i) {
+                if ((uplo == Uplo::Upper) ? (i > j) : (i < j))
+                    A(i, j) = T(0);
+                else
+                    A(i, j) /= real_t(k);
+            }
+            A(j, j) = (diag == Diag::Unit) ? T(1) : A(j, j) + real_t(1);
+        }
+        mm.random(B);
+        lacpy(GENERAL, B, X);
+
+        trsm(side, uplo, trans, diag, alpha, A, X);
+
+        // R = op(A) X - alpha B or X op(A) - alpha B
+        lacpy(GENERAL, B, R);
+        if (side == Side::Left)
+            gemm(trans, NO_TRANS, real_t(1), A, X, -alpha, R);
+        else
+            gemm(NO_TRANS, trans, real_t(1), X, A, -alpha, R);
+
+        const real_t normA = lange(ONE_NORM, A);
+        const real_t normX = lange(ONE_NORM, X);
+        const real_t normB = lange(ONE_NORM, B);
+        CHECK(lange(ONE_NORM, R) <= tol * (normA * normX + normB));
+    }
+}
+
+TEMPLATE_TEST_CASE("getrs solves a linear system with the LU factorization",
+                   "[getrs][linear-solver]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 10, 100);
+    const idx_t nrhs = GENERATE(1, 7, 200);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    // nb = 0 uses the tuned value and the largest nb swaps whole rows
+    const size_t nb = GENERATE(size_t(0), size_t(1), size_t(32),
+                               std::numeric_limits<size_t>::max());
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " trans = " << trans
+                           << " nb = " << nb)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> LU_;
+        auto LU = new_matrix(LU_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<idx_t> piv(n);
+
+        mm.random(A);
+        mm.random(B);
+        lacpy(GENERAL, A, LU);
+        lacpy(GENERAL, B, X);
+
+        REQUIRE(getrf(LU, piv) == 0);
+        LaswpOpts opts;
+        opts.nb = nb;
+        getrs(trans, LU, piv, X, opts);
+
+        // B := op(A) X - B
+        gemm(trans, NO_TRANS, real_t(1), A, X, real_t(-1), B);
+
+        const real_t normA = lange(ONE_NORM, A);
+        const real_t normX = lange(ONE_NORM, X);
+        CHECK(lange(ONE_NORM, B) <= tol * normA * normX);
+    }
+}
@@ -0,0 +1,104 @@
+/// @file test_gttrf.cpp Test the LU factorization of a general tridiagonal
+/// matrix and the solution of the corresponding linear systems
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/gttrf.hpp>
+#include <tlapack/lapack/gttrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("LU factorization of a general tridiagonal matrix",
+                   "[gttrf][gttrs]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 2, 3, 10, 57);
+    const idx_t nrhs = GENERATE(1, 9);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const bool parallel = GENERATE(false, true);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " trans = " << trans
+                           << " parallel = " << parallel)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, nrhs);
+
+        // A is a random tridiagonal matrix. Its diagonal is scaled down so
+        // that gttrf() interchanges rows.
+        std::vector<T> F_;
+        auto F = new_matrix(F_, n, 3);
+        mm.random(F);
+        laset(GENERAL, T(0), T(0), A);
+        for (idx_t i = 0; i < n; ++i) {
+            A(i, i) = (i % 3 == 0) ? real_t(0.01) * F(i, 1) : F(i, 1);
+            if (i + 1 < n) {
+                A(i + 1, i) = F(i, 0);
+                A(i, i + 1) = F(i, 2);
+            }
+        }
+        mm.random(B);
+        lacpy(GENERAL, B, X);
+
+        // Diagonals of A
+        std::vector<T> DL(n - 1), D(n), DU(n - 1), DU2(max(n, idx_t(2)) - 2);
+        std::vector<idx_t> piv(n);
+        for (idx_t i = 0; i < n; ++i) {
+            D[i] = A(i, i);
+            if (i + 1 < n) {
+                DL[i] = A(i + 1, i);
+                DU[i] = A(i, i + 1);
+            }
+        }
+
+        int info = gttrf(DL, D, DU, DU2, piv);
+        REQUIRE(info == 0);
+
+        GttrsOpts opts;
+        opts.nb = 4;
+        if (parallel) opts.exec = ExecutionPolicy::parallel(4);
+        gttrs(trans, DL, D, DU, DU2, piv, X, opts);
+
+        // Check norm(op(A) X - B) / (norm(A) norm(X) + norm(B))
+        lacpy(GENERAL, B, R);
+        gemm(trans, NO_TRANS, real_t(1), A, X, real_t(-1), R);
+        const real_t error =
+            lange(MAX_NORM, R) /
+            (lange(MAX_NORM, A) * lange(MAX_NORM, X) + lange(MAX_NORM, B));
+        CHECK(error <= tol);
+    }
+}
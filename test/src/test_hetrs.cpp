@@ -0,0 +1,132 @@
+/// @file test_hetrs.cpp
+/// @brief Test the symmetric indefinite solver hetrs with all variants of
+/// hetrf
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/hetrf.hpp>
+#include <tlapack/lapack/hetrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("hetrs solves a symmetric indefinite linear system",
+                   "[hetrf][hetrs][linear-solver]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    using variant_t = pair<HetrfVariant, idx_t>;
+    const variant_t variant = GENERATE((variant_t(HetrfVariant::Blocked, 3)),
+                                       (variant_t(HetrfVariant::Rook, 1)),
+                                       (variant_t(HetrfVariant::Rook, 5)),
+                                       (variant_t(HetrfVariant::Aasen, 1)),
+                                       (variant_t(HetrfVariant::Aasen, 5)),
+                                       (variant_t(HetrfVariant::Aasen, 32)));
+    const std::string matrix_type = GENERATE("Random", "KKT");
+    const idx_t n = GENERATE(1, 2, 10, 57);
+    const idx_t nrhs = GENERATE(1, 4);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op invariant = GENERATE(Op::Trans, Op::ConjTrans);
+
+    const bool herm = (invariant == Op::ConjTrans);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs
+                           << " matrix = " << matrix_type << " uplo = " << uplo
+                           << " variant = " << (char)variant.first
+                           << " nb = " << variant.second
+                           << " invariant = " << (char)invariant)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(100 * n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> F_;
+        auto F = new_matrix(F_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<int> ipiv(n);
+
+        // Symmetric or Hermitian indefinite matrix. The KKT matrix
+        //      [ H  C^op ]
+        //      [ C  0    ]
+        // has a zero trailing block, which forces 2-by-2 pivots.
+        mm.random(A);
+        mm.random(B);
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = j + 1; i < n; ++i)
+                A(i, j) = herm ? conj(A(j, i)) : A(j, i);
+            if (herm) A(j, j) = real(A(j, j));
+        }
+        if (matrix_type == "KKT") {
+            for (idx_t j = n - n / 2; j < n; ++j)
+                for (idx_t i = n - n / 2; i < n; ++i)
+                    A(i, j) = T(0);
+        }
+        lacpy(GENERAL, A, F);
+
+        HetrfOpts opts;
+        opts.variant = variant.first;
+        opts.nb = variant.second;
+        opts.invariant = invariant;
+
+        int info = hetrf(uplo, F, ipiv, opts);
+        REQUIRE(info == 0);
+
+        if (variant.first == HetrfVariant::Rook) {
+            // Rook pivoting bounds the entries of L resp. U. The pivot search
+            // uses abs1 in the complex case, which loosens the bound.
+            const real_t alpha = (real_t(1) + sqrt(real_t(17))) / real_t(8);
+            const real_t bound =
+                (is_complex<T> ? real_t(2) : real_t(1)) / (real_t(1) - alpha) +
+                tol;
+            for (idx_t j = 0; j < n; ++j) {
+                const bool twobytwo =
+                    ipiv[j] < 0 &&
+                    ((uplo == Uplo::Lower) ? (j + 1 < n && ipiv[j + 1] < 0)
+                                           : (j > 0 && ipiv[j - 1] < 0));
+                const idx_t skip = twobytwo ? 1 : 0;
+                for (idx_t i = 0; i < n; ++i) {
+                    if ((uplo == Uplo::Lower) ? (i > j + skip)
+                                              : (i + skip < j))
+                        CHECK(abs(F(i, j)) <= bound);
+                }
+            }
+        }
+
+        lacpy(GENERAL, B, X);
+        info = hetrs(uplo, F, ipiv, X, opts);
+        REQUIRE(info == 0);
+
+        // B := A X - B
+        gemm(NO_TRANS, NO_TRANS, real_t(1), A, X, real_t(-1), B);
+
+        const real_t normA = lange(ONE_NORM, A);
+        const real_t normX = lange(ONE_NORM, X);
+        CHECK(lange(ONE_NORM, B) <= tol * normA * normX);
+    }
+}
@@ -34,7 +34,8 @@ TEMPLATE_TEST_CASE("LAUUM is stable", "[lauum]", TLAPACK_TYPES_TO_TEST)
     MatrixMarket mm;
 
     Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
-    idx_t n = GENERATE(1, 2, 6, 9);
+    idx_t n = GENERATE(1, 2, 6, 9, 40);
+    const size_t nx = GENERATE(1, 4, 32);
 
     const real_t eps = uroundoff<real_t>();
     const real_t tol = real_t(1.0e2 * n) * eps;
@@ -49,9 +50,11 @@ TEMPLATE_TEST_CASE("LAUUM is stable", "[lauum]", TLAPACK_TYPES_TO_TEST)
 
     lacpy(GENERAL, A, C);
 
-    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo)
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo << " nx = " << nx)
     {
-        lauum_recursive(uplo, A);
+        LauumOpts opts;
+        opts.nx = nx;
+        lauum_recursive(uplo, A, opts);
 
         // Calculate residual
         real_t normC = lantr(MAX_NORM, uplo, NON_UNIT_DIAG, C);
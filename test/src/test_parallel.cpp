@@ -0,0 +1,211 @@
+/// @file test_parallel.cpp
+/// @brief Test the thread pool and the parallel execution policy of the
+/// blocked routines
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/gebrd.hpp>
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/potrf.hpp>
+
+using namespace tlapack;
+
+TEST_CASE("ThreadPool runs every task once", "[parallel]")
+{
+    ThreadPool pool(3);
+    const std::size_t ntasks = GENERATE(0, 1, 5, 1000);
+    const std::size_t nthreads = GENERATE(0, 1, 2, 8);
+
+    std::vector<int> count(ntasks, 0);
+    pool.parallel_for(
+        ntasks, [&](std::size_t i) { count[i] += 1; }, nthreads);
+    for (std::size_t i = 0; i < ntasks; ++i)
+        CHECK(count[i] == 1);
+
+    // Nested loops
+    std::atomic<std::size_t> total{0};
+    pool.parallel_for(ntasks, [&](std::size_t) {
+        pool.parallel_for(7, [&](std::size_t) { total++; }, nthreads);
+    });
+    CHECK(total == 7 * ntasks);
+
+    // Exceptions are forwarded to the caller
+    if (ntasks > 0) {
+        CHECK_THROWS_AS(pool.parallel_for(ntasks,
+                                          [&](std::size_t i) {
+                                              if (i == ntasks - 1)
+                                                  throw std::runtime_error("");
+                                          }),
+                        std::runtime_error);
+    }
+}
+
+TEMPLATE_TEST_CASE("Parallel policy matches the sequential policy",
+                   "[parallel][potrf][getrf][geqrf][gehrd][gebrd]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(40, 97);
+    const idx_t n = GENERATE(40, 61);
+    const idx_t nb = 8;
+
+    ThreadPool pool(3);
+    const ExecutionPolicy seq = ExecutionPolicy::sequential();
+    const ExecutionPolicy par = ExecutionPolicy::parallel(4, &pool);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * max(m, n)) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+
+        mm.random(A);
+        const real_t normA = lange(MAX_NORM, A);
+
+        // Returns norm(B - C) / norm(A)
+        auto relative_difference = [&]() {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C(i, j) -= B(i, j);
+            return lange(MAX_NORM, C) / normA;
+        };
+
+        SECTION("potrf")
+        {
+            if (m == n) {
+                for (idx_t j = 0; j < n; ++j)
+                    A(j, j) += real_t(n);
+                for (const Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+                    for (const PotrfVariant variant :
+                         {PotrfVariant::Blocked, PotrfVariant::RightLooking}) {
+                        PotrfOpts opts;
+                        opts.variant = variant;
+                        opts.nb = nb;
+
+                        lacpy(GENERAL, A, B);
+                        opts.exec = seq;
+                        REQUIRE(potrf(uplo, B, opts) == 0);
+
+                        lacpy(GENERAL, A, C);
+                        opts.exec = par;
+                        REQUIRE(potrf(uplo, C, opts) == 0);
+
+                        CHECK(relative_difference() <= tol);
+                    }
+                }
+            }
+        }
+
+        SECTION("getrf")
+        {
+            const idx_t k = min(m, n);
+            for (const GetrfVariant variant :
+                 {GetrfVariant::Recursive, GetrfVariant::Blocked,
+                  GetrfVariant::Lookahead}) {
+                std::vector<idx_t> pivB(k), pivC(k);
+                GetrfOpts opts;
+                opts.variant = variant;
+                opts.nb = nb;
+
+                lacpy(GENERAL, A, B);
+                opts.exec = seq;
+                getrf(B, pivB, opts);
+
+                lacpy(GENERAL, A, C);
+                opts.exec = par;
+                getrf(C, pivC, opts);
+
+                for (idx_t i = 0; i < k; ++i)
+                    CHECK(pivB[i] == pivC[i]);
+                CHECK(relative_difference() <= tol);
+            }
+        }
+
+        SECTION("geqrf")
+        {
+            const idx_t k = min(m, n);
+            std::vector<T> tau(k);
+            GeqrfOpts opts;
+            opts.nb = nb;
+
+            lacpy(GENERAL, A, B);
+            opts.exec = seq;
+            geqrf(B, tau, opts);
+
+            lacpy(GENERAL, A, C);
+            opts.exec = par;
+            geqrf(C, tau, opts);
+
+            CHECK(relative_difference() <= tol);
+        }
+
+        SECTION("gehrd")
+        {
+            if (m == n) {
+                std::vector<T> tau(n);
+                GehrdOpts opts;
+                opts.nb = nb;
+                opts.nx_switch = 2;
+
+                lacpy(GENERAL, A, B);
+                opts.exec = seq;
+                gehrd(0, n, B, tau, opts);
+
+                lacpy(GENERAL, A, C);
+                opts.exec = par;
+                gehrd(0, n, C, tau, opts);
+
+                CHECK(relative_difference() <= tol);
+            }
+        }
+
+        SECTION("gebrd")
+        {
+            const idx_t k = min(m, n);
+            std::vector<T> tauv(k);
+            std::vector<T> tauw(k);
+            GebrdOpts opts;
+            opts.nb = nb;
+
+            lacpy(GENERAL, A, B);
+            opts.exec = seq;
+            gebrd(B, tauv, tauw, opts);
+
+            lacpy(GENERAL, A, C);
+            opts.exec = par;
+            gebrd(C, tauv, tauw, opts);
+
+            CHECK(relative_difference() <= tol);
+        }
+    }
+}
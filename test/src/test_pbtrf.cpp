@@ -0,0 +1,98 @@
+/// @file test_pbtrf.cpp
+/// @brief Test the Cholesky factorization and solver for band matrices in
+/// compact band storage
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/blas/hemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/lanhe.hpp>
+
+// Other routines
+#include <tlapack/lapack/pbtrf.hpp>
+#include <tlapack/lapack/pbtrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE(
+    "pbtrf and pbtrs solve Hermitian positive definite band systems",
+    "[pbtrf][pbtrs][linear-solver]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 10, 100);
+    const idx_t kd = min(n - 1, (idx_t)GENERATE(0, 1, 7, 40));
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t nb = GENERATE(1, 4, 32);
+    const idx_t nrhs = 3;
+
+    DYNAMIC_SECTION("n = " << n << " kd = " << kd << " uplo = " << uplo
+                           << " nb = " << nb)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+
+        // Hermitian positive definite band matrix, zero outside the band
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < n; ++i) {
+                if (i > j + kd || j > i + kd)
+                    A(i, j) = T(0);
+                else if (i > j)
+                    A(i, j) = conj(A(j, i));
+            }
+            A(j, j) = real(A(j, j)) + real_t(2 * kd + 1);
+        }
+        mm.random(B);
+        lacpy(GENERAL, B, X);
+
+        // Copy the referenced band of A to compact storage
+        const idx_t kl = (uplo == Uplo::Lower) ? kd : 0;
+        const idx_t ku = (uplo == Uplo::Upper) ? kd : 0;
+        std::vector<T> AB_((kl + ku + 1) * n);
+        LegacyBandedMatrix<T, idx_t> AB(n, n, kl, ku, AB_.data());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = (j > ku) ? j - ku : 0; i < min(n, j + kl + 1); ++i)
+                AB(i, j) = A(i, j);
+
+        // nx = 1 uses the blocked code for any band size
+        PbtrfOpts opts;
+        opts.nb = nb;
+        opts.nx = 1;
+        REQUIRE(pbtrf(uplo, AB, opts) == 0);
+        pbtrs(uplo, AB, X);
+
+        // B := A X - B
+        hemm(LEFT_SIDE, uplo, real_t(1), A, X, real_t(-1), B);
+
+        const real_t normA = lanhe(ONE_NORM, uplo, A);
+        const real_t normX = lange(ONE_NORM, X);
+        CHECK(lange(ONE_NORM, B) <= tol * normA * normX);
+    }
+}
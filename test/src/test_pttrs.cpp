@@ -0,0 +1,240 @@
+/// @file test_pttrs.cpp Test the solvers for Hermitian positive definite
+/// tridiagonal systems
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/ptsv.hpp>
+#include <tlapack/lapack/ptsv_batched.hpp>
+#include <tlapack/lapack/ptsv_partitioned.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE(
+    "Solution of a Hermitian positive-definite tridiagonal system",
+    "[pttrs][ptsv][ptsv_partitioned]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(2, 10, 57, 200);
+    const idx_t nrhs = GENERATE(1, 7, 40);
+    const bool parallel = GENERATE(false, true);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs
+                           << " parallel = " << parallel)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> F_;
+        auto F = new_matrix(F_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+
+        // A is a random diagonally dominant Hermitian tridiagonal matrix
+        mm.random(F);
+        laset(GENERAL, T(0), T(0), A);
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            A(i + 1, i) = F(i + 1, i);
+            A(i, i + 1) = conj(A(i + 1, i));
+        }
+        for (idx_t i = 0; i < n; ++i)
+            A(i, i) = real_t(2) + abs(real(F(i, i)));
+        mm.random(B);
+        lacpy(GENERAL, B, X);
+
+        const real_t normA = lange(MAX_NORM, A);
+        const real_t normB = lange(MAX_NORM, B);
+
+        // Returns norm(A X - B) / (norm(A) norm(X) + norm(B))
+        auto residual = [&]() {
+            std::vector<T> R_;
+            auto R = new_matrix(R_, n, nrhs);
+            lacpy(GENERAL, B, R);
+            gemm(NO_TRANS, NO_TRANS, real_t(1), A, X, real_t(-1), R);
+            return lange(MAX_NORM, R) /
+                   (normA * lange(MAX_NORM, X) + normB);
+        };
+
+        ThreadPool pool(3);
+        const ExecutionPolicy exec =
+            parallel ? ExecutionPolicy::parallel(4, &pool)
+                     : ExecutionPolicy::sequential();
+
+        SECTION("ptsv")
+        {
+            lacpy(GENERAL, A, F);
+            auto D = diag(F, 0);
+            auto E = diag(F, -1);
+
+            PtsvOpts opts;
+            opts.nb = 4;
+            opts.exec = exec;
+            int info = ptsv(D, E, X, opts);
+
+            REQUIRE(info == 0);
+            CHECK(residual() <= tol);
+        }
+
+        SECTION("ptsv_partitioned")
+        {
+            auto D = diag(A, 0);
+            auto E = diag(A, -1);
+
+            PtsvPartitionedOpts opts;
+            opts.nmin = 5;
+            opts.exec = exec;
+            int info = ptsv_partitioned(D, E, X, opts);
+
+            REQUIRE(info == 0);
+            CHECK(residual() <= tol);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "Partitioned solver reports matrices that are not positive definite",
+    "[ptsv_partitioned]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t n = 40;
+    const idx_t k = GENERATE(0, 9, 25, 39);
+
+    DYNAMIC_SECTION("k = " << k)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, 1);
+        laset(GENERAL, T(0), T(1), A);
+        laset(GENERAL, T(1), T(1), X);
+        A(k, k) = T(-1);
+
+        auto D = diag(A, 0);
+        auto E = diag(A, -1);
+
+        ThreadPool pool(3);
+        PtsvPartitionedOpts opts(NO_ERROR_CHECK);
+        opts.nmin = 5;
+        opts.exec = ExecutionPolicy::parallel(4, &pool);
+        int info = ptsv_partitioned(D, E, X, opts);
+
+        CHECK(info > 0);
+    }
+}
+
+TEMPLATE_TEST_CASE("Batched tridiagonal solver matches ptsv",
+                   "[batched][ptsv_batched]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const std::size_t nbatch = GENERATE(1, 21);
+    const idx_t n = GENERATE(1, 5, 16);
+    const idx_t nrhs = GENERATE(1, 3);
+    const std::size_t nthreads = GENERATE(1, 3);
+
+    ThreadPool pool(2);
+    BatchOpts opts;
+    opts.exec = ExecutionPolicy::parallel(nthreads, &pool);
+
+    DYNAMIC_SECTION("nbatch = " << nbatch << " n = " << n << " nrhs = "
+                                << nrhs << " nthreads = " << nthreads)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        // Diagonals of the batch, one system per column
+        std::vector<T> D_, E_, D0_, E0_;
+        auto D = new_matrix(D_, n, nbatch);
+        auto E = new_matrix(E_, max(n, idx_t(1)) - 1, nbatch);
+        mm.random(D);
+        mm.random(E);
+        for (std::size_t b = 0; b < nbatch; ++b)
+            for (idx_t i = 0; i < n; ++i)
+                D(i, b) = real_t(2) + abs(real(D(i, b)));
+
+        // The last system is not positive definite
+        if (nbatch > 1) D(n - 1, nbatch - 1) = T(-1);
+
+        auto D0 = new_matrix(D0_, n, nbatch);
+        auto E0 = new_matrix(E0_, nrows(E), nbatch);
+        lacpy(GENERAL, D, D0);
+        lacpy(GENERAL, E, E0);
+
+        std::vector<std::vector<T>> B_(nbatch), X_(nbatch);
+        std::vector<matrix_t> B, X;
+        for (std::size_t b = 0; b < nbatch; ++b) {
+            B.push_back(new_matrix(B_[b], n, nrhs));
+            X.push_back(new_matrix(X_[b], n, nrhs));
+            mm.random(B[b]);
+            lacpy(GENERAL, B[b], X[b]);
+        }
+        std::vector<int> info(nbatch);
+
+        int ret = ptsv_batched(D, E, X, info, opts);
+
+        for (std::size_t b = 0; b < nbatch; ++b) {
+            auto Db = col(D0, b);
+            auto Eb = col(E0, b);
+            int infob = ptsv(Db, Eb, B[b], PtsvOpts(NO_ERROR_CHECK));
+            REQUIRE(info[b] == infob);
+
+            real_t err = real_t(0);
+            for (idx_t i = 0; i < n; ++i)
+                err = max(err, abs(D(i, b) - Db[i]));
+            for (idx_t i = 0; i + 1 < n; ++i)
+                err = max(err, abs(E(i, b) - Eb[i]));
+            for (idx_t j = 0; j < nrhs; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    err = max(err, abs(X[b](i, j) - B[b](i, j)) /
+                                       (real_t(1) + abs(B[b](i, j))));
+            CHECK(err <= tol);
+        }
+        CHECK(ret == ((nbatch > 1) ? int(nbatch) : 0));
+    }
+}
@@ -0,0 +1,146 @@
+/// @file test_simd.cpp
+/// @brief Test the SIMD kernels used by the generic BLAS templates
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/axpy.hpp>
+#include <tlapack/blas/dot.hpp>
+#include <tlapack/blas/dotu.hpp>
+#include <tlapack/blas/gemv.hpp>
+#include <tlapack/blas/scal.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("SIMD kernels match the reference loops",
+                   "[simd][blas1][blas2]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const SimdIsa isa =
+        GENERATE(SimdIsa::None, SimdIsa::NEON, SimdIsa::AVX2, SimdIsa::AVX512);
+    const idx_t n = GENERATE(1, 7, 33, 100);
+
+    // Skip instruction sets not supported by this machine
+    const SimdIsa default_isa = simd_isa();
+    set_simd_isa(isa);
+    if (simd_isa() != isa) {
+        set_simd_isa(default_isa);
+        SKIP_TEST;
+    }
+
+    DYNAMIC_SECTION("isa = " << isa << " n = " << n)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(4 * n) * eps;
+
+        T alpha = T(real_t(0.75));
+        if constexpr (is_complex<T>) alpha += T(0, real_t(-0.5));
+        const real_t ralpha = real_t(1.5);
+
+        // Vectors are columns of a n-by-2 matrix, so that they are contiguous
+        // in column-major layouts and strided in row-major layouts
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, 2);
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        mm.random(X);
+        mm.random(A);
+
+        auto x = col(X, 0);
+        auto y = col(X, 1);
+
+        SECTION("axpy")
+        {
+            std::vector<T> y0(n);
+            for (idx_t i = 0; i < n; ++i)
+                y0[i] = y[i];
+
+            axpy(alpha, x, y);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(y[i] - (alpha * x[i] + y0[i])) <=
+                      tol * (abs1(x[i]) + abs1(y0[i])));
+
+            for (idx_t i = 0; i < n; ++i)
+                y0[i] = y[i];
+            axpy(ralpha, x, y);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(y[i] - (ralpha * x[i] + y0[i])) <=
+                      tol * (abs1(x[i]) + abs1(y0[i])));
+        }
+
+        SECTION("scal")
+        {
+            std::vector<T> x0(n);
+            for (idx_t i = 0; i < n; ++i)
+                x0[i] = x[i];
+
+            scal(alpha, x);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(x[i] - alpha * x0[i]) <= tol * abs1(x0[i]));
+
+            for (idx_t i = 0; i < n; ++i)
+                x0[i] = x[i];
+            scal(ralpha, x);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(x[i] - ralpha * x0[i]) <= tol * abs1(x0[i]));
+        }
+
+        SECTION("dot and dotu")
+        {
+            T sc(0), su(0);
+            real_t s(0);
+            for (idx_t i = 0; i < n; ++i) {
+                sc += conj(x[i]) * y[i];
+                su += x[i] * y[i];
+                s += abs1(x[i]) * abs1(y[i]);
+            }
+            CHECK(abs1(dot(x, y) - sc) <= tol * s);
+            CHECK(abs1(dotu(x, y) - su) <= tol * s);
+        }
+
+        SECTION("gemv")
+        {
+            const T beta = T(real_t(-1.25));
+            for (const Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans}) {
+                std::vector<T> y0(n);
+                for (idx_t i = 0; i < n; ++i)
+                    y0[i] = y[i];
+
+                gemv(trans, alpha, A, x, beta, y);
+                for (idx_t i = 0; i < n; ++i) {
+                    T sum(0);
+                    real_t s(0);
+                    for (idx_t j = 0; j < n; ++j) {
+                        const T a = (trans == Op::NoTrans) ? A(i, j)
+                                    : (trans == Op::Trans) ? A(j, i)
+                                                           : conj(A(j, i));
+                        sum += a * x[j];
+                        s += abs1(a) * abs1(x[j]);
+                    }
+                    CHECK(abs1(y[i] - (alpha * sum + beta * y0[i])) <=
+                          tol * (s + abs1(y0[i])));
+                }
+            }
+        }
+    }
+
+    set_simd_isa(default_isa);
+}
@@ -0,0 +1,212 @@
+/// @file test_stedc.cpp
+/// @brief Test divide and conquer symmetric tridiagonal eigenvalue solver
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// tlapack routines
+#include <tlapack/blas/copy.hpp>
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/heevd.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/lanhe.hpp>
+#include <tlapack/lapack/laset.hpp>
+#include <tlapack/lapack/stedc.hpp>
+#include <tlapack/lapack/steqr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("stedc is backward stable",
+                   "[symmetriceigenvalues][stedc]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const idx_t n = GENERATE(1, 2, 10, 40, 100);
+    const idx_t nmin = GENERATE(2, 25);
+    const std::string matrix_type = GENERATE("Random", "Clustered", "Split");
+    const bool parallel = GENERATE(false, true);
+
+    std::mt19937 gen;
+    gen.seed(3);
+
+    DYNAMIC_SECTION("n = " << n << " nmin = " << nmin
+                           << " matrix = " << matrix_type
+                           << " parallel = " << parallel)
+    {
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20. * n) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, n, n);
+
+        std::vector<real_t> d1(n), d2(n), d_copy(n);
+        std::vector<real_t> e1(max<idx_t>(n, 1) - 1), e2(size(e1)),
+            e_copy(size(e1));
+
+        // Generate the tridiagonal matrix
+        for (idx_t j = 0; j < n; ++j) {
+            if (matrix_type == "Clustered")
+                d1[j] = one + real_t(j % 3) * eps;
+            else
+                d1[j] = rand_helper<real_t>(gen);
+        }
+        for (idx_t j = 0; j + 1 < n; ++j) {
+            if (matrix_type == "Clustered")
+                e1[j] = real_t(1e-3);
+            else if (matrix_type == "Split" && j % 7 == 6)
+                e1[j] = zero;
+            else
+                e1[j] = rand_helper<real_t>(gen);
+        }
+
+        copy(d1, d_copy);
+        copy(d1, d2);
+        copy(e1, e_copy);
+        copy(e1, e2);
+
+        StedcOpts opts;
+        opts.nmin = nmin;
+        if (parallel) opts.exec = ExecutionPolicy::parallel(4);
+
+        laset(Uplo::General, zero, one, Q);
+        int err = steqr(false, d1, e1, Q);
+        REQUIRE(err == 0);
+        err = stedc(true, d2, e2, Q, opts);
+        REQUIRE(err == 0);
+
+        // Check that the eigenvalues agree with steqr and are sorted in
+        // ascending order
+        const real_t normT = max(abs(d1[0]), abs(d1[n - 1]));
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(d1[i] - d2[i]) <= tol * normT);
+        for (idx_t i = 0; i + 1 < n; ++i)
+            CHECK(d2[i] <= d2[i + 1]);
+
+        // Test for Q's orthogonality
+        std::vector<T> Wq_;
+        auto Wq = new_matrix(Wq_, n, n);
+        auto orth_Q = check_orthogonality(Q, Wq);
+        CHECK(orth_Q <= tol);
+
+        // Test Q * D * Q^H = T
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+        laset(Uplo::General, zero, zero, B);
+        for (idx_t j = 0; j < n; ++j)
+            B(j, j) = d2[j];
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        laset(Uplo::General, zero, zero, A);
+        A(0, 0) = d_copy[0];
+        for (idx_t j = 1; j < n; ++j) {
+            A(j, j - 1) = e_copy[j - 1];
+            A(j - 1, j) = e_copy[j - 1];
+            A(j, j) = d_copy[j];
+        }
+        real_t normA = lange(Norm::Max, A);
+        std::vector<T> K_;
+        auto K = new_matrix(K_, n, n);
+        gemm(Op::NoTrans, Op::ConjTrans, one, B, Q, zero, K);
+        gemm(Op::NoTrans, Op::NoTrans, one, Q, K, -one, A);
+        real_t repres = lange(Norm::Max, A);
+        CHECK(repres <= tol * normA);
+    }
+}
+
+TEMPLATE_TEST_CASE("heevd computes the eigendecomposition",
+                   "[symmetriceigenvalues][heevd]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const real_t one(1);
+
+    const idx_t n = GENERATE(1, 5, 33, 80);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const bool want_z = GENERATE(true, false);
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo
+                           << " want_z = " << want_z)
+    {
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20. * n) * eps;
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> Z_;
+        auto Z = new_matrix(Z_, n, n);
+
+        // Generate a random Hermitian matrix
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j) {
+            A(j, j) = real(A(j, j));
+            for (idx_t i = j + 1; i < n; ++i)
+                A(j, i) = conj(A(i, j));
+        }
+        lacpy(Uplo::General, A, Z);
+        const real_t normA = lanhe(Norm::Max, uplo, A);
+
+        std::vector<real_t> w(n);
+        HeevdOpts opts;
+        opts.nmin = 4;
+        opts.nb = 8;
+        opts.nx_switch = 16;
+        REQUIRE(heevd(want_z, uplo, Z, w, opts) == 0);
+
+        for (idx_t i = 0; i + 1 < n; ++i)
+            CHECK(w[i] <= w[i + 1]);
+
+        if (want_z) {
+            // Test for Z's orthogonality
+            std::vector<T> Wq_;
+            auto Wq = new_matrix(Wq_, n, n);
+            CHECK(check_orthogonality(Z, Wq) <= tol);
+
+            // Test A * Z = Z * diag(w)
+            std::vector<T> K_;
+            auto K = new_matrix(K_, n, n);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    K(i, j) = Z(i, j) * w[j];
+            gemm(Op::NoTrans, Op::NoTrans, one, A, Z, -one, K);
+            CHECK(lange(Norm::Max, K) <= tol * normA);
+        }
+        else {
+            // Compare with the eigenvalues computed with eigenvectors
+            std::vector<real_t> w2(n);
+            lacpy(Uplo::General, A, Z);
+            REQUIRE(heevd(true, uplo, Z, w2, opts) == 0);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs(w[i] - w2[i]) <= tol * normA);
+        }
+    }
+}
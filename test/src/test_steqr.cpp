@@ -45,10 +45,13 @@ TEMPLATE_TEST_CASE("steqr is backward stable",
     // MatrixMarket reader
     uint64_t seed = GENERATE(3, 5, 6);
 
+    // Apply rotations immediately or accumulate nsweeps sweeps
+    const idx_t nsweeps = GENERATE(1, 3, 32);
+
     std::mt19937 gen;
     gen.seed(seed);
 
-    DYNAMIC_SECTION(" n = " << n)
+    DYNAMIC_SECTION(" n = " << n << " nsweeps = " << nsweeps)
     {
         const real_t eps = ulp<real_t>();
         real_t tol = real_t(20. * n) * eps;
@@ -79,7 +82,10 @@ TEMPLATE_TEST_CASE("steqr is backward stable",
         laset(Uplo::General, zero, one, Q);
         int err = steqr(false, d1, e1, Q);
         REQUIRE(err == 0);
-        err = steqr(true, d2, e2, Q);
+        SteqrOpts opts;
+        opts.nsweeps = nsweeps;
+        opts.nmin = 1;
+        err = steqr(true, d2, e2, Q, opts);
         REQUIRE(err == 0);
 
         // Check that eigenvalues of steqr(false...) and steqr(true...) are
@@ -45,6 +45,9 @@ TEMPLATE_TEST_CASE("svd is backward stable",
 
     n = GENERATE(1, 2, 4, 5, 10, 12, 20);
 
+    // Apply rotations immediately or accumulate nsweeps sweeps
+    const idx_t nsweeps = GENERATE(1, 3, 32);
+
     const real_t eps = ulp<real_t>();
     real_t tol = real_t(20. * n) * eps;
     // Use a slightly larger tolerance for half precision
@@ -72,9 +75,12 @@ TEMPLATE_TEST_CASE("svd is backward stable",
     laset(Uplo::General, zero, one, Q);
     laset(Uplo::General, zero, one, Pt);
 
-    DYNAMIC_SECTION(" n = " << n)
+    DYNAMIC_SECTION(" n = " << n << " nsweeps = " << nsweeps)
     {
-        int err = svd_qr(Uplo::Upper, true, true, d, e, Q, Pt);
+        SvdQrOpts opts;
+        opts.nsweeps = nsweeps;
+        opts.nmin = 1;
+        int err = svd_qr(Uplo::Upper, true, true, d, e, Q, Pt, opts);
         REQUIRE(err == 0);
 
         // Check that singular values are positive and sorted in decreasing
@@ -10,9 +10,11 @@
 
 #include "testutils.hpp"
 //
+#include <tlapack/lapack/geqrf.hpp>
 #include <tlapack/lapack/tik_bidiag_elden.hpp>
 #include <tlapack/lapack/tik_qr.hpp>
 #include <tlapack/lapack/tik_svd.hpp>
+#include <tlapack/lapack/tik_svd_path.hpp>
 #include <tlapack/lapack/tkhnv.hpp>
 #include <tlapack/plugins/stdvector.hpp>
 
@@ -122,4 +124,186 @@ TEMPLATE_TEST_CASE("Testing all cases of Tikhonov",
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("Tikhonov regularization path matches single solves",
+                   "[tikhonov check]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    Create<matrix_t> new_matrix;
+
+    const idx_t m = GENERATE(1, 12, 30);
+    const idx_t n = GENERATE(1, 3, 8);
+    const idx_t k = GENERATE(1, 7);
+
+    DYNAMIC_SECTION(" m = " << m << " n = " << n << " k = " << k)
+    {
+        if (m >= n) {
+            const real_t eps = ulp<real_t>();
+            const real_t tol = real_t(10) * real_t(max(m, k)) * eps;
+
+            const std::vector<real_t> lambdas = {real_t(1e-3), real_t(1e-2),
+                                                 real_t(1e-1), real_t(1),
+                                                 real_t(2)};
+            const idx_t nl = lambdas.size();
+
+            // Declare matrices
+            std::vector<T> A_;
+            auto A = new_matrix(A_, m, n);
+            std::vector<T> A_copy_;
+            auto A_copy = new_matrix(A_copy_, m, n);
+            std::vector<T> b_;
+            auto b = new_matrix(b_, m, k);
+            std::vector<T> bcopy_;
+            auto bcopy = new_matrix(bcopy_, m, k);
+            std::vector<T> X_;
+            auto X = new_matrix(X_, n, nl * k);
+            std::vector<T> r_;
+            auto r = new_matrix(r_, m, k);
+
+            MatrixMarket mm;
+            mm.random(A);
+            mm.random(b);
+            lacpy(GENERAL, A, A_copy);
+            lacpy(GENERAL, b, bcopy);
+
+            const real_t normA = lange(FROB_NORM, A);
+            const real_t normb = lange(FROB_NORM, b);
+
+            std::vector<real_t> rnorm(nl), xnorm(nl), gcv(nl);
+            const idx_t lbest =
+                tik_svd_path(A, b, lambdas, X, rnorm, xnorm, gcv);
+
+            for (idx_t l = 0; l < nl; ++l) {
+                const real_t lambda = lambdas[l];
+                auto Xl = slice(X, range{0, n}, range{l * k, (l + 1) * k});
+
+                // Compare with the solution of tik_svd
+                lacpy(GENERAL, A_copy, A);
+                lacpy(GENERAL, bcopy, b);
+                tkhnv(A, b, lambda, TikOpts(TikVariant::SVD));
+                auto x = slice(b, range{0, n}, range{0, k});
+
+                const real_t normx = lange(FROB_NORM, x);
+                for (idx_t j = 0; j < k; ++j)
+                    for (idx_t i = 0; i < n; ++i)
+                        x(i, j) -= Xl(i, j);
+                CHECK(lange(FROB_NORM, x) <= tol * normx);
+
+                // Check the residual and solution norms
+                lacpy(GENERAL, bcopy, r);
+                gemm(NO_TRANS, NO_TRANS, real_t(-1), A_copy, Xl, real_t(1),
+                     r);
+                const real_t normr = lange(FROB_NORM, r);
+                CHECK(abs(rnorm[l] - normr) <= tol * (normb + normA * normx));
+                CHECK(abs(xnorm[l] - lange(FROB_NORM, Xl)) <= tol * normx);
+                CHECK(gcv[l] >= real_t(0));
+                CHECK(gcv[lbest] <= gcv[l]);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Tikhonov regularization path with lambda = 0",
+                   "[tikhonov check]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    Create<matrix_t> new_matrix;
+
+    const idx_t m = GENERATE(4, 9);
+    const idx_t n = 4;
+    const idx_t k = 2;
+
+    DYNAMIC_SECTION(" m = " << m)
+    {
+        const std::vector<real_t> lambdas = {real_t(0), real_t(1)};
+        const idx_t nl = lambdas.size();
+
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(100) * real_t(m) * eps;
+
+        // A has a zero column, so it has a zero singular value
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> b_;
+        auto b = new_matrix(b_, m, k);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nl * k);
+
+        MatrixMarket mm;
+        mm.random(A);
+        mm.random(b);
+        for (idx_t i = 0; i < m; ++i)
+            A(i, 1) = T(0);
+
+        // The pseudo-inverse solution is the least squares solution y of
+        // the problem without the zero column, with a zero in its place
+        std::vector<T> A1_;
+        auto A1 = new_matrix(A1_, m, n - 1);
+        std::vector<T> y_;
+        auto y = new_matrix(y_, m, k);
+        std::vector<T> r_;
+        auto r = new_matrix(r_, m, k);
+        for (idx_t i = 0; i < m; ++i) {
+            A1(i, 0) = A(i, 0);
+            for (idx_t j = 2; j < n; ++j)
+                A1(i, j - 1) = A(i, j);
+        }
+        lacpy(GENERAL, b, y);
+        lacpy(GENERAL, b, r);
+        {
+            std::vector<T> A1f_;
+            auto A1f = new_matrix(A1f_, m, n - 1);
+            lacpy(GENERAL, A1, A1f);
+            std::vector<T> tau(n - 1);
+            geqrf(A1f, tau);
+            unmqr(LEFT_SIDE, CONJ_TRANS, A1f, tau, y);
+            auto R = slice(A1f, range{0, n - 1}, range{0, n - 1});
+            auto y1 = slice(y, range{0, n - 1}, range{0, k});
+            trsm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, real_t(1),
+                 R, y1);
+            gemm(NO_TRANS, NO_TRANS, real_t(-1), A1, y1, real_t(1), r);
+        }
+        const real_t normy =
+            lange(FROB_NORM, slice(y, range{0, n - 1}, range{0, k}));
+        const real_t normr = lange(FROB_NORM, r);
+        const real_t normb = lange(FROB_NORM, b);
+
+        std::vector<real_t> rnorm(nl), xnorm(nl), gcv(nl);
+        const idx_t lbest = tik_svd_path(A, b, lambdas, X, rnorm, xnorm, gcv);
+
+        // Compare x_0 with the pseudo-inverse solution
+        for (idx_t j = 0; j < k; ++j) {
+            CHECK(abs(X(1, j)) <= tol * normy);
+            CHECK(abs(X(0, j) - y(0, j)) <= tol * normy);
+            for (idx_t i = 2; i < n; ++i)
+                CHECK(abs(X(i, j) - y(i - 1, j)) <= tol * normy);
+        }
+        CHECK(abs(xnorm[0] - normy) <= tol * normy);
+        CHECK(abs(rnorm[0] - normr) <= tol * normb);
+        CHECK(rnorm[0] > real_t(0));
+
+        for (idx_t j = 0; j < nl * k; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(!isnan(X(i, j)));
+        for (idx_t l = 0; l < nl; ++l) {
+            CHECK(!isnan(rnorm[l]));
+            CHECK(!isnan(xnorm[l]));
+            CHECK(!isnan(gcv[l]));
+        }
+        CHECK(gcv[lbest] <= gcv[0]);
+        CHECK(gcv[lbest] <= gcv[1]);
+    }
+}
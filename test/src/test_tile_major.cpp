@@ -0,0 +1,280 @@
+/// @file test_tile_major.cpp
+/// @brief Test the tile-major matrix type and the routines that work on its
+/// tiles
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Plugin for tile-major matrices
+#include <tlapack/plugins/tileMajor.hpp>
+
+// Auxiliary routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/lanhe.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/potrf_blocked.hpp>
+#include <tlapack/lapack/ungqr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Tile-major matrices and their views",
+                   "[tilemajor][plugins]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using tile_matrix_t = TileMajorMatrix<T, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 9, 16);
+    const idx_t n = GENERATE(1, 7, 16);
+    const idx_t mb = GENERATE(1, 4, 5);
+    const idx_t nb = GENERATE(3, 4);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " mb = " << mb
+                           << " nb = " << nb)
+    {
+        std::vector<T> A_(tile_matrix_t::storage_size(m, n, mb, nb));
+        tile_matrix_t A(m, n, A_.data(), mb, nb);
+        mm.random(A);
+
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        lacpy(GENERAL, A, B);
+
+        CHECK(layout<tile_matrix_t> == Layout::TileMajor);
+        CHECK(A.mt() == (m + mb - 1) / mb);
+        CHECK(A.nt() == (n + nb - 1) / nb);
+
+        // The tiles are contiguous and hold the entries of A
+        for (idx_t J = 0; J < A.nt(); ++J) {
+            for (idx_t I = 0; I < A.mt(); ++I) {
+                const auto Aij = A.tile(I, J);
+                CHECK(Aij.ptr == &A_[I * mb * nb + J * A.ldt]);
+                CHECK(Aij.ldim == mb);
+                for (idx_t j = 0; j < ncols(Aij); ++j)
+                    for (idx_t i = 0; i < nrows(Aij); ++i)
+                        CHECK(Aij(i, j) == B(I * mb + i, J * nb + j));
+            }
+        }
+
+        // Views keep the tiling of A
+        const idx_t i0 = m / 3, i1 = m - m / 4;
+        const idx_t j0 = n / 2, j1 = n;
+        auto S = slice(A, range(i0, i1), range(j0, j1));
+        CHECK(layout<decltype(S)> == Layout::TileMajor);
+        for (idx_t j = 0; j < ncols(S); ++j)
+            for (idx_t i = 0; i < nrows(S); ++i)
+                CHECK(S(i, j) == B(i0 + i, j0 + j));
+        for (idx_t J = 0; J < S.nt(); ++J) {
+            for (idx_t I = 0; I < S.mt(); ++I) {
+                const auto Sij = S.tile(I, J);
+                const idx_t ia = (I > 0) ? I * mb - S.i0 : 0;
+                const idx_t ja = (J > 0) ? J * nb - S.j0 : 0;
+                for (idx_t j = 0; j < ncols(Sij); ++j)
+                    for (idx_t i = 0; i < nrows(Sij); ++i)
+                        CHECK(Sij(i, j) == B(i0 + ia + i, j0 + ja + j));
+            }
+        }
+
+        // Rows, columns and diagonals
+        const auto r = row(A, m - 1);
+        for (idx_t j = 0; j < n; ++j)
+            CHECK(r[j] == B(m - 1, j));
+        const auto c = slice(A, range(1, m), n - 1);
+        for (idx_t i = 0; i < m - 1; ++i)
+            CHECK(c[i] == B(i + 1, n - 1));
+        const auto d = diag(A, (n > 1) ? 1 : 0);
+        for (idx_t i = 0; i < size(d); ++i)
+            CHECK(d[i] == B(i, i + ((n > 1) ? 1 : 0)));
+        const auto ds = slice(d, range(size(d) / 2, size(d)));
+        for (idx_t i = 0; i < size(ds); ++i)
+            CHECK(ds[i] == d[size(d) / 2 + i]);
+    }
+}
+
+TEMPLATE_TEST_CASE("gemm on tile-major matrices",
+                   "[tilemajor][gemm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<T>;
+    using tile_matrix_t = TileMajorMatrix<T, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = 23, n = 17, k = 19;
+    const Op transA = GENERATE(Op::NoTrans, Op::ConjTrans);
+    const Op transB = GENERATE(Op::NoTrans, Op::Trans);
+    const idx_t tb = GENERATE(4, 8);
+
+    DYNAMIC_SECTION("transA = " << transA << " transB = " << transB
+                                << " tb = " << tb)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(4 * k) * eps;
+
+        const idx_t ma = (transA == Op::NoTrans) ? m : k;
+        const idx_t na = (transA == Op::NoTrans) ? k : m;
+        const idx_t mb = (transB == Op::NoTrans) ? k : n;
+        const idx_t nb = (transB == Op::NoTrans) ? n : k;
+
+        // A, B and C have different tilings, and C is a view that does not
+        // start at the beginning of a tile
+        std::vector<T> A_(tile_matrix_t::storage_size(ma, na, tb, tb + 1));
+        tile_matrix_t A(ma, na, A_.data(), tb, tb + 1);
+        std::vector<T> B_(tile_matrix_t::storage_size(mb, nb, tb + 2, tb));
+        tile_matrix_t B(mb, nb, B_.data(), tb + 2, tb);
+        std::vector<T> Cbig_(tile_matrix_t::storage_size(m + 3, n + 2, tb, tb));
+        tile_matrix_t Cbig(m + 3, n + 2, Cbig_.data(), tb, tb);
+        auto C = slice(Cbig, range(3, m + 3), range(2, n + 2));
+        mm.random(A);
+        mm.random(B);
+        mm.random(C);
+
+        std::vector<T> A0_;
+        auto A0 = new_matrix(A0_, ma, na);
+        std::vector<T> B0_;
+        auto B0 = new_matrix(B0_, mb, nb);
+        std::vector<T> C0_;
+        auto C0 = new_matrix(C0_, m, n);
+        lacpy(GENERAL, A, A0);
+        lacpy(GENERAL, B, B0);
+        lacpy(GENERAL, C, C0);
+
+        const T alpha = T(2);
+        const T beta = T(-0.5);
+        gemm(transA, transB, alpha, A, B, beta, C);
+        gemm(transA, transB, alpha, A0, B0, beta, C0);
+
+        // Tiles may also meet matrices with other layouts
+        std::vector<T> C1_(tile_matrix_t::storage_size(m, n, tb, tb));
+        tile_matrix_t C1(m, n, C1_.data(), tb, tb);
+        std::vector<T> C2_;
+        auto C2 = new_matrix(C2_, m, n);
+        gemm(transA, transB, alpha, A, B0, C1);
+        gemm(transA, transB, alpha, A0, B0, C2);
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                C(i, j) -= C0(i, j);
+                C1(i, j) -= C2(i, j);
+            }
+        CHECK(lange(MAX_NORM, C) <= tol * lange(MAX_NORM, C0));
+        CHECK(lange(MAX_NORM, C1) <= tol * lange(MAX_NORM, C2));
+    }
+}
+
+TEMPLATE_TEST_CASE("Cholesky and QR factorizations of tile-major matrices",
+                   "[tilemajor][potrf][geqrf]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<T>;
+    using tile_matrix_t = TileMajorMatrix<T, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(13, 32);
+    const idx_t tb = GENERATE(4, 7);
+    const size_t nthreads = GENERATE(1, 3);
+
+    DYNAMIC_SECTION("n = " << n << " tb = " << tb
+                           << " nthreads = " << nthreads)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * n) * eps;
+
+        std::vector<T> A_(tile_matrix_t::storage_size(n, n, tb, tb));
+        tile_matrix_t A(n, n, A_.data(), tb, tb);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+
+        SECTION("potrf_blocked")
+        {
+            for (const Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+                mm.random(uplo, A);
+                for (idx_t j = 0; j < n; ++j)
+                    A(j, j) += real_t(n);
+                lacpy(GENERAL, A, B);
+
+                BlockedCholeskyOpts opts;
+                opts.nb = 3;
+                opts.exec = ExecutionPolicy::parallel(nthreads);
+                REQUIRE(potrf_blocked(uplo, A, opts) == 0);
+                opts.nb = tb;
+                opts.exec = ExecutionPolicy::sequential();
+                REQUIRE(potrf_blocked(uplo, B, opts) == 0);
+
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < n; ++i)
+                        B(i, j) -= A(i, j);
+                CHECK(lanhe(MAX_NORM, uplo, B) <= tol * real_t(n));
+            }
+        }
+
+        SECTION("geqrf")
+        {
+            mm.random(A);
+            lacpy(GENERAL, A, B);
+            std::vector<T> tau(n);
+
+            GeqrfOpts opts;
+            opts.nb = 5;
+            opts.exec = ExecutionPolicy::parallel(nthreads);
+            REQUIRE(geqrf(A, tau, opts) == 0);
+
+            // A = Q R
+            std::vector<T> Q_;
+            auto Q = new_matrix(Q_, n, n);
+            std::vector<T> R_;
+            auto R = new_matrix(R_, n, n);
+            lacpy(GENERAL, A, Q);
+            laset(LOWER_TRIANGLE, T(0), T(0), R);
+            lacpy(UPPER_TRIANGLE, A, R);
+            REQUIRE(ungqr(Q, tau) == 0);
+            CHECK(check_orthogonality(Q) <= tol);
+
+            const real_t normA = lange(MAX_NORM, B);
+            gemm(NO_TRANS, NO_TRANS, real_t(1), Q, R, real_t(-1), B);
+            CHECK(lange(MAX_NORM, B) <= tol * normA);
+
+            // Views that start inside a block column use opts.nb
+            auto S = slice(A, range(1, n), range(1, n));
+            CHECK(internal::geqrf_nb(S, opts) == idx_t(opts.nb));
+            CHECK(internal::geqrf_nb(A, opts) == tb);
+        }
+    }
+}
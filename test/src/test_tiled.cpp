@@ -0,0 +1,200 @@
+/// @file test_tiled.cpp
+/// @brief Test the task graph and the tiled factorizations
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/trmm.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/geqrf_tiled.hpp>
+#include <tlapack/lapack/getrf_tiled.hpp>
+#include <tlapack/lapack/lu_mult.hpp>
+#include <tlapack/lapack/potrf.hpp>
+#include <tlapack/lapack/potrf_tiled.hpp>
+
+using namespace tlapack;
+
+TEST_CASE("TaskGraph respects the data dependencies", "[tiled]")
+{
+    using tiled::Access;
+
+    ThreadPool pool(3);
+    const std::size_t nthreads = GENERATE(1, 4);
+
+    // x[i] is updated by a chain of tasks. y reads every x[i] after the chain.
+    const int n = 20, nsteps = 10;
+    std::vector<int> x(n, 0), y(n, -1);
+    tiled::TaskGraph g;
+    for (int s = 0; s < nsteps; ++s) {
+        for (int i = 0; i < n; ++i) {
+            g.insert_task(
+                [&x, i, s]() {
+                    if (x[i] == s) x[i] = s + 1;
+                },
+                {{&x[i], Access::ReadWrite}}, i % 3);
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        g.insert_task([&x, &y, i]() { y[i] = x[i]; },
+                      {{&x[i], Access::Read}, {&y[i], Access::Write}});
+    }
+    CHECK(g.size() == std::size_t(n * (nsteps + 1)));
+
+    g.execute(ExecutionPolicy::parallel(nthreads, &pool));
+    CHECK(g.size() == 0);
+    for (int i = 0; i < n; ++i)
+        CHECK(y[i] == nsteps);
+
+    // Exceptions are forwarded to the caller
+    g.insert_task([]() { throw std::runtime_error(""); },
+                  {{&x[0], Access::ReadWrite}});
+    g.insert_task([&x]() { x[0] = -1; }, {{&x[0], Access::ReadWrite}});
+    CHECK_THROWS_AS(g.execute(ExecutionPolicy::parallel(nthreads, &pool)),
+                    std::runtime_error);
+    CHECK(x[0] == nsteps);
+}
+
+TEMPLATE_TEST_CASE("Tiled factorizations",
+                   "[tiled][potrf][getrf][geqrf]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(37, 97);
+    const idx_t n = GENERATE(40, 61);
+    const std::size_t nthreads = GENERATE(1, 4);
+
+    ThreadPool pool(3);
+    TiledOpts opts;
+    opts.nb = 8;
+    opts.exec = ExecutionPolicy::parallel(nthreads, &pool);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " nthreads = " << nthreads)
+    {
+        const idx_t k = min(m, n);
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * max(m, n)) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+
+        mm.random(A);
+        const real_t normA = lange(MAX_NORM, A);
+
+        SECTION("potrf")
+        {
+            auto A0 = slice(A, range(0, k), range(0, k));
+            auto B0 = slice(B, range(0, k), range(0, k));
+            auto C0 = slice(C, range(0, k), range(0, k));
+            for (idx_t j = 0; j < k; ++j)
+                A0(j, j) += real_t(k);
+
+            for (const Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+                PotrfOpts optsB;
+                optsB.nb = opts.nb;
+                lacpy(GENERAL, A0, B0);
+                REQUIRE(potrf(uplo, B0, optsB) == 0);
+
+                lacpy(GENERAL, A0, C0);
+                REQUIRE(potrf_tiled(uplo, C0, opts) == 0);
+
+                for (idx_t j = 0; j < k; ++j)
+                    for (idx_t i = 0; i < k; ++i)
+                        C0(i, j) -= B0(i, j);
+                CHECK(lange(MAX_NORM, C0) / normA <= tol);
+            }
+
+            // A matrix that is not positive definite
+            lacpy(GENERAL, A0, C0);
+            C0(k - 1, k - 1) = -real_t(k);
+#ifndef TLAPACK_NDEBUG
+            CHECK_THROWS(potrf_tiled(LOWER_TRIANGLE, C0, opts));
+#else
+            CHECK(potrf_tiled(LOWER_TRIANGLE, C0, opts) == int(k));
+#endif
+        }
+
+        SECTION("getrf")
+        {
+            std::vector<idx_t> piv(k);
+            lacpy(GENERAL, A, C);
+            REQUIRE(getrf_tiled(C, piv, opts) == 0);
+
+            // Form L U
+            if (m > n) {
+                auto C0 = slice(C, range(0, n), range(0, n));
+                auto C1 = slice(C, range(n, m), range(0, n));
+                trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG,
+                     real_t(1), C0, C1);
+                lu_mult(C0);
+            }
+            else if (m < n) {
+                auto C0 = slice(C, range(0, m), range(0, m));
+                auto C1 = slice(C, range(0, m), range(m, n));
+                trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, real_t(1),
+                     C0, C1);
+                lu_mult(C0);
+            }
+            else
+                lu_mult(C);
+
+            // Undo the row interchanges
+            for (idx_t j = k - idx_t(1); j != idx_t(-1); j--) {
+                REQUIRE(piv[j] >= j);
+                REQUIRE(piv[j] < m);
+                auto vect1 = row(C, j);
+                auto vect2 = row(C, piv[j]);
+                tlapack::swap(vect1, vect2);
+            }
+
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C(i, j) -= A(i, j);
+            CHECK(lange(MAX_NORM, C) / normA <= tol);
+        }
+
+        SECTION("geqrf")
+        {
+            std::vector<T> tauB(k), tauC(k);
+            GeqrfOpts optsB;
+            optsB.nb = opts.nb;
+            lacpy(GENERAL, A, B);
+            geqrf(B, tauB, optsB);
+
+            lacpy(GENERAL, A, C);
+            geqrf_tiled(C, tauC, opts);
+
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C(i, j) -= B(i, j);
+            CHECK(lange(MAX_NORM, C) / normA <= tol);
+            for (idx_t i = 0; i < k; ++i)
+                CHECK(abs1(tauC[i] - tauB[i]) <= tol);
+        }
+    }
+}
@@ -37,8 +37,10 @@ TEMPLATE_TEST_CASE("TRTRI is stable", "[trtri]", TLAPACK_TYPES_TO_TEST)
     Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
     Diag diag = GENERATE(Diag::Unit, Diag::NonUnit);
     idx_t n = GENERATE(1, 2, 6, 9);
+    const size_t nx = GENERATE(1, 4, 32);
 
-    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo << " diag = " << diag)
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo << " diag = " << diag
+                           << " nx = " << nx)
     {
         const real_t eps = ulp<real_t>();
         const real_t tol = real_t(n) * eps;
@@ -64,7 +66,9 @@ TEMPLATE_TEST_CASE("TRTRI is stable", "[trtri]", TLAPACK_TYPES_TO_TEST)
         lacpy(uplo, A, C);
 
         {
-            trtri_recursive(uplo, diag, C);
+            TrtriOpts opts;
+            opts.nx = nx;
+            trtri_recursive(uplo, diag, C, opts);
 
             // Calculate residuals
 
@@ -0,0 +1,129 @@
+/// @file test_tsqr.cpp
+/// @brief Test the TSQR factorization and the routines that apply and form Q
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/lapack/tsqr.hpp>
+#include <tlapack/lapack/ungqr_tsqr.hpp>
+#include <tlapack/lapack/unmqr_tsqr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("TSQR factorization of a tall and skinny matrix",
+                   "[qr][tsqr]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    using shape_t = pair<idx_t, idx_t>;
+    const shape_t shape = GENERATE((shape_t(7, 7)), (shape_t(100, 1)),
+                                   (shape_t(100, 10)), (shape_t(333, 5)),
+                                   (shape_t(515, 12)));
+    const idx_t mb = GENERATE(1, 16, 60);
+    const size_t nthreads = GENERATE(1, 4);
+
+    const idx_t m = shape.first;
+    const idx_t n = shape.second;
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " mb = " << mb
+                           << " nthreads = " << nthreads)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * m) * eps;
+
+        TsqrOpts opts;
+        opts.mb = mb;
+        opts.nb = 4;
+        opts.exec = ExecutionPolicy::parallel(nthreads);
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        const idx_t p = tsqr_nblocks(A, opts);
+
+        std::vector<T> F_;
+        auto F = new_matrix(F_, m, n);
+        std::vector<T> TT_;
+        auto TT = new_matrix(TT_, n, (2 * p - 1) * n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+
+        mm.random(A);
+        lacpy(GENERAL, A, F);
+
+        REQUIRE(tsqr(F, TT, opts) == 0);
+        laset(LOWER_TRIANGLE, T(0), T(0), R);
+        lacpy(UPPER_TRIANGLE, rows(F, range(0, n)), R);
+
+        // Q has orthonormal columns and A = Q R
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, m, n);
+        lacpy(GENERAL, F, Q);
+        REQUIRE(ungqr_tsqr(Q, TT, opts) == 0);
+        CHECK(check_orthogonality(Q) <= tol);
+
+        std::vector<T> E_;
+        auto E = new_matrix(E_, m, n);
+        lacpy(GENERAL, A, E);
+        gemm(NO_TRANS, NO_TRANS, real_t(1), Q, R, real_t(-1), E);
+        CHECK(lange(MAX_NORM, E) <= tol * lange(MAX_NORM, A));
+
+        // The full Q from unmqr_tsqr extends the one from ungqr_tsqr
+        std::vector<T> Qf_;
+        auto Qf = new_matrix(Qf_, m, m);
+        laset(GENERAL, T(0), T(1), Qf);
+        REQUIRE(unmqr_tsqr(LEFT_SIDE, NO_TRANS, F, TT, Qf, opts) == 0);
+        CHECK(check_orthogonality(Qf) <= tol);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                E(i, j) = Qf(i, j) - Q(i, j);
+        CHECK(lange(MAX_NORM, E) <= tol);
+
+        // Apply op(Q) from both sides and compare with gemm
+        const idx_t k = 3;
+        for (const Side side : {Side::Left, Side::Right}) {
+            for (const Op trans : {Op::NoTrans, Op::ConjTrans}) {
+                const idx_t mc = (side == Side::Left) ? m : k;
+                const idx_t nc = (side == Side::Left) ? k : m;
+
+                std::vector<T> C_;
+                auto C = new_matrix(C_, mc, nc);
+                std::vector<T> D_;
+                auto D = new_matrix(D_, mc, nc);
+                mm.random(C);
+                lacpy(GENERAL, C, D);
+
+                unmqr_tsqr(side, trans, F, TT, C, opts);
+                if (side == Side::Left)
+                    gemm(trans, NO_TRANS, real_t(1), Qf, D, real_t(-1), C);
+                else
+                    gemm(NO_TRANS, trans, real_t(1), D, Qf, real_t(-1), C);
+
+                CHECK(lange(MAX_NORM, C) <= tol * lange(MAX_NORM, D));
+            }
+        }
+    }
+}
@@ -0,0 +1,182 @@
+/// @file test_tuning.cpp
+/// @brief Test the tuning profile used by the options of the blocked routines
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/base/tuning.hpp>
+#include <tlapack/lapack/FrancisOpts.hpp>
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/potrf.hpp>
+
+#include <sstream>
+
+using namespace tlapack;
+
+TEST_CASE("TuningProfile selects entries by type and size", "[tuning]")
+{
+    TuningProfile profile;
+    CHECK(profile.empty());
+    CHECK(profile.get("geqrf", "nb", "d", 100, 32) == 32);
+
+    profile.set("geqrf", "nb", "d", 0, 16);
+    profile.set("geqrf", "nb", "d", 500, 64);
+    profile.set("geqrf", "nb", "*", 0, 48);
+    profile.set("geqrf", "nb", "*", 200, 96);
+
+    // Entries of the same type
+    CHECK(profile.get("geqrf", "nb", "d", 0, 32) == 16);
+    CHECK(profile.get("geqrf", "nb", "d", 499, 32) == 16);
+    CHECK(profile.get("geqrf", "nb", "d", 500, 32) == 64);
+    CHECK(profile.get("geqrf", "nb", "d", 10000, 32) == 64);
+
+    // Entries for any type
+    CHECK(profile.get("geqrf", "nb", "s", 100, 32) == 48);
+    CHECK(profile.get("geqrf", "nb", "s", 300, 32) == 96);
+    CHECK(profile.get("geqrf", "nb", 32) == 48);
+
+    // Unknown parameters
+    CHECK(profile.get("geqrf", "nx_switch", "d", 100, 128) == 128);
+    CHECK(profile.get("gebrd", "nb", 32) == 32);
+
+    // Replace an entry
+    profile.set("geqrf", "nb", "d", 500, 128);
+    CHECK(profile.get("geqrf", "nb", "d", 600, 32) == 128);
+
+    profile.clear();
+    CHECK(profile.empty());
+}
+
+TEST_CASE("TuningProfile is saved and loaded", "[tuning]")
+{
+    TuningProfile profile;
+    profile.set("gehrd", "nb", "z", 0, 24);
+    profile.set("gehrd", "nx_switch", "*", 0, 64);
+    profile.set("multishift_qr", "nshift", "*", 300, 40);
+
+    std::stringstream ss;
+    profile.save(ss);
+
+    TuningProfile loaded;
+    CHECK(loaded.load(ss));
+    CHECK(loaded.get("gehrd", "nb", "z", 10, 32) == 24);
+    CHECK(loaded.get("gehrd", "nx_switch", 128) == 64);
+    CHECK(loaded.get("multishift_qr", "nshift", "*", 299, 0) == 0);
+    CHECK(loaded.get("multishift_qr", "nshift", "*", 300, 0) == 40);
+
+    // Comments and blank lines are ignored, invalid lines are reported
+    std::stringstream in("# comment\n\n  geqrf nb * 0 8\ngeqrf nb\n");
+    TuningProfile p;
+    CHECK(!p.load(in));
+    CHECK(p.get("geqrf", "nb", 32) == 8);
+}
+
+TEMPLATE_TEST_CASE("tuning_type names the scalar types",
+                   "[tuning]",
+                   float,
+                   double,
+                   std::complex<float>,
+                   std::complex<double>)
+{
+    const std::string type = tuning_type<TestType>();
+    if (std::is_same_v<TestType, float>) CHECK(type == "s");
+    if (std::is_same_v<TestType, double>) CHECK(type == "d");
+    if (std::is_same_v<TestType, std::complex<float>>) CHECK(type == "c");
+    if (std::is_same_v<TestType, std::complex<double>>) CHECK(type == "z");
+}
+
+TEST_CASE("Options take their defaults from the tuning profile", "[tuning]")
+{
+    TuningProfile& profile = tuning_profile();
+    const TuningProfile saved = profile;
+    profile.clear();
+
+    // Built-in defaults
+    CHECK(GeqrfOpts().nb == 0);
+    CHECK(GehrdOpts().nx_switch == 0);
+    CHECK(FrancisOpts().nmin == 75);
+    CHECK(FrancisOpts().nshift_recommender(100, 100) == 10);
+    CHECK(tuned_option<double>(0, "geqrf", "nb", 100, 32) == 32);
+    CHECK(tuned_option<double>(16, "geqrf", "nb", 100, 32) == 16);
+
+    profile.set("geqrf", "nb", "*", 0, 64);
+    profile.set("gehrd", "nx_switch", "*", 0, 256);
+    profile.set("potrf", "nb", "*", 0, 96);
+    profile.set("multishift_qr", "nmin", "*", 0, 120);
+    profile.set("multishift_qr", "nshift", "*", 50, 12);
+
+    CHECK(FrancisOpts().nmin == 120);
+    CHECK(FrancisOpts().nshift_recommender(40, 40) == 4);
+    CHECK(FrancisOpts().nshift_recommender(100, 100) == 12);
+    CHECK(tuned_option<float>(0, "gehrd", "nx_switch", 100, 128) == 256);
+    CHECK(tuned_option<float>(0, "potrf", "nb", 100, 32) == 96);
+
+    // Entries of a specific type and size are resolved when the routine is
+    // called
+    profile.set("geqrf", "nb", "d", 0, 8);
+    profile.set("geqrf", "nb", "d", 500, 4);
+    CHECK(tuned_option<double>(0, "geqrf", "nb", 100, 32) == 8);
+    CHECK(tuned_option<double>(0, "geqrf", "nb", 600, 32) == 4);
+    CHECK(tuned_option<float>(0, "geqrf", "nb", 600, 32) == 64);
+    CHECK(tuned_option<double>(16, "geqrf", "nb", 600, 32) == 16);
+
+    profile = saved;
+}
+
+TEMPLATE_TEST_CASE("Routines resolve their block sizes when called",
+                   "[tuning]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    TuningProfile& profile = tuning_profile();
+    const TuningProfile saved = profile;
+    profile.clear();
+
+    const idx_t n = 20;
+    const real_t tol = real_t(100 * n) * ulp<real_t>();
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> tau(n);
+    MatrixMarket mm;
+    mm.random(A0);
+
+    // A block size of the type of A that is larger than n makes geqrf()
+    // use the level-2 code, with the same result as a block size of 1
+    profile.set("geqrf", "nb", tuning_type<T>(), 0, 2 * n);
+    lacpy(GENERAL, A0, A);
+    geqrf(A, tau);
+
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, n);
+    std::vector<T> tauB(n);
+    lacpy(GENERAL, A0, B);
+    geqr2(B, tauB);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i <= j; ++i)
+            CHECK(abs(A(i, j) - B(i, j)) <= tol * abs(B(i, j)) + tol);
+
+    CHECK(internal::geqrf_nb(A, GeqrfOpts()) == 2 * n);
+
+    profile = saved;
+}
@@ -0,0 +1,132 @@
+/// @file test_unrolled_kernels.cpp
+/// @brief Test the kernels for matrices with sizes known at compile time
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/getrf_level0.hpp>
+#include <tlapack/lapack/potf2.hpp>
+
+using namespace tlapack;
+
+// Compares the unrolled kernels for m-by-n matrices with the reference
+// routines. The matrices have sizes known at runtime, so that the reference
+// routines do not use the unrolled kernels.
+template <int m, int n, class matrix_t>
+void check_unrolled_kernels()
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t k = min(m, n);
+    const real_t tol = real_t(10 * max(m, n)) * ulp<real_t>();
+
+    std::vector<T> A_, B_, C_;
+    auto A = new_matrix(A_, m, n);
+    auto B = new_matrix(B_, m, n);
+    auto C = new_matrix(C_, m, n);
+    mm.random(A);
+
+    // Returns norm(B - C) / norm(A)
+    auto relative_difference = [&]() {
+        for (idx_t j = 0; j < (idx_t)n; ++j)
+            for (idx_t i = 0; i < (idx_t)m; ++i)
+                C(i, j) -= B(i, j);
+        return lange(MAX_NORM, C) / lange(MAX_NORM, A);
+    };
+
+    INFO("m = " << m << " n = " << n);
+
+    // potf2
+    if constexpr (m == n) {
+        for (const Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+            lacpy(GENERAL, A, B);
+            for (idx_t j = 0; j < (idx_t)n; ++j)
+                B(j, j) = real_t(n);
+            lacpy(GENERAL, B, C);
+
+            CHECK(internal::potf2_unrolled<n>(uplo, C) == 0);
+            potf2(uplo, B);
+            CHECK(relative_difference() <= tol);
+        }
+    }
+
+    // getrf_level0, including a matrix with a zero column
+    for (const bool singular : {false, true}) {
+        lacpy(GENERAL, A, B);
+        if (singular)
+            for (idx_t i = 0; i < (idx_t)m; ++i)
+                B(i, k - 1) = T(0);
+        lacpy(GENERAL, B, C);
+
+        std::vector<idx_t> pivB(k), pivC(k);
+        const int infoC = internal::getrf_level0_unrolled<m, n>(C, pivC);
+        CHECK(infoC == getrf_level0(B, pivB));
+        CHECK(infoC == (singular ? int(k) : 0));
+        CHECK(pivB == pivC);
+        CHECK(relative_difference() <= tol);
+    }
+
+    // geqr2
+    {
+        lacpy(GENERAL, A, B);
+        lacpy(GENERAL, A, C);
+
+        std::vector<T> tauB(k), tauC(k);
+        CHECK(internal::geqr2_unrolled<m, n>(C, tauC));
+        geqr2(B, tauB);
+        for (idx_t i = 0; i < k; ++i)
+            CHECK(abs1(tauB[i] - tauC[i]) <= tol);
+        CHECK(relative_difference() <= tol);
+
+        // A column that needs rescaling leaves A untouched
+        lacpy(GENERAL, A, C);
+        for (idx_t i = 0; i < (idx_t)m; ++i)
+            C(i, 0) *= safe_min<real_t>();
+        lacpy(GENERAL, C, B);
+        if (!internal::geqr2_unrolled<m, n>(C, tauC))
+            CHECK(relative_difference() == real_t(0));
+    }
+}
+
+TEMPLATE_TEST_CASE("Unrolled kernels match the reference routines",
+                   "[potf2][getrf][geqr2]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+
+    check_unrolled_kernels<1, 1, matrix_t>();
+    check_unrolled_kernels<2, 2, matrix_t>();
+    check_unrolled_kernels<3, 3, matrix_t>();
+    check_unrolled_kernels<4, 4, matrix_t>();
+    check_unrolled_kernels<5, 3, matrix_t>();
+    check_unrolled_kernels<3, 5, matrix_t>();
+}
+
+TEST_CASE("Matrices with sizes known at runtime have no static size",
+          "[potf2][getrf][geqr2]")
+{
+    CHECK(static_nrows<LegacyMatrix<float>> == -1);
+    CHECK(static_ncols<LegacyMatrix<float>> == -1);
+    CHECK(!has_static_size<LegacyMatrix<double>>);
+    CHECK(!internal::use_unrolled_kernel<LegacyMatrix<double>>);
+}
@@ -0,0 +1,125 @@
+/// @file test_workspace_arena.cpp
+/// @brief Test the thread-local workspace arena
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+
+// Other routines
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/gesvd.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/getri.hpp>
+
+using namespace tlapack;
+
+TEST_CASE("WorkspaceArena reuses its memory", "[workspace]")
+{
+    WorkspaceArena arena;
+    const std::size_t a = WorkspaceArena::alignment;
+
+    // Allocations are aligned and released in any order
+    void* p1 = arena.allocate(10);
+    void* p2 = arena.allocate(3 * a);
+    CHECK(reinterpret_cast<std::uintptr_t>(p1) % a == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(p2) % a == 0);
+    CHECK(arena.bytes_served() == 10 + 3 * a);
+    CHECK(arena.heap_allocations() == 1);
+    arena.deallocate(p1, 10);
+    arena.deallocate(p2, 3 * a);
+
+    // Last in, first out
+    p1 = arena.allocate(a);
+    p2 = arena.allocate(a);
+    arena.deallocate(p2, a);
+    CHECK(arena.allocate(a) == p2);
+    arena.deallocate(p2, a);
+    arena.deallocate(p1, a);
+
+    // Growth: the chunks are merged once the arena is empty
+    arena.reset_counters();
+    const std::size_t cap = arena.capacity();
+    p1 = arena.allocate(cap);
+    p2 = arena.allocate(cap);
+    CHECK(arena.heap_allocations() == 1);
+    arena.deallocate(p1, cap);
+    arena.deallocate(p2, cap);
+    CHECK(arena.heap_allocations() == 2);
+    CHECK(arena.capacity() >= 2 * cap);
+
+    arena.reset_counters();
+    p1 = arena.allocate(cap);
+    p2 = arena.allocate(cap);
+    arena.deallocate(p2, cap);
+    arena.deallocate(p1, cap);
+    CHECK(arena.heap_allocations() == 0);
+
+    // Reserve and release
+    arena.release();
+    CHECK(arena.capacity() == 0);
+    arena.reserve<double>(WorkInfo(100, 10));
+    CHECK(arena.capacity() >= 1000 * sizeof(double));
+}
+
+TEST_CASE("Repeated calls do not allocate from the heap", "[workspace]")
+{
+#ifndef TLAPACK_USE_WORKSPACE_ARENA
+    SKIP_TEST;
+#else
+    using matrix_t = LegacyMatrix<double>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = 50;
+    std::vector<double> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<double> B_;
+    auto B = new_matrix(B_, n, n);
+    std::vector<double> U_;
+    auto U = new_matrix(U_, n, n);
+    std::vector<double> Vt_;
+    auto Vt = new_matrix(Vt_, n, n);
+    std::vector<double> tau(n), s(n);
+    std::vector<idx_t> piv(n);
+    mm.random(A);
+    for (idx_t i = 0; i < n; ++i)
+        A(i, i) += double(n);
+
+    auto solve = [&]() {
+        lacpy(GENERAL, A, B);
+        geqrf(B, tau);
+
+        lacpy(GENERAL, A, B);
+        gehrd(0, n, B, tau);
+
+        lacpy(GENERAL, A, B);
+        getrf(B, piv);
+        getri(B, piv);
+
+        lacpy(GENERAL, A, B);
+        gesvd(true, true, B, s, U, Vt);
+    };
+
+    WorkspaceArena& arena = workspace_arena();
+    solve();
+
+    arena.reset_counters();
+    solve();
+    CHECK(arena.bytes_served() > 0);
+    CHECK(arena.heap_allocations() == 0);
+#endif
+}